@@ -0,0 +1,155 @@
+#include <trlevel/CacheFormat.h>
+
+using namespace trlevel;
+
+namespace
+{
+    const std::string Hash = "0123456789ABCDEF";
+
+    tr3_room create_room()
+    {
+        tr3_room room;
+        room.info = { .x = 1024, .z = 2048, .yBottom = 0, .yTop = -512 };
+        room.data.vertices = { { .vertex = { 1, 2, 3 }, .lighting = 4 }, { .vertex = { 5, 6, 7 }, .attributes = 8 } };
+        room.data.rectangles = { { .vertices = { 0, 1, 1, 0 }, .texture = 9 } };
+        room.portals = { { .adjoining_room = 3 } };
+        room.num_x_sectors = 1;
+        room.num_z_sectors = 2;
+        room.sector_list = { { .floordata_index = 10 }, { .floordata_index = 11 } };
+        room.static_meshes = { { .rotation = 16384, .mesh_id = 12 } };
+        room.alternate_room = 5;
+        room.alternate_group = 2;
+        return room;
+    }
+}
+
+TEST(CacheFormat, ValuesReadBackInOrder)
+{
+    const std::vector<int16_t> numbers{ 1, 2, 3 };
+    const std::vector<std::vector<int16_t>> nested{ { 4 }, {}, { 5, 6 } };
+    const std::unordered_map<uint32_t, tr_staticmesh> map{ { 7, { .ID = 7, .Mesh = 8 } }, { 9, { .ID = 9, .Mesh = 10 } } };
+
+    CacheWriter writer(Hash);
+    writer(uint32_t(42), numbers, std::string("name"), nested, map, create_room());
+    const auto data = writer.finish();
+
+    uint32_t value = 0;
+    std::vector<int16_t> read_numbers;
+    std::string name;
+    std::vector<std::vector<int16_t>> read_nested;
+    std::unordered_map<uint32_t, tr_staticmesh> read_map;
+    tr3_room room;
+
+    CacheReader reader(data, Hash);
+    reader(value, read_numbers, name, read_nested, read_map, room);
+
+    ASSERT_EQ(value, 42u);
+    ASSERT_EQ(read_numbers, numbers);
+    ASSERT_EQ(name, "name");
+    ASSERT_EQ(read_nested, nested);
+    ASSERT_EQ(read_map.size(), 2u);
+    ASSERT_EQ(read_map[9].Mesh, 10);
+
+    const auto expected = create_room();
+    ASSERT_EQ(room.info.z, expected.info.z);
+    ASSERT_EQ(room.data.vertices.size(), 2u);
+    ASSERT_EQ(room.data.vertices[1].vertex.z, 7);
+    ASSERT_EQ(room.data.vertices[1].attributes, 8);
+    ASSERT_EQ(room.data.rectangles[0].texture, 9);
+    ASSERT_EQ(room.portals[0].adjoining_room, 3);
+    ASSERT_EQ(room.num_z_sectors, 2);
+    ASSERT_EQ(room.sector_list[1].floordata_index, 11);
+    ASSERT_EQ(room.static_meshes[0].mesh_id, 12);
+    ASSERT_EQ(room.alternate_room, 5);
+    ASSERT_EQ(room.alternate_group, 2);
+}
+
+TEST(CacheFormat, ArraysCanBeViewedInPlace)
+{
+    const std::vector<uint32_t> values{ 1, 2, 3, 4 };
+
+    CacheWriter writer(Hash);
+    writer(uint8_t(1), values);
+    const auto data = writer.finish();
+
+    CacheReader reader(data, Hash);
+    uint8_t prefix = 0;
+    reader.read(prefix);
+    const auto span = reader.read_span<uint32_t>();
+
+    ASSERT_EQ(span.size(), 4u);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(span.data()) % 16, 0u);
+    ASSERT_GE(reinterpret_cast<const uint8_t*>(span.data()), data.data());
+    ASSERT_LT(reinterpret_cast<const uint8_t*>(span.data()), data.data() + data.size());
+    ASSERT_EQ(span[3], 4u);
+}
+
+TEST(CacheFormat, OtherVersionRejected)
+{
+    CacheWriter writer(Hash);
+    auto data = writer.finish();
+
+    const uint32_t version = LevelCacheVersion + 1;
+    std::memcpy(&data[4], &version, sizeof(version));
+    ASSERT_THROW(CacheReader(data, Hash), std::exception);
+}
+
+TEST(CacheFormat, OtherHashRejected)
+{
+    CacheWriter writer(Hash);
+    const auto data = writer.finish();
+    ASSERT_THROW(CacheReader(data, "FEDCBA9876543210"), std::exception);
+}
+
+TEST(CacheFormat, TruncatedEntryRejected)
+{
+    CacheWriter writer(Hash);
+    writer(std::vector<uint32_t>(100, 1u));
+    const auto data = writer.finish();
+
+    std::vector<uint8_t> truncated(data.begin(), data.begin() + data.size() / 2);
+    ASSERT_THROW(CacheReader(truncated, Hash), std::exception);
+
+    // Even with a matching size in the header, reading past the end throws.
+    const uint64_t size = truncated.size();
+    std::memcpy(&truncated[8], &size, sizeof(size));
+    CacheReader reader(truncated, Hash);
+    std::vector<uint32_t> values;
+    ASSERT_THROW(reader.read(values), std::exception);
+}
+
+TEST(CacheFormat, PaddingWrittenAsZeros)
+{
+    struct Padded
+    {
+        uint8_t small;
+        uint32_t large;
+    };
+    static_assert(sizeof(Padded) > sizeof(uint8_t) + sizeof(uint32_t));
+
+    // The same values with different bytes in the padding should give the same entry.
+    const auto write = [](uint8_t fill)
+        {
+            std::vector<Padded> values(2);
+            std::memset(values.data(), fill, values.size() * sizeof(Padded));
+            values[0].small = 1;
+            values[0].large = 2;
+            values[1].small = 3;
+            values[1].large = 4;
+
+            CacheWriter writer(Hash);
+            writer(values[0], values);
+            return writer.finish();
+        };
+
+    const auto data = write(0xAA);
+    ASSERT_EQ(data, write(0x55));
+
+    CacheReader reader(data, Hash);
+    Padded value{};
+    std::vector<Padded> values;
+    reader(value, values);
+    ASSERT_EQ(value.large, 2u);
+    ASSERT_EQ(values[1].small, 3u);
+    ASSERT_EQ(values[1].large, 4u);
+}
@@ -0,0 +1,39 @@
+#include <trlevel/Deferred.h>
+
+using namespace trlevel;
+
+TEST(Deferred, NothingDeferred)
+{
+    Deferred deferred;
+    deferred.run();
+}
+
+TEST(Deferred, WorkRunOnce)
+{
+    int count = 0;
+    Deferred deferred;
+    deferred.defer([&]() { ++count; });
+    ASSERT_EQ(count, 0);
+
+    deferred.run();
+    deferred.run();
+    ASSERT_EQ(count, 1);
+}
+
+TEST(Deferred, WorkRetriedAfterFailure)
+{
+    int count = 0;
+    Deferred deferred;
+    deferred.defer([&]()
+        {
+            if (++count == 1)
+            {
+                throw std::exception("Failed");
+            }
+        });
+
+    ASSERT_THROW(deferred.run(), std::exception);
+    deferred.run();
+    deferred.run();
+    ASSERT_EQ(count, 2);
+}
@@ -0,0 +1,58 @@
+#include <trlevel/Hasher.h>
+#include <random>
+#include <string_view>
+
+using namespace trlevel;
+
+namespace
+{
+    std::span<const uint8_t> as_bytes(std::string_view value)
+    {
+        return { reinterpret_cast<const uint8_t*>(value.data()), value.size() };
+    }
+}
+
+TEST(Hasher, KnownVectors)
+{
+    Hasher hasher(Hasher::Implementation::Software);
+    ASSERT_EQ(hasher.hash({}), "E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B7852B855");
+    ASSERT_EQ(hasher.hash(as_bytes("abc")), "BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD");
+    ASSERT_EQ(hasher.hash(as_bytes("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")), "248D6A61D20638B8E5C026930C3E6039A33CE45964FF2167F6ECEDD419DB06C1");
+}
+
+TEST(Hasher, MillionCharacters)
+{
+    const std::vector<uint8_t> data(1000000, 'a');
+    Hasher hasher;
+    ASSERT_EQ(hasher.hash(data), "CDC76E5C9914FB9281A1C7E284D73E67F1809A48A497200E046D39CCC7112CD0");
+}
+
+TEST(Hasher, UnsupportedImplementationFallsBackToSoftware)
+{
+    for (const auto implementation : { Hasher::Implementation::Intel, Hasher::Implementation::Arm })
+    {
+        Hasher hasher(implementation);
+        ASSERT_EQ(hasher.implementation(), is_supported(implementation) ? implementation : Hasher::Implementation::Software);
+    }
+}
+
+TEST(Hasher, AcceleratedMatchesSoftware)
+{
+    const auto best = best_hasher_implementation();
+    if (best == Hasher::Implementation::Software)
+    {
+        GTEST_SKIP() << "No accelerated SHA-256 on this processor";
+    }
+
+    Hasher software(Hasher::Implementation::Software);
+    Hasher accelerated(best);
+
+    // Cover every padding case around the block boundaries.
+    std::mt19937 random(1);
+    for (std::size_t size = 0; size < 300; ++size)
+    {
+        std::vector<uint8_t> data(size);
+        std::ranges::generate(data, [&]() { return static_cast<uint8_t>(random()); });
+        ASSERT_EQ(accelerated.hash(data), software.hash(data)) << "Size " << size;
+    }
+}
@@ -0,0 +1,112 @@
+#include <trlevel/LevelProbe.h>
+#include <trlevel/trtypes.h>
+
+using namespace trlevel;
+
+namespace
+{
+    class Builder final
+    {
+    public:
+        Builder& u32(uint32_t value)
+        {
+            const auto bytes = std::bit_cast<std::array<uint8_t, 4>>(value);
+            _data.insert(_data.end(), bytes.begin(), bytes.end());
+            return *this;
+        }
+
+        Builder& bytes(std::size_t count)
+        {
+            _data.resize(_data.size() + count);
+            return *this;
+        }
+
+        /// Pad with zeroes up to the offset and then add the value.
+        Builder& at(std::size_t offset, uint32_t value)
+        {
+            _data.resize(offset);
+            return u32(value);
+        }
+
+        std::vector<uint8_t> build() const
+        {
+            return _data;
+        }
+    private:
+        std::vector<uint8_t> _data;
+    };
+}
+
+TEST(LevelProbe, VersionAtStart)
+{
+    const auto version = probe_level_version(Builder().u32(0x54).bytes(64).build());
+    ASSERT_EQ(version.platform, Platform::PC);
+    ASSERT_EQ(version.version, LevelVersion::Tomb4);
+    ASSERT_EQ(version.raw_version, 0x54);
+}
+
+TEST(LevelProbe, Tr2PsxAfterSounds)
+{
+    const auto version = probe_level_version(Builder().u32(2).u32(0).u32(0).u32(3).bytes(3).u32(45).build());
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_EQ(version.version, LevelVersion::Tomb2);
+    ASSERT_EQ(version.raw_version, 45);
+}
+
+TEST(LevelProbe, Tr1PsxAfterTextiles)
+{
+    const auto version = probe_level_version(Builder().at(sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024, 27).build());
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+    ASSERT_EQ(version.raw_version, 27);
+}
+
+TEST(LevelProbe, Tr1PsxDemoMarked)
+{
+    const auto version = probe_level_version(Builder().at(sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024, 32).build());
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+    ASSERT_TRUE(version.extra.contains("handydemo"));
+    ASSERT_TRUE(is_tr1_version_32_demo(version));
+}
+
+TEST(LevelProbe, Tr4PsxAtAnyKnownOffset)
+{
+    for (const auto offset : { 0x6000, 0x7000, 0x7800 })
+    {
+        const auto version = probe_level_version(Builder().u32(1).at(offset, static_cast<uint32_t>(-124)).build());
+        ASSERT_EQ(version.platform, Platform::PSX);
+        ASSERT_EQ(version.version, LevelVersion::Tomb4);
+        ASSERT_EQ(version.raw_version, -124);
+    }
+}
+
+TEST(LevelProbe, Tr5Psx)
+{
+    const auto version = probe_level_version(Builder().u32(1).at(313344, static_cast<uint32_t>(-224)).build());
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_EQ(version.version, LevelVersion::Tomb5);
+    ASSERT_EQ(version.raw_version, -224);
+}
+
+TEST(LevelProbe, SaturnRoomFile)
+{
+    std::vector<uint8_t> data{ 'R', 'O', 'O', 'M', 'F', 'I', 'L', 'E', 0, 0, 0, 0, 0, 0, 0, 0x20 };
+    const auto version = probe_level_version(data);
+    ASSERT_EQ(version.platform, Platform::Saturn);
+    ASSERT_EQ(version.version, LevelVersion::Tomb1);
+    ASSERT_EQ(version.raw_version, 0x20);
+}
+
+TEST(LevelProbe, CountsPastEndIgnored)
+{
+    const auto version = probe_level_version(Builder().u32(0).u32(0xffffffff).bytes(8).build());
+    ASSERT_EQ(version.platform, Platform::PSX);
+    ASSERT_TRUE(version.is_pack);
+}
+
+TEST(LevelProbe, TooShortIsUnknown)
+{
+    const auto version = probe_level_version(std::vector<uint8_t>{ 0x54, 0 });
+    ASSERT_EQ(version.platform, Platform::Unknown);
+    ASSERT_EQ(version.version, LevelVersion::Unknown);
+}
@@ -0,0 +1,223 @@
+#include <trlevel/Level.h>
+#include <trlevel/CacheFormat.h>
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trlevel/Mocks/ILevelCache.h>
+#include <trview.common/Mocks/IFiles.h>
+#include <trview.common/Mocks/Logs/ILog.h>
+#include <trview.common/Resources.h>
+#include "resource.h"
+
+using namespace trlevel;
+using namespace trlevel::mocks;
+using namespace trview::mocks;
+using namespace testing;
+
+namespace
+{
+    std::vector<uint8_t> get_resource(int id)
+    {
+        auto resource = trview::get_resource_memory(id, L"FILE");
+        return std::vector<uint8_t>(resource.data, resource.data + resource.size);
+    }
+
+    std::shared_ptr<Level> create_level(const std::shared_ptr<ILevelCache>& cache)
+    {
+        auto files = std::make_shared<NiceMock<MockFiles>>();
+        ON_CALL(*files, load_file(An<const std::string&>())).WillByDefault(Return(std::nullopt));
+        ON_CALL(*files, load_file(std::string("lake.trc"))).WillByDefault(Return(get_resource(IDR_ORIGINAL_LAKE)));
+        return std::make_shared<Level>("lake.trc", nullptr, files, std::make_shared<Decrypter>(), std::make_shared<NiceMock<MockLog>>(), std::make_shared<Hasher>(), cache);
+    }
+
+    std::unique_ptr<ILevelCache::Entry> create_entry(const std::vector<uint8_t>& data)
+    {
+        auto entry = std::make_unique<NiceMock<MockLevelCacheEntry>>();
+        ON_CALL(*entry, data).WillByDefault(Return(std::span<const uint8_t>(data)));
+        return entry;
+    }
+
+    struct Loaded
+    {
+        std::vector<std::vector<uint32_t>> textiles;
+        std::vector<std::tuple<uint16_t, uint16_t, uint16_t, std::vector<uint8_t>>> sounds;
+    };
+
+    Loaded load(Level& level, bool use_cache, ILevel::LoadCallbacks::OpenMode open_mode = ILevel::LoadCallbacks::OpenMode::Full)
+    {
+        Loaded loaded;
+        level.load(
+            {
+                .on_textile_callback = [&](auto&& data, auto&&, auto&&) { loaded.textiles.push_back(data); },
+                .on_sound_callback = [&](auto&& sound_map, auto&& sound_details, auto&& sample_index, auto&& sample)
+                    {
+                        const auto bytes = sample.bytes();
+                        loaded.sounds.emplace_back(sound_map, sound_details, sample_index, std::vector<uint8_t>(bytes.begin(), bytes.end()));
+                    },
+                .open_mode = open_mode,
+                .use_cache = use_cache
+            });
+        return loaded;
+    }
+}
+
+TEST(Level, CacheNotUsedUnlessRequested)
+{
+    auto cache = std::make_shared<NiceMock<MockLevelCache>>();
+    EXPECT_CALL(*cache, open).Times(0);
+    EXPECT_CALL(*cache, save).Times(0);
+
+    auto level = create_level(cache);
+    load(*level, false);
+    ASSERT_NE(level->num_rooms(), 0u);
+}
+
+TEST(Level, CachedLevelMatchesParsedLevel)
+{
+    auto cache = std::make_shared<NiceMock<MockLevelCache>>();
+    std::vector<uint8_t> entry;
+    EXPECT_CALL(*cache, save).WillOnce(SaveArg<1>(&entry));
+    EXPECT_CALL(*cache, open)
+        .WillOnce(Return(ByMove(std::unique_ptr<ILevelCache::Entry>())))
+        .WillOnce([&](auto&&) { return create_entry(entry); });
+    EXPECT_CALL(*cache, remove).Times(0);
+
+    auto parsed = create_level(cache);
+    const auto parsed_data = load(*parsed, true);
+    ASSERT_FALSE(entry.empty());
+
+    auto cached = create_level(cache);
+    const auto cached_data = load(*cached, true);
+
+    ASSERT_EQ(cached->hash(), parsed->hash());
+    ASSERT_EQ(cached_data.textiles, parsed_data.textiles);
+    ASSERT_EQ(cached_data.sounds, parsed_data.sounds);
+    ASSERT_EQ(cached->get_floor_data_all(), parsed->get_floor_data_all());
+    ASSERT_EQ(cached->object_textures().size(), parsed->object_textures().size());
+    ASSERT_EQ(cached->num_models(), parsed->num_models());
+    ASSERT_EQ(cached->animations().size(), parsed->animations().size());
+
+    ASSERT_EQ(cached->num_rooms(), parsed->num_rooms());
+    for (uint32_t i = 0; i < parsed->num_rooms(); ++i)
+    {
+        const auto cached_room = cached->get_room(i);
+        const auto parsed_room = parsed->get_room(i);
+        ASSERT_EQ(cached_room.info.x, parsed_room.info.x);
+        ASSERT_EQ(cached_room.data.vertices.size(), parsed_room.data.vertices.size());
+        ASSERT_EQ(cached_room.sector_list.size(), parsed_room.sector_list.size());
+        ASSERT_EQ(cached_room.lights.size(), parsed_room.lights.size());
+        ASSERT_EQ(cached_room.alternate_room, parsed_room.alternate_room);
+    }
+
+    ASSERT_EQ(cached->num_entities(), parsed->num_entities());
+    for (uint32_t i = 0; i < parsed->num_entities(); ++i)
+    {
+        ASSERT_EQ(cached->get_entity(i).TypeID, parsed->get_entity(i).TypeID);
+        ASSERT_EQ(cached->get_entity(i).x, parsed->get_entity(i).x);
+    }
+
+    ASSERT_EQ(cached->num_mesh_pointers(), parsed->num_mesh_pointers());
+    for (uint32_t i = 0; i < parsed->num_mesh_pointers(); ++i)
+    {
+        const auto cached_mesh = cached->get_mesh_by_pointer(i);
+        const auto parsed_mesh = parsed->get_mesh_by_pointer(i);
+        ASSERT_EQ(cached_mesh.vertices.size(), parsed_mesh.vertices.size());
+        ASSERT_EQ(cached_mesh.textured_rectangles.size(), parsed_mesh.textured_rectangles.size());
+    }
+}
+
+TEST(Level, OutdatedCacheEntryReplaced)
+{
+    const auto hash = Hasher().hash(get_resource(IDR_ORIGINAL_LAKE));
+    CacheWriter writer(hash);
+    auto outdated = writer.finish();
+    const uint32_t version = LevelCacheVersion - 1;
+    std::memcpy(&outdated[4], &version, sizeof(version));
+
+    auto cache = std::make_shared<NiceMock<MockLevelCache>>();
+    EXPECT_CALL(*cache, open(hash)).WillOnce([&](auto&&) { return create_entry(outdated); });
+    EXPECT_CALL(*cache, remove(hash)).Times(1);
+    EXPECT_CALL(*cache, save(hash, _)).Times(1);
+
+    auto level = create_level(cache);
+    const auto loaded = load(*level, true);
+    ASSERT_NE(level->num_rooms(), 0u);
+    ASSERT_FALSE(loaded.textiles.empty());
+}
+
+TEST(Level, CacheEntryDiscardedWhenExternalFileChanged)
+{
+    // An entry for a level that read a MAIN.SFX which has since been removed.
+    const auto hash = Hasher().hash(get_resource(IDR_ORIGINAL_LAKE));
+    CacheWriter writer(hash);
+    writer(uint64_t(1), std::string("MAIN.SFX"), std::string("0123456789ABCDEF"), false);
+    const auto stale = writer.finish();
+
+    auto cache = std::make_shared<NiceMock<MockLevelCache>>();
+    EXPECT_CALL(*cache, open(hash)).WillOnce([&](auto&&) { return create_entry(stale); });
+    EXPECT_CALL(*cache, remove(hash)).Times(1);
+    EXPECT_CALL(*cache, save(hash, _)).Times(1);
+
+    auto level = create_level(cache);
+    const auto loaded = load(*level, true);
+    ASSERT_NE(level->num_rooms(), 0u);
+    ASSERT_FALSE(loaded.textiles.empty());
+}
+
+TEST(Level, LazyLevelMatchesFullLevel)
+{
+    auto full = create_level(nullptr);
+    const auto full_data = load(*full, false);
+
+    auto lazy = create_level(nullptr);
+    const auto lazy_data = load(*lazy, false, ILevel::LoadCallbacks::OpenMode::Lazy);
+
+    ASSERT_EQ(lazy_data.textiles, full_data.textiles);
+    ASSERT_EQ(lazy_data.sounds, full_data.sounds);
+    ASSERT_EQ(lazy->num_rooms(), full->num_rooms());
+
+    ASSERT_EQ(lazy->num_mesh_pointers(), full->num_mesh_pointers());
+    for (uint32_t i = 0; i < full->num_mesh_pointers(); ++i)
+    {
+        const auto lazy_mesh = lazy->get_mesh_by_pointer(i);
+        const auto full_mesh = full->get_mesh_by_pointer(i);
+        ASSERT_EQ(lazy_mesh.vertices.size(), full_mesh.vertices.size());
+        ASSERT_EQ(lazy_mesh.textured_rectangles.size(), full_mesh.textured_rectangles.size());
+        ASSERT_EQ(lazy_mesh.coloured_triangles.size(), full_mesh.coloured_triangles.size());
+    }
+
+    ASSERT_EQ(lazy->num_models(), full->num_models());
+    for (uint32_t i = 0; i < full->num_models(); ++i)
+    {
+        ASSERT_EQ(lazy->get_model_index(full->get_model(i).ID), full->get_model_index(full->get_model(i).ID));
+        const auto lazy_frame = lazy->get_model_frame(i);
+        const auto full_frame = full->get_model_frame(i);
+        ASSERT_EQ(lazy_frame.offsety, full_frame.offsety);
+        ASSERT_EQ(lazy_frame.values.size(), full_frame.values.size());
+        ASSERT_EQ(lazy->get_model_meshtree(i).size(), full->get_model_meshtree(i).size());
+    }
+}
+
+TEST(Level, LevelLoadsWithoutTextileCallback)
+{
+    auto full = create_level(nullptr);
+    load(*full, false);
+
+    auto level = create_level(nullptr);
+    level->load({ .open_mode = ILevel::LoadCallbacks::OpenMode::Lazy });
+
+    ASSERT_EQ(level->object_textures().size(), full->object_textures().size());
+    ASSERT_EQ(level->num_rooms(), full->num_rooms());
+    ASSERT_EQ(level->num_entities(), full->num_entities());
+    ASSERT_EQ(level->get_floor_data_all(), full->get_floor_data_all());
+}
+
+TEST(Level, LazyLevelNotCached)
+{
+    auto cache = std::make_shared<NiceMock<MockLevelCache>>();
+    EXPECT_CALL(*cache, save).Times(0);
+
+    auto level = create_level(cache);
+    load(*level, true, ILevel::LoadCallbacks::OpenMode::Lazy);
+    ASSERT_NE(level->num_mesh_pointers(), 0u);
+    ASSERT_NE(level->get_mesh_by_pointer(0).vertices.size(), 0u);
+}
@@ -0,0 +1,179 @@
+#include <trlevel/LevelWriter.h>
+#include <trlevel/Level.h>
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trview.common/Mocks/IFiles.h>
+#include <trview.common/Mocks/Logs/ILog.h>
+
+using namespace trlevel;
+using namespace trview::mocks;
+using namespace testing;
+
+namespace
+{
+    struct Loaded
+    {
+        std::shared_ptr<Level> level;
+        std::vector<std::vector<uint32_t>> textiles;
+    };
+
+    Loaded load(const std::vector<uint8_t>& bytes, const std::string& filename)
+    {
+        auto files = std::make_shared<NiceMock<MockFiles>>();
+        ON_CALL(*files, load_file(An<const std::string&>())).WillByDefault(Return(std::nullopt));
+        ON_CALL(*files, load_file(filename)).WillByDefault(Return(bytes));
+
+        Loaded loaded;
+        loaded.level = std::make_shared<Level>(filename, nullptr, files, std::make_shared<Decrypter>(), std::make_shared<NiceMock<MockLog>>(), std::make_shared<Hasher>(), nullptr);
+        loaded.level->load(
+            {
+                .on_textile_callback = [&](auto&& data, auto&&, auto&&) { loaded.textiles.push_back(data); },
+                .on_sound_callback = [](auto&&...) {}
+            });
+        return loaded;
+    }
+
+    /// Write the level as the version, load it back and check that it matches what was generated.
+    void check_round_trip(LevelVersion version, const std::string& filename, bool exact_textiles)
+    {
+        const auto content = generate_level({ .rooms = 3, .sectors = 3, .meshes = 2, .mesh_faces = 6, .entities = 2, .triggers = 5, .textiles = 2 });
+        const auto loaded = load(write_level(content, version), filename);
+        const auto& level = *loaded.level;
+
+        ASSERT_EQ(level.get_version(), version);
+
+        ASSERT_EQ(level.num_rooms(), content.rooms.size());
+        for (uint32_t r = 0; r < level.num_rooms(); ++r)
+        {
+            const auto room = level.get_room(r);
+            const auto& expected = content.rooms[r];
+            ASSERT_EQ(room.info.x, expected.info.x);
+            ASSERT_EQ(room.info.z, expected.info.z);
+            ASSERT_EQ(room.info.yTop, expected.info.yTop);
+            ASSERT_EQ(room.info.yBottom, expected.info.yBottom);
+            ASSERT_EQ(room.num_x_sectors, expected.num_x_sectors);
+            ASSERT_EQ(room.num_z_sectors, expected.num_z_sectors);
+            ASSERT_EQ(room.sector_list.size(), expected.sector_list.size());
+            for (std::size_t s = 0; s < expected.sector_list.size(); ++s)
+            {
+                ASSERT_EQ(room.sector_list[s].floordata_index, expected.sector_list[s].floordata_index);
+                ASSERT_EQ(room.sector_list[s].ceiling, expected.sector_list[s].ceiling);
+            }
+            ASSERT_EQ(room.data.vertices.size(), expected.data.vertices.size());
+            for (std::size_t v = 0; v < expected.data.vertices.size(); ++v)
+            {
+                ASSERT_EQ(room.data.vertices[v].vertex.x, expected.data.vertices[v].vertex.x);
+                ASSERT_EQ(room.data.vertices[v].vertex.y, expected.data.vertices[v].vertex.y);
+                ASSERT_EQ(room.data.vertices[v].vertex.z, expected.data.vertices[v].vertex.z);
+            }
+            ASSERT_EQ(room.data.rectangles.size(), expected.data.rectangles.size());
+            for (std::size_t f = 0; f < expected.data.rectangles.size(); ++f)
+            {
+                ASSERT_TRUE(std::ranges::equal(room.data.rectangles[f].vertices, expected.data.rectangles[f].vertices));
+                ASSERT_EQ(room.data.rectangles[f].texture, expected.data.rectangles[f].texture);
+            }
+        }
+
+        ASSERT_EQ(level.get_floor_data_all(), content.floor_data);
+
+        ASSERT_EQ(level.num_entities(), content.entities.size());
+        for (uint32_t e = 0; e < level.num_entities(); ++e)
+        {
+            const auto entity = level.get_entity(e);
+            ASSERT_EQ(entity.TypeID, content.entities[e].TypeID);
+            ASSERT_EQ(entity.Room, content.entities[e].Room);
+            ASSERT_EQ(entity.x, content.entities[e].x);
+            ASSERT_EQ(entity.z, content.entities[e].z);
+            ASSERT_EQ(entity.Flags, content.entities[e].Flags);
+        }
+
+        ASSERT_EQ(level.num_mesh_pointers(), content.meshes.size());
+        for (uint32_t m = 0; m < level.num_mesh_pointers(); ++m)
+        {
+            const auto mesh = level.get_mesh_by_pointer(m);
+            ASSERT_EQ(mesh.vertices.size(), content.meshes[m].vertices.size());
+            for (std::size_t v = 0; v < mesh.vertices.size(); ++v)
+            {
+                ASSERT_EQ(mesh.vertices[v].x, content.meshes[m].vertices[v].x);
+                ASSERT_EQ(mesh.vertices[v].y, content.meshes[m].vertices[v].y);
+                ASSERT_EQ(mesh.vertices[v].z, content.meshes[m].vertices[v].z);
+            }
+            ASSERT_EQ(mesh.textured_rectangles.size(), content.meshes[m].textured_rectangles.size());
+        }
+
+        ASSERT_EQ(level.num_models(), content.models.size());
+        for (uint32_t m = 0; m < level.num_models(); ++m)
+        {
+            ASSERT_EQ(level.get_model(m).ID, content.models[m].ID);
+            ASSERT_EQ(level.get_model(m).StartingMesh, content.models[m].StartingMesh);
+        }
+
+        ASSERT_EQ(level.object_textures().size(), content.object_textures.size());
+
+        // TR4 and TR5 levels have two extra textiles for the font and sky.
+        const std::size_t extra_textiles = version >= LevelVersion::Tomb4 ? 2 : 0;
+        ASSERT_EQ(loaded.textiles.size(), content.textiles.size() + extra_textiles);
+        if (exact_textiles)
+        {
+            for (std::size_t t = 0; t < content.textiles.size(); ++t)
+            {
+                ASSERT_EQ(loaded.textiles[t], content.textiles[t]);
+            }
+        }
+    }
+}
+
+TEST(LevelWriter, Tomb1RoundTrip)
+{
+    check_round_trip(LevelVersion::Tomb1, "synthetic.phd", true);
+}
+
+TEST(LevelWriter, Tomb2RoundTrip)
+{
+    check_round_trip(LevelVersion::Tomb2, "synthetic.tr2", false);
+}
+
+TEST(LevelWriter, Tomb3RoundTrip)
+{
+    check_round_trip(LevelVersion::Tomb3, "synthetic.tr2", false);
+}
+
+TEST(LevelWriter, Tomb4RoundTrip)
+{
+    check_round_trip(LevelVersion::Tomb4, "synthetic.tr4", true);
+}
+
+TEST(LevelWriter, Tomb5RoundTrip)
+{
+    check_round_trip(LevelVersion::Tomb5, "synthetic.trc", true);
+}
+
+TEST(LevelWriter, TriggersNeedEntities)
+{
+    const auto content = generate_level({ .entities = 0, .triggers = 4 });
+    ASSERT_EQ(content.floor_data, std::vector<uint16_t>{ 0 });
+}
+
+TEST(LevelWriter, TooManyColoursForPalette)
+{
+    LevelContent content;
+    content.textiles.emplace_back(256 * 256);
+    for (uint32_t p = 0; p < 256; ++p)
+    {
+        content.textiles[0][p] = 0xff000000 | (p >> 6) << 10 | (p & 0x3f) << 2;
+    }
+    ASSERT_THROW(write_level(content, LevelVersion::Tomb1), std::exception);
+    ASSERT_NO_THROW(write_level(content, LevelVersion::Tomb4));
+}
+
+TEST(LevelWriter, TextileSizeChecked)
+{
+    LevelContent content;
+    content.textiles.emplace_back(16);
+    ASSERT_THROW(write_level(content, LevelVersion::Tomb4), std::exception);
+}
+
+TEST(LevelWriter, UnknownVersionThrows)
+{
+    ASSERT_THROW(write_level(generate_level({}), LevelVersion::Unknown), std::exception);
+}
@@ -0,0 +1,123 @@
+#include <trlevel/MeshArena.h>
+#include <trlevel/CacheFormat.h>
+
+using namespace trlevel;
+
+namespace
+{
+    struct TestMesh
+    {
+        int16_t seed;
+        std::size_t vertex_count;
+    };
+
+    void build_mesh(MeshArena::Builder& builder, const TestMesh& mesh)
+    {
+        builder.centre({ mesh.seed, mesh.seed, mesh.seed }, mesh.seed * 10);
+        for (std::size_t i = 0; i < mesh.vertex_count; ++i)
+        {
+            builder.vertex({ static_cast<int16_t>(mesh.seed + i), 0, 0 });
+        }
+        builder.textured_rectangle({ .vertices = { 0, 1, 2, 3 }, .texture = static_cast<uint16_t>(mesh.seed), .effects = 0 });
+        builder.coloured_triangle({ .vertices = { 0, 1, 2 }, .texture = static_cast<uint16_t>(mesh.seed + 1) });
+    }
+
+    /// Add the meshes the way a level does - count them all, allocate, then write them.
+    void add_meshes(MeshArena& arena, const std::vector<TestMesh>& meshes)
+    {
+        std::vector<MeshArena::Builder> counted(meshes.size());
+        for (std::size_t i = 0; i < meshes.size(); ++i)
+        {
+            build_mesh(counted[i], meshes[i]);
+        }
+
+        const uint32_t first = arena.allocate(counted);
+        for (std::size_t i = 0; i < meshes.size(); ++i)
+        {
+            auto builder = arena.builder(first + static_cast<uint32_t>(i));
+            build_mesh(builder, meshes[i]);
+        }
+    }
+}
+
+TEST(MeshArena, MeshesAreViewsOfTheirOwnRanges)
+{
+    const std::vector<TestMesh> meshes{ { 1, 4 }, { 20, 2 }, { 300, 0 } };
+
+    MeshArena arena;
+    add_meshes(arena, meshes);
+    ASSERT_EQ(arena.size(), 3u);
+
+    for (uint32_t i = 0; i < meshes.size(); ++i)
+    {
+        const auto view = arena.mesh(i);
+        ASSERT_EQ(view.centre.x, meshes[i].seed);
+        ASSERT_EQ(view.coll_radius, meshes[i].seed * 10);
+        ASSERT_EQ(view.vertices.size(), meshes[i].vertex_count);
+        for (std::size_t v = 0; v < view.vertices.size(); ++v)
+        {
+            ASSERT_EQ(view.vertices[v].x, static_cast<int16_t>(meshes[i].seed + v));
+        }
+        ASSERT_EQ(view.textured_rectangles.size(), 1u);
+        ASSERT_EQ(view.textured_rectangles[0].texture, meshes[i].seed);
+        ASSERT_EQ(view.coloured_triangles.size(), 1u);
+        ASSERT_EQ(view.coloured_triangles[0].texture, meshes[i].seed + 1);
+        ASSERT_TRUE(view.normals.empty());
+        ASSERT_TRUE(view.lights.empty());
+    }
+}
+
+TEST(MeshArena, MissingMeshIsEmpty)
+{
+    MeshArena arena;
+    add_meshes(arena, { { 1, 4 } });
+
+    const auto view = arena.mesh(1);
+    ASSERT_TRUE(view.vertices.empty());
+    ASSERT_TRUE(view.textured_rectangles.empty());
+}
+
+TEST(MeshArena, TexturedFacesCanBeUpdatedInPlace)
+{
+    MeshArena arena;
+    add_meshes(arena, { { 1, 4 }, { 2, 4 } });
+
+    ASSERT_EQ(arena.textured_rectangles().size(), 2u);
+    for (auto& rectangle : arena.textured_rectangles())
+    {
+        rectangle.texture += 100;
+    }
+
+    ASSERT_EQ(arena.mesh(0).textured_rectangles[0].texture, 101);
+    ASSERT_EQ(arena.mesh(1).textured_rectangles[0].texture, 102);
+}
+
+TEST(MeshArena, ArenaReadFromCacheMatches)
+{
+    MeshArena arena;
+    add_meshes(arena, { { 1, 4 }, { 20, 2 } });
+
+    CacheWriter writer("hash");
+    writer(arena);
+    const auto data = writer.finish();
+
+    MeshArena cached;
+    CacheReader reader(data, "hash");
+    reader(cached);
+
+    ASSERT_EQ(cached.size(), 2u);
+    ASSERT_EQ(cached.mesh(1).coll_radius, 200);
+    ASSERT_EQ(cached.mesh(1).vertices.size(), 2u);
+    ASSERT_EQ(cached.mesh(1).vertices[1].x, 21);
+    ASSERT_EQ(cached.mesh(1).textured_rectangles[0].texture, 20);
+}
+
+TEST(MeshArena, BuilderThrowsWhenMeshHasMorePartsThanCounted)
+{
+    MeshArena arena;
+    add_meshes(arena, { { 1, 2 } });
+
+    auto builder = arena.builder(0);
+    build_mesh(builder, { 1, 2 });
+    ASSERT_THROW(builder.vertex({ 0, 0, 0 }), std::runtime_error);
+}
@@ -0,0 +1,62 @@
+#include <trlevel/ModelTables.h>
+
+using namespace trlevel;
+
+namespace
+{
+    tr2_frame create_frame(int16_t offset, std::size_t rotations)
+    {
+        tr2_frame frame;
+        frame.offsetx = offset;
+        frame.offsety = offset * 2;
+        frame.offsetz = offset * 3;
+        for (std::size_t i = 0; i < rotations; ++i)
+        {
+            frame.values.push_back({ .x = static_cast<float>(offset + i), .y = 0, .z = 0 });
+        }
+        return frame;
+    }
+}
+
+TEST(ModelTables, FramesAndMeshTreesStoredPerModel)
+{
+    ModelTables tables;
+    const std::vector<tr_meshtree_node> first_nodes{ { .Flags = 1, .Offset_X = 10 }, { .Flags = 2, .Offset_X = 20 } };
+    tables.add({ .ID = 5, .NumMeshes = 3 }, create_frame(1, 3), first_nodes);
+    tables.add({ .ID = 9, .NumMeshes = 1 }, create_frame(7, 1), {});
+
+    ASSERT_EQ(tables.size(), 2u);
+
+    const auto first_frame = tables.frame(0);
+    ASSERT_EQ(first_frame.offsety, 2);
+    ASSERT_EQ(first_frame.values.size(), 3u);
+    ASSERT_EQ(first_frame.values[2].x, 3.0f);
+    const auto first_tree = tables.meshtree(0);
+    ASSERT_EQ(first_tree.size(), 2u);
+    ASSERT_EQ(first_tree[1].Offset_X, 20);
+
+    const auto second_frame = tables.frame(1);
+    ASSERT_EQ(second_frame.offsetz, 21);
+    ASSERT_EQ(second_frame.values.size(), 1u);
+    ASSERT_EQ(second_frame.values[0].x, 7.0f);
+    ASSERT_TRUE(tables.meshtree(1).empty());
+}
+
+TEST(ModelTables, ModelsFoundById)
+{
+    ModelTables tables;
+    tables.add({ .ID = 5 }, {}, {});
+    tables.add({ .ID = 9 }, {}, {});
+    tables.add({ .ID = 5 }, {}, {});
+
+    ASSERT_EQ(tables.index_of(9), 1u);
+    ASSERT_EQ(tables.index_of(5), 0u);
+    ASSERT_EQ(tables.index_of(6), std::nullopt);
+}
+
+TEST(ModelTables, MissingModelIsEmpty)
+{
+    ModelTables tables;
+    ASSERT_TRUE(tables.frame(0).values.empty());
+    ASSERT_TRUE(tables.meshtree(0).empty());
+}
@@ -0,0 +1,64 @@
+#include <trlevel/Pack.h>
+
+using namespace trlevel;
+
+namespace
+{
+    struct PartData
+    {
+        uint32_t start;
+        std::vector<uint8_t> bytes;
+    };
+
+    std::shared_ptr<const std::vector<uint8_t>> create_pack(const std::vector<PartData>& parts)
+    {
+        std::vector<uint8_t> data(1024);
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            const uint32_t header[2]{ parts[i].start, static_cast<uint32_t>(parts[i].bytes.size()) };
+            std::memcpy(&data[8 + i * sizeof(header)], header, sizeof(header));
+            data.resize(std::max<std::size_t>(data.size(), parts[i].start + parts[i].bytes.size()));
+            std::ranges::copy(parts[i].bytes, data.begin() + parts[i].start);
+        }
+        return std::make_shared<const std::vector<uint8_t>>(data);
+    }
+}
+
+TEST(Pack, PartsViewPackData)
+{
+    const auto data = create_pack({ { 1024, { 0x54, 0, 0, 0, 1, 2 } }, { 2048, { 0xff, 0xff, 0xff, 0xff } } });
+    Pack pack(data);
+
+    const auto& parts = pack.parts();
+    ASSERT_EQ(parts.size(), 2u);
+    ASSERT_EQ(parts[0].start, 1024u);
+    ASSERT_EQ(parts[0].size, 6u);
+    ASSERT_EQ(parts[0].data.data(), data->data() + 1024);
+    ASSERT_EQ(parts[1].data.data(), data->data() + 2048);
+    ASSERT_EQ(pack_entry(pack, 1024), std::vector<uint8_t>({ 0x54, 0, 0, 0, 1, 2 }));
+    ASSERT_EQ(pack_entry(pack, 4096), std::nullopt);
+}
+
+TEST(Pack, LoadIdentifiesParts)
+{
+    Pack pack(create_pack({ { 1024, { 0x54, 0, 0, 0, 1, 2 } }, { 2048, { 0xff, 0xff, 0xff, 0xff } } }));
+    pack.set_filename("pack.bin");
+    pack.load();
+
+    const auto& parts = pack.parts();
+    ASSERT_TRUE(parts[0].version.has_value());
+    ASSERT_EQ(parts[0].version->platform, Platform::PC);
+    ASSERT_EQ(parts[0].version->version, LevelVersion::Tomb4);
+    ASSERT_FALSE(parts[1].version.has_value());
+
+    const auto levels = valid_pack_levels(pack);
+    ASSERT_EQ(levels.size(), 1u);
+    ASSERT_EQ(levels[0].path, "pack://pack.bin\\1024");
+}
+
+TEST(Pack, PartOutsidePackThrows)
+{
+    auto data = *create_pack({ { 1024, { 1, 2, 3, 4 } } });
+    data.resize(1026);
+    ASSERT_THROW(Pack(std::make_shared<const std::vector<uint8_t>>(data)), std::exception);
+}
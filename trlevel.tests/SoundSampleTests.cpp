@@ -0,0 +1,111 @@
+#include <trlevel/SoundSample.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+
+using namespace trlevel;
+
+namespace
+{
+    /// The original stream based vag2wav conversion, kept to check the output of the current decoder.
+    std::vector<uint8_t> reference_vag_to_wav(const std::vector<uint8_t>& bytes, uint32_t sample_frequency)
+    {
+        const auto load_sample = [](int value, int shift_factor)
+            {
+                if (value & 0x8000)
+                {
+                    value |= 0xffff0000;
+                }
+                return static_cast<double>(value >> shift_factor);
+            };
+
+        constexpr double f[5][2] = { { 0.0, 0.0 },{ 60.0 / 64.0,  0.0 }, {  115.0 / 64.0, -52.0 / 64.0 }, {   98.0 / 64.0, -55.0 / 64.0 }, {  122.0 / 64.0, -60.0 / 64.0 } };
+        double s_1 = 0.0;
+        double s_2 = 0.0;
+        double samples[28];
+
+        std::vector<uint8_t> results(44);
+        std::size_t position = 16;
+        while (position + 48 < bytes.size())
+        {
+            int predict_nr = static_cast<char>(bytes[position++]);
+            const int shift_factor = predict_nr & 0xf;
+            predict_nr >>= 4;
+            if (bytes[position++] == 7)
+            {
+                break;
+            }
+
+            for (int i = 0; i < 28; i += 2)
+            {
+                const int d = bytes[position++];
+                samples[i] = load_sample((d & 0xf) << 12, shift_factor);
+                samples[i + 1] = load_sample((d & 0xf0) << 8, shift_factor);
+            }
+
+            for (int i = 0; i < 28; i++)
+            {
+                samples[i] = samples[i] + s_1 * f[predict_nr][0] + s_2 * f[predict_nr][1];
+                s_2 = s_1;
+                s_1 = samples[i];
+                const int16_t value = static_cast<int16_t>(samples[i] + 0.5);
+                results.push_back(static_cast<uint8_t>(value & 0xff));
+                results.push_back(static_cast<uint8_t>((value >> 8) & 0xff));
+            }
+        }
+
+        const auto write = [&](std::size_t offset, auto value) { memcpy(&results[offset], &value, sizeof(value)); };
+        const uint32_t file_size = static_cast<uint32_t>(results.size());
+        memcpy(&results[0], "RIFF", 4);
+        write(4, file_size - 8);
+        memcpy(&results[8], "WAVEfmt ", 8);
+        write(16, 16u);
+        write(20, uint16_t(1));
+        write(22, uint16_t(1));
+        write(24, sample_frequency);
+        write(28, sample_frequency * 2);
+        write(32, uint16_t(2));
+        write(34, uint16_t(16));
+        memcpy(&results[36], "data", 4);
+        write(40, file_size - 44);
+        return results;
+    }
+
+    std::vector<uint8_t> create_vag(std::mt19937& random, std::size_t size, bool end_early)
+    {
+        std::vector<uint8_t> data(size);
+        std::ranges::generate(data, [&]() { return static_cast<uint8_t>(random()); });
+        for (std::size_t block = 16; block + 1 < size; block += 16)
+        {
+            data[block] = static_cast<uint8_t>(((random() % 5) << 4) | (random() % 13));
+            data[block + 1] = end_early && block > size / 2 ? 7 : 0;
+        }
+        return data;
+    }
+}
+
+TEST(SoundSample, VagMatchesReferenceDecoder)
+{
+    std::mt19937 random(1234);
+    for (uint32_t i = 0; i < 200; ++i)
+    {
+        const auto vag = create_vag(random, 64 + random() % 4096, i % 10 == 0);
+        const auto expected = reference_vag_to_wav(vag, 11025);
+        const auto sample = SoundSample{ .source = std::make_shared<const std::vector<uint8_t>>(vag), .size = vag.size(), .format = SoundSample::Format::Vag, .sample_frequency = 11025 };
+        ASSERT_EQ(sample.decode(), expected);
+    }
+}
+
+TEST(SoundSample, WavReturnsRange)
+{
+    const auto source = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3, 4, 5 });
+    const auto sample = SoundSample{ .source = source, .offset = 1, .size = 3 };
+    ASSERT_EQ(sample.decode(), std::vector<uint8_t>({ 2, 3, 4 }));
+}
+
+TEST(SoundSample, OutOfRangeIsEmpty)
+{
+    const auto source = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3, 4, 5 });
+    const auto sample = SoundSample{ .source = source, .offset = 4, .size = 3 };
+    ASSERT_TRUE(sample.decode().empty());
+}
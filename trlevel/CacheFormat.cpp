@@ -0,0 +1,146 @@
+#include "CacheFormat.h"
+#include <format>
+
+namespace trlevel
+{
+    namespace
+    {
+        constexpr std::array<char, 4> Magic{ 'T', 'R', 'V', 'C' };
+        /// Arrays are aligned to this so that any cached type can be viewed in the entry.
+        constexpr std::size_t Alignment = 16;
+
+        struct Header
+        {
+            std::array<char, 4> magic;
+            uint32_t version;
+            uint64_t size;
+        };
+
+        /// The fields of a room, shared by reading and writing so that the two can't disagree.
+        template <typename Room, typename Archive>
+        void cache_room(Room& room, Archive& archive)
+        {
+            archive(room.info,
+                room.data.vertices,
+                room.data.rectangles,
+                room.data.triangles,
+                room.data.sprites,
+                room.portals,
+                room.num_z_sectors,
+                room.num_x_sectors,
+                room.sector_list,
+                room.colour,
+                room.ambient_intensity_1,
+                room.ambient_intensity_2,
+                room.light_mode,
+                room.lights,
+                room.static_meshes,
+                room.alternate_room,
+                room.flags,
+                room.water_scheme,
+                room.reverb_info,
+                room.alternate_group);
+        }
+    }
+
+    void cache_write(CacheWriter& writer, const tr3_room& room)
+    {
+        cache_room(room, writer);
+    }
+
+    void cache_read(CacheReader& reader, tr3_room& room)
+    {
+        cache_room(room, reader);
+    }
+
+    CacheWriter::CacheWriter(const std::string& hash)
+    {
+        write(Header{ .magic = Magic, .version = LevelCacheVersion, .size = 0 });
+        write(hash);
+    }
+
+    void CacheWriter::write(const std::string& value)
+    {
+        write<uint64_t>(value.size());
+        write_bytes(value.data(), value.size());
+    }
+
+    std::vector<uint8_t> CacheWriter::finish()
+    {
+        const uint64_t size = _data.size();
+        std::memcpy(_data.data() + offsetof(Header, size), &size, sizeof(size));
+        return std::move(_data);
+    }
+
+    void CacheWriter::write_bytes(const void* data, std::size_t size)
+    {
+        const auto bytes = static_cast<const uint8_t*>(data);
+        _data.insert(_data.end(), bytes, bytes + size);
+    }
+
+    void CacheWriter::align()
+    {
+        _data.resize((_data.size() + Alignment - 1) / Alignment * Alignment);
+    }
+
+    CacheReader::CacheReader(std::span<const uint8_t> data, const std::string& hash)
+        : _data(data)
+    {
+        if (reinterpret_cast<std::uintptr_t>(data.data()) % Alignment != 0)
+        {
+            throw std::runtime_error("Level cache entry is not aligned");
+        }
+
+        Header header{};
+        read(header);
+        if (header.magic != Magic)
+        {
+            throw std::runtime_error("Not a level cache entry");
+        }
+
+        if (header.version != LevelCacheVersion)
+        {
+            throw std::runtime_error(std::format("Level cache entry is version {}, expected {}", header.version, LevelCacheVersion));
+        }
+
+        if (header.size != data.size())
+        {
+            throw std::runtime_error("Level cache entry is incomplete");
+        }
+
+        std::string entry_hash;
+        read(entry_hash);
+        if (entry_hash != hash)
+        {
+            throw std::runtime_error("Level cache entry is for a different level");
+        }
+    }
+
+    void CacheReader::read(std::string& value)
+    {
+        uint64_t size = 0;
+        read(size);
+        if (size > _data.size() - _position)
+        {
+            throw std::runtime_error("Level cache entry is truncated");
+        }
+        const auto bytes = read_bytes(static_cast<std::size_t>(size));
+        value.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    std::span<const uint8_t> CacheReader::read_bytes(std::size_t size)
+    {
+        if (size > _data.size() - _position)
+        {
+            throw std::runtime_error("Level cache entry is truncated");
+        }
+        const auto bytes = _data.subspan(_position, size);
+        _position += size;
+        return bytes;
+    }
+
+    void CacheReader::align()
+    {
+        _position = std::min(_data.size(), (_position + Alignment - 1) / Alignment * Alignment);
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tr_rooms.h"
+
+namespace trlevel
+{
+    /// Increase when the layout of a cache entry or of any cached type changes. Entries
+    /// written with another version are discarded.
+    constexpr uint32_t LevelCacheVersion = 2;
+
+    class CacheWriter;
+    class CacheReader;
+
+    void cache_write(CacheWriter& writer, const tr3_room& room);
+    void cache_read(CacheReader& reader, tr3_room& room);
+
+    /// Writes a level cache entry. Arrays of trivially copyable types are stored as raw bytes,
+    /// aligned so that they can be copied out with a single memcpy. Padding is written as zeros
+    /// so that saving the same level always produces the same entry.
+    class CacheWriter final
+    {
+    public:
+        explicit CacheWriter(const std::string& hash);
+        /// Write a value. Types that are not trivially copyable need either a write member
+        /// function or a cache_write overload.
+        template <typename T>
+        void write(const T& value);
+        template <typename T>
+        void write(const std::vector<T>& values);
+        template <typename K, typename V>
+        void write(const std::unordered_map<K, V>& values);
+        void write(const std::string& value);
+        template <typename... T>
+        void operator()(const T&... values);
+        /// Complete the header and take the bytes of the entry.
+        std::vector<uint8_t> finish();
+    private:
+        template <typename T>
+        void write_values(const T* values, std::size_t count);
+        void write_bytes(const void* data, std::size_t size);
+        void align();
+
+        std::vector<uint8_t> _data;
+    };
+
+    /// Reads a level cache entry written by CacheWriter. Every read is bounds checked and throws
+    /// if the entry is too short.
+    class CacheReader final
+    {
+    public:
+        /// Validate the header of an entry. Throws if the entry is for another level or was written
+        /// in another format version.
+        explicit CacheReader(std::span<const uint8_t> data, const std::string& hash);
+        template <typename T>
+        void read(T& value);
+        template <typename T>
+        void read(std::vector<T>& values);
+        template <typename K, typename V>
+        void read(std::unordered_map<K, V>& values);
+        void read(std::string& value);
+        /// View an array of trivially copyable values in the entry. The span is only valid while the
+        /// entry is, so callers copy what they keep.
+        template <typename T>
+        std::span<const T> read_span();
+        template <typename... T>
+        void operator()(T&... values);
+    private:
+        std::span<const uint8_t> read_bytes(std::size_t size);
+        void align();
+
+        std::span<const uint8_t> _data;
+        std::size_t _position{ 0 };
+    };
+}
+
+#include "CacheFormat.inl"
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+namespace trlevel
+{
+    template <typename T>
+    void CacheWriter::write(const T& value)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            write_values(&value, 1);
+        }
+        else if constexpr (requires { value.write(*this); })
+        {
+            value.write(*this);
+        }
+        else
+        {
+            cache_write(*this, value);
+        }
+    }
+
+    template <typename T>
+    void CacheWriter::write(const std::vector<T>& values)
+    {
+        write<uint64_t>(values.size());
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            align();
+            write_values(values.data(), values.size());
+        }
+        else
+        {
+            for (const auto& value : values)
+            {
+                write(value);
+            }
+        }
+    }
+
+    template <typename T>
+    void CacheWriter::write_values(const T* values, std::size_t count)
+    {
+        if constexpr (std::has_unique_object_representations_v<T>)
+        {
+            write_bytes(values, count * sizeof(T));
+        }
+        else
+        {
+            // Padding bytes are left uninitialised by the loaders, so clear them in a copy of each value.
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                T value = values[i];
+#if defined(_MSC_VER) && !defined(__clang__)
+                __builtin_zero_non_value_bits(&value);
+#else
+                __builtin_clear_padding(&value);
+#endif
+                write_bytes(&value, sizeof(T));
+            }
+        }
+    }
+
+    template <typename K, typename V>
+    void CacheWriter::write(const std::unordered_map<K, V>& values)
+    {
+        write<uint64_t>(values.size());
+        for (const auto& [key, value] : values)
+        {
+            write(key);
+            write(value);
+        }
+    }
+
+    template <typename... T>
+    void CacheWriter::operator()(const T&... values)
+    {
+        (write(values), ...);
+    }
+
+    template <typename T>
+    void CacheReader::read(T& value)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+        }
+        else if constexpr (requires { value.read(*this); })
+        {
+            value.read(*this);
+        }
+        else
+        {
+            cache_read(*this, value);
+        }
+    }
+
+    template <typename T>
+    void CacheReader::read(std::vector<T>& values)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            const auto span = read_span<T>();
+            values.assign(span.begin(), span.end());
+        }
+        else
+        {
+            uint64_t count = 0;
+            read(count);
+            // Every element takes at least one byte, so this catches sizes that could never fit.
+            if (count > _data.size() - _position)
+            {
+                throw std::runtime_error("Level cache entry is truncated");
+            }
+            values.resize(static_cast<std::size_t>(count));
+            for (auto& value : values)
+            {
+                read(value);
+            }
+        }
+    }
+
+    template <typename K, typename V>
+    void CacheReader::read(std::unordered_map<K, V>& values)
+    {
+        uint64_t count = 0;
+        read(count);
+        if (count > _data.size() - _position)
+        {
+            throw std::runtime_error("Level cache entry is truncated");
+        }
+
+        values.clear();
+        values.reserve(static_cast<std::size_t>(count));
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            K key{};
+            V value{};
+            read(key);
+            read(value);
+            values.emplace(std::move(key), std::move(value));
+        }
+    }
+
+    template <typename T>
+    std::span<const T> CacheReader::read_span()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable arrays can be viewed in place");
+
+        uint64_t count = 0;
+        read(count);
+        align();
+        if (count > (_data.size() - _position) / sizeof(T))
+        {
+            throw std::runtime_error("Level cache entry is truncated");
+        }
+        const auto bytes = read_bytes(static_cast<std::size_t>(count) * sizeof(T));
+        return { reinterpret_cast<const T*>(bytes.data()), static_cast<std::size_t>(count) };
+    }
+
+    template <typename... T>
+    void CacheReader::operator()(T&... values)
+    {
+        (read(values), ...);
+    }
+}
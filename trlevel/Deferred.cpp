@@ -0,0 +1,17 @@
+#include "Deferred.h"
+
+namespace trlevel
+{
+    void Deferred::defer(const std::function<void()>& work)
+    {
+        _work = work;
+    }
+
+    void Deferred::run() const
+    {
+        if (_work)
+        {
+            std::call_once(_once, _work);
+        }
+    }
+}
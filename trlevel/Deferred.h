@@ -0,0 +1,22 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+
+namespace trlevel
+{
+    /// Work that is done the first time that its results are needed. If no work has been
+    /// deferred then running does nothing.
+    class Deferred final
+    {
+    public:
+        /// Set the work to do when the results are first needed.
+        void defer(const std::function<void()>& work);
+        /// Do the deferred work if it has not been done yet. Can be called from multiple threads.
+        /// If the work throws it will be attempted again on the next call.
+        void run() const;
+    private:
+        mutable std::once_flag _once;
+        std::function<void()> _work;
+    };
+}
@@ -1,40 +1,357 @@
 #include "Hasher.h"
-#include <bcrypt.h>
+#include <bit>
+#include <cstring>
 #include <format>
 #include <ranges>
 
+#if defined(_M_X64) || defined(__x86_64__)
+#define TRLEVEL_SHA_INTEL
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define TRLEVEL_SHA_INTEL_TARGET
+#else
+#include <cpuid.h>
+#define TRLEVEL_SHA_INTEL_TARGET __attribute__((target("sha,sse4.1")))
+#endif
+#elif defined(_M_ARM64) || (defined(__aarch64__) && defined(__ARM_FEATURE_SHA2))
+#define TRLEVEL_SHA_ARM
+#include <arm_neon.h>
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+#endif
+
 namespace trlevel
 {
+    namespace
+    {
+        constexpr std::size_t block_size = 64;
+
+        alignas(16) constexpr uint32_t k[64] =
+        {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+
+        constexpr uint32_t initial_state[8] =
+        {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+
+        using Compress = void(*)(uint32_t state[8], const uint8_t* data, std::size_t blocks);
+
+        uint32_t load_big_endian(const uint8_t* data)
+        {
+            return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | data[3];
+        }
+
+        void compress_software(uint32_t state[8], const uint8_t* data, std::size_t blocks)
+        {
+            uint32_t w[64];
+            for (std::size_t block = 0; block < blocks; ++block, data += block_size)
+            {
+                for (int i = 0; i < 16; ++i)
+                {
+                    w[i] = load_big_endian(data + i * 4);
+                }
+
+                for (int i = 16; i < 64; ++i)
+                {
+                    const uint32_t s0 = std::rotr(w[i - 15], 7) ^ std::rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                    const uint32_t s1 = std::rotr(w[i - 2], 17) ^ std::rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+
+                uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+                uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+                for (int i = 0; i < 64; ++i)
+                {
+                    const uint32_t s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+                    const uint32_t ch = (e & f) ^ (~e & g);
+                    const uint32_t t1 = h + s1 + ch + k[i] + w[i];
+                    const uint32_t s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+                    const uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+                    const uint32_t t2 = s0 + maj;
+                    h = g;
+                    g = f;
+                    f = e;
+                    e = d + t1;
+                    d = c;
+                    c = b;
+                    b = a;
+                    a = t1 + t2;
+                }
+
+                state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+                state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+            }
+        }
+
+#if defined(TRLEVEL_SHA_INTEL)
+        bool has_intel_sha()
+        {
+            int registers[4]{};
+#if defined(_MSC_VER)
+            __cpuid(registers, 0);
+            if (registers[0] < 7)
+            {
+                return false;
+            }
+            __cpuid(registers, 1);
+            const bool sse41 = (registers[2] & (1 << 19)) != 0;
+            __cpuidex(registers, 7, 0);
+#else
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            {
+                return false;
+            }
+            const bool sse41 = (ecx & (1 << 19)) != 0;
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            {
+                return false;
+            }
+            registers[1] = static_cast<int>(ebx);
+#endif
+            return sse41 && (registers[1] & (1 << 29)) != 0;
+        }
+
+        /// Each iteration of the round loop handles four rounds. The state is kept as ABEF/CDGH as
+        /// required by sha256rnds2 and the message schedule is held in four rotating registers.
+        TRLEVEL_SHA_INTEL_TARGET void compress_intel(uint32_t state[8], const uint8_t* data, std::size_t blocks)
+        {
+            const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+            __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+            __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+            __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+            __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+            for (std::size_t block = 0; block < blocks; ++block, data += block_size)
+            {
+                const __m128i abef_save = abef;
+                const __m128i cdgh_save = cdgh;
+
+                __m128i message[4];
+                for (int i = 0; i < 4; ++i)
+                {
+                    message[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16)), byte_swap);
+                }
+
+                for (int group = 0; group < 16; ++group)
+                {
+                    __m128i& current = message[group & 3];
+                    if (group >= 4)
+                    {
+                        const __m128i previous = message[(group + 3) & 3];
+                        current = _mm_sha256msg1_epu32(current, message[(group + 1) & 3]);
+                        current = _mm_add_epi32(current, _mm_alignr_epi8(previous, message[(group + 2) & 3], 4));
+                        current = _mm_sha256msg2_epu32(current, previous);
+                    }
+
+                    __m128i rounds = _mm_add_epi32(current, _mm_load_si128(reinterpret_cast<const __m128i*>(&k[group * 4])));
+                    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, rounds);
+                    rounds = _mm_shuffle_epi32(rounds, 0x0E);
+                    abef = _mm_sha256rnds2_epu32(abef, cdgh, rounds);
+                }
+
+                abef = _mm_add_epi32(abef, abef_save);
+                cdgh = _mm_add_epi32(cdgh, cdgh_save);
+            }
+
+            const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+            const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+        }
+#endif
+
+#if defined(TRLEVEL_SHA_ARM)
+        bool has_arm_sha()
+        {
+#if defined(_WIN32)
+            return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE);
+#else
+            return true;
+#endif
+        }
+
+        void compress_arm(uint32_t state[8], const uint8_t* data, std::size_t blocks)
+        {
+            uint32x4_t abcd = vld1q_u32(&state[0]);
+            uint32x4_t efgh = vld1q_u32(&state[4]);
+
+            for (std::size_t block = 0; block < blocks; ++block, data += block_size)
+            {
+                const uint32x4_t abcd_save = abcd;
+                const uint32x4_t efgh_save = efgh;
+
+                uint32x4_t message[4];
+                for (int i = 0; i < 4; ++i)
+                {
+                    message[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i * 16)));
+                }
+
+                for (int group = 0; group < 16; ++group)
+                {
+                    uint32x4_t& current = message[group & 3];
+                    const uint32x4_t rounds = vaddq_u32(current, vld1q_u32(&k[group * 4]));
+                    if (group < 12)
+                    {
+                        current = vsha256su1q_u32(vsha256su0q_u32(current, message[(group + 1) & 3]), message[(group + 2) & 3], message[(group + 3) & 3]);
+                    }
+
+                    const uint32x4_t previous_abcd = abcd;
+                    abcd = vsha256hq_u32(abcd, efgh, rounds);
+                    efgh = vsha256h2q_u32(efgh, previous_abcd, rounds);
+                }
+
+                abcd = vaddq_u32(abcd, abcd_save);
+                efgh = vaddq_u32(efgh, efgh_save);
+            }
+
+            vst1q_u32(&state[0], abcd);
+            vst1q_u32(&state[4], efgh);
+        }
+#endif
+
+        Compress compress_function(Hasher::Implementation implementation)
+        {
+            switch (implementation)
+            {
+#if defined(TRLEVEL_SHA_INTEL)
+                case Hasher::Implementation::Intel:
+                    return compress_intel;
+#endif
+#if defined(TRLEVEL_SHA_ARM)
+                case Hasher::Implementation::Arm:
+                    return compress_arm;
+#endif
+                default:
+                    return compress_software;
+            }
+        }
+    }
+
     IHasher::~IHasher()
     {
     }
 
     Hasher::Hasher()
+        : Hasher(best_hasher_implementation())
     {
-        DWORD object_length = 0;
-        DWORD data_length = 0;
-        BCryptGetProperty(BCRYPT_SHA256_ALG_HANDLE, BCRYPT_OBJECT_LENGTH, reinterpret_cast<PBYTE>(&object_length), sizeof(DWORD), &data_length, 0);
-        hash_object.resize(object_length, 0);
-
-        DWORD hash_length = 0;
-        BCryptGetProperty(BCRYPT_SHA256_ALG_HANDLE, BCRYPT_HASH_LENGTH, (PBYTE)&hash_length, sizeof(DWORD), &data_length, 0);
-        hash_buffer.resize(hash_length, 0);
-
-        BCryptCreateHash(BCRYPT_SHA256_ALG_HANDLE, &_hash, &hash_object[0], object_length, nullptr, 0, BCRYPT_HASH_REUSABLE_FLAG);
     }
 
-    Hasher::~Hasher()
+    Hasher::Hasher(Implementation implementation)
+        : _implementation(is_supported(implementation) ? implementation : Implementation::Software)
     {
-        BCryptDestroyHash(_hash);
     }
 
-    std::string Hasher::hash(const std::vector<uint8_t>& data) const
+    std::string Hasher::hash(std::span<const uint8_t> data) const
     {
-        BCryptHashData(_hash, const_cast<uint8_t*>(&data[0]), static_cast<ULONG>(data.size()), 0);
-        BCryptFinishHash(_hash, const_cast<uint8_t*>(&hash_buffer[0]), static_cast<ULONG>(hash_buffer.size()), 0);
-        return hash_buffer
+        return digest(data)
             | std::views::transform([](uint8_t b) { return std::format("{:02X}", b); })
             | std::views::join
             | std::ranges::to<std::string>();
     }
+
+    Hasher::Digest Hasher::digest(std::span<const uint8_t> data) const
+    {
+        const auto compress = compress_function(_implementation);
+
+        uint32_t state[8];
+        std::memcpy(state, initial_state, sizeof(state));
+
+        const std::size_t full_blocks = data.size() / block_size;
+        compress(state, data.data(), full_blocks);
+
+        // Padding is a single 1 bit, zeroes and then the length in bits - this takes one or two blocks.
+        const std::size_t remaining = data.size() - full_blocks * block_size;
+        uint8_t tail[block_size * 2]{};
+        if (remaining)
+        {
+            std::memcpy(tail, data.data() + full_blocks * block_size, remaining);
+        }
+        tail[remaining] = 0x80;
+        const std::size_t tail_blocks = remaining + 9 > block_size ? 2 : 1;
+        const uint64_t bits = static_cast<uint64_t>(data.size()) * 8;
+        for (int i = 0; i < 8; ++i)
+        {
+            tail[tail_blocks * block_size - 1 - i] = static_cast<uint8_t>(bits >> (i * 8));
+        }
+        compress(state, tail, tail_blocks);
+
+        Digest result;
+        for (int i = 0; i < 8; ++i)
+        {
+            result[i * 4] = static_cast<uint8_t>(state[i] >> 24);
+            result[i * 4 + 1] = static_cast<uint8_t>(state[i] >> 16);
+            result[i * 4 + 2] = static_cast<uint8_t>(state[i] >> 8);
+            result[i * 4 + 3] = static_cast<uint8_t>(state[i]);
+        }
+        return result;
+    }
+
+    Hasher::Implementation Hasher::implementation() const
+    {
+        return _implementation;
+    }
+
+    bool is_supported(Hasher::Implementation implementation)
+    {
+        switch (implementation)
+        {
+            case Hasher::Implementation::Software:
+                return true;
+#if defined(TRLEVEL_SHA_INTEL)
+            case Hasher::Implementation::Intel:
+            {
+                static const bool supported = has_intel_sha();
+                return supported;
+            }
+#endif
+#if defined(TRLEVEL_SHA_ARM)
+            case Hasher::Implementation::Arm:
+            {
+                static const bool supported = has_arm_sha();
+                return supported;
+            }
+#endif
+            default:
+                return false;
+        }
+    }
+
+    Hasher::Implementation best_hasher_implementation()
+    {
+        for (const auto implementation : { Hasher::Implementation::Intel, Hasher::Implementation::Arm })
+        {
+            if (is_supported(implementation))
+            {
+                return implementation;
+            }
+        }
+        return Hasher::Implementation::Software;
+    }
+
+    std::string to_string(Hasher::Implementation implementation)
+    {
+        switch (implementation)
+        {
+            case Hasher::Implementation::Software:
+                return "Software";
+            case Hasher::Implementation::Intel:
+                return "Intel SHA";
+            case Hasher::Implementation::Arm:
+                return "ARMv8 Crypto";
+        }
+        return "Unknown";
+    }
 }
@@ -1,18 +1,38 @@
 #pragma once
 
+#include <array>
+
 #include "IHasher.h"
 
 namespace trlevel
 {
+    /// Portable SHA-256. Uses the SHA extensions on x64 or the crypto extensions on ARMv8
+    /// when the processor supports them and a software implementation otherwise.
     class Hasher final : public IHasher
     {
     public:
+        enum class Implementation
+        {
+            Software,
+            Intel,
+            Arm
+        };
+
+        using Digest = std::array<uint8_t, 32>;
+
         Hasher();
-        virtual ~Hasher();
-        std::string hash(const std::vector<uint8_t>& data) const;
+        explicit Hasher(Implementation implementation);
+        virtual ~Hasher() = default;
+        std::string hash(std::span<const uint8_t> data) const override;
+        Digest digest(std::span<const uint8_t> data) const;
+        Implementation implementation() const;
     private:
-        BCRYPT_HASH_HANDLE _hash{ nullptr };
-        std::vector<uint8_t> hash_object;
-        std::vector<uint8_t> hash_buffer;
+        Implementation _implementation;
     };
+
+    /// Whether the implementation can be used on this processor. Unsupported implementations fall back to software.
+    bool is_supported(Hasher::Implementation implementation);
+    /// Find the fastest implementation supported by this processor.
+    Hasher::Implementation best_hasher_implementation();
+    std::string to_string(Hasher::Implementation implementation);
 }
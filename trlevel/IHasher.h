@@ -1,13 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
-#include <vector>
 
 namespace trlevel
 {
     struct IHasher
     {
         virtual ~IHasher() = 0;
-        virtual std::string hash(const std::vector<uint8_t>& data) const = 0;
+        /// Calculate the SHA-256 of the data, as an upper case hex string.
+        virtual std::string hash(std::span<const uint8_t> data) const = 0;
     };
 }
@@ -8,6 +8,9 @@
 #include "tr_rooms.h"
 #include "LevelVersion.h"
 #include "IPack.h"
+#include "SoundSample.h"
+#include "MeshArena.h"
+#include "ModelTables.h"
 
 namespace trlevel
 {
@@ -15,7 +18,6 @@ namespace trlevel
     struct ILevel
     {
         using Source = std::function<std::shared_ptr<ILevel>(const std::string&, const std::shared_ptr<IPack>&)>;
-        using PackSource = std::function<std::shared_ptr<ILevel>(const std::string&, const std::shared_ptr<IPack>&)>;
 
         virtual ~ILevel() = 0;
 
@@ -97,6 +99,15 @@ namespace trlevel
         // Returns: Whether the model was found.
         virtual bool get_model_by_id(uint32_t id, tr_model& out) const = 0;
 
+        /// Find the index of the model with the specified type ID.
+        virtual std::optional<uint32_t> get_model_index(uint32_t id) const = 0;
+
+        /// Get the first animation frame of the model at the specified index, decoded at load time.
+        virtual FrameView get_model_frame(uint32_t model_index) const = 0;
+
+        /// Get the mesh tree of the model at the specified index, decoded at load time.
+        virtual std::span<const tr_meshtree_node> get_model_meshtree(uint32_t model_index) const = 0;
+
         // Get the number of static meshes in the level.
         // Returns: The number of models.
         virtual uint32_t num_static_meshes() const = 0;
@@ -111,8 +122,8 @@ namespace trlevel
 
         // Get the mesh referenced by the specified mesh pointer.
         // mesh_pointer: The mesh pointer index.
-        // Returns: The mesh.
-        virtual tr_mesh get_mesh_by_pointer(uint32_t mesh_pointer) const = 0;
+        // Returns: A view of the mesh, valid for the lifetime of the level.
+        virtual MeshView get_mesh_by_pointer(uint32_t mesh_pointer) const = 0;
 
         // Get the mesh tree node at the specified index.
         // index: The starting mesh tree index.
@@ -126,6 +137,17 @@ namespace trlevel
         // Returns: The frame.
         virtual tr2_frame get_frame(uint32_t frame_offset, uint32_t mesh_count) const = 0;
 
+        /// Get the animations in the level. TR4 and TR5 animations are converted to the TR1-3 layout.
+        virtual std::vector<tr_animation> animations() const = 0;
+        virtual std::vector<tr_state_change> state_changes() const = 0;
+        virtual std::vector<tr_anim_dispatch> anim_dispatches() const = 0;
+
+        /// Get a keyframe of an animation.
+        /// @param animation The index of the animation.
+        /// @param keyframe The keyframe number, counted from the start of the animation.
+        /// @param mesh_count The number of meshes in the model being animated.
+        virtual tr2_frame get_animation_frame(uint32_t animation, uint32_t keyframe, uint32_t mesh_count) const = 0;
+
         // Get the version of the game that the level was built for.
         // Returns: The level version.
         virtual LevelVersion get_version() const = 0;
@@ -163,17 +185,24 @@ namespace trlevel
             enum class OpenMode
             {
                 Full = 0,
-                Preview
+                Preview,
+                /// Load everything except for the meshes and model animation frames, which are decoded when first read.
+                /// Used for levels that are only read, such as by scripts. Levels that may be rendered, such as the one
+                /// opened by the Diff window, need their textiles up front and are loaded in Full mode.
+                Lazy
             };
 
             std::function<void(const std::string&)> on_progress_callback;
+            /// Receives each textile as it is loaded. If not set then loaders may skip decoding textiles entirely.
             std::function<void(const std::vector<uint32_t>&, uint32_t, uint32_t)> on_textile_callback;
-            std::function<void(uint16_t, uint16_t, uint16_t, const std::vector<uint8_t>&)> on_sound_callback;
+            std::function<void(uint16_t, uint16_t, uint16_t, const SoundSample&)> on_sound_callback;
             OpenMode open_mode{ OpenMode::Full };
+            /// Open the level from the level cache if it has been cached before and add it to the cache if not.
+            bool use_cache{ false };
 
             void on_progress(const std::string& message) const;
             void on_textile(const std::vector<uint32_t>& data) const;
-            void on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const std::vector<uint8_t>&) const;
+            void on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const SoundSample& sample) const;
         };
 
         virtual void load(const LoadCallbacks& callbacks) = 0;
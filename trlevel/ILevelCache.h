@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace trlevel
+{
+    /// Stores loaded levels on disk, keyed by the hash of the level file, so that they can
+    /// be opened again without being parsed. Entries also list the other files that the level
+    /// read, such as MAIN.SFX, so that a change to any of them makes the entry stale.
+    struct ILevelCache
+    {
+        /// A cached level mapped into memory.
+        struct Entry
+        {
+            virtual ~Entry() = 0;
+            /// The bytes of the entry. Valid for as long as the entry is alive.
+            virtual std::span<const uint8_t> data() const = 0;
+        };
+
+        virtual ~ILevelCache() = 0;
+        /// Open the cached level for a level file.
+        /// @param hash The hash of the level file.
+        /// @returns The entry, or nullptr if the level has not been cached.
+        virtual std::unique_ptr<Entry> open(const std::string& hash) const = 0;
+        /// Store a level in the cache, replacing any existing entry.
+        virtual void save(const std::string& hash, const std::vector<uint8_t>& data) = 0;
+        /// Remove a cached level, such as one written in an older format.
+        virtual void remove(const std::string& hash) = 0;
+    };
+}
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 #include <trview.common/IFiles.h>
@@ -17,11 +18,12 @@ namespace trlevel
         {
             uint32_t start;
             uint32_t size;
-            std::vector<uint8_t> data;
+            /// The bytes of the part, which are owned by the pack.
+            std::span<const uint8_t> data;
             std::optional<trlevel::PlatformAndVersion> version;
         };
 
-        using Source = std::function<std::shared_ptr<IPack>(std::basic_ispanstream<uint8_t>&)>;
+        using Source = std::function<std::shared_ptr<IPack>(const std::shared_ptr<const std::vector<uint8_t>>&)>;
         virtual ~IPack() = 0;
         virtual void load() = 0;
         virtual const std::vector<Part>& parts() const = 0;
@@ -1,12 +1,16 @@
 #include "Level.h"
 #include "LevelLoadException.h"
 #include "LevelEncryptedException.h"
+#include "LevelProbe.h"
 #include <format>
 #include <ranges>
 #include <spanstream>
 #include <numeric>
 #include <span>
 #include <filesystem>
+#include <execution>
+#include <mutex>
+#include <stdexcept>
 
 #include "Level_common.h"
 #include "Level_psx.h"
@@ -35,11 +39,11 @@ namespace trlevel
         }
     }
 
-    void ILevel::LoadCallbacks::on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const std::vector<uint8_t>& data) const
+    void ILevel::LoadCallbacks::on_sound(uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const SoundSample& sample) const
     {
         if (on_sound_callback)
         {
-            on_sound_callback(sound_map, sound_details, sample_index, data);
+            on_sound_callback(sound_map, sound_details, sample_index, sample);
         }
     }
 
@@ -48,7 +52,7 @@ namespace trlevel
         const float PiMul2 = 6.283185307179586476925286766559f;
         const int16_t Lara = 0;
     
-        bool is_tr5(trview::Activity& activity, LevelVersion version, const std::wstring& filename)
+        bool is_tr5(trview::Activity& activity, LevelVersion version, const std::string& filename)
         {
             if (version != LevelVersion::Tomb4)
             {
@@ -56,230 +60,7 @@ namespace trlevel
             }
 
             activity.log("Checking file extension to determine whether this is a Tomb5 level");
-            std::wstring transformed;
-            std::transform(filename.begin(), filename.end(), std::back_inserter(transformed), towupper);
-            return transformed.find(L".TRC") != filename.npos;
-        }
-
-        std::optional<PlatformAndVersion>  check_for_tr1_psx_without_sound(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX sometimes has sound separated
-            file.seekg(sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 32)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 32)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 PSX has sound data before the version number - attempt to read
-            // sound data and see if we end up at a TR2 version number.
-            skip(file, read<uint32_t>(file) * sizeof(uint32_t));
-            skip(file, read<uint32_t>(file));
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 45)
-            {
-                return PlatformAndVersion { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 45 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx_version_44(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 beta has TR1 style sounds first.
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 44)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 44 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_version_42(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 42 has sounds, style sounds then 18 textiles + cluts;
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 18);
-            skip(file, sizeof(tr_clut) * 2048);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 42)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 42 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr2_psx_version_38(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR2 38 has TR1 style sounds then 14 textiles + cluts.
-            skip(file, read<uint32_t>(file));
-            skip(file, read<uint32_t>(file));
-            skip(file, sizeof(tr_textile4) * 14);
-            skip(file, sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 38)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 38 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_psx_version_27(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX August 1996 has textiles first.
-            file.seekg(sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 27)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 27 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_psx_version_32_demo(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX 1996 Demo has textiles first. But object list version is 32.
-            file.seekg(sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 32)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32, .extra = { "handydemo" } };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_may_1996(std::basic_ispanstream<uint8_t>& file)
-        {
-            // TR1 PSX May 1996 has textiles first.
-            file.seekg(sizeof(tr_textile4) * 21 + sizeof(tr_clut) * 1024);
-            const uint32_t potential_version = read<uint32_t>(file);
-            if (potential_version == 11)
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 11 };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr1_saturn(std::basic_ispanstream<uint8_t>& file)
-        {
-            std::array<uint8_t, 8> data;
-            file.read(&data[0], 8);
-            if ((data | std::ranges::to<std::string>()) == "ROOMFILE")
-            {
-                skip(file, 4);
-                const int32_t version = std::byteswap(read<int32_t>(file));
-                return PlatformAndVersion{ .platform = Platform::Saturn, .version = LevelVersion::Tomb1, .raw_version = version };
-            }
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr4_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            file.seekg(0x7000);
-            const int32_t potential_version = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version };
-            }
-
-            file.seekg(0x7800);
-            const int32_t potential_version_2 = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version_2))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version_2 };
-            }
-
-            file.seekg(0x6000);
-            const int32_t potential_version_3 = peek<int32_t>(file);
-            if (is_supported_tr4_psx_version(potential_version_3))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version_3 };
-            }
-
-            return std::nullopt;
-        }
-
-        std::optional<PlatformAndVersion> check_for_tr5_psx(std::basic_ispanstream<uint8_t>& file)
-        {
-            file.seekg(313344);
-            const int32_t potential_version = read<int32_t>(file);
-            if (is_supported_tr5_psx_version(potential_version))
-            {
-                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb5, .raw_version = potential_version };
-            }
-            return std::nullopt;
-        }
-
-        class FileResetter final
-        {
-        public:
-            FileResetter(std::basic_ispanstream<uint8_t>& file)
-                : _file(file)
-            {
-                _file.seekg(0, std::ios::beg);
-            }
-
-            ~FileResetter()
-            {
-                _file.clear();
-                _file.seekg(0, std::ios::beg);
-            }
-        private:
-            std::basic_ispanstream<uint8_t>& _file;
-        };
-
-        PlatformAndVersion detect_level_version(std::basic_ispanstream<uint8_t>& file)
-        {
-            const std::vector<std::function<std::optional<PlatformAndVersion>(std::basic_ispanstream<uint8_t>&)>> checks
-            {
-                check_for_tr2_psx,
-                check_for_tr2_psx_version_44,
-                check_for_tr2_version_42,
-                check_for_tr2_psx_version_38,
-                check_for_tr1_psx_version_27,
-                check_for_tr1_psx_version_32_demo,
-                check_for_tr1_may_1996,
-                check_for_tr1_psx_without_sound,
-                check_for_tr1_psx,
-                check_for_tr4_psx,
-                check_for_tr5_psx,
-                check_for_tr1_saturn
-            };
-
-            for (const auto& check : checks)
-            {
-                const FileResetter resetter(file);
-                try
-                {
-                    if (const auto version = check(file))
-                    {
-                        return version.value();
-                    }
-                }
-                catch(...)
-                {
-                }
-            }
-            return {};
+            return trview::to_lowercase(filename).find(".trc") != filename.npos;
         }
 
         bool has_frame_count(PlatformAndVersion version)
@@ -295,13 +76,13 @@ namespace trlevel
         }
     }
 
-    Level::Level(const std::string& filename, const std::shared_ptr<IPack>& pack, const std::shared_ptr<trview::IFiles>& files, const std::shared_ptr<IDecrypter>& decrypter, const std::shared_ptr<trview::ILog>& log, const std::shared_ptr<IHasher>& hasher, const IPack::Source& pack_source)
-        : _log(log), _decrypter(decrypter), _filename(filename), _files(files), _pack_source(pack_source), _pack(pack), _hasher(hasher)
+    Level::Level(const std::string& filename, const std::shared_ptr<IPack>& pack, const std::shared_ptr<trview::IFiles>& files, const std::shared_ptr<IDecrypter>& decrypter, const std::shared_ptr<trview::ILog>& log, const std::shared_ptr<IHasher>& hasher, const std::shared_ptr<ILevelCache>& cache, const IPack::Source& pack_source)
+        : _log(log), _decrypter(decrypter), _filename(filename), _files(files), _pack_source(pack_source), _pack(pack), _hasher(hasher), _cache(cache)
     {
     }
 
-    Level::Level(const std::string& filename, const std::shared_ptr<IPack>& pack, const std::shared_ptr<trview::IFiles>& files, const std::shared_ptr<IDecrypter>& decrypter, const std::shared_ptr<trview::ILog>& log, const std::shared_ptr<IHasher>& hasher)
-        : _log(log), _decrypter(decrypter), _filename(filename), _files(files), _pack(pack), _hasher(hasher)
+    Level::Level(const std::string& filename, const std::shared_ptr<IPack>& pack, const std::shared_ptr<trview::IFiles>& files, const std::shared_ptr<IDecrypter>& decrypter, const std::shared_ptr<trview::ILog>& log, const std::shared_ptr<IHasher>& hasher, const std::shared_ptr<ILevelCache>& cache)
+        : _log(log), _decrypter(decrypter), _filename(filename), _files(files), _pack(pack), _hasher(hasher), _cache(cache)
     {
     }
 
@@ -311,86 +92,130 @@ namespace trlevel
 
     void Level::generate_meshes(const std::vector<uint16_t>& mesh_data)
     {
-        if (_mesh_data.empty())
+        if (_lazy)
         {
+            // Every loader passes its mesh data member, which is kept until the meshes are decoded.
+            _meshes_decode.defer([this]() { decode_meshes(_mesh_data); });
             return;
         }
+        decode_meshes(mesh_data);
+    }
 
-        // As well as reading the actual mesh data, generate a map of mesh_pointer to 
-        // mesh. It seems that a lot of the pointers point to the same mesh.
-        std::span span{ reinterpret_cast<const uint8_t*>(&mesh_data[0]), mesh_data.size() * sizeof(uint16_t) };
-        std::basic_ispanstream<uint8_t> stream{ span };
-        stream.exceptions(std::istream::failbit | std::istream::badbit | std::istream::eofbit);
-        for (auto pointer : _mesh_pointers)
+    void Level::decode_meshes(const std::vector<uint16_t>& mesh_data)
+    {
+        if (mesh_data.empty())
         {
-            // Does the map already contain this mesh? If so, don't bother reading it again.
-            auto found = _meshes.find(pointer);
-            if (found != _meshes.end())
+            return;
+        }
+
+        // A lot of the mesh pointers point to the same mesh, so only decode each offset once.
+        std::vector<uint32_t> offsets = _mesh_pointers;
+        std::ranges::sort(offsets);
+        const auto [first, last] = std::ranges::unique(offsets);
+        offsets.erase(first, last);
+
+        std::span span{ reinterpret_cast<const uint8_t*>(&mesh_data[0]), mesh_data.size() * sizeof(uint16_t) };
+        const auto for_each_mesh = [&](const std::function<void(std::size_t, std::basic_ispanstream<uint8_t>&)>& read)
             {
-                continue;
-            }
+                std::exception_ptr error;
+                std::mutex error_mutex;
+                std::for_each(std::execution::par, offsets.begin(), offsets.end(), [&](const uint32_t& offset)
+                    {
+                        try
+                        {
+                            std::basic_ispanstream<uint8_t> stream{ span };
+                            stream.exceptions(std::istream::failbit | std::istream::badbit | std::istream::eofbit);
+                            stream.seekg(offset, std::ios::beg);
+                            read(&offset - offsets.data(), stream);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard lock{ error_mutex };
+                            if (!error)
+                            {
+                                error = std::current_exception();
+                            }
+                        }
+                    });
+
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            };
 
-            stream.seekg(pointer, std::ios::beg);
+        // Count the parts of each mesh first so that the arena can be allocated once and each mesh then read
+        // straight into its own ranges.
+        std::vector<MeshArena::Builder> counted(offsets.size());
+        for_each_mesh([&](std::size_t index, auto& stream) { generate_mesh(counted[index], stream); });
+        const uint32_t first_mesh = _meshes.allocate(counted);
+        for_each_mesh([&](std::size_t index, auto& stream)
+            {
+                auto builder = _meshes.builder(first_mesh + static_cast<uint32_t>(index));
+                generate_mesh(builder, stream);
+            });
 
-            tr_mesh mesh;
+        _mesh_pointer_meshes = _mesh_pointers
+            | std::views::transform([&](uint32_t pointer) { return first_mesh + static_cast<uint32_t>(std::ranges::lower_bound(offsets, pointer) - offsets.begin()); })
+            | std::ranges::to<std::vector>();
+    }
 
-            if (_platform_and_version.platform == Platform::PSX)
+    void Level::generate_mesh(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
+    {
+        if (_platform_and_version.platform == Platform::PSX)
+        {
+            if (_platform_and_version.version == LevelVersion::Tomb1)
             {
-                if (_platform_and_version.version == LevelVersion::Tomb1)
+                if (is_tr1_may_1996(_platform_and_version))
                 {
-                    if (is_tr1_may_1996(_platform_and_version))
-                    {
-                        generate_mesh_tr1_psx_may_1996(mesh, stream);
-                    }
-                    else
-                    {
-                        generate_mesh_tr1_psx(mesh, stream);
-                    }
+                    generate_mesh_tr1_psx_may_1996(mesh, stream);
                 }
-                else if (_platform_and_version.version == LevelVersion::Tomb2)
+                else
                 {
-                    if (is_tr2_version_44(_platform_and_version) || 
-                        is_tr2_version_42(_platform_and_version))
-                    {
-                        generate_mesh_tr2_psx_version_44(mesh, stream);
-                    }
-                    else if (is_tr2_version_38(_platform_and_version))
-                    {
-                        generate_mesh_tr2_psx_version_38(mesh, stream);
-                    }
-                    else
-                    {
-                        generate_mesh_tr2_psx(mesh, stream);
-                    }
+                    generate_mesh_tr1_psx(mesh, stream);
                 }
-                else if (_platform_and_version.version == LevelVersion::Tomb3)
+            }
+            else if (_platform_and_version.version == LevelVersion::Tomb2)
+            {
+                if (is_tr2_version_44(_platform_and_version) || 
+                    is_tr2_version_42(_platform_and_version))
                 {
-                    generate_mesh_tr3_psx(mesh, stream);
+                    generate_mesh_tr2_psx_version_44(mesh, stream);
                 }
-                else if (_platform_and_version.version == LevelVersion::Tomb4 ||
-                         _platform_and_version.version == LevelVersion::Tomb5)
+                else if (is_tr2_version_38(_platform_and_version))
                 {
-                    generate_mesh_tr4_psx(mesh, stream);
+                    generate_mesh_tr2_psx_version_38(mesh, stream);
+                }
+                else
+                {
+                    generate_mesh_tr2_psx(mesh, stream);
                 }
             }
-            else if (_platform_and_version.platform == Platform::Saturn)
-            {
-                generate_mesh_tr1_saturn(mesh, stream);
-            }
-            else if (is_tr1_may_1996(_platform_and_version))
-            {
-                generate_mesh_tr1_pc_may_1996(mesh, stream);
-            }
-            else if (is_tr1_version_21(_platform_and_version))
+            else if (_platform_and_version.version == LevelVersion::Tomb3)
             {
-                generate_mesh_tr1_pc_version_21(mesh, stream);
+                generate_mesh_tr3_psx(mesh, stream);
             }
-            else
+            else if (_platform_and_version.version == LevelVersion::Tomb4 ||
+                     _platform_and_version.version == LevelVersion::Tomb5)
             {
-                generate_mesh(mesh, stream);
+                generate_mesh_tr4_psx(mesh, stream);
             }
-
-            _meshes.insert({ pointer, mesh });
+        }
+        else if (_platform_and_version.platform == Platform::Saturn)
+        {
+            generate_mesh_tr1_saturn(mesh, stream);
+        }
+        else if (is_tr1_may_1996(_platform_and_version))
+        {
+            generate_mesh_tr1_pc_may_1996(mesh, stream);
+        }
+        else if (is_tr1_version_21(_platform_and_version))
+        {
+            generate_mesh_tr1_pc_version_21(mesh, stream);
+        }
+        else
+        {
+            generate_mesh_pc(mesh, stream);
         }
     }
 
@@ -490,16 +315,60 @@ namespace trlevel
     }
 
     bool Level::get_model_by_id(uint32_t id, tr_model& output) const 
+    {
+        const auto index = get_model_index(id);
+        if (!index)
+        {
+            return false;
+        }
+        output = _models[index.value()];
+        return true;
+    }
+
+    std::optional<uint32_t> Level::get_model_index(uint32_t id) const
+    {
+        _model_tables_decode.run();
+        return _model_tables.index_of(id);
+    }
+
+    FrameView Level::get_model_frame(uint32_t model_index) const
+    {
+        _model_tables_decode.run();
+        return _model_tables.frame(model_index);
+    }
+
+    std::span<const tr_meshtree_node> Level::get_model_meshtree(uint32_t model_index) const
+    {
+        _model_tables_decode.run();
+        return _model_tables.meshtree(model_index);
+    }
+
+    void Level::generate_model_tables()
+    {
+        if (_lazy)
+        {
+            _model_tables_decode.defer([this]() { decode_model_tables(); });
+            return;
+        }
+        decode_model_tables();
+    }
+
+    void Level::decode_model_tables()
     {
         for (const auto& model : _models)
         {
-            if (model.ID == id)
+            if (model.NumMeshes == 0 || model.NumMeshes > 0xff00)
             {
-                output = model;
-                return true;
+                _model_tables.add(model, {}, {});
+                continue;
             }
+
+            // Request one less node than there are meshes as the first mesh is at the same position as the entity.
+            const uint32_t available_nodes = model.MeshTree < _meshtree.size() ? static_cast<uint32_t>((_meshtree.size() - model.MeshTree) / 4) : 0u;
+            const auto frame = get_frame(has_double_frames(_platform_and_version) ? model.FrameOffset : model.FrameOffset / 2, model.NumMeshes);
+            const auto nodes = get_meshtree(model.MeshTree, std::min<uint32_t>(model.NumMeshes - 1, available_nodes));
+            _model_tables.add(model, frame, nodes);
         }
-        return false;
     }
 
     uint32_t Level::num_static_meshes() const
@@ -522,10 +391,14 @@ namespace trlevel
         return static_cast<uint32_t>(_mesh_pointers.size());
     }
 
-    tr_mesh Level::get_mesh_by_pointer(uint32_t mesh_pointer) const
+    MeshView Level::get_mesh_by_pointer(uint32_t mesh_pointer) const
     {
-        auto index = _mesh_pointers[mesh_pointer];
-        return _meshes.find(index)->second;
+        _meshes_decode.run();
+        if (mesh_pointer >= _mesh_pointer_meshes.size())
+        {
+            return {};
+        }
+        return _meshes.mesh(_mesh_pointer_meshes[mesh_pointer]);
     }
 
     std::vector<tr_meshtree_node> Level::get_meshtree(uint32_t starting_index, uint32_t node_count) const
@@ -633,6 +506,33 @@ namespace trlevel
         return frame;
     }
 
+    std::vector<tr_animation> Level::animations() const
+    {
+        return _animations;
+    }
+
+    std::vector<tr_state_change> Level::state_changes() const
+    {
+        return _state_changes;
+    }
+
+    std::vector<tr_anim_dispatch> Level::anim_dispatches() const
+    {
+        return _anim_dispatches;
+    }
+
+    tr2_frame Level::get_animation_frame(uint32_t animation, uint32_t keyframe, uint32_t mesh_count) const
+    {
+        if (animation >= _animations.size())
+        {
+            return {};
+        }
+
+        const auto& anim = _animations[animation];
+        const uint32_t offset = has_double_frames(_platform_and_version) ? anim.FrameOffset : anim.FrameOffset / 2;
+        return get_frame(offset + keyframe * anim.FrameSize, mesh_count);
+    }
+
     LevelVersion Level::get_version() const 
     {
         return _platform_and_version.version;
@@ -713,25 +613,27 @@ namespace trlevel
             activity.log(std::format("Opening file \"{}\"", _filename));
 
             const bool is_packed = _filename.starts_with("pack") && _pack;
-            const bool is_pack_preview = _filename.starts_with("pack-preview") && _pack;
-            auto bytes = is_packed ? pack_entry(*_pack, std::stoi(_name)) : _files->load_file(_filename);
-            if (!bytes.has_value())
+            auto loaded = is_packed ? pack_entry(*_pack, std::stoi(_name)) : _files->load_file(_filename);
+            if (!loaded.has_value())
             {
                 throw LevelLoadException();
             }
 
-            _hash = _hasher->hash(*bytes);
+            // The hash is calculated while the level is parsed and only waited for when it is first read. Previews
+            // rarely need it so it is deferred until then. The task holds the bytes so they outlive this function.
+            const auto bytes = std::make_shared<std::vector<uint8_t>>(std::move(*loaded));
+            _hash = std::async(callbacks.open_mode == LoadCallbacks::OpenMode::Preview ? std::launch::deferred : std::launch::async,
+                [hasher = _hasher, data = bytes]() mutable
+                {
+                    const auto to_hash = std::move(data);
+                    return hasher->hash(*to_hash);
+                }).share();
+
             std::basic_ispanstream<uint8_t> file{ std::span(*bytes) };
 
             file.exceptions(std::ios::failbit);
 
             log_file(activity, file, std::format("Opened file \"{}\"", _filename));
-            log_file(activity, file, std::format("File hash: {}", _hash));
-
-            if (callbacks.open_mode != LoadCallbacks::OpenMode::Preview)
-            {
-                OutputDebugStringA(std::format("{}\n", _hash).c_str());
-            }
 
             read_header(file, *bytes, activity, callbacks);
 
@@ -743,7 +645,7 @@ namespace trlevel
                 _platform_and_version.remastered = _files->load_file(level_path.string()).has_value();
             }
 
-            if (is_pack_preview || callbacks.open_mode == LoadCallbacks::OpenMode::Preview)
+            if (callbacks.open_mode == LoadCallbacks::OpenMode::Preview)
             {
                 return;
             }
@@ -754,40 +656,68 @@ namespace trlevel
                 _platform_and_version.is_pack = false;
             }
 
+            // Saturn levels remap mesh textures while loading, so their meshes are always decoded up front.
+            _lazy = callbacks.open_mode == LoadCallbacks::OpenMode::Lazy && _platform_and_version.platform != Platform::Saturn;
+
+            // Cache entries are keyed by hash, so a cached load waits for the hash before parsing anything. Packs
+            // only list the levels inside them and are always parsed.
+            const bool use_cache = callbacks.use_cache && _cache && !_platform_and_version.is_pack;
+            if (use_cache && load_from_cache(activity, callbacks))
+            {
+                activity.log(std::format("File hash: {}", hash()));
+                callbacks.on_progress("Loading complete");
+                return;
+            }
+
+            // Saving a lazy load would decode everything that was deferred, so only full loads are recorded and saved.
+            const bool save_cache = use_cache && !_lazy;
+            CacheRecording recording;
+            if (save_cache)
+            {
+                _external_files.emplace();
+            }
+            const LoadCallbacks load_callbacks = save_cache ? record_callbacks(callbacks, recording) : callbacks;
+
             const std::unordered_map<PlatformAndVersion, std::function<void()>> loaders
             {
-                {{.platform = Platform::PSX, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Tomb2 }, [&]() { load_tr2_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Tomb4 }, [&]() { load_tr4_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_psx(file, activity, callbacks); }},
-                {{.platform = Platform::PSX, .version = LevelVersion::Unknown, .is_pack = true }, [&]() { load_psx_pack(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb1, .remastered = true }, [&]() { load_tr1_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb2 }, [&]() { load_tr2_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb2, .remastered = true }, [&]() { load_tr2_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb3, .remastered = true }, [&]() { load_tr3_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb4 }, [&]() { load_tr4_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb4, .remastered = true }, [&]() { load_tr4_pc_remastered(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_pc(file, activity, callbacks); }},
-                {{.platform = Platform::PC, .version = LevelVersion::Tomb5, .remastered = true }, [&]() { load_tr5_pc_remastered(file, activity, callbacks); }},
-                {{.platform = Platform::Dreamcast, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_dc(file, activity, callbacks); }},
-                {{.platform = Platform::Saturn, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_saturn(file, activity, callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_psx(file, activity, load_callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Tomb2 }, [&]() { load_tr2_psx(file, activity, load_callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_psx(file, activity, load_callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Tomb4 }, [&]() { load_tr4_psx(file, activity, load_callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_psx(file, activity, load_callbacks); }},
+                {{.platform = Platform::PSX, .version = LevelVersion::Unknown, .is_pack = true }, [&]() { load_psx_pack(bytes); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb1, .remastered = true }, [&]() { load_tr1_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb2 }, [&]() { load_tr2_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb2, .remastered = true }, [&]() { load_tr2_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb3 }, [&]() { load_tr3_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb3, .remastered = true }, [&]() { load_tr3_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb4 }, [&]() { load_tr4_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb4, .remastered = true }, [&]() { load_tr4_pc_remastered(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_pc(file, activity, load_callbacks); }},
+                {{.platform = Platform::PC, .version = LevelVersion::Tomb5, .remastered = true }, [&]() { load_tr5_pc_remastered(file, activity, load_callbacks); }},
+                {{.platform = Platform::Dreamcast, .version = LevelVersion::Tomb5 }, [&]() { load_tr5_dc(file, activity, load_callbacks); }},
+                {{.platform = Platform::Saturn, .version = LevelVersion::Tomb1 }, [&]() { load_tr1_saturn(file, activity, load_callbacks); }},
             };
 
             const auto loader = loaders.find(_platform_and_version);
             if (loader != loaders.end())
             {
                 loader->second();
+                generate_model_tables();
+                if (save_cache)
+                {
+                    save_to_cache(activity, recording);
+                }
+                activity.log(std::format("File hash: {}", hash()));
                 callbacks.on_progress("Loading complete");
                 return;
             }
 
-            throw std::exception(std::format("Unsupported level platform and version ({}:{}{})",
+            throw std::runtime_error(std::format("Unsupported level platform and version ({}:{}{})",
                 to_string(_platform_and_version.platform),
                 to_string(_platform_and_version.version),
-                _platform_and_version.remastered ? " (Remastered)" : "").c_str());
+                _platform_and_version.remastered ? " (Remastered)" : ""));
         }
         catch (const LevelEncryptedException&)
         {
@@ -819,17 +749,7 @@ namespace trlevel
     void Level::read_header(std::basic_ispanstream<uint8_t>& file, std::vector<uint8_t>& bytes, trview::Activity& activity, const LoadCallbacks& callbacks)
     {
         log_file(activity, file, "Reading version number from file");
-        uint32_t raw_version = read<uint32_t>(file);
-
-        // For levels where the version number is not the first bytes check the
-        // appropriate location in the file.
-        _platform_and_version = detect_level_version(file);
-
-        // If specific version checks failed we can check the first bytes.
-        if (_platform_and_version.version == LevelVersion::Unknown)
-        {
-            _platform_and_version = convert_level_version(raw_version);
-        }
+        _platform_and_version = probe_level_version(bytes);
 
         log_file(activity, file, std::format("Version number is {} ({}), Platform is {}", _platform_and_version.raw_version, to_string(get_version()), to_string(platform())));
         if (_platform_and_version.version == LevelVersion::Unknown)
@@ -844,14 +764,16 @@ namespace trlevel
         if (_platform_and_version.raw_version == 0x63345254)
         {
             callbacks.on_progress("Decrypting");
-            log_file(activity, file, std::format("File is encrypted, decrypting"));
+            log_file(activity, file, "File is encrypted, decrypting");
+            // Decryption happens in place so the hash of the original file has to be finished first.
+            _hash.wait();
             _decrypter->decrypt(bytes);
             file.seekg(0, std::ios::beg);
             _platform_and_version = convert_level_version(peek<uint32_t>(file));
             log_file(activity, file, std::format("Version number is {:X} ({})", _platform_and_version.raw_version, to_string(get_version())));
         }
 
-        if (is_tr5(activity, get_version(), trview::to_utf16(_filename)))
+        if (is_tr5(activity, get_version(), _filename))
         {
             _platform_and_version.version = LevelVersion::Tomb5;
             log_file(activity, file, std::format("Version number is {:X} ({})", _platform_and_version.raw_version, to_string(get_version())));
@@ -869,9 +791,10 @@ namespace trlevel
 
     void Level::load_sound_fx(trview::Activity& activity, const LoadCallbacks& callbacks)
     {
-        if (const auto main = load_main_sfx())
+        if (auto main = load_main_sfx())
         {
-            std::basic_ispanstream<uint8_t> sfx_file{ std::span(*main) };
+            const auto sfx = std::make_shared<const std::vector<uint8_t>>(std::move(*main));
+            std::basic_ispanstream<uint8_t> sfx_file{ std::span(*sfx) };
             sfx_file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
 
             // Remastered has a sound map like structure at the start of main.sfx, so skip that if present:
@@ -894,18 +817,47 @@ namespace trlevel
                 }
             }
 
-            int16_t overall_index = 0;
-            while (static_cast<std::size_t>(sfx_file.tellg()) < main->size())
+            // Mark the samples used by the level up front so that each entry is a single lookup.
+            // Each entry is at least 8 bytes so larger indices can't be in the file.
+            const std::size_t max_entries = sfx->size() / 8;
+            std::vector<bool> used_samples;
+            for (const auto sample_index : _sample_indices)
+            {
+                if (sample_index >= max_entries)
+                {
+                    continue;
+                }
+
+                if (sample_index >= used_samples.size())
+                {
+                    used_samples.resize(sample_index + 1, false);
+                }
+                used_samples[sample_index] = true;
+            }
+
+            // Walk the RIFF entries directly in the buffer, recording used samples as views into it.
+            const std::size_t sfx_size = sfx->size();
+            std::size_t offset = static_cast<std::size_t>(sfx_file.tellg());
+            for (uint32_t overall_index = 0; offset < sfx_size; ++overall_index)
             {
-                skip(sfx_file, 4);
-                uint32_t size = read<uint32_t>(sfx_file);
-                sfx_file.seekg(-8, std::ios::cur);
-                if (std::ranges::find(_sample_indices, static_cast<uint32_t>(overall_index)) != _sample_indices.end())
+                if (offset + 8 > sfx_size)
+                {
+                    throw std::runtime_error("Sample header is outside of MAIN.SFX");
+                }
+
+                uint32_t size = 0;
+                memcpy(&size, sfx->data() + offset + 4, sizeof(size));
+                const std::size_t entry_size = static_cast<std::size_t>(size) + 8;
+                if (offset + entry_size > sfx_size)
+                {
+                    throw std::runtime_error("Sample is outside of MAIN.SFX");
+                }
+
+                if (overall_index < used_samples.size() && used_samples[overall_index])
                 {
-                    _sound_samples.push_back({ main->begin() + sfx_file.tellg(), main->begin() + sfx_file.tellg() + size + 8 });
+                    _sound_samples.push_back({ .source = sfx, .offset = offset, .size = entry_size });
                 }
-                overall_index++;
-                sfx_file.seekg(size + 8, std::ios::cur);
+                offset += entry_size;
             }
         }
     }
@@ -913,19 +865,19 @@ namespace trlevel
     std::optional<std::vector<uint8_t>> Level::load_main_sfx()
     {
         const auto path = trview::path_for_filename(_filename);
-        const auto og_main = _files->load_file(std::format("{}/MAIN.SFX", path));
+        const auto og_main = load_external_file(std::format("{}/MAIN.SFX", path));
         if (og_main.has_value())
         {
             return og_main;
         }
 
-        if (auto remastered_main = _files->load_file(std::format("{}/../SFX/MAIN.SFX", path)))
+        if (auto remastered_main = load_external_file(std::format("{}/../SFX/MAIN.SFX", path)))
         {
             _platform_and_version.remastered = true;
             return remastered_main;
         }
 
-        if (auto remastered_main_expansion = _files->load_file(std::format("{}/../../SFX/MAIN.SFX", path)))
+        if (auto remastered_main_expansion = load_external_file(std::format("{}/../../SFX/MAIN.SFX", path)))
         {
             _platform_and_version.remastered = true;
             return remastered_main_expansion;
@@ -934,38 +886,49 @@ namespace trlevel
         return std::nullopt;
     }
 
+    std::optional<std::vector<uint8_t>> Level::load_external_file(const std::string& filename)
+    {
+        auto bytes = _files->load_file(filename);
+        if (_external_files)
+        {
+            // Files that are missing are recorded too, as adding one later changes what the level loads.
+            _external_files->push_back({ .filename = filename, .hash = bytes ? _hasher->hash(*bytes) : std::string() });
+        }
+        return bytes;
+    }
+
     bool Level::trng() const
     {
         return _trng;
     }
 
-    void Level::generate_mesh(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_pc(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
-        mesh.vertices = read_vector<int16_t, tr_vertex>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
+        stream_vector<tr_vertex>(stream, read<int16_t>(stream), [&](auto&& v) { mesh.vertex(v); });
 
         int16_t normals = read<int16_t>(stream);
         if (normals > 0)
         {
-            mesh.normals = read_vector<tr_vertex>(stream, normals);
+            stream_vector<tr_vertex>(stream, normals, [&](auto&& n) { mesh.normal(n); });
         }
         else
         {
-            mesh.lights = read_vector<int16_t>(stream, abs(normals));
+            stream_vector<int16_t>(stream, abs(normals), [&](auto&& l) { mesh.light(l); });
         }
 
         if (get_version() < LevelVersion::Tomb4)
         {
-            mesh.textured_rectangles = convert_rectangles(read_vector<int16_t, tr_face4>(stream));
-            mesh.textured_triangles = convert_triangles(read_vector<int16_t, tr_face3>(stream));
-            mesh.coloured_rectangles = read_vector<int16_t, tr_face4>(stream);
-            mesh.coloured_triangles = read_vector<int16_t, tr_face3>(stream);
+            stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(convert_rectangle(r)); });
+            stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(convert_triangle(t)); });
+            stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.coloured_rectangle(r); });
+            stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.coloured_triangle(t); });
         }
         else
         {
-            mesh.textured_rectangles = read_vector<int16_t, tr4_mesh_face4>(stream);
-            mesh.textured_triangles = read_vector<int16_t, tr4_mesh_face3>(stream);
+            stream_vector<tr4_mesh_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(r); });
+            stream_vector<tr4_mesh_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(t); });
         }
     }
 
@@ -983,7 +946,7 @@ namespace trlevel
                     return { tile, texture.u0, texture.v0, width, height, texture.LeftSide, texture.TopSide, texture.RightSide, texture.BottomSide };
                 })
             | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} sprite textures", _sprite_textures.size()));
+        log_file(activity, file, "Read {} sprite textures", _sprite_textures.size());
     }
 
     void Level::adjust_room_textures_psx()
@@ -1068,7 +1031,7 @@ namespace trlevel
                 const uint16_t sample_index = static_cast<uint16_t>(sound_detail.tr_sound_details.Sample + s);
                 if (sample_index < _sound_samples.size())
                 {
-                    callbacks.on_sound(static_cast<uint16_t>(sound_map_index), sound_details_index, sample_index, { _sound_samples[sample_index] });
+                    callbacks.on_sound(static_cast<uint16_t>(sound_map_index), sound_details_index, sample_index, _sound_samples[sample_index]);
                 }
             }
         }
@@ -1089,7 +1052,7 @@ namespace trlevel
 
     std::string Level::hash() const
     {
-        return _hash;
+        return _hash.valid() ? _hash.get() : std::string();
     }
 
     std::string Level::filename() const
@@ -5,11 +5,14 @@
 #include <vector>
 #include <unordered_map>
 #include <optional>
+#include <future>
 
 #include "ILevel.h"
 #include "trtypes.h"
 #include "IDecrypter.h"
 #include "IHasher.h"
+#include "ILevelCache.h"
+#include "Deferred.h"
 
 #include <trview.common/Logs/ILog.h>
 #include <trview.common/Logs/Activity.h>
@@ -17,6 +20,9 @@
 
 namespace trlevel
 {
+    class CacheWriter;
+    class CacheReader;
+
     class Level : public ILevel
     {
     public:
@@ -26,6 +32,7 @@ namespace trlevel
             const std::shared_ptr<IDecrypter>& decrypter,
             const std::shared_ptr<trview::ILog>& log,
             const std::shared_ptr<IHasher>& hasher,
+            const std::shared_ptr<ILevelCache>& cache,
             const IPack::Source& pack_source);
 
         explicit Level(const std::string& filename,
@@ -33,7 +40,8 @@ namespace trlevel
             const std::shared_ptr<trview::IFiles>& files,
             const std::shared_ptr<IDecrypter>& decrypter,
             const std::shared_ptr<trview::ILog>& log,
-            const std::shared_ptr<IHasher>& hasher);
+            const std::shared_ptr<IHasher>& hasher,
+            const std::shared_ptr<ILevelCache>& cache);
 
         virtual ~Level();
 
@@ -108,6 +116,9 @@ namespace trlevel
         // model: The location to store the model.
         // Returns: Whether the model was found.
         virtual bool get_model_by_id(uint32_t id, tr_model& model) const override;
+        std::optional<uint32_t> get_model_index(uint32_t id) const override;
+        FrameView get_model_frame(uint32_t model_index) const override;
+        std::span<const tr_meshtree_node> get_model_meshtree(uint32_t model_index) const override;
 
         // Get the number of static meshes in the level.
         // Returns: The number of models.
@@ -124,7 +135,7 @@ namespace trlevel
         // Get the mesh at the specified index.
         // index: The index of the mesh to get.
         // Returns: The mesh.
-        virtual tr_mesh get_mesh_by_pointer(uint32_t mesh_pointer) const override;
+        virtual MeshView get_mesh_by_pointer(uint32_t mesh_pointer) const override;
 
         // Get the mesh tree node at the specified index.
         // index: The mesh tree index.
@@ -137,6 +148,10 @@ namespace trlevel
         // mesh_count: The number of meshes to read.
         // Returns: The frame.
         virtual tr2_frame get_frame(uint32_t frame_offset, uint32_t mesh_count) const override;
+        std::vector<tr_animation> animations() const override;
+        std::vector<tr_state_change> state_changes() const override;
+        std::vector<tr_anim_dispatch> anim_dispatches() const override;
+        tr2_frame get_animation_frame(uint32_t animation, uint32_t keyframe, uint32_t mesh_count) const override;
 
         // Get the version of the game that the level was built for.
         // Returns: The level version.
@@ -177,7 +192,12 @@ namespace trlevel
         std::string hash() const override;
         std::string filename() const override;
     private:
+        /// Decode the meshes, or defer decoding until the first mesh is read if the level is being loaded lazily.
         void generate_meshes(const std::vector<uint16_t>& mesh_data);
+        void decode_meshes(const std::vector<uint16_t>& mesh_data);
+        /// Decode the model tables, or defer decoding until the first model is read if the level is being loaded lazily.
+        void generate_model_tables();
+        void decode_model_tables();
         tr_colour4 colour_from_object_texture(uint32_t texture) const;
         uint16_t convert_textile4(uint16_t tile, uint16_t clut_id);
         uint16_t attribute_for_clut(uint16_t clut_id) const;
@@ -238,28 +258,72 @@ namespace trlevel
         void load_tr5_pc(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void load_tr5_pc_remastered(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
         void load_tr5_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
-        void load_psx_pack(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks);
+        void load_psx_pack(const std::shared_ptr<const std::vector<uint8_t>>& bytes);
 
         void load_sound_fx(trview::Activity& activity, const LoadCallbacks& callbacks);
         std::optional<std::vector<uint8_t>> load_main_sfx();
+        /// Load a file other than the level that the level's content is read from, recording its hash if the
+        /// load is being cached.
+        std::optional<std::vector<uint8_t>> load_external_file(const std::string& filename);
         void load_ngle_sound_fx(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const LoadCallbacks& callbacks);
 
-        void generate_mesh(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr1_pc_version_21(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr1_pc_may_1996(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr1_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr1_psx_may_1996(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr1_saturn(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr2_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr2_psx_version_44(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr2_psx_version_38(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr3_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
-        void generate_mesh_tr4_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream);
+        void generate_mesh(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_pc(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr1_pc_version_21(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr1_pc_may_1996(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr1_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr1_psx_may_1996(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr1_saturn(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr2_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr2_psx_version_44(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr2_psx_version_38(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr3_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
+        void generate_mesh_tr4_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const;
         void generate_object_textures_tr4_psx(std::basic_ispanstream<uint8_t>& file, uint32_t start, const tr4_psx_level_info& info);
         void generate_sound_samples(const LoadCallbacks& callbacks);
         void generate_sounds(const LoadCallbacks& callbacks);
         void generate_textiles_from_textile8(const LoadCallbacks& callbacks);
 
+        /// Textiles and sounds passed to the callbacks during a load, kept so that they can be cached.
+        struct CacheRecording
+        {
+            struct Sound
+            {
+                uint16_t sound_map;
+                uint16_t sound_details;
+                uint16_t sample_index;
+                SoundSample::Format format;
+                uint32_t sample_frequency;
+                uint64_t offset;
+                uint64_t size;
+            };
+
+            std::vector<std::vector<uint32_t>> textiles;
+            std::vector<Sound> sounds;
+            std::vector<uint8_t> sound_data;
+            /// The first sound recorded for each sample, so that each sample is only stored once.
+            std::unordered_map<uint16_t, std::size_t> samples;
+        };
+
+        /// A file other than the level that was read while loading, such as MAIN.SFX. A cache entry is only
+        /// used if every one of these files is unchanged.
+        struct ExternalFile
+        {
+            std::string filename;
+            /// Hash of the file contents, or empty if the file did not exist.
+            std::string hash;
+
+            void write(CacheWriter& writer) const;
+            void read(CacheReader& reader);
+        };
+
+        /// Call the visitor with every member that is stored in the level cache.
+        template <typename Self, typename Visitor>
+        static void visit_cached(Self& level, Visitor&& visitor);
+        LoadCallbacks record_callbacks(const LoadCallbacks& callbacks, CacheRecording& recording) const;
+        bool load_from_cache(trview::Activity& activity, const LoadCallbacks& callbacks);
+        void save_to_cache(trview::Activity& activity, const CacheRecording& recording) const;
+
         PlatformAndVersion _platform_and_version;
 
         std::vector<tr_colour>  _palette;
@@ -287,11 +351,19 @@ namespace trlevel
         uint16_t _weather_type{ 0u };
 
         // Mesh management.
-        std::unordered_map<uint32_t, tr_mesh> _meshes;
+        MeshArena                             _meshes;
+        std::vector<uint32_t>                 _mesh_pointer_meshes;
+        ModelTables                           _model_tables;
+        bool                                  _lazy{ false };
+        Deferred                              _meshes_decode;
+        Deferred                              _model_tables_decode;
         std::vector<uint16_t>                 _mesh_data;
         std::vector<uint32_t>                 _mesh_pointers;
         std::vector<uint32_t>                 _meshtree;
         std::vector<uint16_t>                 _frames;
+        std::vector<tr_animation>             _animations;
+        std::vector<tr_state_change>          _state_changes;
+        std::vector<tr_anim_dispatch>         _anim_dispatches;
         std::vector<tr_sprite_texture>        _sprite_textures;
         std::vector<tr_sprite_sequence>       _sprite_sequences;
 
@@ -304,7 +376,7 @@ namespace trlevel
         std::vector<int16_t> _sound_map;
         std::vector<uint32_t> _sample_indices;
         std::vector<uint8_t> _sound_data;
-        std::vector<std::vector<uint8_t>> _sound_samples;
+        std::vector<SoundSample> _sound_samples;
 
         std::shared_ptr<trview::ILog>   _log;
         std::shared_ptr<IDecrypter>     _decrypter;
@@ -315,6 +387,9 @@ namespace trlevel
         IPack::Source _pack_source;
         std::shared_ptr<IPack> _pack;
         std::shared_ptr<IHasher> _hasher;
-        std::string _hash;
+        std::shared_future<std::string> _hash;
+        std::shared_ptr<ILevelCache> _cache;
+        /// The external files read during the current load, if it is being cached.
+        std::optional<std::vector<ExternalFile>> _external_files;
     };
 }
@@ -0,0 +1,127 @@
+#include "LevelCache.h"
+#include <format>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace trlevel
+{
+    ILevelCache::~ILevelCache()
+    {
+    }
+
+    ILevelCache::Entry::~Entry()
+    {
+    }
+
+    namespace
+    {
+#ifdef _WIN32
+        class MappedEntry final : public ILevelCache::Entry
+        {
+        public:
+            MappedEntry(HANDLE file, HANDLE mapping, const void* view, std::size_t size)
+                : _file(file), _mapping(mapping), _view(view), _size(size)
+            {
+            }
+
+            virtual ~MappedEntry()
+            {
+                UnmapViewOfFile(_view);
+                CloseHandle(_mapping);
+                CloseHandle(_file);
+            }
+
+            std::span<const uint8_t> data() const override
+            {
+                return { static_cast<const uint8_t*>(_view), _size };
+            }
+        private:
+            HANDLE _file;
+            HANDLE _mapping;
+            const void* _view;
+            std::size_t _size;
+        };
+#else
+        /// Without file mapping the entry is read into memory instead.
+        class LoadedEntry final : public ILevelCache::Entry
+        {
+        public:
+            explicit LoadedEntry(std::vector<uint8_t>&& bytes)
+                : _bytes(std::move(bytes))
+            {
+            }
+
+            std::span<const uint8_t> data() const override
+            {
+                return _bytes;
+            }
+        private:
+            std::vector<uint8_t> _bytes;
+        };
+#endif
+    }
+
+    LevelCache::LevelCache(const std::shared_ptr<trview::IFiles>& files)
+        : _files(files), _directory(files->appdata_directory() + "\\trview\\cache")
+    {
+    }
+
+    std::unique_ptr<ILevelCache::Entry> LevelCache::open(const std::string& hash) const
+    {
+#ifdef _WIN32
+        const HANDLE file = CreateFileW(trview::to_utf16(entry_filename(hash)).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        return std::make_unique<MappedEntry>(file, mapping, view, static_cast<std::size_t>(size.QuadPart));
+#else
+        auto bytes = _files->load_file(entry_filename(hash));
+        if (!bytes || bytes->empty())
+        {
+            return nullptr;
+        }
+        return std::make_unique<LoadedEntry>(std::move(*bytes));
+#endif
+    }
+
+    void LevelCache::save(const std::string& hash, const std::vector<uint8_t>& data)
+    {
+        _files->create_directory(_directory);
+        _files->save_file(entry_filename(hash), data);
+    }
+
+    void LevelCache::remove(const std::string& hash)
+    {
+        _files->delete_file(entry_filename(hash));
+    }
+
+    std::string LevelCache::entry_filename(const std::string& hash) const
+    {
+        return std::format("{}\\{}.trvc", _directory, hash);
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <trview.common/IFiles.h>
+
+#include "ILevelCache.h"
+
+namespace trlevel
+{
+    /// Level cache that keeps one file per level in the trview application data directory
+    /// and opens entries as read only file mappings.
+    class LevelCache final : public ILevelCache
+    {
+    public:
+        explicit LevelCache(const std::shared_ptr<trview::IFiles>& files);
+        virtual ~LevelCache() = default;
+        std::unique_ptr<Entry> open(const std::string& hash) const override;
+        void save(const std::string& hash, const std::vector<uint8_t>& data) override;
+        void remove(const std::string& hash) override;
+    private:
+        std::string entry_filename(const std::string& hash) const;
+
+        std::shared_ptr<trview::IFiles> _files;
+        std::string _directory;
+    };
+}
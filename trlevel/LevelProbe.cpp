@@ -0,0 +1,174 @@
+#include "LevelProbe.h"
+#include "Level_psx.h"
+
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace trlevel
+{
+    namespace
+    {
+        enum class StepType
+        {
+            None,
+            /// Move forward a fixed number of bytes.
+            Skip,
+            /// Read a 32 bit count and move past that many elements of the given size.
+            SkipCounted
+        };
+
+        struct Step
+        {
+            StepType type{ StepType::None };
+            uint32_t size{ 0 };
+        };
+
+        enum class Check
+        {
+            /// The 32 bit value at the position is the expected version.
+            Equals,
+            /// The 32 bit value at the position is a supported TR4 PSX version.
+            Tr4Psx,
+            /// The 32 bit value at the position is a supported TR5 PSX version.
+            Tr5Psx,
+            /// The file starts with ROOMFILE and has a big endian version after it.
+            SaturnRoomFile
+        };
+
+        struct Signature
+        {
+            std::array<Step, 3> steps;
+            Check check;
+            int32_t version;
+            Platform platform;
+            LevelVersion level_version;
+            bool handy_demo{ false };
+        };
+
+        constexpr Step skip(uint32_t size) { return { StepType::Skip, size }; }
+        constexpr Step skip_counted(uint32_t element_size) { return { StepType::SkipCounted, element_size }; }
+
+        constexpr uint32_t Textile4 = sizeof(tr_textile4);
+        constexpr uint32_t Clut = sizeof(tr_clut);
+
+        /// Checked in order, the first match is used.
+        constexpr std::array<Signature, 14> signatures
+        {{
+            // TR2 PSX has sound data before the version number.
+            { { skip_counted(4), skip_counted(1) }, Check::Equals, 45, Platform::PSX, LevelVersion::Tomb2 },
+            // TR2 beta has TR1 style sounds first.
+            { { skip_counted(1), skip_counted(1) }, Check::Equals, 44, Platform::PSX, LevelVersion::Tomb2 },
+            // TR2 42 has TR1 style sounds then 18 textiles and CLUTs.
+            { { skip_counted(1), skip_counted(1), skip(Textile4 * 18 + Clut * 2048) }, Check::Equals, 42, Platform::PSX, LevelVersion::Tomb2 },
+            // TR2 38 has TR1 style sounds then 14 textiles and CLUTs.
+            { { skip_counted(1), skip_counted(1), skip(Textile4 * 14 + Clut * 1024) }, Check::Equals, 38, Platform::PSX, LevelVersion::Tomb2 },
+            // TR1 PSX August 1996 has textiles first.
+            { { skip(Textile4 * 15 + Clut * 1024) }, Check::Equals, 27, Platform::PSX, LevelVersion::Tomb1 },
+            // TR1 PSX 1996 Demo has textiles first, but object list version is 32.
+            { { skip(Textile4 * 15 + Clut * 1024) }, Check::Equals, 32, Platform::PSX, LevelVersion::Tomb1, true },
+            // TR1 PSX May 1996 has textiles first.
+            { { skip(Textile4 * 21 + Clut * 1024) }, Check::Equals, 11, Platform::PSX, LevelVersion::Tomb1 },
+            // TR1 PSX sometimes has sound separated.
+            { { skip(Textile4 * 13 + Clut * 1024) }, Check::Equals, 32, Platform::PSX, LevelVersion::Tomb1 },
+            { { skip_counted(1), skip_counted(1), skip(Textile4 * 13 + Clut * 1024) }, Check::Equals, 32, Platform::PSX, LevelVersion::Tomb1 },
+            { { skip(0x7000) }, Check::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { { skip(0x7800) }, Check::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { { skip(0x6000) }, Check::Tr4Psx, 0, Platform::PSX, LevelVersion::Tomb4 },
+            { { skip(313344) }, Check::Tr5Psx, 0, Platform::PSX, LevelVersion::Tomb5 },
+            { {}, Check::SaturnRoomFile, 0, Platform::Saturn, LevelVersion::Tomb1 }
+        }};
+
+        std::optional<uint32_t> read_u32(std::span<const uint8_t> data, uint64_t position)
+        {
+            if (position > data.size() || data.size() - position < sizeof(uint32_t))
+            {
+                return std::nullopt;
+            }
+            uint32_t value = 0;
+            std::memcpy(&value, data.data() + position, sizeof(value));
+            return value;
+        }
+
+        std::optional<uint64_t> position_of(std::span<const uint8_t> data, const Signature& signature)
+        {
+            uint64_t position = 0;
+            for (const auto& step : signature.steps)
+            {
+                if (step.type == StepType::Skip)
+                {
+                    position += step.size;
+                }
+                else if (step.type == StepType::SkipCounted)
+                {
+                    const auto count = read_u32(data, position);
+                    if (!count)
+                    {
+                        return std::nullopt;
+                    }
+                    position += sizeof(uint32_t) + static_cast<uint64_t>(count.value()) * step.size;
+                }
+
+                // Anything past the end of the file means that this is not the right layout.
+                if (position > data.size())
+                {
+                    return std::nullopt;
+                }
+            }
+            return position;
+        }
+
+        std::optional<int32_t> match(std::span<const uint8_t> data, const Signature& signature)
+        {
+            if (signature.check == Check::SaturnRoomFile)
+            {
+                constexpr std::string_view room_file = "ROOMFILE";
+                if (data.size() < room_file.size() || !std::equal(room_file.begin(), room_file.end(), data.begin()))
+                {
+                    return std::nullopt;
+                }
+                const auto version = read_u32(data, room_file.size() + 4);
+                return version ? std::optional<int32_t>(std::byteswap(static_cast<int32_t>(version.value()))) : std::nullopt;
+            }
+
+            const auto position = position_of(data, signature);
+            const auto value = position ? read_u32(data, position.value()) : std::nullopt;
+            if (!value)
+            {
+                return std::nullopt;
+            }
+
+            const int32_t version = static_cast<int32_t>(value.value());
+            switch (signature.check)
+            {
+            case Check::Equals:
+                return version == signature.version ? std::optional(version) : std::nullopt;
+            case Check::Tr4Psx:
+                return is_supported_tr4_psx_version(version) ? std::optional(version) : std::nullopt;
+            case Check::Tr5Psx:
+                return is_supported_tr5_psx_version(version) ? std::optional(version) : std::nullopt;
+            }
+            return std::nullopt;
+        }
+    }
+
+    PlatformAndVersion probe_level_version(std::span<const uint8_t> data)
+    {
+        for (const auto& signature : signatures)
+        {
+            if (const auto version = match(data, signature))
+            {
+                PlatformAndVersion result{ .platform = signature.platform, .version = signature.level_version, .raw_version = version.value() };
+                if (signature.handy_demo)
+                {
+                    result.extra.insert("handydemo");
+                }
+                return result;
+            }
+        }
+
+        const auto version = read_u32(data, 0);
+        return version ? convert_level_version(static_cast<int32_t>(version.value())) : PlatformAndVersion{};
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "LevelVersion.h"
+
+namespace trlevel
+{
+    /// Identify the platform and version of a level from its bytes. Levels that don't start with their
+    /// version number are matched against a table of signatures first, then the first four bytes are used
+    /// as the version number. Only a few values are read and this never throws - data that can't be
+    /// identified has an unknown version.
+    PlatformAndVersion probe_level_version(std::span<const uint8_t> data);
+}
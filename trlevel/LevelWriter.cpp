@@ -0,0 +1,841 @@
+#include "LevelWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+
+namespace trlevel
+{
+    namespace
+    {
+        constexpr std::size_t TextilePixels = 256 * 256;
+        constexpr uint32_t Tr1Version = 0x20;
+        constexpr uint32_t Tr2Version = 0x2D;
+        constexpr uint32_t Tr3Version = 0xFF180038;
+        constexpr uint32_t Tr4Version = 0x00345254;
+
+        class ByteWriter final
+        {
+        public:
+            template <typename T>
+            void write(const T& value)
+            {
+                const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+                _data.insert(_data.end(), bytes, bytes + sizeof(T));
+            }
+
+            template <typename T>
+            void write_values(const std::vector<T>& values)
+            {
+                const auto bytes = reinterpret_cast<const uint8_t*>(values.data());
+                _data.insert(_data.end(), bytes, bytes + values.size() * sizeof(T));
+            }
+
+            /// Write the number of values as SizeType followed by the values.
+            template <typename SizeType, typename T>
+            void write_vector(const std::vector<T>& values)
+            {
+                if (values.size() > static_cast<std::size_t>(std::numeric_limits<SizeType>::max()))
+                {
+                    throw std::runtime_error("Too many values for the size of their count");
+                }
+                write(static_cast<SizeType>(values.size()));
+                write_values(values);
+            }
+
+            void write_bytes(std::span<const uint8_t> bytes)
+            {
+                _data.insert(_data.end(), bytes.begin(), bytes.end());
+            }
+
+            void write_zeroes(std::size_t count)
+            {
+                _data.resize(_data.size() + count);
+            }
+
+            /// Write a zlib compressed block, preceded by the uncompressed and compressed sizes.
+            void write_compressed(std::span<const uint8_t> bytes)
+            {
+                uLongf compressed_size = compressBound(static_cast<uLong>(bytes.size()));
+                std::vector<uint8_t> compressed(compressed_size);
+                if (compress(compressed.data(), &compressed_size, bytes.data(), static_cast<uLong>(bytes.size())) != Z_OK)
+                {
+                    throw std::runtime_error("Failed to compress level data");
+                }
+                write(static_cast<uint32_t>(bytes.size()));
+                write(static_cast<uint32_t>(compressed_size));
+                write_bytes({ compressed.data(), compressed_size });
+            }
+
+            std::size_t size() const
+            {
+                return _data.size();
+            }
+
+            const std::vector<uint8_t>& data() const
+            {
+                return _data;
+            }
+
+            std::vector<uint8_t> take()
+            {
+                return std::move(_data);
+            }
+        private:
+            std::vector<uint8_t> _data;
+        };
+
+        using RoomWriter = void(*)(ByteWriter&, const tr3_room&);
+
+        tr_face4 to_face4(const tr4_mesh_face4& face)
+        {
+            return { .vertices = { face.vertices[0], face.vertices[1], face.vertices[2], face.vertices[3] }, .texture = face.texture };
+        }
+
+        tr_face3 to_face3(const tr4_mesh_face3& face)
+        {
+            return { .vertices = { face.vertices[0], face.vertices[1], face.vertices[2] }, .texture = face.texture };
+        }
+
+        /// Inverse of the TR3/4 vertex colour conversion.
+        uint16_t to_colour16(const DirectX::SimpleMath::Color& colour)
+        {
+            const auto channel = [](float value) { return static_cast<uint16_t>(std::clamp(std::lround(value * 16.5f), 0l, 31l)); };
+            return static_cast<uint16_t>(channel(colour.R()) << 10 | channel(colour.G()) << 5 | channel(colour.B()));
+        }
+
+        /// Inverse of the TR5 vertex colour conversion.
+        uint32_t to_colour32(const DirectX::SimpleMath::Color& colour)
+        {
+            const auto channel = [](float value) { return static_cast<uint32_t>(std::clamp(std::lround(value * 128.0f), 0l, 255l)); };
+            return channel(colour.R()) << 16 | channel(colour.G()) << 8 | channel(colour.B());
+        }
+
+        /// Inverse of the 16-bit textile conversion, rounding to the nearest 5-bit value.
+        uint16_t to_textile16(uint32_t pixel)
+        {
+            const auto channel = [](uint32_t value) { return static_cast<uint16_t>(std::lround((value & 0xff) * 31.0f / 255.0f)); };
+            return static_cast<uint16_t>((pixel & 0xff000000 ? 0x8000 : 0) | channel(pixel) << 10 | channel(pixel >> 8) << 5 | channel(pixel >> 16));
+        }
+
+        std::vector<tr_textile16> to_textiles16(const std::vector<std::vector<uint32_t>>& textiles)
+        {
+            std::vector<tr_textile16> result(textiles.size());
+            for (std::size_t t = 0; t < textiles.size(); ++t)
+            {
+                std::ranges::transform(textiles[t], result[t].Tile, to_textile16);
+            }
+            return result;
+        }
+
+        std::vector<tr_textile32> to_textiles32(const std::vector<std::vector<uint32_t>>& textiles)
+        {
+            // Swapping the red and blue channels is its own inverse.
+            std::vector<tr_textile32> result(textiles.size());
+            for (std::size_t t = 0; t < textiles.size(); ++t)
+            {
+                std::ranges::transform(textiles[t], result[t].Tile, convert_textile32);
+            }
+            return result;
+        }
+
+        /// Reduce the textiles to 8-bit with a palette. Entry 0 is used for transparent pixels and the others
+        /// are added as colours are found.
+        std::pair<std::vector<tr_textile8>, std::vector<tr_colour>> to_textiles8(const std::vector<std::vector<uint32_t>>& textiles)
+        {
+            std::vector<tr_textile8> result(textiles.size());
+            std::vector<tr_colour> palette(256, tr_colour{});
+            std::unordered_map<uint32_t, uint8_t> indices;
+            for (std::size_t t = 0; t < textiles.size(); ++t)
+            {
+                for (std::size_t p = 0; p < TextilePixels; ++p)
+                {
+                    const uint32_t pixel = textiles[t][p];
+                    if (!(pixel & 0xff000000))
+                    {
+                        result[t].Tile[p] = 0;
+                        continue;
+                    }
+
+                    const tr_colour colour
+                    {
+                        .Red = static_cast<uint8_t>((pixel & 0xff) >> 2),
+                        .Green = static_cast<uint8_t>(((pixel >> 8) & 0xff) >> 2),
+                        .Blue = static_cast<uint8_t>(((pixel >> 16) & 0xff) >> 2)
+                    };
+                    const uint32_t key = colour.Red << 16 | colour.Green << 8 | colour.Blue;
+                    auto found = indices.find(key);
+                    if (found == indices.end())
+                    {
+                        if (indices.size() == 255)
+                        {
+                            throw std::runtime_error("Textiles use more colours than fit in an 8-bit palette");
+                        }
+                        const auto index = static_cast<uint8_t>(indices.size() + 1);
+                        palette[index] = colour;
+                        found = indices.insert({ key, index }).first;
+                    }
+                    result[t].Tile[p] = found->second;
+                }
+            }
+            return { std::move(result), std::move(palette) };
+        }
+
+        void write_room_info(ByteWriter& file, const tr3_room& room)
+        {
+            file.write(tr1_4_room_info{ .x = room.info.x, .z = room.info.z, .yBottom = room.info.yBottom, .yTop = room.info.yTop });
+        }
+
+        /// Write the vertices, faces and sprites of a TR1-4 room, preceded by their size in words.
+        template <typename ConvertVertex>
+        void write_room_geometry(ByteWriter& file, const tr3_room& room, ConvertVertex&& convert_vertex)
+        {
+            ByteWriter geometry;
+            geometry.write_vector<int16_t>(room.data.vertices | std::views::transform(convert_vertex) | std::ranges::to<std::vector>());
+            geometry.write_vector<int16_t>(room.data.rectangles | std::views::transform(to_face4) | std::ranges::to<std::vector>());
+            geometry.write_vector<int16_t>(room.data.triangles | std::views::transform(to_face3) | std::ranges::to<std::vector>());
+            geometry.write_vector<int16_t>(room.data.sprites);
+            file.write(static_cast<uint32_t>(geometry.size() / 2));
+            file.write_bytes(geometry.data());
+        }
+
+        void check_room_sectors(const tr3_room& room)
+        {
+            if (room.sector_list.size() != static_cast<std::size_t>(room.num_x_sectors) * room.num_z_sectors)
+            {
+                throw std::runtime_error("Room sector count does not match its dimensions");
+            }
+        }
+
+        void write_room_sectors(ByteWriter& file, const tr3_room& room)
+        {
+            check_room_sectors(room);
+            file.write(room.num_z_sectors);
+            file.write(room.num_x_sectors);
+            file.write_values(room.sector_list);
+        }
+
+        template <typename Light>
+        std::vector<Light> room_lights(const tr3_room& room, Light tr_x_room_light::* member)
+        {
+            return room.lights | std::views::transform([&](auto&& light) { return light.*member; }) | std::ranges::to<std::vector>();
+        }
+
+        void write_tr1_room(ByteWriter& file, const tr3_room& room)
+        {
+            write_room_info(file, room);
+            write_room_geometry(file, room, [](const trview_room_vertex& v) { return tr_room_vertex{ .vertex = v.vertex, .lighting = v.lighting }; });
+            file.write_vector<uint16_t>(room.portals);
+            write_room_sectors(file, room);
+            file.write(room.ambient_intensity_1);
+            file.write_vector<uint16_t>(room_lights(room, &tr_x_room_light::tr1));
+            file.write_vector<uint16_t>(room.static_meshes
+                | std::views::transform([](auto&& m) { return tr_room_staticmesh{ .x = m.x, .y = m.y, .z = m.z, .rotation = m.rotation, .intensity = m.colour, .mesh_id = m.mesh_id }; })
+                | std::ranges::to<std::vector>());
+            file.write(room.alternate_room);
+            file.write(room.flags);
+        }
+
+        void write_tr2_room(ByteWriter& file, const tr3_room& room)
+        {
+            write_room_info(file, room);
+            write_room_geometry(file, room, [](const trview_room_vertex& v)
+                {
+                    return tr2_room_vertex{ .vertex = v.vertex, .lighting = v.lighting, .attributes = v.attributes, .lighting2 = v.lighting };
+                });
+            file.write_vector<uint16_t>(room.portals);
+            write_room_sectors(file, room);
+            file.write(room.ambient_intensity_1);
+            file.write(room.ambient_intensity_2);
+            file.write(room.light_mode);
+            file.write_vector<uint16_t>(room_lights(room, &tr_x_room_light::tr2));
+            file.write_vector<uint16_t>(room.static_meshes);
+            file.write(room.alternate_room);
+            file.write(room.flags);
+        }
+
+        tr3_room_vertex to_tr3_room_vertex(const trview_room_vertex& v)
+        {
+            return { .vertex = v.vertex, .lighting = v.lighting, .attributes = v.attributes, .colour = to_colour16(v.colour) };
+        }
+
+        void write_tr3_room(ByteWriter& file, const tr3_room& room)
+        {
+            write_room_info(file, room);
+            write_room_geometry(file, room, to_tr3_room_vertex);
+            file.write_vector<uint16_t>(room.portals);
+            write_room_sectors(file, room);
+            file.write(room.ambient_intensity_1);
+            file.write(room.light_mode);
+            file.write_vector<uint16_t>(room_lights(room, &tr_x_room_light::tr3));
+            file.write_vector<uint16_t>(room.static_meshes);
+            file.write(room.alternate_room);
+            file.write(room.flags);
+            file.write(static_cast<uint8_t>(room.water_scheme));
+            file.write(room.reverb_info);
+            file.write<uint8_t>(0); // filler
+        }
+
+        void write_tr4_room(ByteWriter& file, const tr3_room& room)
+        {
+            write_room_info(file, room);
+            write_room_geometry(file, room, to_tr3_room_vertex);
+            file.write_vector<uint16_t>(room.portals);
+            write_room_sectors(file, room);
+            file.write(room.colour);
+            file.write_vector<uint16_t>(room_lights(room, &tr_x_room_light::tr4));
+            file.write_vector<uint16_t>(room.static_meshes);
+            file.write(room.alternate_room);
+            file.write(room.flags);
+            file.write(static_cast<uint8_t>(room.water_scheme));
+            file.write(room.reverb_info);
+            file.write(room.alternate_group);
+        }
+
+        /// TR5 rooms have a header with offsets to each part of the room data. All of the geometry is
+        /// written as a single layer.
+        void write_tr5_room(ByteWriter& file, const tr3_room& room)
+        {
+            if (room.data.vertices.size() > std::numeric_limits<uint16_t>::max() ||
+                room.data.rectangles.size() > std::numeric_limits<uint16_t>::max() ||
+                room.data.triangles.size() > std::numeric_limits<uint16_t>::max())
+            {
+                throw std::runtime_error("Too much geometry for a single TR5 room layer");
+            }
+
+            ByteWriter data;
+            const auto lights = room_lights(room, &tr_x_room_light::tr5);
+            data.write_values(lights);
+
+            const auto start_sd_offset = static_cast<uint32_t>(data.size());
+            check_room_sectors(room);
+            data.write_values(room.sector_list);
+            const auto end_sd_offset = static_cast<uint32_t>(data.size());
+            data.write_vector<uint16_t>(room.portals);
+            data.write<uint16_t>(0); // separator
+
+            const auto end_portal_offset = static_cast<uint32_t>(data.size());
+            data.write_values(room.static_meshes);
+
+            const auto layer_offset = static_cast<uint32_t>(data.size());
+            const uint32_t num_layers = room.data.vertices.empty() ? 0 : 1;
+            if (num_layers)
+            {
+                tr5_room_layer layer{};
+                layer.num_vertices = static_cast<uint16_t>(room.data.vertices.size());
+                layer.num_rectangles = static_cast<uint16_t>(room.data.rectangles.size());
+                layer.num_triangles = static_cast<uint16_t>(room.data.triangles.size());
+                data.write(layer);
+            }
+
+            const auto poly_offset = static_cast<uint32_t>(data.size());
+            data.write_values(room.data.rectangles);
+            data.write_values(room.data.triangles);
+
+            const auto vertices_offset = static_cast<uint32_t>(data.size());
+            data.write_values(room.data.vertices
+                | std::views::transform([](const trview_room_vertex& v)
+                    {
+                        return tr5_room_vertex
+                        {
+                            .vertex = { static_cast<float>(v.vertex.x), static_cast<float>(v.vertex.y), static_cast<float>(v.vertex.z) },
+                            .normal = { 0, 0, 0 },
+                            .colour = to_colour32(v.colour)
+                        };
+                    })
+                | std::ranges::to<std::vector>());
+
+            tr5_room_header header{};
+            header.end_sd_offset = end_sd_offset;
+            header.start_sd_offset = start_sd_offset;
+            header.end_portal_offset = end_portal_offset;
+            header.info = room.info;
+            header.num_z_sectors = room.num_z_sectors;
+            header.num_x_sectors = room.num_x_sectors;
+            header.colour = room.colour;
+            header.num_lights = static_cast<uint16_t>(lights.size());
+            header.num_static_meshes = static_cast<uint16_t>(room.static_meshes.size());
+            header.reverb_info = room.reverb_info;
+            header.alternate_group = room.alternate_group;
+            header.water_scheme = room.water_scheme;
+            header.alternate_room = static_cast<uint16_t>(room.alternate_room);
+            header.flags = static_cast<uint16_t>(room.flags);
+            header.room_x = static_cast<float>(room.info.x);
+            header.room_y = static_cast<float>(room.info.y);
+            header.room_z = static_cast<float>(room.info.z);
+            header.num_room_triangles = static_cast<uint32_t>(room.data.triangles.size());
+            header.num_room_rectangles = static_cast<uint32_t>(room.data.rectangles.size());
+            header.num_lights2 = header.num_lights;
+            header.room_y_top = static_cast<float>(room.info.yTop);
+            header.room_y_bottom = static_cast<float>(room.info.yBottom);
+            header.num_layers = num_layers;
+            header.layer_offset = layer_offset;
+            header.vertices_offset = vertices_offset;
+            header.poly_offset = poly_offset;
+            header.poly_offset2 = poly_offset;
+            header.vertices_size = static_cast<uint32_t>(data.size()) - vertices_offset;
+
+            file.write_bytes(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>("XELA"), 4));
+            file.write(static_cast<uint32_t>(sizeof(header) + data.size()));
+            file.write(header);
+            file.write_bytes(data.data());
+        }
+
+        template <typename SizeType>
+        void write_rooms(ByteWriter& file, const std::vector<tr3_room>& rooms, RoomWriter write_room)
+        {
+            if (rooms.size() > static_cast<std::size_t>(std::numeric_limits<SizeType>::max()))
+            {
+                throw std::runtime_error("Too many rooms for the level version");
+            }
+            file.write(static_cast<SizeType>(rooms.size()));
+            for (const auto& room : rooms)
+            {
+                write_room(file, room);
+            }
+        }
+
+        void write_mesh(ByteWriter& file, const tr_mesh& mesh, LevelVersion version)
+        {
+            file.write(mesh.centre);
+            file.write(mesh.coll_radius);
+            file.write_vector<int16_t>(mesh.vertices);
+            if (!mesh.normals.empty())
+            {
+                file.write_vector<int16_t>(mesh.normals);
+            }
+            else
+            {
+                // A negative count means that there are lights instead of normals.
+                file.write(static_cast<int16_t>(-static_cast<int32_t>(mesh.lights.size())));
+                file.write_values(mesh.lights);
+            }
+
+            if (version < LevelVersion::Tomb4)
+            {
+                file.write_vector<int16_t>(mesh.textured_rectangles | std::views::transform(to_face4) | std::ranges::to<std::vector>());
+                file.write_vector<int16_t>(mesh.textured_triangles | std::views::transform(to_face3) | std::ranges::to<std::vector>());
+                file.write_vector<int16_t>(mesh.coloured_rectangles);
+                file.write_vector<int16_t>(mesh.coloured_triangles);
+            }
+            else
+            {
+                file.write_vector<int16_t>(mesh.textured_rectangles);
+                file.write_vector<int16_t>(mesh.textured_triangles);
+            }
+        }
+
+        tr4_animation to_tr4_animation(const tr_animation& a)
+        {
+            return
+            {
+                .FrameOffset = a.FrameOffset, .FrameRate = a.FrameRate, .FrameSize = a.FrameSize, .State_ID = a.State_ID,
+                .Speed = a.Speed, .Accel = a.Accel, .SpeedLateral = 0, .AccelLateral = 0,
+                .FrameStart = a.FrameStart, .FrameEnd = a.FrameEnd, .NextAnimation = a.NextAnimation, .NextFrame = a.NextFrame,
+                .NumStateChanges = a.NumStateChanges, .StateChangeOffset = a.StateChangeOffset,
+                .NumAnimCommands = a.NumAnimCommands, .AnimCommand = a.AnimCommand
+            };
+        }
+
+        tr4_object_texture to_tr4_object_texture(const tr_object_texture& texture)
+        {
+            tr4_object_texture result{ .Attribute = texture.Attribute, .TileAndFlag = texture.TileAndFlag };
+            std::memcpy(result.Vertices, texture.Vertices, sizeof(result.Vertices));
+            return result;
+        }
+
+        /// Floor data through to static meshes are laid out the same way in every version.
+        void write_floor_data_to_static_meshes(ByteWriter& file, const LevelContent& content, LevelVersion version)
+        {
+            file.write_vector<uint32_t>(content.floor_data);
+
+            ByteWriter mesh_data;
+            std::vector<uint32_t> mesh_pointers;
+            for (const auto& mesh : content.meshes)
+            {
+                mesh_pointers.push_back(static_cast<uint32_t>(mesh_data.size()));
+                write_mesh(mesh_data, mesh, version);
+            }
+            file.write(static_cast<uint32_t>(mesh_data.size() / 2));
+            file.write_bytes(mesh_data.data());
+            file.write_vector<uint32_t>(mesh_pointers);
+
+            if (version < LevelVersion::Tomb4)
+            {
+                file.write_vector<uint32_t>(content.animations);
+            }
+            else
+            {
+                file.write_vector<uint32_t>(content.animations | std::views::transform(to_tr4_animation) | std::ranges::to<std::vector>());
+            }
+            file.write_vector<uint32_t>(content.state_changes);
+            file.write_vector<uint32_t>(content.anim_dispatches);
+            file.write<uint32_t>(0); // anim commands
+            file.write_vector<uint32_t>(content.meshtree);
+            file.write_vector<uint32_t>(content.frames);
+
+            if (version == LevelVersion::Tomb5)
+            {
+                file.write_vector<uint32_t>(content.models
+                    | std::views::transform([](auto&& m) { return tr5_model{ .model = m, .filler = 0 }; })
+                    | std::ranges::to<std::vector>());
+            }
+            else
+            {
+                file.write_vector<uint32_t>(content.models);
+            }
+            file.write_vector<uint32_t>(content.static_meshes);
+        }
+
+        /// Boxes, overlaps and zones are written empty.
+        void write_boxes(ByteWriter& file)
+        {
+            file.write<uint32_t>(0);
+            file.write<uint32_t>(0);
+        }
+
+        /// An empty set of animated textures - one word for the sequence count.
+        void write_animated_textures(ByteWriter& file)
+        {
+            file.write<uint32_t>(1);
+            file.write<int16_t>(0);
+        }
+
+        /// Cinematic frames, demo data, sound map and sound details, all empty.
+        void write_cinematics_to_sound_details(ByteWriter& file)
+        {
+            file.write<uint16_t>(0);
+            file.write<uint16_t>(0);
+            file.write<uint32_t>(0);
+        }
+
+        void write_palettes_tr2_3(ByteWriter& file)
+        {
+            file.write_zeroes(sizeof(tr_colour) * 256);
+            file.write_zeroes(sizeof(tr_colour4) * 256);
+        }
+
+        void write_textiles_tr2_3(ByteWriter& file, const LevelContent& content)
+        {
+            file.write(static_cast<uint32_t>(content.textiles.size()));
+            file.write_zeroes(sizeof(tr_textile8) * content.textiles.size());
+            file.write_values(to_textiles16(content.textiles));
+        }
+
+        void write_textiles_tr4_5(ByteWriter& file, const LevelContent& content)
+        {
+            if (content.textiles.size() > std::numeric_limits<uint16_t>::max())
+            {
+                throw std::runtime_error("Too many textiles for the level version");
+            }
+
+            const auto as_bytes = [](const auto& values)
+                {
+                    return std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(values.data()), values.size() * sizeof(values[0]));
+                };
+
+            // All textiles are counted as room textiles.
+            file.write(static_cast<uint16_t>(content.textiles.size()));
+            file.write<uint16_t>(0);
+            file.write<uint16_t>(0);
+            file.write_compressed(as_bytes(to_textiles32(content.textiles)));
+            file.write_compressed(as_bytes(to_textiles16(content.textiles)));
+            file.write_compressed(as_bytes(std::vector<tr_textile32>(2)));
+        }
+
+        void write_tr1(ByteWriter& file, const LevelContent& content)
+        {
+            const auto [textiles, palette] = to_textiles8(content.textiles);
+            file.write(Tr1Version);
+            file.write_vector<uint32_t>(textiles);
+            file.write<uint32_t>(0); // unused
+            write_rooms<uint16_t>(file, content.rooms, write_tr1_room);
+            write_floor_data_to_static_meshes(file, content, LevelVersion::Tomb1);
+            file.write_vector<uint32_t>(content.object_textures);
+            file.write_vector<uint32_t>(content.sprite_textures);
+            file.write_vector<uint32_t>(content.sprite_sequences);
+            file.write_vector<uint32_t>(content.cameras);
+            file.write_vector<uint32_t>(content.sound_sources);
+            write_boxes(file);
+            write_animated_textures(file);
+            file.write_vector<uint32_t>(content.entities
+                | std::views::transform([](auto&& e) { return tr_entity{ e.TypeID, e.Room, e.x, e.y, e.z, e.Angle, e.Intensity1, e.Flags }; })
+                | std::ranges::to<std::vector>());
+            file.write_zeroes(32 * 256); // light map
+            file.write_values(palette);
+            write_cinematics_to_sound_details(file);
+            file.write<int32_t>(0); // sound data
+            file.write<uint32_t>(0); // sample indices
+        }
+
+        void write_tr2(ByteWriter& file, const LevelContent& content)
+        {
+            file.write(Tr2Version);
+            write_palettes_tr2_3(file);
+            write_textiles_tr2_3(file, content);
+            file.write<uint32_t>(0); // unused
+            write_rooms<uint16_t>(file, content.rooms, write_tr2_room);
+            write_floor_data_to_static_meshes(file, content, LevelVersion::Tomb2);
+            file.write_vector<uint32_t>(content.object_textures);
+            file.write_vector<uint32_t>(content.sprite_textures);
+            file.write_vector<uint32_t>(content.sprite_sequences);
+            file.write_vector<uint32_t>(content.cameras);
+            file.write_vector<uint32_t>(content.sound_sources);
+            write_boxes(file);
+            write_animated_textures(file);
+            file.write_vector<uint32_t>(content.entities);
+            file.write_zeroes(32 * 256); // light map
+            write_cinematics_to_sound_details(file);
+            file.write<uint32_t>(0); // sample indices
+        }
+
+        void write_tr3(ByteWriter& file, const LevelContent& content)
+        {
+            file.write(Tr3Version);
+            write_palettes_tr2_3(file);
+            write_textiles_tr2_3(file, content);
+            file.write<uint32_t>(0); // unused
+            write_rooms<uint16_t>(file, content.rooms, write_tr3_room);
+            write_floor_data_to_static_meshes(file, content, LevelVersion::Tomb3);
+            file.write_vector<uint32_t>(content.sprite_textures);
+            file.write_vector<uint32_t>(content.sprite_sequences);
+            file.write_vector<uint32_t>(content.cameras);
+            file.write_vector<uint32_t>(content.sound_sources);
+            write_boxes(file);
+            write_animated_textures(file);
+            file.write_vector<uint32_t>(content.object_textures);
+            file.write_vector<uint32_t>(content.entities);
+            file.write_zeroes(32 * 256); // light map
+            write_cinematics_to_sound_details(file);
+            file.write<uint32_t>(0); // sample indices
+        }
+
+        /// The part of a TR4/5 level that is compressed in TR4. Markers are three bytes in TR4 and four in TR5.
+        std::vector<uint8_t> level_data_tr4_5(const LevelContent& content, LevelVersion version)
+        {
+            const std::size_t marker_size = version == LevelVersion::Tomb5 ? 4 : 3;
+
+            ByteWriter data;
+            data.write<uint32_t>(0); // unused
+            if (version == LevelVersion::Tomb5)
+            {
+                write_rooms<uint32_t>(data, content.rooms, write_tr5_room);
+            }
+            else
+            {
+                write_rooms<uint16_t>(data, content.rooms, write_tr4_room);
+            }
+            write_floor_data_to_static_meshes(data, content, version);
+            data.write_bytes(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>("SPR"), marker_size));
+            data.write_vector<uint32_t>(content.sprite_textures);
+            data.write_vector<uint32_t>(content.sprite_sequences);
+            data.write_vector<uint32_t>(content.cameras);
+            data.write<uint32_t>(0); // flyby cameras
+            data.write_vector<uint32_t>(content.sound_sources);
+            write_boxes(data);
+            write_animated_textures(data);
+            data.write<uint8_t>(0); // animated texture uv count
+            data.write_bytes(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>("TEX"), marker_size));
+            if (version == LevelVersion::Tomb5)
+            {
+                data.write_vector<uint32_t>(content.object_textures
+                    | std::views::transform([](auto&& t) { return tr5_object_texture{ .tr4_texture = to_tr4_object_texture(t), .filler = 0 }; })
+                    | std::ranges::to<std::vector>());
+            }
+            else
+            {
+                data.write_vector<uint32_t>(content.object_textures | std::views::transform(to_tr4_object_texture) | std::ranges::to<std::vector>());
+            }
+            data.write_vector<uint32_t>(content.entities);
+            data.write_vector<uint32_t>(content.ai_objects);
+            data.write<uint16_t>(0); // demo data
+            data.write<uint32_t>(0); // sound details
+            data.write<uint32_t>(0); // sample indices
+            return data.take();
+        }
+
+        void write_tr4(ByteWriter& file, const LevelContent& content)
+        {
+            file.write(Tr4Version);
+            write_textiles_tr4_5(file, content);
+            file.write_compressed(level_data_tr4_5(content, LevelVersion::Tomb4));
+            file.write<uint32_t>(0); // sound samples
+        }
+
+        void write_tr5(ByteWriter& file, const LevelContent& content)
+        {
+            file.write(Tr4Version);
+            write_textiles_tr4_5(file, content);
+            file.write<uint16_t>(0); // lara type
+            file.write<uint16_t>(0); // weather type
+            file.write_zeroes(28);
+
+            // TR5 level data isn't compressed, but still has both sizes.
+            const auto data = level_data_tr4_5(content, LevelVersion::Tomb5);
+            file.write(static_cast<uint32_t>(data.size()));
+            file.write(static_cast<uint32_t>(data.size()));
+            file.write_bytes(data);
+            file.write<uint32_t>(0); // sound samples
+        }
+
+        constexpr std::array<std::array<uint16_t, 4>, 6> cube_faces
+        {{
+            { 0, 1, 2, 3 }, { 7, 6, 5, 4 }, { 0, 4, 5, 1 }, { 1, 5, 6, 2 }, { 2, 6, 7, 3 }, { 3, 7, 4, 0 }
+        }};
+    }
+
+    LevelContent generate_level(const SyntheticLevelCounts& counts)
+    {
+        LevelContent content;
+
+        // Blocks of colour in steps of 32 so that they are exact in the 8-bit palette.
+        std::vector<uint32_t> pixels(TextilePixels);
+        for (uint32_t y = 0; y < 256; ++y)
+        {
+            for (uint32_t x = 0; x < 256; ++x)
+            {
+                pixels[x + y * 256] = 0xff000000 | (y & 0xe0) << 8 | (x & 0xe0);
+            }
+        }
+        content.textiles.assign(counts.textiles, pixels);
+
+        for (uint32_t t = 0; t < counts.textiles; ++t)
+        {
+            content.object_textures.push_back(
+                {
+                    .Attribute = 0,
+                    .TileAndFlag = static_cast<uint16_t>(t),
+                    .Vertices = { { 0, 0, 0, 0 }, { 0, 255, 0, 0 }, { 0, 255, 0, 255 }, { 0, 0, 0, 255 } }
+                });
+        }
+        const auto texture = [&](std::size_t index) { return static_cast<uint16_t>(content.object_textures.empty() ? 0 : index % content.object_textures.size()); };
+
+        // Room vertices are relative to the room, so no more sectors than fit in 16 bits.
+        const uint16_t sectors = std::clamp<uint16_t>(counts.sectors, 1, 31);
+        const uint16_t side = sectors + 1;
+        content.floor_data.push_back(0);
+        for (uint32_t r = 0; r < counts.rooms; ++r)
+        {
+            tr3_room room;
+            room.info = { .x = static_cast<int32_t>(r % 32) * sectors * 1024, .y = 0, .z = static_cast<int32_t>(r / 32) * sectors * 1024, .yBottom = 0, .yTop = -1024 };
+            room.num_x_sectors = sectors;
+            room.num_z_sectors = sectors;
+            room.sector_list.assign(sectors * sectors, { .floordata_index = 0, .box_index = 0xffff, .room_below = 0xff, .floor = 0, .room_above = 0xff, .ceiling = -4 });
+            room.alternate_group = 0;
+            for (uint16_t z = 0; z < side; ++z)
+            {
+                for (uint16_t x = 0; x < side; ++x)
+                {
+                    room.data.vertices.push_back({ .vertex = { static_cast<int16_t>(x * 1024), 0, static_cast<int16_t>(z * 1024) }, .lighting = 0x1000 });
+                }
+            }
+            for (uint16_t z = 0; z < sectors; ++z)
+            {
+                for (uint16_t x = 0; x < sectors; ++x)
+                {
+                    const uint16_t corner = x + z * side;
+                    room.data.rectangles.push_back(
+                        {
+                            .vertices = { corner, static_cast<uint16_t>(corner + 1), static_cast<uint16_t>(corner + side + 1), static_cast<uint16_t>(corner + side) },
+                            .texture = texture(x + z),
+                            .effects = 0
+                        });
+                }
+            }
+            content.rooms.push_back(room);
+        }
+
+        // One trigger per sector, working through each room in turn.
+        if (counts.entities > 0)
+        {
+            const uint64_t capacity = static_cast<uint64_t>(counts.rooms) * sectors * sectors;
+            const uint32_t triggers = static_cast<uint32_t>(std::min<uint64_t>(counts.triggers, capacity));
+            for (uint32_t t = 0; t < triggers; ++t)
+            {
+                auto& sector = content.rooms[t % counts.rooms].sector_list[t / counts.rooms];
+                sector.floordata_index = static_cast<uint16_t>(content.floor_data.size());
+                const uint16_t entity = static_cast<uint16_t>(t % std::min<uint32_t>(counts.entities, 0x400));
+                content.floor_data.insert(content.floor_data.end(), { 0x8004, 0x3e00, static_cast<uint16_t>(0x8000 | entity) });
+            }
+        }
+
+        for (uint32_t m = 0; m < counts.meshes; ++m)
+        {
+            tr_mesh mesh{ .centre = { 0, 0, 0 }, .coll_radius = 222 };
+            for (int16_t v = 0; v < 8; ++v)
+            {
+                mesh.vertices.push_back({ static_cast<int16_t>(v & 1 ? 128 : -128), static_cast<int16_t>(v & 4 ? 128 : -128), static_cast<int16_t>(v & 2 ? 128 : -128) });
+                mesh.lights.push_back(0x1000);
+            }
+            for (uint16_t f = 0; f < counts.mesh_faces; ++f)
+            {
+                const auto& face = cube_faces[f % cube_faces.size()];
+                mesh.textured_rectangles.push_back({ .vertices = { face[0], face[1], face[2], face[3] }, .texture = texture(f), .effects = 0 });
+            }
+            content.meshes.push_back(mesh);
+        }
+
+        // Models start at a 16-bit mesh pointer index. They all share a zeroed first frame.
+        content.frames.assign(12, 0);
+        const uint32_t models = std::min<uint32_t>(counts.meshes, 0x10000);
+        for (uint32_t m = 0; m < models; ++m)
+        {
+            content.models.push_back({ .ID = m, .NumMeshes = 1, .StartingMesh = static_cast<uint16_t>(m), .MeshTree = 0, .FrameOffset = 0, .Animation = 0 });
+        }
+
+        for (uint32_t e = 0; e < counts.entities; ++e)
+        {
+            const std::size_t room = content.rooms.empty() ? 0 : e % content.rooms.size();
+            const auto info = content.rooms.empty() ? tr_room_info{} : content.rooms[room].info;
+            content.entities.push_back(
+                {
+                    .TypeID = static_cast<int16_t>(content.models.empty() ? 0 : e % content.models.size()),
+                    .Room = static_cast<int16_t>(room),
+                    .x = info.x + sectors * 512,
+                    .y = 0,
+                    .z = info.z + sectors * 512,
+                    .Angle = 0,
+                    .Intensity1 = -1,
+                    .Intensity2 = -1,
+                    .Flags = 0x3e00
+                });
+        }
+
+        return content;
+    }
+
+    std::vector<uint8_t> write_level(const LevelContent& content, LevelVersion version)
+    {
+        if (std::ranges::any_of(content.textiles, [](auto&& t) { return t.size() != TextilePixels; }))
+        {
+            throw std::runtime_error("Textiles must be 256x256 pixels");
+        }
+
+        ByteWriter file;
+        switch (version)
+        {
+        case LevelVersion::Tomb1:
+            write_tr1(file, content);
+            break;
+        case LevelVersion::Tomb2:
+            write_tr2(file, content);
+            break;
+        case LevelVersion::Tomb3:
+            write_tr3(file, content);
+            break;
+        case LevelVersion::Tomb4:
+            write_tr4(file, content);
+            break;
+        case LevelVersion::Tomb5:
+            write_tr5(file, content);
+            break;
+        default:
+            throw std::runtime_error("Only Tomb1 to Tomb5 levels can be written");
+        }
+        return file.take();
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "LevelVersion.h"
+#include "trtypes.h"
+#include "tr_rooms.h"
+
+namespace trlevel
+{
+    /// Level content in the form that the loaders produce it, which can be written out as a PC level.
+    /// Each mesh is written once and given one mesh pointer, in order. Room lights are written from the
+    /// member of tr_x_room_light that matches the version being written.
+    struct LevelContent
+    {
+        /// 256x256 pixels per textile, in the form reported by the textile callback.
+        std::vector<std::vector<uint32_t>> textiles;
+        std::vector<tr3_room> rooms;
+        std::vector<uint16_t> floor_data;
+        std::vector<tr_mesh> meshes;
+        std::vector<tr_animation> animations;
+        std::vector<tr_state_change> state_changes;
+        std::vector<tr_anim_dispatch> anim_dispatches;
+        std::vector<uint32_t> meshtree;
+        std::vector<uint16_t> frames;
+        std::vector<tr_model> models;
+        std::vector<tr_staticmesh> static_meshes;
+        std::vector<tr_object_texture> object_textures;
+        std::vector<tr_sprite_texture> sprite_textures;
+        std::vector<tr_sprite_sequence> sprite_sequences;
+        std::vector<tr_camera> cameras;
+        std::vector<tr_sound_source> sound_sources;
+        std::vector<tr2_entity> entities;
+        std::vector<tr4_ai_object> ai_objects;
+    };
+
+    /// How much of everything to put in a generated level.
+    struct SyntheticLevelCounts
+    {
+        uint32_t rooms{ 1 };
+        /// Sectors along each side of a room, from 1 to 31 so that room vertices fit in 16 bits. Every sector has a floor rectangle.
+        uint16_t sectors{ 4 };
+        /// Each mesh gets a model with the same index, up to the number of models a level can hold.
+        uint32_t meshes{ 1 };
+        uint16_t mesh_faces{ 6 };
+        uint32_t entities{ 1 };
+        /// Triggers are placed one per sector and activate entities, so none are generated without entities.
+        uint32_t triggers{ 0 };
+        uint32_t textiles{ 1 };
+    };
+
+    /// Generate level content with the given counts. The content can be written as any version - the
+    /// textiles use few enough colours to fit in an 8-bit palette.
+    LevelContent generate_level(const SyntheticLevelCounts& counts);
+
+    /// Serialise the content as a PC level of the given version. TR4 level data is compressed. Tomb5 shares
+    /// its version number with Tomb4, so the level must be saved with a .trc extension to be read back as Tomb5.
+    /// Values that the version can't represent are converted the way the loader would see them - TR1 textiles
+    /// are reduced to an 8-bit palette (throws if more than 255 colours are used) and TR2/3 textiles to 16-bit.
+    std::vector<uint8_t> write_level(const LevelContent& content, LevelVersion version);
+}
@@ -0,0 +1,190 @@
+#include "Level.h"
+#include "CacheFormat.h"
+#include <format>
+
+namespace trlevel
+{
+    template <typename Self, typename Visitor>
+    void Level::visit_cached(Self& level, Visitor&& visitor)
+    {
+        // The 4 bit textiles and CLUTs are only kept after loading for PSX object colours.
+        visitor(level._palette,
+            level._palette16,
+            level._num_textiles,
+            level._textile4,
+            level._clut,
+            level._rooms,
+            level._object_textures,
+            level._object_textures_psx,
+            level._animated_textures,
+            level._animated_texture_uv_count,
+            level._floor_data,
+            level._models,
+            level._entities,
+            level._static_meshes,
+            level._ai_objects,
+            level._lara_type,
+            level._weather_type,
+            level._meshes,
+            level._mesh_pointer_meshes,
+            level._model_tables,
+            level._mesh_pointers,
+            level._meshtree,
+            level._frames,
+            level._animations,
+            level._state_changes,
+            level._anim_dispatches,
+            level._sprite_textures,
+            level._sprite_sequences,
+            level._cameras,
+            level._flyby_cameras,
+            level._sound_sources,
+            level._sound_details,
+            level._sound_map,
+            level._trng);
+    }
+
+    void Level::ExternalFile::write(CacheWriter& writer) const
+    {
+        writer(filename, hash);
+    }
+
+    void Level::ExternalFile::read(CacheReader& reader)
+    {
+        reader(filename, hash);
+    }
+
+    ILevel::LoadCallbacks Level::record_callbacks(const LoadCallbacks& callbacks, CacheRecording& recording) const
+    {
+        LoadCallbacks recording_callbacks = callbacks;
+        recording_callbacks.on_textile_callback = [&](const std::vector<uint32_t>& data, uint32_t width, uint32_t height)
+            {
+                recording.textiles.push_back(data);
+                if (callbacks.on_textile_callback)
+                {
+                    callbacks.on_textile_callback(data, width, height);
+                }
+            };
+        recording_callbacks.on_sound_callback = [&](uint16_t sound_map, uint16_t sound_details, uint16_t sample_index, const SoundSample& sample)
+            {
+                const auto [existing, inserted] = recording.samples.try_emplace(sample_index, recording.sounds.size());
+                CacheRecording::Sound sound
+                {
+                    .sound_map = sound_map,
+                    .sound_details = sound_details,
+                    .sample_index = sample_index,
+                    .format = sample.format,
+                    .sample_frequency = sample.sample_frequency
+                };
+
+                if (inserted)
+                {
+                    const auto bytes = sample.bytes();
+                    sound.offset = recording.sound_data.size();
+                    sound.size = bytes.size();
+                    recording.sound_data.insert(recording.sound_data.end(), bytes.begin(), bytes.end());
+                }
+                else
+                {
+                    sound.offset = recording.sounds[existing->second].offset;
+                    sound.size = recording.sounds[existing->second].size;
+                }
+                recording.sounds.push_back(sound);
+
+                if (callbacks.on_sound_callback)
+                {
+                    callbacks.on_sound_callback(sound_map, sound_details, sample_index, sample);
+                }
+            };
+        return recording_callbacks;
+    }
+
+    bool Level::load_from_cache(trview::Activity& activity, const LoadCallbacks& callbacks)
+    {
+        std::vector<std::vector<uint32_t>> textiles;
+        std::vector<CacheRecording::Sound> sounds;
+        std::shared_ptr<const std::vector<uint8_t>> sound_data;
+        bool remastered = false;
+
+        try
+        {
+            const auto entry = _cache->open(hash());
+            if (!entry)
+            {
+                return false;
+            }
+
+            callbacks.on_progress("Loading from cache");
+            CacheReader reader(entry->data(), hash());
+
+            // Sounds can come from files next to the level, so the entry is stale if any of those has changed.
+            std::vector<ExternalFile> external_files;
+            reader(external_files, remastered);
+            for (const auto& external : external_files)
+            {
+                const auto bytes = _files->load_file(external.filename);
+                if ((bytes ? _hasher->hash(*bytes) : std::string()) != external.hash)
+                {
+                    throw std::runtime_error(std::format("{} has changed", external.filename));
+                }
+            }
+
+            visit_cached(*this, reader);
+            reader(textiles, sounds);
+            const auto sound_bytes = reader.read_span<uint8_t>();
+            if (std::ranges::any_of(sounds, [&](const auto& s) { return s.offset > sound_bytes.size() || s.size > sound_bytes.size() - s.offset; }))
+            {
+                throw std::runtime_error("Cached sound is outside of the sound data");
+            }
+
+            // Samples share one buffer, as they do when parsed, so that the mapping can be closed.
+            sound_data = std::make_shared<const std::vector<uint8_t>>(sound_bytes.begin(), sound_bytes.end());
+        }
+        catch (const std::exception& e)
+        {
+            // Discard whatever was read so that the level can be parsed from scratch and cached again.
+            activity.log(trview::LogMessage::Status::Warning, std::format("Discarding cached level: {}", e.what()));
+            visit_cached(*this, [](auto&... fields) { ((fields = {}), ...); });
+            _cache->remove(hash());
+            return false;
+        }
+
+        // Set when MAIN.SFX was found with the remastered layout, which a cached load doesn't look for.
+        _platform_and_version.remastered |= remastered;
+        activity.log("Loaded level from cache");
+        for (const auto& textile : textiles)
+        {
+            callbacks.on_textile(textile);
+        }
+
+        for (const auto& sound : sounds)
+        {
+            callbacks.on_sound(sound.sound_map, sound.sound_details, sound.sample_index,
+                {
+                    .source = sound_data,
+                    .offset = static_cast<std::size_t>(sound.offset),
+                    .size = static_cast<std::size_t>(sound.size),
+                    .format = sound.format,
+                    .sample_frequency = sound.sample_frequency
+                });
+        }
+        return true;
+    }
+
+    void Level::save_to_cache(trview::Activity& activity, const CacheRecording& recording) const
+    {
+        try
+        {
+            CacheWriter writer(hash());
+            writer(_external_files.value_or(std::vector<ExternalFile>{}), _platform_and_version.remastered);
+            visit_cached(*this, writer);
+            writer(recording.textiles, recording.sounds, recording.sound_data);
+            _cache->save(hash(), writer.finish());
+            activity.log("Saved level to cache");
+        }
+        catch (const std::exception& e)
+        {
+            activity.log(trview::LogMessage::Status::Warning, std::format("Failed to save level to cache: {}", e.what()));
+        }
+    }
+}
@@ -53,7 +53,7 @@ namespace trlevel
         callbacks.on_progress("Reading AI objects");
         log_file(activity, file, "Reading AI objects");
         const auto ai_objects = read_vector<uint32_t, tr4_ai_object>(file);
-        log_file(activity, file, std::format("Read {} AI objects", ai_objects.size()));
+        log_file(activity, file, "Read {} AI objects", ai_objects.size());
         return ai_objects;
     }
 
@@ -74,7 +74,7 @@ namespace trlevel
         }
 
         file.seekg(static_cast<std::size_t>(start) + word_count * 2);
-        log_file(activity, file, std::format("Read {} animated textures sequences", textures.size()));
+        log_file(activity, file, "Read {} animated textures sequences", textures.size());
         return textures;
     }
 
@@ -83,7 +83,7 @@ namespace trlevel
         callbacks.on_progress("Reading animated textures UV count");
         log_file(activity, file, "Reading animated textures UV count");
         uint8_t animated_textures_uv_count = read<uint8_t>(file);
-        log_file(activity, file, std::format("Animated texture UV count: {}", animated_textures_uv_count));
+        log_file(activity, file, "Animated texture UV count: {}", animated_textures_uv_count);
         return animated_textures_uv_count;
     }
 
@@ -106,7 +106,7 @@ namespace trlevel
         callbacks.on_progress("Reading anim commands");
         log_file(activity, file, "Reading anim commands");
         const auto anim_commands = read_vector<uint32_t, tr_anim_command>(file);
-        log_file(activity, file, std::format("Read {} anim commands", anim_commands.size()));
+        log_file(activity, file, "Read {} anim commands", anim_commands.size());
         return anim_commands;
     }
 
@@ -115,7 +115,7 @@ namespace trlevel
         callbacks.on_progress("Reading anim dispatches");
         log_file(activity, file, "Reading anim dispatches");
         const auto anim_dispatches = read_vector<uint32_t, tr_anim_dispatch>(file);
-        log_file(activity, file, std::format("Read {} anim dispatches", anim_dispatches.size()));
+        log_file(activity, file, "Read {} anim dispatches", anim_dispatches.size());
         return anim_dispatches;
     }
 
@@ -125,7 +125,7 @@ namespace trlevel
         log_file(activity, file, "Reading boxes");
         std::vector<tr2_box> boxes = read_vector<uint32_t, tr2_box>(file);
         uint32_t num_boxes = static_cast<uint32_t>(boxes.size());
-        log_file(activity, file, std::format("Read {} boxes", num_boxes));
+        log_file(activity, file, "Read {} boxes", num_boxes);
         return boxes;
     }
 
@@ -134,7 +134,7 @@ namespace trlevel
         callbacks.on_progress("Reading cameras");
         log_file(activity, file, "Reading cameras");
         const auto cameras = read_vector<uint32_t, tr_camera>(file);
-        log_file(activity, file, std::format("Read {} cameras", cameras.size()));
+        log_file(activity, file, "Read {} cameras", cameras.size());
         return cameras;
     }
 
@@ -143,7 +143,7 @@ namespace trlevel
         callbacks.on_progress("Reading cinematic frames");
         log_file(activity, file, "Reading cinematic frames");
         std::vector<tr_cinematic_frame> cinematic_frames = read_vector<uint16_t, tr_cinematic_frame>(file);
-        log_file(activity, file, std::format("Read {} cinematic frames", cinematic_frames.size()));
+        log_file(activity, file, "Read {} cinematic frames", cinematic_frames.size());
         return cinematic_frames;
     }
 
@@ -152,7 +152,7 @@ namespace trlevel
         callbacks.on_progress("Reading demo data");
         log_file(activity, file, "Reading demo data");
         auto demo_data = read_vector<uint16_t, uint8_t>(file);
-        log_file(activity, file, std::format("Read {} demo data", demo_data.size()));
+        log_file(activity, file, "Read {} demo data", demo_data.size());
         return demo_data;
     }
 
@@ -162,7 +162,7 @@ namespace trlevel
         log_file(activity, file, "Reading entities");
         // TR4 entity is in here, OCB is not set but goes into intensity2 (convert later).
         const auto entities = read_vector<uint32_t, tr2_entity>(file);
-        log_file(activity, file, std::format("Read {} entities", entities.size()));
+        log_file(activity, file, "Read {} entities", entities.size());
         return entities;
     }
 
@@ -171,7 +171,7 @@ namespace trlevel
         callbacks.on_progress("Reading floor data");
         log_file(activity, file, "Reading floor data");
         const auto floor_data = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} floor data", floor_data.size()));
+        log_file(activity, file, "Read {} floor data", floor_data.size());
         return floor_data;
     }
 
@@ -180,15 +180,15 @@ namespace trlevel
         callbacks.on_progress("Reading flyby cameras");
         log_file(activity, file, "Reading flyby cameras");
         std::vector<tr4_flyby_camera> flyby_cameras = read_vector<uint32_t, tr4_flyby_camera>(file);
-        log_file(activity, file, std::format("Read {} flyby cameras", flyby_cameras.size()));
+        log_file(activity, file, "Read {} flyby cameras", flyby_cameras.size());
         return flyby_cameras;
     }
 
     void read_fog_bulbs_tr5_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, uint32_t num_fog_bulbs)
     {
-        log_file(activity, file, std::format("Reading {} fog bulbs", num_fog_bulbs));
+        log_file(activity, file, "Reading {} fog bulbs", num_fog_bulbs);
         auto fog_bulbs = read_vector<tr5_fog_bulb>(file, num_fog_bulbs);
-        log_file(activity, file, std::format("Read {} fog bulbs", fog_bulbs.size()));
+        log_file(activity, file, "Read {} fog bulbs", fog_bulbs.size());
 
         log_file(activity, file, "Converting lights to fog bulbs");
         uint32_t fog_bulb = 0;
@@ -208,7 +208,7 @@ namespace trlevel
         callbacks.on_progress("Reading frames");
         log_file(activity, file, "Reading frames");
         const auto frames = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} frames", frames.size()));
+        log_file(activity, file, "Read {} frames", frames.size());
         return frames;
     }
 
@@ -226,7 +226,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh data");
         log_file(activity, file, "Reading mesh data");
         const auto mesh_data = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} mesh data", mesh_data.size()));
+        log_file(activity, file, "Read {} mesh data", mesh_data.size());
         return mesh_data;
     }
 
@@ -235,7 +235,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh pointers");
         log_file(activity, file, "Reading mesh pointers");
         const auto mesh_pointers = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} mesh pointers", mesh_pointers.size()));
+        log_file(activity, file, "Read {} mesh pointers", mesh_pointers.size());
         return mesh_pointers;
     }
 
@@ -244,7 +244,7 @@ namespace trlevel
         callbacks.on_progress("Reading mesh trees");
         log_file(activity, file, "Reading mesh trees");
         const auto meshtree = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} mesh trees", meshtree.size()));
+        log_file(activity, file, "Read {} mesh trees", meshtree.size());
         return meshtree;
     }
 
@@ -253,7 +253,7 @@ namespace trlevel
         callbacks.on_progress("Reading models");
         log_file(activity, file, "Reading models");
         auto models = read_vector<uint32_t, tr_model>(file);
-        log_file(activity, file, std::format("Read {} models", models.size()));
+        log_file(activity, file, "Read {} models", models.size());
         return models;
     }
 
@@ -262,7 +262,7 @@ namespace trlevel
         callbacks.on_progress("Reading models");
         log_file(activity, file, "Reading models");
         const auto models = convert_models(read_vector<uint32_t, tr5_model>(file));
-        log_file(activity, file, std::format("Read {} models", models.size()));
+        log_file(activity, file, "Read {} models", models.size());
         return models;
     }
 
@@ -270,7 +270,7 @@ namespace trlevel
     {
         log_file(activity, file, "Reading number of data words");
         uint32_t NumDataWords = read<uint32_t>(file);
-        log_file(activity, file, std::format("{} data words to process", NumDataWords));
+        log_file(activity, file, "{} data words to process", NumDataWords);
         return NumDataWords;
     }
 
@@ -279,7 +279,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         auto object_textures = read_vector<uint32_t, tr_object_texture>(file);
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -288,7 +288,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         const auto object_textures = convert_object_textures(read_vector<uint32_t, tr4_object_texture>(file));
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -297,7 +297,7 @@ namespace trlevel
         callbacks.on_progress("Reading object textures");
         log_file(activity, file, "Reading object textures");
         const auto object_textures = convert_object_textures(read_vector<uint32_t, tr5_object_texture>(file));
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -306,7 +306,7 @@ namespace trlevel
         callbacks.on_progress("Reading overlaps");
         log_file(activity, file, "Reading overlaps");
         std::vector<uint16_t> overlaps = read_vector<uint32_t, uint16_t>(file);
-        log_file(activity, file, std::format("Read {} overlaps", overlaps.size()));
+        log_file(activity, file, "Read {} overlaps", overlaps.size());
         return overlaps;
     }
 
@@ -314,35 +314,35 @@ namespace trlevel
     {
         log_file(activity, file, "Reading alternate group");
         room.alternate_group = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read alternate group: {}", room.alternate_group));
+        log_file(activity, file, "Read alternate group: {}", room.alternate_group);
     }
 
     void read_room_alternate_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading alternate room");
         room.alternate_room = read<int16_t>(file);
-        log_file(activity, file, std::format("Read alternate room: {}", room.alternate_room));
+        log_file(activity, file, "Read alternate room: {}", room.alternate_room);
     }
 
     void read_room_ambient_intensity_1(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading ambient intensity 1");
         room.ambient_intensity_1 = read<int16_t>(file);
-        log_file(activity, file, std::format("Read ambient intensity 1: {}", room.ambient_intensity_1));
+        log_file(activity, file, "Read ambient intensity 1: {}", room.ambient_intensity_1);
     }
 
     void read_room_colour(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading room colour");
         room.colour = read<uint32_t>(file);
-        log_file(activity, file, std::format("Read room colour {:X}", room.colour));
+        log_file(activity, file, "Read room colour {:X}", room.colour);
     }
 
     void read_room_flags(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading flags");
         room.flags = read<int16_t>(file);
-        log_file(activity, file, std::format("Read flags: {:X}", room.flags));
+        log_file(activity, file, "Read flags: {:X}", room.flags);
     }
 
     tr_room_info read_room_info(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file)
@@ -355,7 +355,7 @@ namespace trlevel
 
     std::vector<tr5_room_layer> read_room_layers(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const tr5_room_header& header)
     {
-        log_file(activity, file, std::format("Reading {} layers", header.num_layers));
+        log_file(activity, file, "Reading {} layers", header.num_layers);
         return read_vector<tr5_room_layer>(file, header.num_layers);
     }
 
@@ -363,97 +363,97 @@ namespace trlevel
     {
         log_file(activity, file, "Reading light mode");
         room.light_mode = read<int16_t>(file);
-        log_file(activity, file, std::format("Read light mode: {}", room.light_mode));
+        log_file(activity, file, "Read light mode: {}", room.light_mode);
     }
 
     void read_room_lights_tr5_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, uint16_t num_lights)
     {
-        log_file(activity, file, std::format("Reading {} lights", num_lights));
+        log_file(activity, file, "Reading {} lights", num_lights);
         room.lights = convert_lights(read_vector<tr5_room_light>(file, num_lights));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 
     void read_room_portals(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading portals");
         room.portals = read_vector<uint16_t, tr_room_portal>(file);
-        log_file(activity, file, std::format("Read {} portals", room.portals.size()));
+        log_file(activity, file, "Read {} portals", room.portals.size());
     }
 
     void read_room_rectangles(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading rectangles");
         room.data.rectangles = convert_rectangles(read_vector<int16_t, tr_face4>(file));
-        log_file(activity, file, std::format("Read {} rectangles", room.data.rectangles.size()));
+        log_file(activity, file, "Read {} rectangles", room.data.rectangles.size());
     }
 
     void read_room_reverb_info(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading reverb info");
         room.reverb_info = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read reverb info: {}", room.reverb_info));
+        log_file(activity, file, "Read reverb info: {}", room.reverb_info);
     }
 
     void read_room_sectors(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading number of z sectors");
         room.num_z_sectors = read<uint16_t>(file);
-        log_file(activity, file, std::format("There are {} z sectors", room.num_z_sectors));
+        log_file(activity, file, "There are {} z sectors", room.num_z_sectors);
         log_file(activity, file, "Reading number of x sectors");
         room.num_x_sectors = read<uint16_t>(file);
-        log_file(activity, file, std::format("There are {} x sectors", room.num_x_sectors));
-        log_file(activity, file, std::format("Reading {} sectors", room.num_z_sectors * room.num_x_sectors));
+        log_file(activity, file, "There are {} x sectors", room.num_x_sectors);
+        log_file(activity, file, "Reading {} sectors", room.num_z_sectors * room.num_x_sectors);
         room.sector_list = read_vector<tr_room_sector>(file, room.num_z_sectors * room.num_x_sectors);
-        log_file(activity, file, std::format("Read {} sectors", room.sector_list.size()));
+        log_file(activity, file, "Read {} sectors", room.sector_list.size());
     }
 
     void read_room_sectors_tr5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
-        log_file(activity, file, std::format("Reading {} sectors ({} x {})", room.num_x_sectors * room.num_z_sectors, room.num_x_sectors, room.num_z_sectors));
+        log_file(activity, file, "Reading {} sectors ({} x {})", room.num_x_sectors * room.num_z_sectors, room.num_x_sectors, room.num_z_sectors);
         room.sector_list = read_vector<tr_room_sector>(file, room.num_z_sectors * room.num_x_sectors);
-        log_file(activity, file, std::format("Read {} sectors", room.sector_list.size()));
+        log_file(activity, file, "Read {} sectors", room.sector_list.size());
     }
 
     void read_room_sprites(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading sprites");
         room.data.sprites = read_vector<int16_t, tr_room_sprite>(file);
-        log_file(activity, file, std::format("Read {} sprites", room.data.sprites.size()));
+        log_file(activity, file, "Read {} sprites", room.data.sprites.size());
     }
 
     void read_room_static_meshes(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading static meshes");
         room.static_meshes = read_vector<uint16_t, tr3_room_staticmesh>(file);
-        log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
     }
 
     void read_room_static_meshes_tr5(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room, const tr5_room_header& header)
     {
-        log_file(activity, file, std::format("Reading {} static meshes", header.num_static_meshes));
+        log_file(activity, file, "Reading {} static meshes", header.num_static_meshes);
         room.static_meshes = read_vector<tr3_room_staticmesh>(file, header.num_static_meshes);
-        log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
     }
 
     void read_room_triangles(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading triangles");
         room.data.triangles = convert_triangles(read_vector<int16_t, tr_face3>(file));
-        log_file(activity, file, std::format("Read {} triangles", room.data.triangles.size()));
+        log_file(activity, file, "Read {} triangles", room.data.triangles.size());
     }
 
     void read_room_vertices_tr3_4(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading vertices");
         room.data.vertices = convert_vertices(read_vector<int16_t, tr3_room_vertex>(file));
-        log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+        log_file(activity, file, "Read {} vertices", room.data.vertices.size());
     }
 
     void read_room_water_scheme(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading water scheme");
         room.water_scheme = read<uint8_t>(file);
-        log_file(activity, file, std::format("Read water scheme: {}", room.water_scheme));
+        log_file(activity, file, "Read water scheme: {}", room.water_scheme);
     }
 
     std::vector<uint32_t> read_sample_indices(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks)
@@ -461,7 +461,7 @@ namespace trlevel
         callbacks.on_progress("Reading sample indices");
         log_file(activity, file, "Reading sample indices");
         auto sample_indices = read_vector<uint32_t, uint32_t>(file);
-        log_file(activity, file, std::format("Read {} sample indices", sample_indices.size()));
+        log_file(activity, file, "Read {} sample indices", sample_indices.size());
         return sample_indices;
     }
 
@@ -470,7 +470,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound data");
         log_file(activity, file, "Reading sound data");
         const auto sound_data = read_vector<int32_t, uint8_t>(file);
-        log_file(activity, file, std::format("Read {} sound data", sound_data.size()));
+        log_file(activity, file, "Read {} sound data", sound_data.size());
         return sound_data;
     }
 
@@ -479,7 +479,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound details");
         log_file(activity, file, "Reading sound details");
         auto sound_details = read_vector<uint32_t, tr_x_sound_details>(file);
-        log_file(activity, file, std::format("Read {} sound details", sound_details.size()));
+        log_file(activity, file, "Read {} sound details", sound_details.size());
         return sound_details;
     }
 
@@ -503,7 +503,7 @@ namespace trlevel
         callbacks.on_progress("Reading sound sources");
         log_file(activity, file, "Reading sound sources");
         const auto sound_sources = read_vector<uint32_t, tr_sound_source>(file);
-        log_file(activity, file, std::format("Read {} sound sources", sound_sources.size()));
+        log_file(activity, file, "Read {} sound sources", sound_sources.size());
         return sound_sources;
     }
 
@@ -512,7 +512,7 @@ namespace trlevel
         callbacks.on_progress("Reading sprite sequences");
         log_file(activity, file, "Reading sprite sequences");
         const auto sprite_sequences = read_vector<uint32_t, tr_sprite_sequence>(file);
-        log_file(activity, file, std::format("Read {} sprite sequences", sprite_sequences.size()));
+        log_file(activity, file, "Read {} sprite sequences", sprite_sequences.size());
         return sprite_sequences;
     }
 
@@ -521,7 +521,7 @@ namespace trlevel
         callbacks.on_progress("Reading sprite textures");
         log_file(activity, file, "Reading sprite textures");
         auto sprite_textures = read_vector<uint32_t, tr_sprite_texture>(file);
-        log_file(activity, file, std::format("Read {} sprite textures", sprite_textures.size()));
+        log_file(activity, file, "Read {} sprite textures", sprite_textures.size());
         return sprite_textures;
     }
 
@@ -530,7 +530,7 @@ namespace trlevel
         callbacks.on_progress("Reading state changes");
         log_file(activity, file, "Reading state changes");
         const auto state_changes = read_vector<uint32_t, tr_state_change>(file);
-        log_file(activity, file, std::format("Read {} state changes", state_changes.size()));
+        log_file(activity, file, "Read {} state changes", state_changes.size());
         return state_changes;
     }
 
@@ -539,7 +539,7 @@ namespace trlevel
         callbacks.on_progress("Reading static meshes");
         log_file(activity, file, "Reading static meshes");
         auto static_meshes = read_vector<uint32_t, tr_staticmesh>(file);
-        log_file(activity, file, std::format("Read {} static meshes", static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", static_meshes.size());
         std::unordered_map<uint32_t, tr_staticmesh> mesh_map;
         for (const auto& mesh : static_meshes)
         {
@@ -555,11 +555,11 @@ namespace trlevel
 
         uint32_t num_textiles = read<uint32_t>(file);
         callbacks.on_progress(std::format("Skipping {} 8-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Skipping {} 8-bit textiles", num_textiles));
+        log_file(activity, file, "Skipping {} 8-bit textiles", num_textiles);
         skip(file, sizeof(tr_textile8) * num_textiles);
 
         callbacks.on_progress(std::format("Reading {} 16-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Reading {} 16-bit textiles", num_textiles));
+        log_file(activity, file, "Reading {} 16-bit textiles", num_textiles);
         stream_vector<tr_textile16>(file, num_textiles, [&](auto&& t) { callbacks.on_textile(convert_textile(t)); });
         return num_textiles;
     }
@@ -570,11 +570,21 @@ namespace trlevel
         uint16_t num_room_textiles = read<uint16_t>(file);
         uint16_t num_obj_textiles = read<uint16_t>(file);
         uint16_t num_bump_textiles = read<uint16_t>(file);
-        log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
+        log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
         const auto num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
 
+        if (!callbacks.on_textile_callback)
+        {
+            // Nothing will receive the textiles, so skip the 32-bit, 16-bit and misc blocks without decompressing them.
+            log_file(activity, file, "Skipping {} textiles", num_textiles);
+            skip_vector_compressed(file);
+            skip_vector_compressed(file);
+            skip_vector_compressed(file);
+            return num_textiles;
+        }
+
         callbacks.on_progress(std::format("Reading {} 32-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Reading {} 32-bit textiles", num_textiles));
+        log_file(activity, file, "Reading {} 32-bit textiles", num_textiles);
         auto textile32 = read_vector_compressed<tr_textile32>(file, num_textiles);
 
         constexpr auto is_blank = [](const auto& t)
@@ -594,7 +604,7 @@ namespace trlevel
             activity.log(trview::LogMessage::Status::Warning, "32-bit textiles were all blank, discarding");
             textile32 = {};
             callbacks.on_progress(std::format("Reading {} 16-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Reading {} 16-bit textiles", num_textiles));
+            log_file(activity, file, "Reading {} 16-bit textiles", num_textiles);
             auto textile16 = read_vector_compressed<tr_textile16>(file, num_textiles);
 
             for (const auto& textile : textile16)
@@ -611,7 +621,7 @@ namespace trlevel
             textile32 = {};
 
             callbacks.on_progress(std::format("Skipping {} 16-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Skipping {} 16-bit textiles", num_textiles));
+            log_file(activity, file, "Skipping {} 16-bit textiles", num_textiles);
             skip_vector_compressed(file);
         }
 
@@ -629,7 +639,7 @@ namespace trlevel
         callbacks.on_progress("Reading zones");
         log_file(activity, file, "Reading zones");
         std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 10);
-        log_file(activity, file, std::format("Read {} zones", zones.size()));
+        log_file(activity, file, "Read {} zones", zones.size());
     }
 
     void skip_xela(std::basic_ispanstream<uint8_t>& file)
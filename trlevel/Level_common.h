@@ -7,6 +7,7 @@
 
 #include <trview.common/Logs/ILog.h>
 #include <trview.common/Logs/Activity.h>
+#include <trview.common/Logs/Trace.h>
 
 #include "trtypes.h"
 #include "ILevel.h"
@@ -45,6 +46,13 @@ namespace trlevel
     void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const std::string& text);
     void log_file(trview::Activity& activity, std::istream& stream, const std::string& text);
 
+    /// Record a trace event at the current position in the file. The format is a string literal with a {} for
+    /// each value and is only formatted when the log is read, so prefer this over formatting a string to log.
+    template <std::size_t N, std::integral... Values> requires (sizeof...(Values) <= trview::TraceEvent::MaxValues)
+    void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const char(&format)[N], Values... values);
+    template <std::size_t N, std::integral... Values> requires (sizeof...(Values) <= trview::TraceEvent::MaxValues)
+    void log_file(trview::Activity& activity, std::istream& stream, const char(&format)[N], Values... values);
+
     /* Shared level data reading functions */
 
     bool is_ngle_sound_samples(trview::Activity&, std::basic_ispanstream<uint8_t>& file);
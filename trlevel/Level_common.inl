@@ -47,6 +47,20 @@ namespace trlevel
         return read_vector<DataType, SizeType>(file, size);
     }
 
+    template <std::size_t N, std::integral... Values> requires (sizeof...(Values) <= trview::TraceEvent::MaxValues)
+    void log_file(trview::Activity& activity, std::basic_ispanstream<uint8_t>& stream, const char(&format)[N], Values... values)
+    {
+        const std::array<int64_t, sizeof...(Values)> converted{ static_cast<int64_t>(values)... };
+        activity.trace(format, static_cast<uint64_t>(stream.tellg()), converted);
+    }
+
+    template <std::size_t N, std::integral... Values> requires (sizeof...(Values) <= trview::TraceEvent::MaxValues)
+    void log_file(trview::Activity& activity, std::istream& stream, const char(&format)[N], Values... values)
+    {
+        const std::array<int64_t, sizeof...(Values)> converted{ static_cast<int64_t>(values)... };
+        activity.trace(format, static_cast<uint64_t>(stream.tellg()), converted);
+    }
+
     template < typename DataType >
     std::vector<DataType> read_vector_compressed(std::basic_ispanstream<uint8_t>& file, uint32_t elements)
     {
@@ -69,16 +83,16 @@ namespace trlevel
         const size_type num_rooms = read<size_type>(file);
 
         callbacks.on_progress(std::format("Reading {} rooms", num_rooms));
-        log_file(activity, file, std::format("Reading {} rooms", num_rooms));
+        log_file(activity, file, "Reading {} rooms", num_rooms);
         for (auto i = 0u; i < num_rooms; ++i)
         {
             trview::Activity room_activity(activity, std::format("Room {}", i));
             callbacks.on_progress(std::format("Reading room {}", i));
-            log_file(room_activity, file, std::format("Reading room {}", i));
+            log_file(room_activity, file, "Reading room {}", i);
             tr3_room room;
             load_function(room_activity, file, room);
 
-            log_file(room_activity, file, std::format("Read room {}", i));
+            log_file(room_activity, file, "Read room {}", i);
             rooms.push_back(room);
         }
 
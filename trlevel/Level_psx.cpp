@@ -6,25 +6,80 @@
 #include <trview.common/Algorithms.h>
 
 #include <format>
+#include <numeric>
 #include <ranges>
 
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace trlevel
 {
     namespace
     {
+        constexpr std::size_t vag_header_size = 16;
+        constexpr std::size_t vag_block_size = 16;
+        constexpr std::size_t vag_block_samples = 28;
+        constexpr std::size_t wav_header_size = 44;
+        constexpr double vag_filters[5][2] = { { 0.0, 0.0 },{ 60.0 / 64.0,  0.0 }, {  115.0 / 64.0, -52.0 / 64.0 }, {   98.0 / 64.0, -55.0 / 64.0 }, {  122.0 / 64.0, -60.0 / 64.0 } };
+
         template <typename T>
-        void write(std::basic_ospanstream<uint8_t>& file, const T& value)
+        uint8_t* write(uint8_t* output, const T& value)
+        {
+            memcpy(output, &value, sizeof(value));
+            return output + sizeof(value);
+        }
+
+        /// Write a 16 bit mono PCM header to the start of the WAV buffer.
+        void write_wav_header(std::vector<uint8_t>& wav, uint32_t sample_frequency)
         {
-            file.write(reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+            const uint32_t file_size = static_cast<uint32_t>(wav.size());
+            uint8_t* output = wav.data();
+            output = std::ranges::copy(std::string_view("RIFF"), output).out;
+            output = write<uint32_t>(output, file_size - 8);
+            output = std::ranges::copy(std::string_view("WAVEfmt "), output).out;
+            output = write<uint32_t>(output, 16);
+            output = write<uint16_t>(output, 1);
+            output = write<uint16_t>(output, 1);
+            output = write<uint32_t>(output, sample_frequency);
+            output = write<uint32_t>(output, sample_frequency * 2);
+            output = write<uint16_t>(output, 2);
+            output = write<uint16_t>(output, 16);
+            output = std::ranges::copy(std::string_view("data"), output).out;
+            write<uint32_t>(output, file_size - static_cast<uint32_t>(wav_header_size));
         }
 
-        constexpr double load_sample(int value, int shift_factor)
+        /// Unpack the 28 4-bit samples in a VAG block into 16 bit samples with the shift factor applied.
+        /// @param block The 16 byte block. The first two bytes are the header and are ignored.
+        void unpack_vag_block(const uint8_t* block, int shift_factor, int16_t* samples)
         {
-            if (value & 0x8000)
+#if defined(_M_X64) || defined(__SSE2__)
+            // Each nibble is moved to the top of a 16 bit lane so that the arithmetic shift
+            // right by the shift factor also sign extends it.
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+            const __m128i mask = _mm_set1_epi8(static_cast<char>(0xf0));
+            const __m128i low = _mm_and_si128(_mm_slli_epi16(data, 4), mask);
+            const __m128i high = _mm_and_si128(data, mask);
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i shift = _mm_cvtsi32_si128(shift_factor);
+            const __m128i first = _mm_unpacklo_epi8(low, high);
+            const __m128i second = _mm_unpackhi_epi8(low, high);
+
+            alignas(16) int16_t unpacked[32];
+            _mm_store_si128(reinterpret_cast<__m128i*>(&unpacked[0]), _mm_sra_epi16(_mm_unpacklo_epi8(zero, first), shift));
+            _mm_store_si128(reinterpret_cast<__m128i*>(&unpacked[8]), _mm_sra_epi16(_mm_unpackhi_epi8(zero, first), shift));
+            _mm_store_si128(reinterpret_cast<__m128i*>(&unpacked[16]), _mm_sra_epi16(_mm_unpacklo_epi8(zero, second), shift));
+            _mm_store_si128(reinterpret_cast<__m128i*>(&unpacked[24]), _mm_sra_epi16(_mm_unpackhi_epi8(zero, second), shift));
+            // The first four values are from the two header bytes.
+            memcpy(samples, &unpacked[4], vag_block_samples * sizeof(int16_t));
+#else
+            for (std::size_t i = 0; i < vag_block_samples; i += 2)
             {
-                value |= 0xffff0000;
+                const uint8_t d = block[2 + i / 2];
+                samples[i] = static_cast<int16_t>(static_cast<int16_t>((d & 0xf) << 12) >> shift_factor);
+                samples[i + 1] = static_cast<int16_t>(static_cast<int16_t>((d & 0xf0) << 8) >> shift_factor);
             }
-            return static_cast<double>(value >> shift_factor);
+#endif
         }
     }
 
@@ -38,72 +93,44 @@ namespace trlevel
 
     /// <summary>
     /// Based on vag2wav from http://unhaut.epizy.com/psxsdk/
+    /// Decodes each 16 byte ADPCM block directly into a preallocated WAV buffer.
     /// </summary>
-    std::vector<uint8_t> convert_vag_to_wav(const std::vector<uint8_t>& bytes, uint32_t sample_frequency)
+    std::vector<uint8_t> convert_vag_to_wav(std::span<const uint8_t> bytes, uint32_t sample_frequency)
     {
-        std::span span{ &bytes[0], bytes.size() };
-        std::basic_ispanstream<uint8_t> in_stream{ span };
-        in_stream.exceptions(std::istream::failbit | std::istream::badbit | std::istream::eofbit);
-        in_stream.seekg(16, std::ios::beg);
+        // Blocks are decoded while there are more than 48 bytes after the start of the block.
+        const std::size_t max_blocks = bytes.size() > vag_header_size + 48 ? (bytes.size() - vag_header_size - 48 + vag_block_size - 1) / vag_block_size : 0;
 
+        std::vector<uint8_t> results(wav_header_size + max_blocks * vag_block_samples * sizeof(int16_t));
+        int16_t block_samples[vag_block_samples];
+        uint8_t* output = results.data() + wav_header_size;
         double s_1 = 0.0;
         double s_2 = 0.0;
-        double samples[28];
-        constexpr double f[5][2] = { { 0.0, 0.0 },{ 60.0 / 64.0,  0.0 }, {  115.0 / 64.0, -52.0 / 64.0 }, {   98.0 / 64.0, -55.0 / 64.0 }, {  122.0 / 64.0, -60.0 / 64.0 } };
-
-        // Uncompressed is usually about 3.33 times larger
-        std::vector<uint8_t> results;
-        results.resize(static_cast<uint32_t>(3.5 * bytes.size()));
-
-        std::span out_span{ &results[0], results.size() };
-        std::basic_ospanstream<uint8_t> out_stream{ out_span };
-        out_stream.exceptions(std::istream::failbit | std::istream::badbit | std::istream::eofbit);
-
-        out_stream << "RIFF";
-        out_stream.seekp(4, std::ios::cur);
-        out_stream << "WAVEfmt ";
-        write(out_stream, 16);
-        write<uint16_t>(out_stream, 1);
-        write<uint16_t>(out_stream, 1);
-        write<uint32_t>(out_stream, sample_frequency);
-        write<uint32_t>(out_stream, sample_frequency * 2);
-        write<uint16_t>(out_stream, 2);
-        write<uint16_t>(out_stream, 16);
-        out_stream << "data";
-        out_stream.seekp(4, std::ios::cur);
-
-        while (static_cast<uint32_t>(in_stream.tellg()) + 48 < static_cast<uint32_t>(bytes.size()))
+
+        for (std::size_t b = 0; b < max_blocks; ++b)
         {
-            int predict_nr = read<char>(in_stream);
-            int shift_factor = predict_nr & 0xf;
-            predict_nr >>= 4;
-            if (read<uint8_t>(in_stream) == 7)
+            const uint8_t* block = bytes.data() + vag_header_size + b * vag_block_size;
+            const int predict_nr = static_cast<int8_t>(block[0]) >> 4;
+            if (block[1] == 7)
             {
                 break;
             }
 
-            for (int i = 0; i < 28; i += 2)
-            {
-                const int d = read<uint8_t>(in_stream);
-                samples[i] = load_sample((d & 0xf) << 12, shift_factor);
-                samples[i + 1] = load_sample((d & 0xf0) << 8, shift_factor);
-            }
+            unpack_vag_block(block, block[0] & 0xf, block_samples);
 
-            for (int i = 0; i < 28; i++)
+            const double* filter = vag_filters[predict_nr >= 0 && predict_nr < 5 ? predict_nr : 0];
+            for (std::size_t i = 0; i < vag_block_samples; ++i)
             {
-                samples[i] = samples[i] + s_1 * f[predict_nr][0] + s_2 * f[predict_nr][1];
+                const double sample = block_samples[i] + s_1 * filter[0] + s_2 * filter[1];
                 s_2 = s_1;
-                s_1 = samples[i];
-                write<int16_t>(out_stream, static_cast<int16_t>(samples[i] + 0.5));
+                s_1 = sample;
+                const int16_t value = static_cast<int16_t>(sample + 0.5);
+                memcpy(output, &value, sizeof(value));
+                output += sizeof(value);
             }
         }
 
-        const uint32_t file_size = static_cast<uint32_t>(out_stream.tellp());
-        out_stream.seekp(4, std::ios::beg);
-        write<uint32_t>(out_stream, file_size - 8);
-        out_stream.seekp(40, std::ios::beg);
-        write<uint32_t>(out_stream, file_size - 44);
-        results.resize(file_size);
+        results.resize(output - results.data());
+        write_wav_header(results, sample_frequency);
         return results;
     }
 
@@ -122,7 +149,7 @@ namespace trlevel
         callbacks.on_progress("Reading models");
         log_file(activity, file, "Reading models");
         auto models = convert_models(read_vector<uint32_t, tr_model_psx>(file));
-        log_file(activity, file, std::format("Read {} models", models.size()));
+        log_file(activity, file, "Read {} models", models.size());
         return models;
     }
 
@@ -141,17 +168,21 @@ namespace trlevel
         file.seekg(sample_start + 510, std::ios::beg);
         skip(file, 4);
 
-        for (uint32_t s = 0; s < sample_sizes.size(); ++s)
+        // Samples are stored back to back, so read them in one block and index into it.
+        const auto sound_data = std::make_shared<const std::vector<uint8_t>>(
+            read_vector<uint8_t>(file, std::accumulate(sample_sizes.begin(), sample_sizes.end(), std::size_t(0))));
+
+        std::size_t offset = 0;
+        for (const auto size : sample_sizes)
         {
-            callbacks.on_progress(std::format("Loading sound {} of {}", s, sample_sizes.size()));
-            log_file(activity, file, std::format("Loading sound {} of {}", s, sample_sizes.size()));
-            if (sample_sizes[s] > 0)
+            if (size > 0)
             {
-                _sound_samples.push_back(convert_vag_to_wav(read_vector<uint8_t>(file, sample_sizes[s]), sample_frequency));
+                _sound_samples.push_back({ .source = sound_data, .offset = offset, .size = size, .format = SoundSample::Format::Vag, .sample_frequency = sample_frequency });
             }
+            offset += size;
         }
 
-        log_file(activity, file, std::format("Read {} sounds", sample_sizes.size()));
+        log_file(activity, file, "Read {} sounds", sample_sizes.size());
     }
 
     void Level::read_sounds_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const ILevel::LoadCallbacks& callbacks, uint32_t sample_frequency)
@@ -162,21 +193,19 @@ namespace trlevel
         const auto sound_offsets = read_vector<uint32_t, uint32_t>(file);
         if (!sound_offsets.empty())
         {
-            const auto sound_data = read_vector<uint32_t, byte>(file);
+            const auto sound_data = std::make_shared<const std::vector<uint8_t>>(read_vector<uint32_t, byte>(file));
 
             for (uint32_t s = 0; s < sound_offsets.size(); ++s)
             {
-                callbacks.on_progress(std::format("Loading sound {} of {}", s, sound_offsets.size()));
-                log_file(activity, file, std::format("Loading sound {} of {}", s, sound_offsets.size()));
                 const std::size_t offset = sound_offsets[s];
                 const std::size_t size = s == sound_offsets.size() - 1 ?
-                    sound_data.size() - offset - 1 :
+                    sound_data->size() - offset - 1 :
                     sound_offsets[s + 1] - offset;
-                _sound_samples.push_back(convert_vag_to_wav({ &sound_data[offset], &sound_data[offset + size] }, sample_frequency));
+                _sound_samples.push_back({ .source = sound_data, .offset = offset, .size = size, .format = SoundSample::Format::Vag, .sample_frequency = sample_frequency });
             }
         }
 
-        log_file(activity, file, std::format("Read {} sounds", sound_offsets.size()));
+        log_file(activity, file, "Read {} sounds", sound_offsets.size());
     }
 
     tr_colour4 Level::colour_from_object_texture(uint32_t texture) const
@@ -261,11 +290,11 @@ namespace trlevel
         return std::ranges::any_of(clut.Colour, [](auto&& c) { return c.Red == 0 && c.Green == 0 && c.Blue == 0; }) ? 1 : 0;
     }
 
-    void Level::load_psx_pack(std::basic_ispanstream<uint8_t>& file, trview::Activity&, const LoadCallbacks&)
+    void Level::load_psx_pack(const std::shared_ptr<const std::vector<uint8_t>>& bytes)
     {
         if (_pack_source)
         {
-            _pack = _pack_source(file);
+            _pack = _pack_source(bytes);
             _pack->set_filename(_filename);
         }
     }
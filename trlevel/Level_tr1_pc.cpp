@@ -82,14 +82,14 @@ namespace trlevel
         {
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(read_vector<uint16_t, tr_room_light>(file));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void read_room_static_meshes_tr1_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
         {
             log_file(activity, file, "Reading static meshes");
             room.static_meshes = convert_room_static_meshes(read_vector<uint16_t, tr_room_staticmesh>(file));
-            log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+            log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
         }
 
         uint16_t attribute_for_object_texture(tr_object_texture& ot, const std::vector<tr_textile8>& textiles)
@@ -253,7 +253,7 @@ namespace trlevel
                 textures.push_back({ std::from_range, std::views::iota(static_cast<int16_t>(start + room_texture_adjustment), static_cast<int16_t>(end + 1 + room_texture_adjustment)) });
             }
 
-            log_file(activity, file, std::format("Read {} animated textures sequences", textures.size()));
+            log_file(activity, file, "Read {} animated textures sequences", textures.size());
             return textures;
         }
     }
@@ -263,7 +263,7 @@ namespace trlevel
         callbacks.on_progress("Reading boxes");
         log_file(activity, file, "Reading boxes");
         const auto boxes = read_vector<uint32_t, tr_box>(file);
-        log_file(activity, file, std::format("Read {} boxes", static_cast<uint32_t>(boxes.size())));
+        log_file(activity, file, "Read {} boxes", static_cast<uint32_t>(boxes.size()));
         return boxes;
     }
 
@@ -272,7 +272,7 @@ namespace trlevel
         callbacks.on_progress("Reading entities");
         log_file(activity, file, "Reading entities");
         auto entities = convert_entities(read_vector<uint32_t, tr_entity>(file));
-        log_file(activity, file, std::format("Read {} entities", entities.size()));
+        log_file(activity, file, "Read {} entities", entities.size());
         return entities;
     }
 
@@ -280,7 +280,7 @@ namespace trlevel
     {
         log_file(activity, file, "Reading vertices");
         room.data.vertices = convert_vertices(read_vector<int16_t, tr_room_vertex>(file));
-        log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+        log_file(activity, file, "Read {} vertices", room.data.vertices.size());
     }
 
     void read_zones_tr1(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const ILevel::LoadCallbacks& callbacks, uint32_t num_boxes)
@@ -288,48 +288,44 @@ namespace trlevel
         callbacks.on_progress("Reading zones");
         log_file(activity, file, "Reading zones");
         std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 6);
-        log_file(activity, file, std::format("Read {} zones", zones.size()));
+        log_file(activity, file, "Read {} zones", zones.size());
     }
 
     void Level::generate_sound_samples(const LoadCallbacks& callbacks)
     {
         callbacks.on_progress("Generating sound samples");
+        const auto sound_data = std::make_shared<const std::vector<uint8_t>>(std::move(_sound_data));
         for (int s = 0; s < _sample_indices.size(); ++s)
         {
-            const auto start = _sample_indices[s];
-            const auto end = s + 1 < _sample_indices.size() ? _sample_indices[s + 1] : _sound_data.size();
-            _sound_samples.push_back({ _sound_data.begin() + start, _sound_data.begin() + end });
+            const std::size_t start = _sample_indices[s];
+            const std::size_t end = s + 1 < _sample_indices.size() ? _sample_indices[s + 1] : sound_data->size();
+            _sound_samples.push_back({ .source = sound_data, .offset = start, .size = end - start });
         }
     }
 
-    void Level::generate_mesh_tr1_pc_version_21(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr1_pc_version_21(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
         int16_t vertices_count = read<int16_t>(stream);
         vertices_count = static_cast<int16_t>(std::abs(vertices_count));
 
-        mesh.vertices = read_vector<tr_vertex>(stream, vertices_count);
+        stream_vector<tr_vertex>(stream, vertices_count, [&](auto&& v) { mesh.vertex(v); });
         int16_t normals_count = read<int16_t>(stream);
 
         for (int i = 0; i < vertices_count; ++i)
         {
             if (normals_count > 0)
             {
-                mesh.normals.push_back(read<tr_vertex>(stream));
+                mesh.normal(read<tr_vertex>(stream));
             }
             else
             {
-                mesh.lights.push_back(read<int16_t>(stream)); // intensity
-                mesh.normals.push_back({ 0, 0, 0 });
+                mesh.light(read<int16_t>(stream)); // intensity
+                mesh.normal({ 0, 0, 0 });
             }
         }
 
-        std::vector<tr_face3> coloured_triangles;
-        std::vector<tr_face4> coloured_rectangles;
-        std::vector<tr_face3> textured_triangles;
-        std::vector<tr_face4> textured_rectangles;
-
         const uint16_t num_primitives = read<uint16_t>(stream);
         for (uint16_t i = 0; i < num_primitives; ++i)
         {
@@ -338,12 +334,12 @@ namespace trlevel
             {
             case PrimitiveType::ColouredTriangle:
             {
-                coloured_triangles.push_back(read<tr_face3>(stream));
+                mesh.coloured_triangle(read<tr_face3>(stream));
                 break;
             }
             case PrimitiveType::ColouredRectangle:
             {
-                coloured_rectangles.push_back(read<tr_face4>(stream));
+                mesh.coloured_rectangle(read<tr_face4>(stream));
                 break;
             }
             case PrimitiveType::Triangle2:
@@ -351,7 +347,7 @@ namespace trlevel
             case PrimitiveType::Triangle10:
             case PrimitiveType::TransparentTexturedTriangle:
             {
-                textured_triangles.push_back(read<tr_face3>(stream));
+                mesh.textured_triangle(convert_triangle(read<tr_face3>(stream)));
                 break;
             }
             case PrimitiveType::Rectangle3:
@@ -359,92 +355,76 @@ namespace trlevel
             case PrimitiveType::Rectangle11:
             case PrimitiveType::TransparentTexturedRectangle:
             {
-                textured_rectangles.push_back(read<tr_face4>(stream));
+                mesh.textured_rectangle(convert_rectangle(read<tr_face4>(stream)));
                 break;
             }
             }
         }
-
-        mesh.textured_rectangles = convert_rectangles(textured_rectangles);
-        mesh.textured_triangles = convert_triangles(textured_triangles);
-        mesh.coloured_rectangles = coloured_rectangles;
-        mesh.coloured_triangles = coloured_triangles;
     }
 
-    void Level::generate_mesh_tr1_pc_may_1996(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr1_pc_may_1996(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = { .x = 0, .y = 0, .z = 0 };
-        mesh.coll_radius = read<uint16_t>(stream);
+        mesh.centre({ .x = 0, .y = 0, .z = 0 }, read<uint16_t>(stream));
         int16_t vertices_count = read<int16_t>(stream);
         vertices_count = static_cast<int16_t>(std::abs(vertices_count));
 
-        mesh.vertices = read_vector<tr_vertex>(stream, vertices_count);
+        stream_vector<tr_vertex>(stream, vertices_count, [&](auto&& v) { mesh.vertex(v); });
         int16_t normals_count = read<int16_t>(stream);
 
         for (int i = 0; i < vertices_count; ++i)
         {
             if (normals_count > 0)
             {
-                mesh.normals.push_back(read<tr_vertex>(stream));
+                mesh.normal(read<tr_vertex>(stream));
             }
             else
             {
-                mesh.lights.push_back(read<int16_t>(stream)); // intensity
-                mesh.normals.push_back({ 0, 0, 0 });
+                mesh.light(read<int16_t>(stream)); // intensity
+                mesh.normal({ 0, 0, 0 });
             }
         }
 
-        std::vector<tr_face3> coloured_triangles;
-        std::vector<tr_face4> coloured_rectangles;
-        std::vector<tr_face3> textured_triangles;
-        std::vector<tr_face4> textured_rectangles;
-
         const uint16_t num_primitives = read<uint16_t>(stream);
         for (uint16_t i = 0; i < num_primitives; ++i)
         {
             PrimitiveType primitive_type = read<PrimitiveType>(stream);
             switch (primitive_type)
             {
-                case PrimitiveType::ColouredTriangle:
-                {
-                    coloured_triangles.push_back(read<tr_face3>(stream));
-                    break;
-                }
-                case PrimitiveType::ColouredRectangle:
-                {
-                    coloured_rectangles.push_back(read<tr_face4>(stream));
-                    break;
-                }
-                case PrimitiveType::Triangle2:
-                case PrimitiveType::TexturedTriangle:
-                case PrimitiveType::Triangle10:
-                case PrimitiveType::TransparentTexturedTriangle:
-                {
-                    textured_triangles.push_back(read<tr_face3>(stream));
-                    break;
-                }
-                case PrimitiveType::Rectangle3:
-                case PrimitiveType::TexturedRectangle:
-                case PrimitiveType::Rectangle11: 
-                case PrimitiveType::TransparentTexturedRectangle:
-                {
-                    textured_rectangles.push_back(read<tr_face4>(stream));
-                    break;
-                }
+            case PrimitiveType::ColouredTriangle:
+            {
+                mesh.coloured_triangle(read<tr_face3>(stream));
+                break;
+            }
+            case PrimitiveType::ColouredRectangle:
+            {
+                mesh.coloured_rectangle(read<tr_face4>(stream));
+                break;
+            }
+            case PrimitiveType::Triangle2:
+            case PrimitiveType::TexturedTriangle:
+            case PrimitiveType::Triangle10:
+            case PrimitiveType::TransparentTexturedTriangle:
+            {
+                mesh.textured_triangle(convert_triangle(read<tr_face3>(stream)));
+                break;
+            }
+            case PrimitiveType::Rectangle3:
+            case PrimitiveType::TexturedRectangle:
+            case PrimitiveType::Rectangle11:
+            case PrimitiveType::TransparentTexturedRectangle:
+            {
+                mesh.textured_rectangle(convert_rectangle(read<tr_face4>(stream)));
+                break;
+            }
             }
         }
-
-        mesh.textured_rectangles = convert_rectangles(textured_rectangles);
-        mesh.textured_triangles = convert_triangles(textured_triangles);
-        mesh.coloured_rectangles = coloured_rectangles;
-        mesh.coloured_triangles = coloured_triangles;
     }
 
     void Level::load_tr1_pc_may_1996_wad(std::vector<uint8_t>& textile_buffer, trview::Activity& activity, const LoadCallbacks& callbacks)
     {
         std::filesystem::path wad_filename{ _filename };
         wad_filename.replace_extension("WAD");
-        const auto wad_bytes = _files->load_file(wad_filename.string());
+        const auto wad_bytes = load_external_file(wad_filename.string());
         if (!wad_bytes.has_value())
         {
             return;
@@ -468,15 +448,15 @@ namespace trlevel
         uint32_t num_animations = read<uint32_t>(wad_file);
         skip(wad_file, num_animations * 26);
 
-        read_state_changes(activity, wad_file, callbacks);
-        read_anim_dispatches(activity, wad_file, callbacks);
+        _state_changes = read_state_changes(activity, wad_file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, wad_file, callbacks);
         read_anim_commands(activity, wad_file, callbacks);
         _meshtree = read_meshtree(activity, wad_file, callbacks);
         _frames = read_frames(activity, wad_file, callbacks);
         _models = read_models_tr1_4(activity, wad_file, callbacks);
 
         auto static_meshes = read_vector<uint32_t, tr_staticmesh_may_1996>(wad_file);
-        log_file(activity, wad_file, std::format("Read {} static meshes", static_meshes.size()));
+        log_file(activity, wad_file, "Read {} static meshes", static_meshes.size());
         for (const auto& mesh : static_meshes)
         {
             const tr_staticmesh new_mesh
@@ -495,7 +475,7 @@ namespace trlevel
     {
         std::filesystem::path swd_filename{ _filename };
         swd_filename.replace_extension("SWD");
-        const auto wad_bytes = _files->load_file(swd_filename);
+        const auto wad_bytes = load_external_file(swd_filename.string());
         if (!wad_bytes.has_value())
         {
             return;
@@ -685,9 +665,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -774,7 +754,7 @@ namespace trlevel
         log_file(activity, file, "Reading textiles");
         _num_textiles = read<uint32_t>(file);
         callbacks.on_progress(std::format("Reading {} 8-bit textiles", _num_textiles));
-        log_file(activity, file, std::format("Reading {} 8-bit textiles", _num_textiles));
+        log_file(activity, file, "Reading {} 8-bit textiles", _num_textiles);
         _textile8 = read_vector<tr_textile8>(file, _num_textiles);
     }
 
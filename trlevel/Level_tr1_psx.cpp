@@ -36,7 +36,7 @@ namespace trlevel
             callbacks.on_progress("Reading models");
             log_file(activity, file, "Reading models");
             auto models = convert_models(read_vector<uint32_t, tr_model_psx>(file));
-            log_file(activity, file, std::format("Read {} models", models.size()));
+            log_file(activity, file, "Read {} models", models.size());
             return models;
         }
 
@@ -44,14 +44,14 @@ namespace trlevel
         {
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(read_vector<uint16_t, tr_room_light_psx>(file));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void read_room_static_meshes_tr1_psx(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
         {
             log_file(activity, file, "Reading static meshes");
             room.static_meshes = convert_room_static_meshes(read_vector<uint16_t, tr_room_staticmesh_psx>(file));
-            log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+            log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
         }
 
         void load_tr1_psx_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
@@ -119,7 +119,7 @@ namespace trlevel
             callbacks.on_progress("Reading zones");
             log_file(activity, file, "Reading zones");
             std::vector<int16_t> zones = read_vector<int16_t>(file, num_boxes * 4);
-            log_file(activity, file, std::format("Read {} zones", zones.size()));
+            log_file(activity, file, "Read {} zones", zones.size());
         }
     }
 
@@ -127,126 +127,100 @@ namespace trlevel
     {
         log_file(activity, file, "Reading vertices");
         room.data.vertices = convert_vertices(convert_psx_vertex_lighting(read_vector<int16_t, tr_room_vertex>(file)));
-        log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+        log_file(activity, file, "Read {} vertices", room.data.vertices.size());
     }
 
-    void Level::generate_mesh_tr1_psx_may_1996(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr1_psx_may_1996(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = { .x = 0, .y = 0, .z = 0 };
-        mesh.coll_radius = read<uint16_t>(stream);
+        mesh.centre({ .x = 0, .y = 0, .z = 0 }, read<uint16_t>(stream));
         int16_t vertices_count = read<int16_t>(stream);
         int16_t normals_count = vertices_count;
         vertices_count = static_cast<int16_t>(std::abs(vertices_count));
         
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+        stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         
         for (int i = 0; i < vertices_count; ++i)
         {
             if (normals_count > 0)
             {
-                tr_vertex_psx norm = read<tr_vertex_psx>(stream);
-                norm.w = 1;
-                mesh.normals.push_back({ norm.x, norm.y, norm.z });
+                mesh.normal(convert_vertex(read<tr_vertex_psx>(stream)));
             }
             else
             {
-                mesh.lights.push_back(read<int16_t>(stream)); // intensity
-                mesh.normals.push_back({ 0, 0, 0 });
+                mesh.light(read<int16_t>(stream)); // intensity
+                mesh.normal({ 0, 0, 0 });
             }
         }
-        const auto rectangles = read_vector<int16_t, tr_face4>(stream);
-        const auto triangles = read_vector<int16_t, tr_face3>(stream);
 
-        mesh.textured_rectangles = rectangles
-            | std::views::filter([](const auto& rect) { return rect.texture > 255; })
-            | std::views::transform([](const auto& rect)
+        stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& rect)
+            {
+                if (rect.texture > 255)
                 {
-                    tr4_mesh_face4 new_face4;
-                    memcpy(new_face4.vertices, rect.vertices, sizeof(rect.vertices));
-                    new_face4.texture = rect.texture;
-                    new_face4.effects = 0;
-                    return new_face4;
-                })
-            | std::ranges::to<std::vector>();
-        mesh.textured_triangles = triangles
-            | std::views::filter([](const auto& tri) { return tri.texture > 255; })
-            | std::views::transform([](const auto& tri)
+                    mesh.textured_rectangle(convert_rectangle(rect));
+                }
+                else
                 {
-                    tr4_mesh_face3 new_face3;
-                    memcpy(new_face3.vertices, tri.vertices, sizeof(tri.vertices));
-                    new_face3.texture = tri.texture;
-                    new_face3.effects = 0;
-                    return new_face3;
-                })
-            | std::ranges::to<std::vector>();
-
-        mesh.coloured_rectangles = rectangles
-            | std::views::filter([](const auto& rect) { return rect.texture < 256; })
-            | std::ranges::to<std::vector>();
-
-        mesh.coloured_triangles = triangles
-            | std::views::filter([](const auto& tri) { return tri.texture < 256; })
-            | std::ranges::to<std::vector>();
+                    mesh.coloured_rectangle(rect);
+                }
+            });
+        stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& tri)
+            {
+                if (tri.texture > 255)
+                {
+                    mesh.textured_triangle(convert_triangle(tri));
+                }
+                else
+                {
+                    mesh.coloured_triangle(tri);
+                }
+            });
     }
 
-    void Level::generate_mesh_tr1_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr1_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
         int16_t vertices_count = read<int16_t>(stream);
         int16_t normals_count = vertices_count;
         vertices_count = static_cast<int16_t>(std::abs(vertices_count));
 
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+        stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
 
         for (int i = 0; i < vertices_count; ++i)
         {
             if (normals_count > 0)
             {
-                tr_vertex_psx norm = read<tr_vertex_psx>(stream);
-                norm.w = 1;
-                mesh.normals.push_back({ norm.x, norm.y, norm.z });
+                mesh.normal(convert_vertex(read<tr_vertex_psx>(stream)));
             }
             else
             {
-                mesh.lights.push_back(read<int16_t>(stream)); // intensity
-                mesh.normals.push_back({ 0, 0, 0 });
+                mesh.light(read<int16_t>(stream)); // intensity
+                mesh.normal({ 0, 0, 0 });
             }
         }
 
-        const auto rectangles = read_vector<int16_t, tr_face4>(stream);
-        const auto triangles = read_vector<int16_t, tr_face3>(stream);
-
-        mesh.textured_rectangles = rectangles
-            | std::views::filter([](const auto& rect) { return rect.texture > 255; })
-            | std::views::transform([](const auto& rect)
+        stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& rect)
+            {
+                if (rect.texture > 255)
                 {
-                    tr4_mesh_face4 new_face4;
-                    memcpy(new_face4.vertices, rect.vertices, sizeof(rect.vertices));
-                    new_face4.texture = rect.texture;
-                    new_face4.effects = 0;
-                    return new_face4;
-                })
-            | std::ranges::to<std::vector>();
-        mesh.textured_triangles = triangles
-            | std::views::filter([](const auto& tri) { return tri.texture > 255; })
-            | std::views::transform([](const auto& tri)
+                    mesh.textured_rectangle(convert_rectangle(rect));
+                }
+                else
                 {
-                    tr4_mesh_face3 new_face3;
-                    memcpy(new_face3.vertices, tri.vertices, sizeof(tri.vertices));
-                    new_face3.texture = tri.texture;
-                    new_face3.effects = 0;
-                    return new_face3;
-                })
-            | std::ranges::to<std::vector>();
-
-        mesh.coloured_rectangles = rectangles
-            | std::views::filter([](const auto& rect) { return rect.texture < 256; })
-            | std::ranges::to<std::vector>();
-
-        mesh.coloured_triangles = triangles
-            | std::views::filter([](const auto& tri) { return tri.texture < 256; })
-            | std::ranges::to<std::vector>();
+                    mesh.coloured_rectangle(rect);
+                }
+            });
+        stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& tri)
+            {
+                if (tri.texture > 255)
+                {
+                    mesh.textured_triangle(convert_triangle(tri));
+                }
+                else
+                {
+                    mesh.coloured_triangle(tri);
+                }
+            });
     }
 
     void Level::load_tr1_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -305,9 +279,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -346,7 +320,7 @@ namespace trlevel
         _num_textiles = is_tr1_version_32_demo(_platform_and_version) ? 15 : 13;
         _textile4 = read_vector<tr_textile4>(file, _num_textiles);
         _clut = read_vector<tr_clut>(file, 1024);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 
     void Level::read_textiles_tr1_psx_version_27(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -357,7 +331,7 @@ namespace trlevel
         _num_textiles = 15;
         _textile4 = read_vector<tr_textile4>(file, _num_textiles);
         _clut = read_vector<tr_clut>(file, 1024);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 
     void Level::read_object_textures_tr1_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -390,7 +364,7 @@ namespace trlevel
                     };
                 })
             | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} object textures", _object_textures.size()));
+        log_file(activity, file, "Read {} object textures", _object_textures.size());
     }
 
     void Level::read_sounds_external_tr1_psx(trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -402,8 +376,8 @@ namespace trlevel
             auto dot_pos = level_filename.find_last_of('.');
             const std::string level_name = dot_pos == level_filename.npos ? level_filename : level_filename.substr(0, dot_pos);
 
-            auto sound_header = _files->load_file(std::format("{}\\..\\PSXSOUND\\{}.VBH", folder, level_name));
-            auto sound_data = _files->load_file(std::format("{}\\..\\PSXSOUND\\{}.VBB", folder, level_name));
+            auto sound_header = load_external_file(std::format("{}\\..\\PSXSOUND\\{}.VBH", folder, level_name));
+            auto sound_data = load_external_file(std::format("{}\\..\\PSXSOUND\\{}.VBB", folder, level_name));
 
             if (sound_header && sound_data)
             {
@@ -434,9 +408,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -487,15 +461,15 @@ namespace trlevel
         uint32_t num_animations = read<uint32_t>(file);
         skip(file, num_animations * 28);
 
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
         _models = read_models_psx(activity, file, callbacks);
 
         auto static_meshes = read_vector<uint32_t, tr_staticmesh_may_1996>(file);
-        log_file(activity, file, std::format("Read {} static meshes", static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", static_meshes.size());
         for (const auto& mesh : static_meshes)
         {
             const tr_staticmesh new_mesh
@@ -566,7 +566,7 @@ namespace trlevel
                     v.lighting = (-v.lighting) / 4;
                 }
                 room.data.vertices = convert_vertices(vertices);
-                log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+                log_file(activity, file, "Read {} vertices", room.data.vertices.size());
 
                 uint16_t num_primitives = to_le(read<uint16_t>(file));
                 num_primitives;
@@ -583,7 +583,7 @@ namespace trlevel
                             log_file(activity, file, "Skipping invisible triangles");
                             uint16_t triangle_count = to_le(read<uint16_t>(file));
                             skip(file, triangle_count * sizeof(tr_face3));
-                            log_file(activity, file, std::format("Skipped {} invisible triangles", triangle_count));
+                            log_file(activity, file, "Skipped {} invisible triangles", triangle_count);
                             break;
                         }
                         case Primitive::InvisibleRectangle:
@@ -591,7 +591,7 @@ namespace trlevel
                             log_file(activity, file, "Skipping invisible rectangles");
                             uint16_t rectangle_count = to_le(read<uint16_t>(file));
                             skip(file, rectangle_count * sizeof(tr_face4));
-                            log_file(activity, file, std::format("Skipped {} invisible rectangles", rectangle_count));
+                            log_file(activity, file, "Skipped {} invisible rectangles", rectangle_count);
                             break;
                         }
                         case Primitive::TexturedTriangle:
@@ -607,7 +607,7 @@ namespace trlevel
                                 t.texture >>= 4;
                             }
                             room.data.triangles.append_range(new_triangles);
-                            log_file(activity, file, std::format("Read {} triangles", triangle_count));
+                            log_file(activity, file, "Read {} triangles", triangle_count);
                             break;
                         }
                         case Primitive::TransparentRectangle:
@@ -626,7 +626,7 @@ namespace trlevel
                                 r.effects = primitive_type == Primitive::TransparentRectangle ? 1 : 0;
                             }
                             room.data.rectangles.append_range(new_rectangles);
-                            log_file(activity, file, std::format("Read {} textured rectangles", rectangle_count));
+                            log_file(activity, file, "Read {} textured rectangles", rectangle_count);
                             break;
                         }
                         case Primitive::Sprite:
@@ -640,7 +640,7 @@ namespace trlevel
                                 s.texture >>= 4;
                             }
                             room.data.sprites.append_range(new_sprites);
-                            log_file(activity, file, std::format("Read {} sprites", sprite_count));
+                            log_file(activity, file, "Read {} sprites", sprite_count);
                             break;
                         }
                     }
@@ -653,7 +653,7 @@ namespace trlevel
                 log_file(activity, file, "Reading static meshes");
                 const uint32_t num_static_meshes = to_le(read<uint32_t>(file));
                 room.static_meshes = convert_room_static_meshes(to_le(read_vector<tr_room_staticmesh_saturn>(file, num_static_meshes)));
-                log_file(activity, file, std::format("Read {} static meshes", room.static_meshes.size()));
+                log_file(activity, file, "Read {} static meshes", room.static_meshes.size());
             }
         }
 
@@ -663,17 +663,17 @@ namespace trlevel
             log_file(activity, file, "Reading portals");
             uint32_t num_portals = to_le(read<uint32_t>(file));
             room.portals = to_le(read_vector<tr_room_portal>(file, num_portals));
-            log_file(activity, file, std::format("Read {} portals", room.portals.size()));
+            log_file(activity, file, "Read {} portals", room.portals.size());
         }
 
         void read_floordat(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, tr3_room& room)
         {
             log_file(activity, file, "Reading number of z sectors");
             room.num_z_sectors = static_cast<uint16_t>(to_le(read<uint32_t>(file)));
-            log_file(activity, file, std::format("There are {} z sectors", room.num_z_sectors));
+            log_file(activity, file, "There are {} z sectors", room.num_z_sectors);
             log_file(activity, file, "Reading number of x sectors");
             room.num_x_sectors = static_cast<uint16_t>(to_le(read<uint32_t>(file)));
-            log_file(activity, file, std::format("There are {} x sectors", room.num_x_sectors));
+            log_file(activity, file, "There are {} x sectors", room.num_x_sectors);
 
             const auto floorsiz_tag = read_tag_name(file);
             uint32_t floorsize_u1 = to_le(read<uint32_t>(file));
@@ -681,9 +681,9 @@ namespace trlevel
             floorsize_u1;
             floorsize_u2;
 
-            log_file(activity, file, std::format("Reading {} sectors", room.num_z_sectors * room.num_x_sectors));
+            log_file(activity, file, "Reading {} sectors", room.num_z_sectors * room.num_x_sectors);
             room.sector_list = to_le(read_vector<tr_room_sector>(file, room.num_z_sectors * room.num_x_sectors));
-            log_file(activity, file, std::format("Read {} sectors", room.sector_list.size()));
+            log_file(activity, file, "Read {} sectors", room.sector_list.size());
         }
 
         void read_lightamb(std::basic_ispanstream<uint8_t>& file, trview::Activity&, tr3_room& room)
@@ -698,7 +698,7 @@ namespace trlevel
             uint32_t num_lights = to_le(read<uint32_t>(file));
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(to_le(read_vector<tr_room_light_saturn>(file, num_lights)));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void read_rm_flip(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, tr3_room& room)
@@ -706,7 +706,7 @@ namespace trlevel
             log_file(activity, file, "Reading alternate room");
             skip(file, 4); // unknown
             room.alternate_room = static_cast<int16_t>(to_le(read<uint32_t>(file)));
-            log_file(activity, file, std::format("Read alternate room: {}", room.alternate_room));
+            log_file(activity, file, "Read alternate room: {}", room.alternate_room);
         }
 
         void read_rm_flags(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, tr3_room& room)
@@ -714,7 +714,7 @@ namespace trlevel
             log_file(activity, file, "Reading flags");
             skip(file, 4); // unknown
             room.flags = static_cast<int16_t>(to_le(read<uint32_t>(file)));
-            log_file(activity, file, std::format("Read flags: {:X}", room.flags));
+            log_file(activity, file, "Read flags: {:X}", room.flags);
         }
 
         std::vector<tr3_room> read_roomdata(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const PlatformAndVersion& platform_and_version)
@@ -801,7 +801,7 @@ namespace trlevel
                 itemdata_size;
                 uint32_t itemdata_count = to_le(read<uint32_t>(file));
                 _entities = convert_entities(to_le(read_vector<tr_entity_saturn>(file, itemdata_count)));
-                log_file(activity, file, std::format("Read {} entities", _entities.size()));
+                log_file(activity, file, "Read {} entities", _entities.size());
             };
 
         const auto read_aranges = [&](auto& file)
@@ -1028,7 +1028,7 @@ namespace trlevel
             skip(file, 4);
             uint32_t count = to_le(read<uint32_t>(file));
             const auto static_meshes = to_le(read_vector<tr_staticmesh>(file, count));
-            log_file(activity, file, std::format("Read {} static meshes", static_meshes.size()));
+            log_file(activity, file, "Read {} static meshes", static_meshes.size());
             for (const auto& mesh : static_meshes)
             {
                 _static_meshes.insert({ mesh.ID, mesh });
@@ -1165,36 +1165,33 @@ namespace trlevel
         callbacks.on_progress("Loading complete");
 
         std::unordered_set<uint16_t> transparent_object_textures;
-        for (auto& [_, mesh] : _meshes)
+        for (auto& r : _meshes.textured_rectangles())
         {
-            for (auto& r : mesh.textured_rectangles)
+            const int16_t signed_tex = static_cast<int16_t>(r.texture);
+            const int16_t tex = (signed_tex & 0x7fff) >> 4;
+            const auto& mapping = texture_info.object_texture_mapping.find(tex);
+            if (mapping != texture_info.object_texture_mapping.end())
             {
-                const int16_t signed_tex = static_cast<int16_t>(r.texture);
-                const int16_t tex = (signed_tex & 0x7fff) >> 4;
-                const auto& mapping = texture_info.object_texture_mapping.find(tex);
-                if (mapping != texture_info.object_texture_mapping.end())
-                {
-                    r.texture = (r.texture & 0x8000) | mapping->second[0].value().index;
-                }
-                if (r.effects != 0)
-                {
-                    transparent_object_textures.insert(r.texture & 0xFFF);
-                }
+                r.texture = (r.texture & 0x8000) | mapping->second[0].value().index;
             }
-
-            for (auto& t : mesh.textured_triangles)
+            if (r.effects != 0)
             {
-                const uint16_t texture_operation = get_texture_operation(t.texture);
-                const int16_t  tex = (static_cast<int16_t>(t.texture) & 0x1fff);
+                transparent_object_textures.insert(r.texture & 0xFFF);
+            }
+        }
 
-                const auto& mapping = texture_info.object_texture_mapping.find(tex);
-                if (mapping != texture_info.object_texture_mapping.end())
-                {
-                    int16_t new_tex = mapping->second[texture_operation + 1].value_or(mapping->second[0].value()).index;
-                    t.texture = (t.texture & 0xE000) | new_tex;
-                }
-                transparent_object_textures.insert(t.texture & 0xFFF);
+        for (auto& t : _meshes.textured_triangles())
+        {
+            const uint16_t texture_operation = get_texture_operation(t.texture);
+            const int16_t  tex = (static_cast<int16_t>(t.texture) & 0x1fff);
+
+            const auto& mapping = texture_info.object_texture_mapping.find(tex);
+            if (mapping != texture_info.object_texture_mapping.end())
+            {
+                int16_t new_tex = mapping->second[texture_operation + 1].value_or(mapping->second[0].value()).index;
+                t.texture = (t.texture & 0xE000) | new_tex;
             }
+            transparent_object_textures.insert(t.texture & 0xFFF);
         }
 
         // Extract the mapped texture transparency values
@@ -1291,7 +1288,7 @@ namespace trlevel
                 out_stream.seekp(40, std::ios::beg);
                 write<uint32_t>(out_stream, file_size - 44);
                 results.resize(file_size);
-                _sound_samples.push_back(results);
+                _sound_samples.push_back(make_sound_sample(std::move(results)));
             }
             else
             {
@@ -1404,10 +1401,10 @@ namespace trlevel
         mapper.finish();
     }
 
-    void Level::generate_mesh_tr1_saturn(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr1_saturn(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = to_le(read<tr_vertex>(stream));
-        mesh.coll_radius = to_le(read<uint16_t>(stream));
+        const auto centre = to_le(read<tr_vertex>(stream));
+        mesh.centre(centre, to_le(read<uint16_t>(stream)));
 
         uint16_t unknown = to_le(read<uint16_t>(stream));
         unknown;
@@ -1416,60 +1413,58 @@ namespace trlevel
         int16_t normals_count = vertices_count;
         normals_count;
         vertices_count = static_cast<int16_t>(std::abs(vertices_count));
-        mesh.vertices = to_le(read_vector<tr_vertex>(stream, vertices_count));
+        stream_vector<tr_vertex>(stream, vertices_count, [&](auto&& v) { mesh.vertex(to_le(v)); });
 
         int16_t normals = to_le(read<int16_t>(stream));
         if (normals > 0)
         {
-            mesh.normals = to_le(read_vector<tr_vertex>(stream, normals));
+            stream_vector<tr_vertex>(stream, normals, [&](auto&& n) { mesh.normal(to_le(n)); });
         }
         else
         {
-            mesh.lights = to_le(read_vector<int16_t>(stream, abs(normals)));
+            stream_vector<int16_t>(stream, abs(normals), [&](auto&& l) { mesh.light(to_le(l)); });
         }
 
         const uint16_t num_primitives = to_le(read<uint16_t>(stream));
         uint16_t total_primitives = 0;
 
-        auto read_rects = [&](bool negate_texture = false) -> std::vector<tr_face4>
+        auto read_rects = [&](const std::function<void(const tr_face4&)>& out, bool negate_texture = false)
         {
             if (total_primitives < num_primitives)
             {
                 uint16_t trects_count = to_le(read<uint16_t>(stream));
                 total_primitives += trects_count;
-                auto trects = to_le(read_vector<tr_face4>(stream, trects_count));
-                for (auto& r : trects)
-                {
-                    r.vertices[0] >>= 5;
-                    r.vertices[1] >>= 5;
-                    r.vertices[2] >>= 5;
-                    r.vertices[3] >>= 5;
-                    if (negate_texture)
+                stream_vector<tr_face4>(stream, trects_count, [&](auto&& value)
                     {
-                        r.texture |= 0x8000;
-                    }
-                }
-                return trects;
+                        auto r = to_le(value);
+                        r.vertices[0] >>= 5;
+                        r.vertices[1] >>= 5;
+                        r.vertices[2] >>= 5;
+                        r.vertices[3] >>= 5;
+                        if (negate_texture)
+                        {
+                            r.texture |= 0x8000;
+                        }
+                        out(r);
+                    });
             }
-            return {};
         };
 
-        auto read_tris = [&]() -> std::vector<tr_face3>
+        auto read_tris = [&](const std::function<void(const tr_face3&)>& out)
             {
                 if (total_primitives < num_primitives)
                 {
                     uint16_t ttris_count = to_le(read<uint16_t>(stream));
                     total_primitives += ttris_count;
-                    auto ttris = to_le(read_vector<tr_face3>(stream, ttris_count));
-                    for (auto& r : ttris)
-                    {
-                        r.vertices[0] >>= 5;
-                        r.vertices[1] >>= 5;
-                        r.vertices[2] >>= 5;
-                    }
-                    return ttris;
+                    stream_vector<tr_face3>(stream, ttris_count, [&](auto&& value)
+                        {
+                            auto r = to_le(value);
+                            r.vertices[0] >>= 5;
+                            r.vertices[1] >>= 5;
+                            r.vertices[2] >>= 5;
+                            out(r);
+                        });
                 }
-                return {};
             };
 
         const uint16_t num_primitive_types = to_le(read<uint16_t>(stream));
@@ -1480,14 +1475,12 @@ namespace trlevel
             {
                 case MeshPrimitive::ColouredTriangle:
                 {
-                    auto tris = read_tris();
-                    mesh.coloured_triangles.append_range(tris);
+                    read_tris([&](auto&& tri) { mesh.coloured_triangle(tri); });
                     break;
                 }
                 case MeshPrimitive::ColouredRectangle:
                 {
-                    auto rects = read_rects();
-                    mesh.coloured_rectangles.append_range(rects);
+                    read_rects([&](auto&& rect) { mesh.coloured_rectangle(rect); });
                     break;
                 }
                 case MeshPrimitive::TexturedRectangle:
@@ -1495,30 +1488,31 @@ namespace trlevel
                 case MeshPrimitive::TexturedMirroredRectangle:
                 case MeshPrimitive::TexturedMirroredTransparentRectangle:
                 {
-                    auto rects = convert_rectangles(read_rects(prim_type == MeshPrimitive::TexturedMirroredRectangle || prim_type == MeshPrimitive::TexturedMirroredTransparentRectangle));
-                    if (prim_type == MeshPrimitive::TransparentRectangle || prim_type == MeshPrimitive::TexturedMirroredTransparentRectangle)
-                    {
-                        for (auto& rect : rects)
+                    const bool transparent = prim_type == MeshPrimitive::TransparentRectangle || prim_type == MeshPrimitive::TexturedMirroredTransparentRectangle;
+                    read_rects([&](auto&& value)
                         {
-                            rect.effects = 1;
-                        }
-                    }
-                    mesh.textured_rectangles.append_range(rects);
+                            auto rect = convert_rectangle(value);
+                            if (transparent)
+                            {
+                                rect.effects = 1;
+                            }
+                            mesh.textured_rectangle(rect);
+                        }, prim_type == MeshPrimitive::TexturedMirroredRectangle || prim_type == MeshPrimitive::TexturedMirroredTransparentRectangle);
                     break;
                 }
                 case MeshPrimitive::UnknownTriangle:
                 case MeshPrimitive::TransparentTriangle:
                 case MeshPrimitive::TexturedTriangle:
                 {
-                    auto tris = convert_triangles(read_tris());
-                    if (prim_type == MeshPrimitive::TransparentTriangle)
-                    {
-                        for (auto& tri : tris)
+                    read_tris([&](auto&& value)
                         {
-                            tri.effects = 1;
-                        }
-                    }
-                    mesh.textured_triangles.append_range(tris);
+                            auto tri = convert_triangle(value);
+                            if (prim_type == MeshPrimitive::TransparentTriangle)
+                            {
+                                tri.effects = 1;
+                            }
+                            mesh.textured_triangle(tri);
+                        });
                     break;
                 }
             }
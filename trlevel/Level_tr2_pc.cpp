@@ -12,7 +12,7 @@ namespace trlevel
         {
             log_file(activity, file, "Reading vertices");
             room.data.vertices = convert_vertices(read_vector<int16_t, tr2_room_vertex>(file));
-            log_file(activity, file, std::format("Read {} vertices", room.data.vertices.size()));
+            log_file(activity, file, "Read {} vertices", room.data.vertices.size());
         }
 
         void load_tr2_pc_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
@@ -68,14 +68,14 @@ namespace trlevel
     {
         log_file(activity, file, "Reading ambient intensity 2");
         room.ambient_intensity_2 = read<int16_t>(file);
-        log_file(activity, file, std::format("Read ambient intensity 2: {}", room.ambient_intensity_2));
+        log_file(activity, file, "Read ambient intensity 2: {}", room.ambient_intensity_2);
     }
 
     void read_room_lights_tr2_pc(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
     {
         log_file(activity, file, "Reading lights");
         room.lights = convert_lights(read_vector<uint16_t, tr2_room_light>(file));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 
     void Level::read_textiles_tr2_pc_e3(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -85,11 +85,11 @@ namespace trlevel
 
         uint32_t num_textiles = read<uint32_t>(file);
         callbacks.on_progress(std::format("Skipping {} 8-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Skipping {} 8-bit textiles", num_textiles));
+        log_file(activity, file, "Skipping {} 8-bit textiles", num_textiles);
         skip(file, sizeof(tr_textile8) * num_textiles);
 
         callbacks.on_progress(std::format("Reading {} 16-bit textiles", num_textiles));
-        log_file(activity, file, std::format("Reading {} 16-bit textiles", num_textiles));
+        log_file(activity, file, "Reading {} 16-bit textiles", num_textiles);
         stream_vector<tr_textile16>(file, num_textiles, [&](auto&& t) { callbacks.on_textile(convert_textile_pc_e3(t)); });
     }
 
@@ -105,9 +105,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -137,7 +137,7 @@ namespace trlevel
             skip(file, 4); // RIFF
             uint32_t size = peek<uint32_t>(file);
             file.seekg(-4, std::ios::cur);
-            _sound_samples.push_back(read_vector<uint8_t>(file, size + 4));
+            _sound_samples.push_back(make_sound_sample(read_vector<uint8_t>(file, size + 4)));
         }
         generate_sounds(callbacks);
         callbacks.on_progress("Generating meshes");
@@ -162,9 +162,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
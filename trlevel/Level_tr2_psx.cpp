@@ -35,6 +35,31 @@ namespace trlevel
         };
 #pragma pack(pop)
 
+        /// Convert a mesh rectangle, where the vertex indices are stored shifted by the given amount.
+        tr4_mesh_face4 convert_mesh_rectangle(const tr_face4& rect, int shift)
+        {
+            tr4_mesh_face4 new_face4;
+            new_face4.vertices[0] = rect.vertices[0] >> shift;
+            new_face4.vertices[1] = rect.vertices[1] >> shift;
+            new_face4.vertices[2] = rect.vertices[2] >> shift;
+            new_face4.vertices[3] = rect.vertices[3] >> shift;
+            new_face4.texture = rect.texture;
+            new_face4.effects = 0;
+            return new_face4;
+        }
+
+        /// Convert a mesh triangle, where the vertex indices are stored shifted by the given amount.
+        tr4_mesh_face3 convert_mesh_triangle(const tr_face3& tri, int shift)
+        {
+            tr4_mesh_face3 new_face3;
+            new_face3.vertices[0] = tri.vertices[0] >> shift;
+            new_face3.vertices[1] = tri.vertices[1] >> shift;
+            new_face3.vertices[2] = tri.vertices[2] >> shift;
+            new_face3.texture = tri.texture;
+            new_face3.effects = 0;
+            return new_face3;
+        }
+
         std::vector<trview_room_vertex> convert_vertices_tr2_psx(std::vector<uint32_t> vertices, int32_t y_top)
         {
             return vertices |
@@ -223,122 +248,48 @@ namespace trlevel
         }
     }
 
-    void Level::generate_mesh_tr2_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr2_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
 
         int16_t num_vertices = read<int16_t>(stream);
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
+        stream_vector<tr_vertex_psx>(stream, abs(num_vertices), [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         if (num_vertices > 0)
         {
-            mesh.normals = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
-
-            const auto reflective_rectangles = read_vector<int16_t, tr_face4_psx>(stream);
-            const auto reflective_triangles = read_vector<int16_t, tr_face3_psx>(stream);
-
-            mesh.textured_rectangles.append_range(reflective_rectangles
-                | std::views::transform([](const auto& rect)
-                    {
-                        tr4_mesh_face4 new_face4;
-                        new_face4.vertices[0] = rect.face.vertices[0] >> 3;
-                        new_face4.vertices[1] = rect.face.vertices[1] >> 3;
-                        new_face4.vertices[2] = rect.face.vertices[2] >> 3;
-                        new_face4.vertices[3] = rect.face.vertices[3] >> 3;
-                        new_face4.texture = rect.face.texture;
-                        new_face4.effects = 0;
-                        return new_face4;
-                    }));
-            mesh.textured_triangles.append_range(reflective_triangles
-                | std::views::transform([](const auto& tri)
-                    {
-                        tr4_mesh_face3 new_face3;
-                        new_face3.vertices[0] = tri.face.vertices[0] >> 3;
-                        new_face3.vertices[1] = tri.face.vertices[1] >> 3;
-                        new_face3.vertices[2] = tri.face.vertices[2] >> 3;
-                        new_face3.texture = tri.face.texture;
-                        new_face3.effects = 0;
-                        return new_face3;
-                    }));
+            stream_vector<tr_vertex_psx>(stream, num_vertices, [&](auto&& n) { mesh.normal(convert_vertex(n)); });
+            stream_vector<tr_face4_psx>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(convert_mesh_rectangle(r.face, 3)); });
+            stream_vector<tr_face3_psx>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(convert_mesh_triangle(t.face, 3)); });
         }
         else
         {
-            mesh.lights = read_vector<int16_t>(stream, abs(num_vertices));
+            stream_vector<int16_t>(stream, abs(num_vertices), [&](auto&& l) { mesh.light(l); });
         }
 
-        const auto rectangles = read_vector<int16_t, tr_face4>(stream);
-        const auto triangles = read_vector<int16_t, tr_face3>(stream);
-
-        mesh.textured_rectangles.append_range(rectangles
-            | std::views::transform([](const auto& rect)
-                {
-                    tr4_mesh_face4 new_face4;
-                    new_face4.vertices[0] = rect.vertices[0] >> 3;
-                    new_face4.vertices[1] = rect.vertices[1] >> 3;
-                    new_face4.vertices[2] = rect.vertices[2] >> 3;
-                    new_face4.vertices[3] = rect.vertices[3] >> 3;
-                    new_face4.texture = rect.texture;
-                    new_face4.effects = 0;
-                    return new_face4;
-                }));
-        mesh.textured_triangles.append_range(triangles
-            | std::views::transform([](const auto& tri)
-                {
-                    tr4_mesh_face3 new_face3;
-                    new_face3.vertices[0] = tri.vertices[0] >> 3;
-                    new_face3.vertices[1] = tri.vertices[1] >> 3;
-                    new_face3.vertices[2] = tri.vertices[2] >> 3;
-                    new_face3.texture = tri.texture;
-                    new_face3.effects = 0;
-                    return new_face3;
-                }));
-
+        stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(convert_mesh_rectangle(r, 3)); });
+        stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(convert_mesh_triangle(t, 3)); });
     }
 
-    void Level::generate_mesh_tr2_psx_version_44(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr2_psx_version_44(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
         const auto start = stream.tellg();
 
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
 
         int16_t num_vertices = read<int16_t>(stream);
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
+        stream_vector<tr_vertex_psx>(stream, abs(num_vertices), [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         if (num_vertices > 0)
         {
-            mesh.normals = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
+            stream_vector<tr_vertex_psx>(stream, num_vertices, [&](auto&& n) { mesh.normal(convert_vertex(n)); });
         }
         else
         {
-            mesh.lights = read_vector<int16_t>(stream, abs(num_vertices));
+            stream_vector<int16_t>(stream, abs(num_vertices), [&](auto&& l) { mesh.light(l); });
         }
 
-        const auto rectangles = read_vector<int16_t, tr_face4>(stream);
-        const auto triangles = read_vector<int16_t, tr_face3>(stream);
-
-        mesh.textured_rectangles.append_range(rectangles
-            | std::views::transform([](const auto& rect)
-                {
-                    tr4_mesh_face4 new_face4;
-                    new_face4.vertices[0] = rect.vertices[0] >> 3;
-                    new_face4.vertices[1] = rect.vertices[1] >> 3;
-                    new_face4.vertices[2] = rect.vertices[2] >> 3;
-                    new_face4.vertices[3] = rect.vertices[3] >> 3;
-                    new_face4.texture = rect.texture;
-                    new_face4.effects = 0;
-                    return new_face4;
-                }));
-        mesh.textured_triangles.append_range(triangles
-            | std::views::transform([](const auto& tri)
-                {
-                    tr4_mesh_face3 new_face3;
-                    new_face3.vertices[0] = tri.vertices[0] >> 3;
-                    new_face3.vertices[1] = tri.vertices[1] >> 3;
-                    new_face3.vertices[2] = tri.vertices[2] >> 3;
-                    new_face3.texture = tri.texture;
-                    new_face3.effects = 0;
-                    return new_face3;
-                }));
+        stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(convert_mesh_rectangle(r, 3)); });
+        stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(convert_mesh_triangle(t, 3)); });
 
         if ((stream.tellg() - start) % 4)
         {
@@ -346,50 +297,26 @@ namespace trlevel
         }
     }
 
-    void Level::generate_mesh_tr2_psx_version_38(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr2_psx_version_38(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
         const auto start = stream.tellg();
 
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int32_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int32_t>(stream));
 
         int16_t num_vertices = read<int16_t>(stream);
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
+        stream_vector<tr_vertex_psx>(stream, abs(num_vertices), [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         if (num_vertices > 0)
         {
-            mesh.normals = convert_vertices(read_vector<tr_vertex_psx>(stream, abs(num_vertices)));
+            stream_vector<tr_vertex_psx>(stream, num_vertices, [&](auto&& n) { mesh.normal(convert_vertex(n)); });
         }
         else
         {
-            mesh.lights = read_vector<int16_t>(stream, abs(num_vertices));
+            stream_vector<int16_t>(stream, abs(num_vertices), [&](auto&& l) { mesh.light(l); });
         }
 
-        const auto rectangles = read_vector<int16_t, tr_face4>(stream);
-        const auto triangles = read_vector<int16_t, tr_face3>(stream);
-
-        mesh.textured_rectangles.append_range(rectangles
-            | std::views::transform([](const auto& rect)
-                {
-                    tr4_mesh_face4 new_face4;
-                    new_face4.vertices[0] = rect.vertices[0];
-                    new_face4.vertices[1] = rect.vertices[1];
-                    new_face4.vertices[2] = rect.vertices[2];
-                    new_face4.vertices[3] = rect.vertices[3];
-                    new_face4.texture = rect.texture;
-                    new_face4.effects = 0;
-                    return new_face4;
-                }));
-        mesh.textured_triangles.append_range(triangles
-            | std::views::transform([](const auto& tri)
-                {
-                    tr4_mesh_face3 new_face3;
-                    new_face3.vertices[0] = tri.vertices[0];
-                    new_face3.vertices[1] = tri.vertices[1];
-                    new_face3.vertices[2] = tri.vertices[2];
-                    new_face3.texture = tri.texture;
-                    new_face3.effects = 0;
-                    return new_face3;
-                }));
+        stream_vector<tr_face4>(stream, read<int16_t>(stream), [&](auto&& r) { mesh.textured_rectangle(convert_mesh_rectangle(r, 0)); });
+        stream_vector<tr_face3>(stream, read<int16_t>(stream), [&](auto&& t) { mesh.textured_triangle(convert_mesh_triangle(t, 0)); });
 
         if ((stream.tellg() - start) % 4)
         {
@@ -408,9 +335,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -457,9 +384,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -503,7 +430,7 @@ namespace trlevel
         _num_textiles = 14;
         _textile4 = read_vector<tr_textile4>(file, _num_textiles);
         _clut = read_vector<tr_clut>(file, 1024);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
 
         skip(file, 4);
 
@@ -511,9 +438,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -578,9 +505,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -645,7 +572,7 @@ namespace trlevel
                     };
                 })
             | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} object textures", _object_textures.size()));
+        log_file(activity, file, "Read {} object textures", _object_textures.size());
     }
 
     void Level::read_textiles_tr2_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -662,7 +589,7 @@ namespace trlevel
             num_cluts = read<uint32_t>(file);
         }
         _clut = read_vector<tr_clut>(file, num_cluts);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 
     void Level::read_textiles_tr2_psx_version_44(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -672,7 +599,7 @@ namespace trlevel
         _num_textiles = read<uint32_t>(file);
         _textile4 = read_vector<tr_textile4>(file, _num_textiles);
         _clut = read_vector<tr_clut>(file, 2048);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 
     void Level::read_textiles_tr2_psx_version_42(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -683,6 +610,6 @@ namespace trlevel
         _textile4 = read_vector<tr_textile4>(file, _num_textiles);
         _clut = read_vector<tr_clut>(file, 2048);
         skip(file, 4);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 }
@@ -54,9 +54,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -89,6 +89,6 @@ namespace trlevel
     {
         log_file(activity, file, "Reading lights");
         room.lights = convert_lights(read_vector<uint16_t, tr3_room_light>(file));
-        log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+        log_file(activity, file, "Read {} lights", room.lights.size());
     }
 }
@@ -125,7 +125,7 @@ namespace trlevel
         }
     }
 
-    void Level::generate_mesh_tr3_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr3_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
         const uint32_t skybox_id = get_skybox_id(_platform_and_version);
         const auto skybox_model = std::ranges::find_if(_models, [skybox_id](auto&& m) { return m.ID == skybox_id; });
@@ -137,22 +137,22 @@ namespace trlevel
             }
         }
 
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int16_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int16_t>(stream));
         uint8_t vertices_count = read<uint8_t>(stream);
         uint8_t flags = read<uint8_t>(stream);
         uint16_t face_data_offset = read<uint16_t>(stream);
         const auto at = stream.tellg();
 
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+        stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         if ((flags & 0x80) == 0)
         {
-            mesh.normals = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+            stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& n) { mesh.normal(convert_vertex(n)); });
         }
         else
         {
-            mesh.lights = read_vector<int16_t>(stream, vertices_count);
-            mesh.normals.push_back({ 0,0,0 });
+            stream_vector<int16_t>(stream, vertices_count, [&](auto&& l) { mesh.light(l); });
+            mesh.normal({ 0,0,0 });
         }
 
         stream.seekg(static_cast<std::size_t>(at) + face_data_offset, std::ios::beg);
@@ -185,7 +185,7 @@ namespace trlevel
                     .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 16) & 0xff },
                     .texture = (face_a & 0xff) | (((face_b >> 24) & 0xff) << 8)
                 };
-                mesh.textured_triangles.push_back(tri);
+                mesh.textured_triangle(tri);
 
                 face_a >>= 8;
             }
@@ -218,7 +218,7 @@ namespace trlevel
                     .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 24) & 0xff, (face_b >> 16) & 0xff },
                     .texture = (face_a & 0xffff)
                 };
-                mesh.textured_rectangles.push_back(rect);
+                mesh.textured_rectangle(rect);
 
                 face_a >>= 16;
             }
@@ -262,9 +262,9 @@ namespace trlevel
 
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr1_3(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = read_animations_tr1_3(activity, file, callbacks);
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -328,7 +328,7 @@ namespace trlevel
                     };
                 })
             | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} object textures", _object_textures.size()));
+        log_file(activity, file, "Read {} object textures", _object_textures.size());
     }
 
     void Level::read_room_textures_tr3_psx(std::basic_ispanstream<uint8_t>& file, trview::Activity& activity, const LoadCallbacks& callbacks)
@@ -371,7 +371,7 @@ namespace trlevel
                     };
                 })
             | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} room textures", room_textures.size()));
+        log_file(activity, file, "Read {} room textures", room_textures.size());
 
         adjust_room_textures_psx();
         _object_textures_psx.append_range(room_textures_object_psx);
@@ -392,6 +392,6 @@ namespace trlevel
             num_cluts = read<uint32_t>(file);
         }
         _clut = read_vector<tr_clut>(file, num_cluts * 2);
-        log_file(activity, file, std::format("Read {} textile4s and {} clut", _textile4.size(), _clut.size()));
+        log_file(activity, file, "Read {} textile4s and {} clut", _textile4.size(), _clut.size());
     }
 }
@@ -3,6 +3,7 @@
 
 #include <ranges>
 #include <span>
+#include <stdexcept>
 
 namespace trlevel
 {
@@ -18,7 +19,7 @@ namespace trlevel
         {
             uint32_t num_samples = read<uint32_t>(file);
             callbacks.on_progress("Reading NGLE sound samples");
-            log_file(activity, file, std::format("Reading {} sound samples", num_samples));
+            log_file(activity, file, "Reading {} sound samples", num_samples);
             return read_vector<NgleSoundSample>(file, num_samples);
         }
 
@@ -26,7 +27,7 @@ namespace trlevel
         {
             log_file(activity, file, "Reading lights");
             room.lights = convert_lights(read_vector<uint16_t, tr4_room_light>(file));
-            log_file(activity, file, std::format("Read {} lights", room.lights.size()));
+            log_file(activity, file, "Read {} lights", room.lights.size());
         }
 
         void load_tr4_pc_room(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, tr3_room& room)
@@ -61,11 +62,19 @@ namespace trlevel
             uint16_t num_room_textiles = read<uint16_t>(file);
             uint16_t num_obj_textiles = read<uint16_t>(file);
             uint16_t num_bump_textiles = read<uint16_t>(file);
-            log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
+            log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
             const auto num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
 
+            if (!callbacks.on_textile_callback)
+            {
+                // Nothing will receive the textiles, so skip the sizes, the textiles and the misc textiles.
+                log_file(activity, file, "Skipping {} textiles", num_textiles);
+                skip(file, static_cast<uint32_t>(4 + (num_textiles + 2) * sizeof(tr_textile32)));
+                return num_textiles;
+            }
+
             callbacks.on_progress(std::format("Reading {} 32-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Reading {} 32-bit textiles", num_textiles));
+            log_file(activity, file, "Reading {} 32-bit textiles", num_textiles);
             skip(file, 4); // skip sizes
             auto textile32 = read_vector<tr_textile32>(file, num_textiles);
 
@@ -119,9 +128,9 @@ namespace trlevel
             _floor_data = read_floor_data(activity, data_stream, callbacks);
             _mesh_data = read_mesh_data(activity, data_stream, callbacks);
             _mesh_pointers = read_mesh_pointers(activity, data_stream, callbacks);
-            read_animations_tr4_5(activity, data_stream, callbacks);
-            read_state_changes(activity, data_stream, callbacks);
-            read_anim_dispatches(activity, data_stream, callbacks);
+            _animations = convert_animations(read_animations_tr4_5(activity, data_stream, callbacks));
+            _state_changes = read_state_changes(activity, data_stream, callbacks);
+            _anim_dispatches = read_anim_dispatches(activity, data_stream, callbacks);
             read_anim_commands(activity, data_stream, callbacks);
             _meshtree = read_meshtree(activity, data_stream, callbacks);
             _frames = read_frames(activity, data_stream, callbacks);
@@ -211,9 +220,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr4_5(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = convert_animations(read_animations_tr4_5(activity, file, callbacks));
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -252,30 +261,30 @@ namespace trlevel
     {
         uint32_t num_samples = read<uint32_t>(file);
         callbacks.on_progress("Reading sound samples");
-        log_file(activity, file, std::format("Reading {} sound samples", num_samples));
+        log_file(activity, file, "Reading {} sound samples", num_samples);
         for (uint32_t i = 0; i < num_samples; ++i)
         {
             uint32_t uncompressed = read<uint32_t>(file);
             uncompressed;
             uint32_t compressed = read<uint32_t>(file);
-            _sound_samples.push_back(read_vector<uint8_t>(file, compressed));
+            _sound_samples.push_back(make_sound_sample(read_vector<uint8_t>(file, compressed)));
         }
-        log_file(activity, file, std::format("Read {} sound samples", num_samples));
+        log_file(activity, file, "Read {} sound samples", num_samples);
     }
 
     void Level::load_ngle_sound_fx(trview::Activity& activity, std::basic_ispanstream<uint8_t>& file, const LoadCallbacks& callbacks)
     {
         const auto ngle_samples = read_sound_samples_ngle(activity, file, callbacks);
-        if (const auto main = load_main_sfx())
+        if (auto main = load_main_sfx())
         {
-            std::basic_ispanstream<uint8_t> sfx_file{ std::span(*main) };
-            sfx_file.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
-
-            for (uint32_t i = 0; i < ngle_samples.size(); ++i)
+            const auto sfx = std::make_shared<const std::vector<uint8_t>>(std::move(*main));
+            for (const auto& sample : ngle_samples)
             {
-                const auto sample = ngle_samples[i];
-                sfx_file.seekg(sample.start);
-                _sound_samples.push_back(read_vector<uint8_t>(sfx_file, sample.size));
+                if (static_cast<std::size_t>(sample.start) + sample.size > sfx->size())
+                {
+                    throw std::runtime_error("Sample is outside of MAIN.SFX");
+                }
+                _sound_samples.push_back({ .source = sfx, .offset = sample.start, .size = sample.size });
             }
         }
     }
@@ -196,7 +196,7 @@ namespace trlevel
         const uint32_t mesh_data_start = static_cast<uint32_t>(file.tellg());
         const auto mesh_data = read_vector<uint16_t>(file, info.mesh_data_size / sizeof(uint16_t));
         file.seekg(mesh_data_start + info.mesh_data_size, std::ios::beg);
-        log_file(activity, file, std::format("Read {} mesh data", mesh_data.size()));
+        log_file(activity, file, "Read {} mesh data", mesh_data.size());
         return mesh_data;
     }
 
@@ -207,7 +207,7 @@ namespace trlevel
         const uint32_t mesh_pointers_start = static_cast<uint32_t>(file.tellg());
         const auto mesh_pointers = read_vector<uint32_t>(file, info.mesh_pointer_size / sizeof(uint32_t));
         file.seekg(mesh_pointers_start + info.mesh_pointer_size, std::ios::beg);
-        log_file(activity, file, std::format("Read {} mesh pointers", mesh_pointers.size()));
+        log_file(activity, file, "Read {} mesh pointers", mesh_pointers.size());
         return mesh_pointers;
     }
 
@@ -218,7 +218,7 @@ namespace trlevel
         const uint32_t meshtree_pointers_start = static_cast<uint32_t>(file.tellg());
         const auto meshtree = read_vector<uint32_t>(file, info.meshtree_size / sizeof(uint32_t));
         file.seekg(meshtree_pointers_start + info.meshtree_size, std::ios::beg);
-        log_file(activity, file, std::format("Read {} mesh trees", meshtree.size()));
+        log_file(activity, file, "Read {} mesh trees", meshtree.size());
         return meshtree;
     }
 
@@ -246,7 +246,7 @@ namespace trlevel
         const uint32_t object_textures_start = static_cast<uint32_t>(file.tellg());
         const auto object_textures = read_vector<tr_object_texture_psx>(file, info.texture_info_length / sizeof(tr_object_texture_psx));
         file.seekg(object_textures_start + info.texture_info_length, std::ios::beg);
-        log_file(activity, file, std::format("Read {} object textures", object_textures.size()));
+        log_file(activity, file, "Read {} object textures", object_textures.size());
         return object_textures;
     }
 
@@ -324,7 +324,7 @@ namespace trlevel
             skip(file, sizeof(tr_object_texture_psx) * 2);
         }
         file.seekg(room_textures_start + info.texture_info_length2, std::ios::beg);
-        log_file(activity, file, std::format("Read {} room textures", room_textures_psx.size()));
+        log_file(activity, file, "Read {} room textures", room_textures_psx.size());
         return room_textures_psx;
     }
 
@@ -335,7 +335,7 @@ namespace trlevel
         const uint32_t sound_sources_start = static_cast<uint32_t>(file.tellg());
         const auto sound_sources = read_vector<tr_sound_source>(file, info.sfx_info_length / sizeof(tr_sound_source));
         file.seekg(sound_sources_start + info.sfx_info_length, std::ios::beg);
-        log_file(activity, file, std::format("Read {} sound sources", sound_sources.size()));
+        log_file(activity, file, "Read {} sound sources", sound_sources.size());
         return sound_sources;
     }
 
@@ -359,7 +359,7 @@ namespace trlevel
                         .Flags = e.Flags
                     };
                 }) | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} entities", entities.size()));
+        log_file(activity, file, "Read {} entities", entities.size());
         return entities;
     }
 
@@ -382,7 +382,7 @@ namespace trlevel
                         .angle = a.angle
                     };
                 }) | std::ranges::to<std::vector>();
-        log_file(activity, file, std::format("Read {} AI objects", ai_objects.size()));
+        log_file(activity, file, "Read {} AI objects", ai_objects.size());
         return ai_objects;
     }
 
@@ -405,7 +405,7 @@ namespace trlevel
                     .FrameOffset = model.FrameOffset
                 });
         }
-        log_file(activity, file, std::format("Read {} models", converted_models.size()));
+        log_file(activity, file, "Read {} models", converted_models.size());
         return converted_models;
     }
 
@@ -427,7 +427,7 @@ namespace trlevel
                     .Flags = staticmesh.Flags
                 } });
         }
-        log_file(activity, file, std::format("Read {} static meshes", converted_static_meshes.size()));
+        log_file(activity, file, "Read {} static meshes", converted_static_meshes.size());
         return converted_static_meshes;
     }
 
@@ -437,7 +437,7 @@ namespace trlevel
         callbacks.on_progress("Reading frames");
         log_file(activity, file, "Reading frames");
         const auto frames = read_vector<uint16_t>(file, info.frames_size / sizeof(uint16_t));
-        log_file(activity, file, std::format("Read {} frames", frames.size()));
+        log_file(activity, file, "Read {} frames", frames.size());
         return frames;
     }
 
@@ -488,35 +488,33 @@ namespace trlevel
         const auto sound_offsets = read_vector<uint32_t>(file, info.num_sounds);
 
         file.seekg(start + info.sound_data_offset, std::ios::beg);
-        const auto sound_data = read_vector<byte>(file, info.sound_data_length);
+        const auto sound_data = std::make_shared<const std::vector<uint8_t>>(read_vector<byte>(file, info.sound_data_length));
 
         for (uint32_t s = 0; s < sound_offsets.size(); ++s)
         {
-            callbacks.on_progress(std::format("Loading sound {} of {}", s, sound_offsets.size()));
-            log_file(activity, file, std::format("Loading sound {} of {}", s, sound_offsets.size()));
             const std::size_t offset = sound_offsets[s];
             const std::size_t size = s == sound_offsets.size() - 1 ?
-                sound_data.size() - offset - 1 :
+                sound_data->size() - offset - 1 :
                 sound_offsets[s + 1] - offset;
-            _sound_samples.push_back(convert_vag_to_wav({ &sound_data[offset], &sound_data[offset + size] }, sample_frequency));
+            _sound_samples.push_back({ .source = sound_data, .offset = offset, .size = size, .format = SoundSample::Format::Vag, .sample_frequency = sample_frequency });
         }
 
-        log_file(activity, file, std::format("Read {} sounds", sound_offsets.size()));
+        log_file(activity, file, "Read {} sounds", sound_offsets.size());
     }
 
-    void Level::generate_mesh_tr4_psx(tr_mesh& mesh, std::basic_ispanstream<uint8_t>& stream)
+    void Level::generate_mesh_tr4_psx(MeshArena::Builder& mesh, std::basic_ispanstream<uint8_t>& stream) const
     {
-        mesh.centre = read<tr_vertex>(stream);
-        mesh.coll_radius = read<int16_t>(stream);
+        const auto centre = read<tr_vertex>(stream);
+        mesh.centre(centre, read<int16_t>(stream));
         uint8_t vertices_count = read<uint8_t>(stream);
         uint8_t flags = read<uint8_t>(stream);
         uint16_t face_data_offset = read<uint16_t>(stream);
         const auto at = stream.tellg();
 
-        mesh.vertices = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+        stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& v) { mesh.vertex(convert_vertex(v)); });
         if ((flags & 0x80) == 0)
         {
-            mesh.normals = convert_vertices(read_vector<tr_vertex_psx>(stream, vertices_count));
+            stream_vector<tr_vertex_psx>(stream, vertices_count, [&](auto&& n) { mesh.normal(convert_vertex(n)); });
         }
         else
         {
@@ -529,97 +527,90 @@ namespace trlevel
         uint16_t num_triangles = read<uint16_t>(stream);
         uint16_t num_rectangles = read<uint16_t>(stream);
 
-        if (num_triangles)
-        {
-            const auto triangle_start = stream.tellg();
-            const uint16_t* data = reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg());
-            const uint16_t* ptr = data;
-            const auto start = ptr;
-
-            uint32_t face_a = 0;
-            uint32_t face_b = 0;
-            for (int t = 0; t < num_triangles; ++t)
+        // Faces are read straight from the data, so they can be walked once to check them and again to add them.
+        const auto for_each_triangle = [&](auto&& function)
             {
-                if (!(t % 4))
-                {
-                    face_a = *ptr++;
-                    face_a |= (*ptr++) << 16;
-                }
-
-                face_b = *ptr++;
-                face_b |= (*ptr++) << 16;
-
-                tr4_mesh_face3 tri
+                const uint16_t* ptr = reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg());
+                uint32_t face_a = 0;
+                uint32_t face_b = 0;
+                for (int t = 0; t < num_triangles; ++t)
                 {
-                    .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 16) & 0xff },
-                    .texture = (face_a & 0xff) | (((face_b >> 24) & 0xff) << 8)
-                };
-                mesh.textured_triangles.push_back(tri);
-
-                face_a >>= 8;
-            }
+                    if (!(t % 4))
+                    {
+                        face_a = *ptr++;
+                        face_a |= (*ptr++) << 16;
+                    }
 
-            const auto skip_amount = ptr - start;
-            skip(stream, static_cast<uint32_t>(skip_amount * 2));
-        }
+                    face_b = *ptr++;
+                    face_b |= (*ptr++) << 16;
 
-        if (num_rectangles)
-        {
-            const uint16_t* data = reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg());
-            const uint16_t* ptr = data;
-            const auto start = ptr;
+                    tr4_mesh_face3 tri
+                    {
+                        .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 16) & 0xff },
+                        .texture = (face_a & 0xff) | (((face_b >> 24) & 0xff) << 8)
+                    };
+                    function(tri);
 
-            uint32_t face_a = 0;
-            uint32_t face_b = 0;
-            for (int r = 0; r < num_rectangles; ++r)
-            {
-                if (!(r % 2))
-                {
-                    face_a = *ptr++;
-                    face_a |= (*ptr++) << 16;
+                    face_a >>= 8;
                 }
+                return static_cast<uint32_t>(ptr - reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg()));
+            };
 
-                face_b = *ptr++;
-                face_b |= (*ptr++) << 16;
-
-                tr4_mesh_face4 rect
+        const auto for_each_rectangle = [&](auto&& function)
+            {
+                const uint16_t* ptr = reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg());
+                uint32_t face_a = 0;
+                uint32_t face_b = 0;
+                for (int r = 0; r < num_rectangles; ++r)
                 {
-                    .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 24) & 0xff, (face_b >> 16) & 0xff },
-                    .texture = (face_a & 0xffff)
-                };
-                mesh.textured_rectangles.push_back(rect);
+                    if (!(r % 2))
+                    {
+                        face_a = *ptr++;
+                        face_a |= (*ptr++) << 16;
+                    }
 
-                face_a >>= 16;
-            }
+                    face_b = *ptr++;
+                    face_b |= (*ptr++) << 16;
 
-            const auto skip_amount = ptr - start;
-            skip(stream, static_cast<uint32_t>(skip_amount * 2));
-        }
+                    tr4_mesh_face4 rect
+                    {
+                        .vertices = { face_b & 0xff, (face_b >> 8) & 0xff, (face_b >> 24) & 0xff, (face_b >> 16) & 0xff },
+                        .texture = (face_a & 0xffff)
+                    };
+                    function(rect);
 
-        auto bad_rects = mesh.textured_rectangles | 
-            std::views::filter([&](auto& r)
-                {
-                    return r.vertices[0] >= mesh.vertices.size() ||
-                           r.vertices[1] >= mesh.vertices.size() ||
-                           r.vertices[2] >= mesh.vertices.size() ||
-                           r.vertices[3] >= mesh.vertices.size();
-                }) | std::ranges::to<std::vector>();
-        auto bad_tris = mesh.textured_triangles |
-            std::views::filter([&](auto& t)
-                {
-                    return t.vertices[0] >= mesh.vertices.size() ||
-                        t.vertices[1] >= mesh.vertices.size() ||
-                        t.vertices[2] >= mesh.vertices.size();
-                }) | std::ranges::to<std::vector>();
+                    face_a >>= 16;
+                }
+                return static_cast<uint32_t>(ptr - reinterpret_cast<const uint16_t*>(stream.span().data() + stream.tellg()));
+            };
 
-        if (!bad_rects.empty())
+        // If any face refers to a vertex that the mesh doesn't have, none of the faces of that type are used.
+        if (num_triangles)
         {
-            mesh.textured_rectangles.clear();
+            bool valid = true;
+            const uint32_t words = for_each_triangle([&](auto&& t)
+                {
+                    valid &= t.vertices[0] < vertices_count && t.vertices[1] < vertices_count && t.vertices[2] < vertices_count;
+                });
+            if (valid)
+            {
+                for_each_triangle([&](auto&& t) { mesh.textured_triangle(t); });
+            }
+            skip(stream, words * 2);
         }
 
-        if (!bad_tris.empty())
+        if (num_rectangles)
         {
-            mesh.textured_triangles.clear();
+            bool valid = true;
+            const uint32_t words = for_each_rectangle([&](auto&& r)
+                {
+                    valid &= r.vertices[0] < vertices_count && r.vertices[1] < vertices_count && r.vertices[2] < vertices_count && r.vertices[3] < vertices_count;
+                });
+            if (valid)
+            {
+                for_each_rectangle([&](auto&& r) { mesh.textured_rectangle(r); });
+            }
+            skip(stream, words * 2);
         }
     }
 
@@ -991,9 +982,9 @@ namespace trlevel
 
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr4_5(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = convert_animations(read_animations_tr4_5(activity, file, callbacks));
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
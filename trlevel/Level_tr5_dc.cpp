@@ -23,7 +23,7 @@ namespace trlevel
             uint32_t room_data_size = read<uint32_t>(file);
             const uint32_t room_start = static_cast<uint32_t>(file.tellg());
             const uint32_t room_end = room_start + room_data_size;
-            log_file(activity, file, std::format("Reading room data information. Data Size: {}", room_data_size));
+            log_file(activity, file, "Reading room data information. Data Size: {}", room_data_size);
 
             log_file(activity, file, "Reading room header");
             const auto header = read<tr5_room_header>(file);
@@ -65,7 +65,7 @@ namespace trlevel
             int32_t layer_number = 0;
             for (const auto& layer : layers)
             {
-                log_file(activity, file, std::format("Reading {} rectangles for layer {}", layer.num_rectangles, layer_number));
+                log_file(activity, file, "Reading {} rectangles for layer {}", layer.num_rectangles, layer_number);
                 auto rects = read_vector<tr4_mesh_face4>(file, layer.num_rectangles);
                 for (auto& rect : rects)
                 {
@@ -76,7 +76,7 @@ namespace trlevel
                 }
                 std::copy(rects.begin(), rects.end(), std::back_inserter(room.data.rectangles));
 
-                log_file(activity, file, std::format("Reading {} triangles for layer {}", layer.num_triangles, layer_number));
+                log_file(activity, file, "Reading {} triangles for layer {}", layer.num_triangles, layer_number);
                 auto tris = read_vector<tr4_mesh_face3>(file, layer.num_triangles);
                 for (auto& tri : tris)
                 {
@@ -95,7 +95,7 @@ namespace trlevel
             layer_number = 0;
             for (const auto& layer : layers)
             {
-                log_file(activity, file, std::format("Reading {} vertices for layer {}", layer.num_vertices, layer_number));
+                log_file(activity, file, "Reading {} vertices for layer {}", layer.num_vertices, layer_number);
                 auto verts = convert_vertices(read_vector<tr5_room_vertex_dreamcast>(file, layer.num_vertices) |
                     std::views::transform([](auto&& v) -> tr5_room_vertex { return { .vertex = v.vertex, .normal = v.normal, .colour = v.colour }; }) |
                     std::ranges::to<std::vector>());
@@ -149,11 +149,11 @@ namespace trlevel
                 uint32_t num_room_textiles = read<uint32_t>(file);
                 uint32_t num_obj_textiles = read<uint32_t>(file);
                 uint32_t num_bump_textiles = read<uint32_t>(file);
-                log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
+                log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
                 _num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
             
                 callbacks.on_progress(std::format("Reading {} 16-bit textiles", _num_textiles));
-                log_file(activity, file, std::format("Reading {} 16-bit textiles", _num_textiles));
+                log_file(activity, file, "Reading {} 16-bit textiles", _num_textiles);
 
                 for (uint32_t i = 0u; i < _num_textiles; ++i)
                 {
@@ -175,14 +175,14 @@ namespace trlevel
                 uint32_t num_room_textiles = read<uint32_t>(file);
                 uint32_t num_obj_textiles = read<uint32_t>(file);
                 uint32_t num_bump_textiles = read<uint32_t>(file);
-                log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
+                log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
                 _num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
             }
 
             {
                 DreamcastPage page{ file };
                 callbacks.on_progress(std::format("Reading {} 16-bit textiles", _num_textiles));
-                log_file(activity, file, std::format("Reading {} 16-bit textiles", _num_textiles));
+                log_file(activity, file, "Reading {} 16-bit textiles", _num_textiles);
 
                 auto textile16 = read_vector<tr_textile16>(file, _num_textiles);
                 for (const auto& textile : textile16)
@@ -198,10 +198,10 @@ namespace trlevel
             DreamcastPage page{ file };
             log_file(activity, file, "Reading Lara type");
             _lara_type = read<uint16_t>(file);
-            log_file(activity, file, std::format("Lara type: {}", _lara_type));
+            log_file(activity, file, "Lara type: {}", _lara_type);
             log_file(activity, file, "Reading weather type");
             _weather_type = read<uint16_t>(file);
-            log_file(activity, file, std::format("Weather type: {}", _weather_type));
+            log_file(activity, file, "Weather type: {}", _weather_type);
             log_file(activity, file, "Skipping 28 unknown/padding bytes");
             file.seekg(28, std::ios::cur);
         }
@@ -217,9 +217,9 @@ namespace trlevel
             DreamcastPage page{ file };
             _mesh_data = read_mesh_data(activity, file, callbacks);
             _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-            read_animations_tr4_5(activity, file, callbacks);
-            read_state_changes(activity, file, callbacks);
-            read_anim_dispatches(activity, file, callbacks);
+            _animations = convert_animations(read_animations_tr4_5(activity, file, callbacks));
+            _state_changes = read_state_changes(activity, file, callbacks);
+            _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
             read_anim_commands(activity, file, callbacks);
             _meshtree = read_meshtree(activity, file, callbacks);
             _frames = read_frames(activity, file, callbacks);
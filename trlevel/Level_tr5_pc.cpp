@@ -15,7 +15,7 @@ namespace trlevel
             uint32_t room_data_size = read<uint32_t>(file);
             const uint32_t room_start = static_cast<uint32_t>(file.tellg());
             const uint32_t room_end = room_start + room_data_size;
-            log_file(activity, file, std::format("Reading room data information. Data Size: {}", room_data_size));
+            log_file(activity, file, "Reading room data information. Data Size: {}", room_data_size);
 
             log_file(activity, file, "Reading room header");
             const auto header = read<tr5_room_header>(file);
@@ -54,7 +54,7 @@ namespace trlevel
             int32_t layer_number = 0;
             for (const auto& layer : layers)
             {
-                log_file(activity, file, std::format("Reading {} rectangles for layer {}", layer.num_rectangles, layer_number));
+                log_file(activity, file, "Reading {} rectangles for layer {}", layer.num_rectangles, layer_number);
                 auto rects = read_vector<tr4_mesh_face4>(file, layer.num_rectangles);
                 for (auto& rect : rects)
                 {
@@ -65,7 +65,7 @@ namespace trlevel
                 }
                 std::copy(rects.begin(), rects.end(), std::back_inserter(room.data.rectangles));
 
-                log_file(activity, file, std::format("Reading {} triangles for layer {}", layer.num_triangles, layer_number));
+                log_file(activity, file, "Reading {} triangles for layer {}", layer.num_triangles, layer_number);
                 auto tris = read_vector<tr4_mesh_face3>(file, layer.num_triangles);
                 for (auto& tri : tris)
                 {
@@ -84,7 +84,7 @@ namespace trlevel
             layer_number = 0;
             for (const auto& layer : layers)
             {
-                log_file(activity, file, std::format("Reading {} vertices for layer {}", layer.num_vertices, layer_number));
+                log_file(activity, file, "Reading {} vertices for layer {}", layer.num_vertices, layer_number);
                 auto verts = convert_vertices(read_vector<tr5_room_vertex>(file, layer.num_vertices));
                 std::copy(verts.begin(), verts.end(), std::back_inserter(room.data.vertices));
                 ++layer_number;
@@ -127,11 +127,11 @@ namespace trlevel
             {
                 const auto layer = read<tr5_room_layer_remastered>(file);
 
-                log_file(activity, file, std::format("Reading {} vertices for layer {}", layer.num_vertices, i));
+                log_file(activity, file, "Reading {} vertices for layer {}", layer.num_vertices, i);
                 auto verts = convert_vertices(read_vector<tr5_room_vertex>(file, layer.num_vertices));
                 std::copy(verts.begin(), verts.end(), std::back_inserter(room.data.vertices));
 
-                log_file(activity, file, std::format("Reading {} rectangles for layer {}", layer.num_rectangles, i));
+                log_file(activity, file, "Reading {} rectangles for layer {}", layer.num_rectangles, i);
                 auto rects = read_vector<tr4_mesh_face4>(file, layer.num_rectangles);
                 for (auto& rect : rects)
                 {
@@ -142,7 +142,7 @@ namespace trlevel
                 }
                 std::copy(rects.begin(), rects.end(), std::back_inserter(room.data.rectangles));
 
-                log_file(activity, file, std::format("Reading {} triangles for layer {}", layer.num_triangles, i));
+                log_file(activity, file, "Reading {} triangles for layer {}", layer.num_triangles, i);
                 auto tris = read_vector<tr4_mesh_face3>(file, layer.num_triangles);
                 for (auto& tri : tris)
                 {
@@ -165,11 +165,19 @@ namespace trlevel
             uint16_t num_room_textiles = read<uint16_t>(file);
             uint16_t num_obj_textiles = read<uint16_t>(file);
             uint16_t num_bump_textiles = read<uint16_t>(file);
-            log_file(activity, file, std::format("Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles));
+            log_file(activity, file, "Textile counts - Room:{}, Object:{}, Bump:{}", num_room_textiles, num_obj_textiles, num_bump_textiles);
             const auto num_textiles = num_room_textiles + num_obj_textiles + num_bump_textiles;
 
+            if (!callbacks.on_textile_callback)
+            {
+                // Nothing will receive the textiles, so skip the sizes, the textiles and the misc textiles.
+                log_file(activity, file, "Skipping {} textiles", num_textiles);
+                skip(file, static_cast<uint32_t>(4 + (num_textiles + 3) * sizeof(tr_textile32)));
+                return num_textiles;
+            }
+
             callbacks.on_progress(std::format("Reading {} 32-bit textiles", num_textiles));
-            log_file(activity, file, std::format("Reading {} 32-bit textiles", num_textiles));
+            log_file(activity, file, "Reading {} 32-bit textiles", num_textiles);
             skip(file, 4); // skip sizes
             auto textile32 = read_vector<tr_textile32>(file, num_textiles);
 
@@ -195,10 +203,10 @@ namespace trlevel
         _num_textiles = read_textiles_tr4_5(activity, file, callbacks);
         log_file(activity, file, "Reading Lara type");
         _lara_type = read<uint16_t>(file);
-        log_file(activity, file, std::format("Lara type: {}", _lara_type));
+        log_file(activity, file, "Lara type: {}", _lara_type);
         log_file(activity, file, "Reading weather type");
         _weather_type = read<uint16_t>(file);
-        log_file(activity, file, std::format("Weather type: {}", _weather_type));
+        log_file(activity, file, "Weather type: {}", _weather_type);
         log_file(activity, file, "Skipping 28 unknown/padding bytes");
         file.seekg(28, std::ios::cur);
 
@@ -222,9 +230,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr4_5(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = convert_animations(read_animations_tr4_5(activity, file, callbacks));
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -299,9 +307,9 @@ namespace trlevel
         _floor_data = read_floor_data(activity, file, callbacks);
         _mesh_data = read_mesh_data(activity, file, callbacks);
         _mesh_pointers = read_mesh_pointers(activity, file, callbacks);
-        read_animations_tr4_5(activity, file, callbacks);
-        read_state_changes(activity, file, callbacks);
-        read_anim_dispatches(activity, file, callbacks);
+        _animations = convert_animations(read_animations_tr4_5(activity, file, callbacks));
+        _state_changes = read_state_changes(activity, file, callbacks);
+        _anim_dispatches = read_anim_dispatches(activity, file, callbacks);
         read_anim_commands(activity, file, callbacks);
         _meshtree = read_meshtree(activity, file, callbacks);
         _frames = read_frames(activity, file, callbacks);
@@ -0,0 +1,203 @@
+#include "MeshArena.h"
+#include "CacheFormat.h"
+
+namespace trlevel
+{
+    namespace
+    {
+        template <typename Range>
+        Range next_range(uint32_t& end, Range counted)
+        {
+            const Range range{ end, counted.count };
+            end += counted.count;
+            return range;
+        }
+
+        template <typename T, typename Range>
+        bool in_range(const std::vector<T>& pool, Range range)
+        {
+            return range.start <= pool.size() && range.count <= pool.size() - range.start;
+        }
+
+        template <typename T, typename Range>
+        std::span<const T> view(const std::vector<T>& pool, Range range)
+        {
+            return std::span<const T>(pool).subspan(range.start, range.count);
+        }
+    }
+
+    uint32_t MeshArena::allocate(std::span<const Builder> counted)
+    {
+        const uint32_t first = size();
+        auto vertices = static_cast<uint32_t>(_vertices.size());
+        auto normals = static_cast<uint32_t>(_normals.size());
+        auto lights = static_cast<uint32_t>(_lights.size());
+        auto textured_rectangles = static_cast<uint32_t>(_textured_rectangles.size());
+        auto textured_triangles = static_cast<uint32_t>(_textured_triangles.size());
+        auto coloured_rectangles = static_cast<uint32_t>(_coloured_rectangles.size());
+        auto coloured_triangles = static_cast<uint32_t>(_coloured_triangles.size());
+
+        _entries.reserve(_entries.size() + counted.size());
+        for (const auto& builder : counted)
+        {
+            const auto& mesh = builder._counted;
+            _entries.push_back(
+                {
+                    .centre = mesh.centre,
+                    .coll_radius = mesh.coll_radius,
+                    .vertices = next_range(vertices, mesh.vertices),
+                    .normals = next_range(normals, mesh.normals),
+                    .lights = next_range(lights, mesh.lights),
+                    .textured_rectangles = next_range(textured_rectangles, mesh.textured_rectangles),
+                    .textured_triangles = next_range(textured_triangles, mesh.textured_triangles),
+                    .coloured_rectangles = next_range(coloured_rectangles, mesh.coloured_rectangles),
+                    .coloured_triangles = next_range(coloured_triangles, mesh.coloured_triangles)
+                });
+        }
+
+        _vertices.resize(vertices);
+        _normals.resize(normals);
+        _lights.resize(lights);
+        _textured_rectangles.resize(textured_rectangles);
+        _textured_triangles.resize(textured_triangles);
+        _coloured_rectangles.resize(coloured_rectangles);
+        _coloured_triangles.resize(coloured_triangles);
+        return first;
+    }
+
+    MeshArena::Builder MeshArena::builder(uint32_t index)
+    {
+        return Builder(*this, index);
+    }
+
+    MeshView MeshArena::mesh(uint32_t index) const
+    {
+        if (index >= _entries.size())
+        {
+            return {};
+        }
+
+        const auto& entry = _entries[index];
+        return
+        {
+            .centre = entry.centre,
+            .coll_radius = entry.coll_radius,
+            .vertices = view(_vertices, entry.vertices),
+            .normals = view(_normals, entry.normals),
+            .lights = view(_lights, entry.lights),
+            .textured_rectangles = view(_textured_rectangles, entry.textured_rectangles),
+            .textured_triangles = view(_textured_triangles, entry.textured_triangles),
+            .coloured_rectangles = view(_coloured_rectangles, entry.coloured_rectangles),
+            .coloured_triangles = view(_coloured_triangles, entry.coloured_triangles)
+        };
+    }
+
+    uint32_t MeshArena::size() const
+    {
+        return static_cast<uint32_t>(_entries.size());
+    }
+
+    std::span<tr4_mesh_face4> MeshArena::textured_rectangles()
+    {
+        return _textured_rectangles;
+    }
+
+    std::span<tr4_mesh_face3> MeshArena::textured_triangles()
+    {
+        return _textured_triangles;
+    }
+
+    void MeshArena::write(CacheWriter& writer) const
+    {
+        writer(_entries, _vertices, _normals, _lights, _textured_rectangles, _textured_triangles, _coloured_rectangles, _coloured_triangles);
+    }
+
+    void MeshArena::read(CacheReader& reader)
+    {
+        reader(_entries, _vertices, _normals, _lights, _textured_rectangles, _textured_triangles, _coloured_rectangles, _coloured_triangles);
+
+        // Views are made without checks, so make sure that the ranges from the cache are valid.
+        const bool valid = std::ranges::all_of(_entries, [this](const Entry& entry)
+            {
+                return in_range(_vertices, entry.vertices) &&
+                    in_range(_normals, entry.normals) &&
+                    in_range(_lights, entry.lights) &&
+                    in_range(_textured_rectangles, entry.textured_rectangles) &&
+                    in_range(_textured_triangles, entry.textured_triangles) &&
+                    in_range(_coloured_rectangles, entry.coloured_rectangles) &&
+                    in_range(_coloured_triangles, entry.coloured_triangles);
+            });
+        if (!valid)
+        {
+            throw std::runtime_error("Cached mesh refers to data outside of the arena");
+        }
+    }
+
+    MeshArena::Builder::Builder(MeshArena& arena, uint32_t index)
+        : _arena(&arena), _index(index)
+    {
+    }
+
+    template <typename T>
+    void MeshArena::Builder::add(std::vector<T> MeshArena::* pool, Range Entry::* range, const T& value)
+    {
+        uint32_t& count = (_counted.*range).count;
+        if (_arena)
+        {
+            // The mesh is read the same way both times, so this only happens if the arena was sized from another mesh.
+            const Range& allocated = _arena->_entries[_index].*range;
+            if (count >= allocated.count)
+            {
+                throw std::runtime_error("Mesh has more parts than were counted");
+            }
+            (_arena->*pool)[allocated.start + count] = value;
+        }
+        ++count;
+    }
+
+    void MeshArena::Builder::centre(const tr_vertex& centre, int32_t coll_radius)
+    {
+        _counted.centre = centre;
+        _counted.coll_radius = coll_radius;
+        if (_arena)
+        {
+            _arena->_entries[_index].centre = centre;
+            _arena->_entries[_index].coll_radius = coll_radius;
+        }
+    }
+
+    void MeshArena::Builder::vertex(const tr_vertex& vertex)
+    {
+        add(&MeshArena::_vertices, &Entry::vertices, vertex);
+    }
+
+    void MeshArena::Builder::normal(const tr_vertex& normal)
+    {
+        add(&MeshArena::_normals, &Entry::normals, normal);
+    }
+
+    void MeshArena::Builder::light(int16_t light)
+    {
+        add(&MeshArena::_lights, &Entry::lights, light);
+    }
+
+    void MeshArena::Builder::textured_rectangle(const tr4_mesh_face4& face)
+    {
+        add(&MeshArena::_textured_rectangles, &Entry::textured_rectangles, face);
+    }
+
+    void MeshArena::Builder::textured_triangle(const tr4_mesh_face3& face)
+    {
+        add(&MeshArena::_textured_triangles, &Entry::textured_triangles, face);
+    }
+
+    void MeshArena::Builder::coloured_rectangle(const tr_face4& face)
+    {
+        add(&MeshArena::_coloured_rectangles, &Entry::coloured_rectangles, face);
+    }
+
+    void MeshArena::Builder::coloured_triangle(const tr_face3& face)
+    {
+        add(&MeshArena::_coloured_triangles, &Entry::coloured_triangles, face);
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "trtypes.h"
+
+namespace trlevel
+{
+    class CacheWriter;
+    class CacheReader;
+
+    /// A mesh whose vertices and faces are stored in a MeshArena. Only valid while the arena is alive and unchanged.
+    struct MeshView
+    {
+        tr_vertex centre{};
+        int32_t coll_radius{ 0 };
+        std::span<const tr_vertex> vertices;
+        std::span<const tr_vertex> normals;
+        std::span<const int16_t> lights;
+        std::span<const tr4_mesh_face4> textured_rectangles;
+        std::span<const tr4_mesh_face3> textured_triangles;
+        std::span<const tr_face4> coloured_rectangles;
+        std::span<const tr_face3> coloured_triangles;
+    };
+
+    /// Stores all of the meshes in a level in one pool per element type, with each mesh
+    /// recorded as ranges into the pools.
+    class MeshArena final
+    {
+    public:
+        class Builder;
+
+        /// Add a mesh for each builder, sized from what the builder counted. Each pool is allocated once.
+        /// @returns The index of the first mesh added.
+        uint32_t allocate(std::span<const Builder> counted);
+        /// Get a builder that writes a mesh added by allocate into its ranges of the pools. Builders for
+        /// different meshes can be used at the same time.
+        Builder builder(uint32_t index);
+        MeshView mesh(uint32_t index) const;
+        uint32_t size() const;
+        /// All textured faces in the arena, for fixing up texture indices after loading.
+        std::span<tr4_mesh_face4> textured_rectangles();
+        std::span<tr4_mesh_face3> textured_triangles();
+        void write(CacheWriter& writer) const;
+        void read(CacheReader& reader);
+    private:
+        struct Range
+        {
+            uint32_t start{ 0 };
+            uint32_t count{ 0 };
+        };
+
+        struct Entry
+        {
+            tr_vertex centre;
+            int32_t coll_radius;
+            Range vertices;
+            Range normals;
+            Range lights;
+            Range textured_rectangles;
+            Range textured_triangles;
+            Range coloured_rectangles;
+            Range coloured_triangles;
+        };
+
+        std::vector<Entry> _entries;
+        std::vector<tr_vertex> _vertices;
+        std::vector<tr_vertex> _normals;
+        std::vector<int16_t> _lights;
+        std::vector<tr4_mesh_face4> _textured_rectangles;
+        std::vector<tr4_mesh_face3> _textured_triangles;
+        std::vector<tr_face4> _coloured_rectangles;
+        std::vector<tr_face3> _coloured_triangles;
+    };
+
+    /// Receives the parts of one mesh as it is read. A default constructed builder only counts the parts, so a mesh
+    /// is read once to count it and again, after MeshArena::allocate, with a builder from MeshArena::builder.
+    class MeshArena::Builder final
+    {
+    public:
+        Builder() = default;
+        void centre(const tr_vertex& centre, int32_t coll_radius);
+        void vertex(const tr_vertex& vertex);
+        void normal(const tr_vertex& normal);
+        void light(int16_t light);
+        void textured_rectangle(const tr4_mesh_face4& face);
+        void textured_triangle(const tr4_mesh_face3& face);
+        void coloured_rectangle(const tr_face4& face);
+        void coloured_triangle(const tr_face3& face);
+    private:
+        friend class MeshArena;
+        Builder(MeshArena& arena, uint32_t index);
+
+        template <typename T>
+        void add(std::vector<T> MeshArena::* pool, Range Entry::* range, const T& value);
+
+        MeshArena* _arena{ nullptr };
+        uint32_t _index{ 0 };
+        /// The number of each part added so far. Only the counts of the ranges are used.
+        Entry _counted{};
+    };
+}
@@ -30,12 +30,19 @@ namespace trlevel
             MOCK_METHOD(uint32_t, num_models, (), (const, override));
             MOCK_METHOD(tr_model, get_model, (uint32_t), (const, override));
             MOCK_METHOD(bool, get_model_by_id, (uint32_t, tr_model&), (const, override));
+            MOCK_METHOD(std::optional<uint32_t>, get_model_index, (uint32_t), (const, override));
+            MOCK_METHOD(FrameView, get_model_frame, (uint32_t), (const, override));
+            MOCK_METHOD(std::span<const tr_meshtree_node>, get_model_meshtree, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_static_meshes, (), (const, override));
             MOCK_METHOD(std::optional<tr_staticmesh>, get_static_mesh, (uint32_t), (const, override));
             MOCK_METHOD(uint32_t, num_mesh_pointers, (), (const, override));
-            MOCK_METHOD(tr_mesh, get_mesh_by_pointer, (uint32_t), (const, override));
+            MOCK_METHOD(MeshView, get_mesh_by_pointer, (uint32_t), (const, override));
             MOCK_METHOD(std::vector<tr_meshtree_node>, get_meshtree, (uint32_t, uint32_t), (const, override));
             MOCK_METHOD(tr2_frame, get_frame, (uint32_t, uint32_t), (const, override));
+            MOCK_METHOD(std::vector<tr_animation>, animations, (), (const, override));
+            MOCK_METHOD(std::vector<tr_state_change>, state_changes, (), (const, override));
+            MOCK_METHOD(std::vector<tr_anim_dispatch>, anim_dispatches, (), (const, override));
+            MOCK_METHOD(tr2_frame, get_animation_frame, (uint32_t, uint32_t, uint32_t), (const, override));
             MOCK_METHOD(LevelVersion, get_version, (), (const, override));
             MOCK_METHOD(bool, get_sprite_sequence_by_id, (int32_t, tr_sprite_sequence&), (const, override));
             MOCK_METHOD(std::optional<tr_sprite_texture>, get_sprite_texture, (uint32_t), (const, override));
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../ILevelCache.h"
+
+namespace trlevel
+{
+    namespace mocks
+    {
+        struct MockLevelCache : public ILevelCache
+        {
+            MockLevelCache();
+            virtual ~MockLevelCache();
+            MOCK_METHOD(std::unique_ptr<Entry>, open, (const std::string&), (const, override));
+            MOCK_METHOD(void, save, (const std::string&, const std::vector<uint8_t>&), (override));
+            MOCK_METHOD(void, remove, (const std::string&), (override));
+        };
+
+        struct MockLevelCacheEntry : public ILevelCache::Entry
+        {
+            MockLevelCacheEntry();
+            virtual ~MockLevelCacheEntry();
+            MOCK_METHOD(std::span<const uint8_t>, data, (), (const, override));
+        };
+    }
+}
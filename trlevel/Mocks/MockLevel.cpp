@@ -1,6 +1,7 @@
 #include "../stdafx.h"
 #include <gmock/gmock.h>
 #include "ILevel.h"
+#include "ILevelCache.h"
 
 namespace trlevel
 {
@@ -8,5 +9,9 @@ namespace trlevel
     {
         MockLevel::MockLevel() {}
         MockLevel::~MockLevel() {}
+        MockLevelCache::MockLevelCache() {}
+        MockLevelCache::~MockLevelCache() {}
+        MockLevelCacheEntry::MockLevelCacheEntry() {}
+        MockLevelCacheEntry::~MockLevelCacheEntry() {}
     }
 }
\ No newline at end of file
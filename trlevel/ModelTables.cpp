@@ -0,0 +1,87 @@
+#include "ModelTables.h"
+#include "CacheFormat.h"
+
+namespace trlevel
+{
+    void ModelTables::add(const tr_model& model, const tr2_frame& frame, std::span<const tr_meshtree_node> nodes)
+    {
+        const uint32_t index = static_cast<uint32_t>(_entries.size());
+        _entries.push_back(
+            {
+                .offsetx = frame.offsetx,
+                .offsety = frame.offsety,
+                .offsetz = frame.offsetz,
+                .rotations_start = static_cast<uint32_t>(_rotations.size()),
+                .rotations_count = static_cast<uint32_t>(frame.values.size()),
+                .nodes_start = static_cast<uint32_t>(_nodes.size()),
+                .nodes_count = static_cast<uint32_t>(nodes.size())
+            });
+        _rotations.insert(_rotations.end(), frame.values.begin(), frame.values.end());
+        _nodes.insert(_nodes.end(), nodes.begin(), nodes.end());
+        // Keep the first model with each ID, as the linear search did.
+        _indices.emplace(model.ID, index);
+    }
+
+    std::optional<uint32_t> ModelTables::index_of(uint32_t id) const
+    {
+        const auto found = _indices.find(id);
+        if (found == _indices.end())
+        {
+            return std::nullopt;
+        }
+        return found->second;
+    }
+
+    FrameView ModelTables::frame(uint32_t model_index) const
+    {
+        if (model_index >= _entries.size())
+        {
+            return {};
+        }
+
+        const auto& entry = _entries[model_index];
+        return
+        {
+            .offsetx = entry.offsetx,
+            .offsety = entry.offsety,
+            .offsetz = entry.offsetz,
+            .values = std::span<const tr2_frame_rotation>(_rotations).subspan(entry.rotations_start, entry.rotations_count)
+        };
+    }
+
+    std::span<const tr_meshtree_node> ModelTables::meshtree(uint32_t model_index) const
+    {
+        if (model_index >= _entries.size())
+        {
+            return {};
+        }
+
+        const auto& entry = _entries[model_index];
+        return std::span<const tr_meshtree_node>(_nodes).subspan(entry.nodes_start, entry.nodes_count);
+    }
+
+    uint32_t ModelTables::size() const
+    {
+        return static_cast<uint32_t>(_entries.size());
+    }
+
+    void ModelTables::write(CacheWriter& writer) const
+    {
+        writer(_entries, _rotations, _nodes, _indices);
+    }
+
+    void ModelTables::read(CacheReader& reader)
+    {
+        reader(_entries, _rotations, _nodes, _indices);
+
+        const bool valid = std::ranges::all_of(_entries, [this](const Entry& entry)
+            {
+                return entry.rotations_start <= _rotations.size() && entry.rotations_count <= _rotations.size() - entry.rotations_start &&
+                    entry.nodes_start <= _nodes.size() && entry.nodes_count <= _nodes.size() - entry.nodes_start;
+            });
+        if (!valid || std::ranges::any_of(_indices, [this](const auto& index) { return index.second >= _entries.size(); }))
+        {
+            throw std::runtime_error("Cached model refers to data outside of the tables");
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "trtypes.h"
+
+namespace trlevel
+{
+    class CacheWriter;
+    class CacheReader;
+
+    /// The first animation frame of a model, with rotations stored in ModelTables.
+    struct FrameView
+    {
+        int16_t offsetx{ 0 }, offsety{ 0 }, offsetz{ 0 };
+        std::span<const tr2_frame_rotation> values;
+
+        DirectX::SimpleMath::Vector3 position() const
+        {
+            return DirectX::SimpleMath::Vector3(offsetx / Scale_X, offsety / Scale_Y, offsetz / Scale_Z);
+        }
+    };
+
+    /// The first frame and mesh tree of every model in a level, decoded once at load time
+    /// into flat arrays, with models indexed by type ID.
+    class ModelTables final
+    {
+    public:
+        /// Add the next model. Models are indexed in the order they are added.
+        void add(const tr_model& model, const tr2_frame& frame, std::span<const tr_meshtree_node> nodes);
+        std::optional<uint32_t> index_of(uint32_t id) const;
+        FrameView frame(uint32_t model_index) const;
+        std::span<const tr_meshtree_node> meshtree(uint32_t model_index) const;
+        uint32_t size() const;
+        void write(CacheWriter& writer) const;
+        void read(CacheReader& reader);
+    private:
+        struct Entry
+        {
+            int16_t offsetx;
+            int16_t offsety;
+            int16_t offsetz;
+            uint32_t rotations_start;
+            uint32_t rotations_count;
+            uint32_t nodes_start;
+            uint32_t nodes_count;
+        };
+
+        std::vector<Entry> _entries;
+        std::vector<tr2_frame_rotation> _rotations;
+        std::vector<tr_meshtree_node> _nodes;
+        std::unordered_map<uint32_t, uint32_t> _indices;
+    };
+}
@@ -1,7 +1,10 @@
 #include "Pack.h"
-#include "Level_common.h"
+#include "LevelProbe.h"
 
 #include <trview.common/Strings.h>
+#include <cstring>
+#include <execution>
+#include <format>
 #include <ranges>
 #include <utility>
 #include <filesystem>
@@ -21,40 +24,44 @@ namespace trlevel
     {
     }
 
-    Pack::Pack(std::basic_ispanstream<uint8_t>& file, const trlevel::ILevel::PackSource& level_source)
-        : _level_source(level_source)
+    Pack::Pack(const std::shared_ptr<const std::vector<uint8_t>>& data)
+        : _data(data)
     {
-        file.seekg(8, std::ios::beg);
-        _parts = read_vector<Header>(file, 50) |
+        constexpr std::size_t headers_start = 8;
+        constexpr std::size_t header_count = 50;
+        if (_data->size() < headers_start + sizeof(Header) * header_count)
+        {
+            throw std::runtime_error("Pack is too small for its part headers");
+        }
+
+        std::array<Header, header_count> headers;
+        std::memcpy(headers.data(), _data->data() + headers_start, sizeof(headers));
+
+        // Parts are views of the pack data rather than copies of it.
+        const std::span<const uint8_t> bytes{ *_data };
+        _parts = headers |
             std::views::filter([](auto&& h) { return h.size > 0; }) |
             std::views::transform([&](auto&& h) -> Part
                 {
-                    file.seekg(h.start, std::ios::beg);
-                    std::vector<uint8_t> data;
-                    if (h.size > 0)
+                    if (h.start > bytes.size() || h.size > bytes.size() - h.start)
                     {
-                        data.resize(h.size);
-                        file.read(&data[0], h.size);
+                        throw std::runtime_error("Pack part is outside of the pack");
                     }
-                    return { .start = h.start, .size = h.size, .data = data };
+                    return { .start = h.start, .size = h.size, .data = bytes.subspan(h.start, h.size) };
                 }) | std::ranges::to<std::vector>();
     }
 
     void Pack::load()
     {
-        for (auto& part : _parts)
-        {
-            try
+        // Only the version is needed, so the parts are probed rather than loaded as levels.
+        std::for_each(std::execution::par, _parts.begin(), _parts.end(), [](Part& part)
             {
-                auto level = _level_source(std::format("pack-preview://{}", part.start), shared_from_this());
-                level->load({});
-                part.version = level->platform_and_version();
-            }
-            catch(...)
-            {
-                // Consume exception
-            }
-        }
+                const auto version = probe_level_version(part.data);
+                if (version.version != LevelVersion::Unknown || version.is_pack)
+                {
+                    part.version = version;
+                }
+            });
     }
 
     const std::vector<IPack::Part>& Pack::parts() const
@@ -97,7 +104,7 @@ namespace trlevel
         {
             if (p.start == offset)
             {
-                return p.data;
+                return std::vector<uint8_t>(p.data.begin(), p.data.end());
             }
         }
         return std::nullopt;
@@ -1,25 +1,23 @@
 #pragma once
 
 #include <memory>
-#include <spanstream>
 
 #include "IPack.h"
-#include "ILevel.h"
 
 namespace trlevel
 {
-    class Pack final : public IPack, public std::enable_shared_from_this<IPack>
+    class Pack final : public IPack
     {
     public:
-        explicit Pack(std::basic_ispanstream<uint8_t>& file, const trlevel::ILevel::PackSource& level_source);
+        explicit Pack(const std::shared_ptr<const std::vector<uint8_t>>& data);
         virtual ~Pack() = default;
         void load() override;
         const std::vector<Part>& parts() const override;
         std::string filename() const override;
         void set_filename(const std::string& filename) override;
     private:
+        std::shared_ptr<const std::vector<uint8_t>> _data;
         std::vector<Part> _parts;
-        trlevel::ILevel::PackSource _level_source;
         std::string _filename;
     };
 }
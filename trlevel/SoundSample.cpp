@@ -0,0 +1,35 @@
+#include "SoundSample.h"
+#include "Level_psx.h"
+
+namespace trlevel
+{
+    std::span<const uint8_t> SoundSample::bytes() const
+    {
+        if (!source || offset + size > source->size())
+        {
+            return {};
+        }
+        return std::span<const uint8_t>(*source).subspan(offset, size);
+    }
+
+    std::vector<uint8_t> SoundSample::decode() const
+    {
+        const auto data = bytes();
+        if (data.empty())
+        {
+            return {};
+        }
+
+        if (format == Format::Vag)
+        {
+            return convert_vag_to_wav(data, sample_frequency);
+        }
+        return { data.begin(), data.end() };
+    }
+
+    SoundSample make_sound_sample(std::vector<uint8_t>&& data)
+    {
+        const std::size_t size = data.size();
+        return { .source = std::make_shared<const std::vector<uint8_t>>(std::move(data)), .offset = 0, .size = size };
+    }
+}
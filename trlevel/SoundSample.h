@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace trlevel
+{
+    /// A sound sample as a byte range into a buffer shared with other samples from the same
+    /// level. Conversion into a playable WAV is deferred until the sample is first played.
+    struct SoundSample
+    {
+        enum class Format
+        {
+            /// The bytes are already a RIFF WAV file.
+            Wav,
+            /// The bytes are PSX VAG ADPCM and need converting to PCM.
+            Vag
+        };
+
+        std::shared_ptr<const std::vector<uint8_t>> source;
+        std::size_t offset{ 0 };
+        std::size_t size{ 0 };
+        Format format{ Format::Wav };
+        uint32_t sample_frequency{ 0 };
+
+        /// Get the undecoded bytes of the sample.
+        std::span<const uint8_t> bytes() const;
+        /// Convert the sample into a playable WAV file.
+        std::vector<uint8_t> decode() const;
+    };
+
+    /// Create a sound sample that owns all of the specified bytes.
+    SoundSample make_sound_sample(std::vector<uint8_t>&& data);
+}
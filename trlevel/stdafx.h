@@ -6,6 +6,7 @@
 #include <sstream>
 #include <iterator>
 #include <exception>
+#include <stdexcept>
 #include <string>
 #include <array>
 #include <vector>
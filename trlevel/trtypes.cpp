@@ -115,35 +115,37 @@ namespace trlevel
         return new_object_textures;
     }
 
+    tr4_mesh_face3 convert_triangle(const tr_face3& triangle)
+    {
+        tr4_mesh_face3 new_face3;
+        memcpy(new_face3.vertices, triangle.vertices, sizeof(triangle.vertices));
+        new_face3.texture = triangle.texture;
+        new_face3.effects = 0;
+        return new_face3;
+    }
+
     std::vector<tr4_mesh_face3> convert_triangles(std::vector<tr_face3> triangles)
     {
         std::vector<tr4_mesh_face3> new_triangles;
         new_triangles.reserve(triangles.size());
-        std::transform(triangles.begin(), triangles.end(),
-            std::back_inserter(new_triangles), [](const auto& tri)
-        {
-            tr4_mesh_face3 new_face3;
-            memcpy(new_face3.vertices, tri.vertices, sizeof(tri.vertices));
-            new_face3.texture = tri.texture;
-            new_face3.effects = 0;
-            return new_face3;
-        });
+        std::transform(triangles.begin(), triangles.end(), std::back_inserter(new_triangles), convert_triangle);
         return new_triangles;
     }
 
+    tr4_mesh_face4 convert_rectangle(const tr_face4& rectangle)
+    {
+        tr4_mesh_face4 new_face4;
+        memcpy(new_face4.vertices, rectangle.vertices, sizeof(rectangle.vertices));
+        new_face4.texture = rectangle.texture;
+        new_face4.effects = 0;
+        return new_face4;
+    }
+
     std::vector<tr4_mesh_face4> convert_rectangles(std::vector<tr_face4> rectangles)
     {
         std::vector<tr4_mesh_face4> new_rectangles;
         new_rectangles.reserve(rectangles.size());
-        std::transform(rectangles.begin(), rectangles.end(),
-            std::back_inserter(new_rectangles), [](const auto& rect)
-        {
-            tr4_mesh_face4 new_face4;
-            memcpy(new_face4.vertices, rect.vertices, sizeof(rect.vertices));
-            new_face4.texture = rect.texture;
-            new_face4.effects = 0;
-            return new_face4;
-        });
+        std::transform(rectangles.begin(), rectangles.end(), std::back_inserter(new_rectangles), convert_rectangle);
         return new_rectangles;
     }
 
@@ -176,10 +178,30 @@ namespace trlevel
         return new_models;
     }
 
+    std::vector<tr_animation> convert_animations(std::vector<tr4_animation> animations)
+    {
+        return animations
+            | std::views::transform([](const auto& a)
+                {
+                    return tr_animation
+                    {
+                        a.FrameOffset, a.FrameRate, a.FrameSize, a.State_ID, a.Speed, a.Accel,
+                        a.FrameStart, a.FrameEnd, a.NextAnimation, a.NextFrame,
+                        a.NumStateChanges, a.StateChangeOffset, a.NumAnimCommands, a.AnimCommand
+                    };
+                })
+            | std::ranges::to<std::vector>();
+    }
+
+    tr_vertex convert_vertex(const tr_vertex_psx& vertex)
+    {
+        return { vertex.x, vertex.y, vertex.z };
+    }
+
     std::vector<tr_vertex> convert_vertices(std::vector<tr_vertex_psx> vertices)
     {
         return vertices
-            | std::views::transform([](const auto& vert) { return tr_vertex{ vert.x, vert.y, vert.z }; })
+            | std::views::transform(convert_vertex)
             | std::ranges::to<std::vector>();
     }
 
@@ -985,9 +985,15 @@ namespace trlevel
     /// @returns The converted texture.
     std::vector<tr_object_texture> convert_object_textures(std::vector<tr5_object_texture> object_textures);
 
+    // Convert a Tomb Raider I-III triangle to a TRIV triangle.
+    tr4_mesh_face3 convert_triangle(const tr_face3& triangle);
+
     // Convert a set of Tomb Raider I-III triangles to TRIV triangles.
     std::vector<tr4_mesh_face3> convert_triangles(std::vector<tr_face3> triangles);
 
+    // Convert a Tomb Raider I-III rectangle to a TRIV rectangle.
+    tr4_mesh_face4 convert_rectangle(const tr_face4& rectangle);
+
     // Convert a set of Tomb Raider I-III rectangles to TRIV rectangles.
     std::vector<tr4_mesh_face4> convert_rectangles(std::vector<tr_face4> rectangles);
 
@@ -999,6 +1005,10 @@ namespace trlevel
     std::vector<tr_model> convert_models(std::vector<tr_model_psx> models);
     std::vector<tr_model> convert_models(std::vector<tr5_model> models);
 
+    /// Convert a set of TR4/5 animations into the TR1-3 layout, dropping the lateral speed.
+    std::vector<tr_animation> convert_animations(std::vector<tr4_animation> animations);
+
+    tr_vertex convert_vertex(const tr_vertex_psx& vertex);
     std::vector<tr_vertex> convert_vertices(std::vector<tr_vertex_psx> vertices);
 
     std::vector<tr4_mesh_face3> convert_tr3_psx_room_triangles(std::vector<uint32_t> triangles, uint16_t total_vertices);
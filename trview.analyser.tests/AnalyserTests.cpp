@@ -0,0 +1,142 @@
+#include <trview.analyser/Analyser.h>
+#include <trlevel/Mocks/ILevel.h>
+
+#include <external/nlohmann/json.hpp>
+
+using namespace trlevel;
+using namespace trlevel::mocks;
+using namespace trview::analyser;
+using testing::NiceMock;
+using testing::Return;
+
+namespace
+{
+    tr3_room create_room(const std::vector<uint16_t>& floordata_indices)
+    {
+        tr3_room room{};
+        for (const auto index : floordata_indices)
+        {
+            room.sector_list.push_back({ .floordata_index = index });
+        }
+        return room;
+    }
+
+    void set_floordata(NiceMock<MockLevel>& level, const std::vector<uint16_t>& floordata, const std::vector<uint16_t>& floordata_indices, PlatformAndVersion version = { .version = LevelVersion::Tomb4 })
+    {
+        ON_CALL(level, get_floor_data_all).WillByDefault(Return(floordata));
+        ON_CALL(level, platform_and_version).WillByDefault(Return(version));
+        ON_CALL(level, num_rooms).WillByDefault(Return(1));
+        ON_CALL(level, get_room).WillByDefault(Return(create_room(floordata_indices)));
+    }
+}
+
+TEST(Analyser, CountTriggersWalksFloordata)
+{
+    NiceMock<MockLevel> level;
+    set_floordata(level,
+        {
+            0,
+            // Portal, then a trigger with a camera command that takes an extra word.
+            0x0001, 0x0005,
+            0x8004, 0x3e00, 0x0401, 0x8000,
+            // Key trigger that ends at the key reference.
+            0x8304, 0x3e00, 0x8001,
+        },
+        { 0, 1, 7 });
+
+    ASSERT_EQ(count_triggers(level), 2u);
+}
+
+TEST(Analyser, CountTriggersSkipsTrngFlipeffectData)
+{
+    // With TRNG a flipeffect takes an extra word and that word ends the commands, so the walk carries on to the second trigger.
+    const std::vector<uint16_t> floordata{ 0, 0x0004, 0x3e00, 0xa401, 0x8000, 0x8004, 0x3e00, 0x8001 };
+
+    NiceMock<MockLevel> trng;
+    set_floordata(trng, floordata, { 1 });
+    ON_CALL(trng, trng).WillByDefault(Return(true));
+    ASSERT_EQ(count_triggers(trng), 2u);
+
+    NiceMock<MockLevel> not_trng;
+    set_floordata(not_trng, floordata, { 1 });
+    ASSERT_EQ(count_triggers(not_trng), 1u);
+}
+
+TEST(Analyser, CountTriggersUsesMay1996Functions)
+{
+    // The May 1996 prototype uses 3 for triggers, which is a ceiling slant in the other versions.
+    const std::vector<uint16_t> floordata{ 0, 0x8003, 0x3e00, 0x8001 };
+
+    NiceMock<MockLevel> may_1996;
+    set_floordata(may_1996, floordata, { 1 }, { .platform = Platform::PC, .version = LevelVersion::Tomb1, .raw_version = 11 });
+    ASSERT_EQ(count_triggers(may_1996), 1u);
+
+    NiceMock<MockLevel> tr1;
+    set_floordata(tr1, floordata, { 1 }, { .platform = Platform::PC, .version = LevelVersion::Tomb1, .raw_version = 32 });
+    ASSERT_EQ(count_triggers(tr1), 0u);
+}
+
+TEST(Analyser, CountTriggersStopsAtEndOfFloordata)
+{
+    NiceMock<MockLevel> level;
+    set_floordata(level, { 0, 0x0004, 0x3e00, 0x0001 }, { 1, 10 });
+
+    ASSERT_EQ(count_triggers(level), 1u);
+}
+
+TEST(Analyser, JsonIncludesLevelStats)
+{
+    Report report
+    {
+        .levels =
+        {
+            {
+                .filename = "level1.tr2",
+                .file_size = 100,
+                .version = { .platform = Platform::PC, .version = LevelVersion::Tomb2, .raw_version = 45 },
+                .rooms = 2,
+                .entities = 3,
+                .triggers = 4,
+                .textiles = 5,
+                .sounds = 6,
+                .load_time = std::chrono::milliseconds(7),
+                .phases = { { .name = "Open", .duration = std::chrono::milliseconds(1) } }
+            },
+            {
+                .filename = "level2.tr2",
+                .file_size = 200,
+                .error = "Failed"
+            }
+        },
+        .elapsed = std::chrono::milliseconds(10),
+        .jobs = 2,
+        .peak_memory = 1000
+    };
+
+    const auto json = nlohmann::json::parse(to_json(report));
+    ASSERT_EQ(json["elapsed_ms"], 10.0);
+    ASSERT_EQ(json["jobs"], 2);
+    ASSERT_EQ(json["peak_memory_bytes"], 1000);
+    ASSERT_EQ(json["levels"].size(), 2u);
+
+    const auto& level = json["levels"][0];
+    ASSERT_EQ(level["filename"], "level1.tr2");
+    ASSERT_EQ(level["file_size"], 100);
+    ASSERT_EQ(level["load_ms"], 7.0);
+    ASSERT_EQ(level["raw_version"], 45);
+    ASSERT_EQ(level["rooms"], 2);
+    ASSERT_EQ(level["entities"], 3);
+    ASSERT_EQ(level["triggers"], 4);
+    ASSERT_EQ(level["textiles"], 5);
+    ASSERT_EQ(level["sounds"], 6);
+    ASSERT_FALSE(level.contains("error"));
+    ASSERT_EQ(level["phases"].size(), 1u);
+    ASSERT_EQ(level["phases"][0]["name"], "Open");
+    ASSERT_EQ(level["phases"][0]["ms"], 1.0);
+
+    const auto& failed = json["levels"][1];
+    ASSERT_EQ(failed["filename"], "level2.tr2");
+    ASSERT_EQ(failed["file_size"], 200);
+    ASSERT_EQ(failed["error"], "Failed");
+    ASSERT_FALSE(failed.contains("rooms"));
+}
@@ -0,0 +1,44 @@
+#include <trview.analyser/Arguments.h>
+
+using namespace trview::analyser;
+
+TEST(Arguments, Defaults)
+{
+    const auto arguments = parse_arguments({ "level.tr2" });
+    ASSERT_TRUE(arguments);
+    ASSERT_EQ(arguments->options.jobs, 0u);
+    ASSERT_EQ(arguments->options.open_mode, trlevel::ILevel::LoadCallbacks::OpenMode::Full);
+    ASSERT_FALSE(arguments->quiet);
+    ASSERT_EQ(arguments->json_filename, "");
+    ASSERT_EQ(arguments->filenames, std::vector<std::string>{ "level.tr2" });
+}
+
+TEST(Arguments, Options)
+{
+    const auto arguments = parse_arguments({ "--jobs", "4", "--lazy", "--quiet", "--json", "out.json", "level.tr2", "level2.tr4" });
+    ASSERT_TRUE(arguments);
+    ASSERT_EQ(arguments->options.jobs, 4u);
+    ASSERT_EQ(arguments->options.open_mode, trlevel::ILevel::LoadCallbacks::OpenMode::Lazy);
+    ASSERT_TRUE(arguments->quiet);
+    ASSERT_EQ(arguments->json_filename, "out.json");
+    ASSERT_EQ(arguments->filenames, (std::vector<std::string>{ "level.tr2", "level2.tr4" }));
+}
+
+TEST(Arguments, InvalidJobs)
+{
+    for (const auto& jobs : { "", "four", "-1", "4x", "99999999999" })
+    {
+        ASSERT_FALSE(parse_arguments({ "--jobs", jobs, "level.tr2" })) << jobs;
+    }
+}
+
+TEST(Arguments, UnknownOption)
+{
+    ASSERT_FALSE(parse_arguments({ "--fast", "level.tr2" }));
+}
+
+TEST(Arguments, NoLevels)
+{
+    ASSERT_FALSE(parse_arguments({}));
+    ASSERT_FALSE(parse_arguments({ "--quiet" }));
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <trview.analyser/pch.h>
@@ -0,0 +1,230 @@
+#include "Analyser.h"
+#include "Memory.h"
+
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trlevel/Level.h>
+#include <trview.app/Elements/FloordataParser.h>
+#include <trview.common/Logs/Log.h>
+
+#include <external/nlohmann/json.hpp>
+
+namespace trview
+{
+    namespace analyser
+    {
+        namespace
+        {
+            const std::unordered_set<std::string> level_extensions{ ".tr2", ".tr4", ".trc", ".phd", ".psx", ".obj", ".tom", ".sat" };
+
+            double milliseconds(std::chrono::nanoseconds duration)
+            {
+                return std::chrono::duration<double, std::milli>(duration).count();
+            }
+
+            /// Times the gaps between the loader's progress messages.
+            class PhaseTimer final
+            {
+            public:
+                explicit PhaseTimer(std::vector<Phase>& phases)
+                    : _phases(phases), _start(std::chrono::steady_clock::now())
+                {
+                    _phases.push_back({ .name = "Open" });
+                }
+
+                void next(const std::string& name)
+                {
+                    stop();
+                    const auto existing = std::ranges::find(_phases, name, &Phase::name);
+                    _current = existing == _phases.end() ? _phases.size() : static_cast<std::size_t>(existing - _phases.begin());
+                    if (existing == _phases.end())
+                    {
+                        _phases.push_back({ .name = name });
+                    }
+                }
+
+                void stop()
+                {
+                    const auto now = std::chrono::steady_clock::now();
+                    _phases[_current].duration += now - _start;
+                    _start = now;
+                }
+            private:
+                std::vector<Phase>& _phases;
+                std::size_t _current{ 0 };
+                std::chrono::steady_clock::time_point _start;
+            };
+        }
+
+        uint32_t count_triggers(const trlevel::ILevel& level)
+        {
+            const auto floor_data = level.get_floor_data_all();
+            const auto version = level.platform_and_version();
+            uint32_t triggers = 0;
+            for (uint32_t r = 0; r < level.num_rooms(); ++r)
+            {
+                for (const auto& sector : level.get_room(r).sector_list)
+                {
+                    if (sector.floordata_index != 0)
+                    {
+                        for_each_floordata_command(floor_data, sector.floordata_index, level.trng(), version, [&](auto function, auto&&)
+                            {
+                                if (function == FloordataFunction::Trigger)
+                                {
+                                    ++triggers;
+                                }
+                            });
+                    }
+                }
+            }
+            return triggers;
+        }
+
+        std::vector<std::string> find_levels(const std::string& directory)
+        {
+            std::vector<std::string> levels;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, std::filesystem::directory_options::skip_permission_denied))
+            {
+                if (entry.is_regular_file() && level_extensions.contains(to_lowercase(entry.path().extension().string())))
+                {
+                    levels.push_back(entry.path().string());
+                }
+            }
+            std::ranges::sort(levels);
+            return levels;
+        }
+
+        LevelStats analyse_level(const std::string& filename, const std::shared_ptr<IFiles>& files, const Options& options)
+        {
+            LevelStats stats{ .filename = filename };
+            std::error_code error;
+            stats.file_size = std::filesystem::file_size(filename, error);
+
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                auto level = std::make_shared<trlevel::Level>(filename, nullptr, files, std::make_shared<trlevel::Decrypter>(),
+                    std::make_shared<Log>(), std::make_shared<trlevel::Hasher>(), nullptr);
+
+                PhaseTimer timer(stats.phases);
+                level->load(
+                    {
+                        .on_progress_callback = [&](auto&& message) { timer.next(message); },
+                        .on_textile_callback = [&](auto&&...) { ++stats.textiles; },
+                        .on_sound_callback = [&](auto&&...) { ++stats.sounds; },
+                        .open_mode = options.open_mode
+                    });
+                timer.stop();
+
+                stats.version = level->platform_and_version();
+                stats.rooms = level->num_rooms();
+                stats.entities = level->num_entities();
+                stats.triggers = count_triggers(*level);
+            }
+            catch (const std::exception& e)
+            {
+                stats.error = e.what();
+            }
+            stats.load_time = std::chrono::steady_clock::now() - start;
+            return stats;
+        }
+
+        Report analyse_levels(const std::vector<std::string>& filenames, const std::shared_ptr<IFiles>& files, const Options& options)
+        {
+            Report report;
+            report.levels.resize(filenames.size());
+            report.jobs = options.jobs ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+
+            const auto start = std::chrono::steady_clock::now();
+            std::atomic<std::size_t> next{ 0 };
+            {
+                std::vector<std::jthread> workers;
+                for (uint32_t i = 0; i < std::min<std::size_t>(report.jobs, filenames.size()); ++i)
+                {
+                    workers.emplace_back([&]()
+                        {
+                            for (auto index = next++; index < filenames.size(); index = next++)
+                            {
+                                report.levels[index] = analyse_level(filenames[index], files, options);
+                            }
+                        });
+                }
+            }
+            report.elapsed = std::chrono::steady_clock::now() - start;
+            report.peak_memory = peak_memory();
+            return report;
+        }
+
+        std::string to_text(const LevelStats& stats)
+        {
+            if (!stats.error.empty())
+            {
+                return std::format("{}: failed after {:.1f} ms - {}", stats.filename, milliseconds(stats.load_time), stats.error);
+            }
+
+            std::string text = std::format("{}: {} {} (version {}) in {:.1f} ms - {} rooms, {} entities, {} triggers, {} textiles, {} sounds",
+                stats.filename, to_string(stats.version.platform), to_string(stats.version.version), stats.version.raw_version,
+                milliseconds(stats.load_time), stats.rooms, stats.entities, stats.triggers, stats.textiles, stats.sounds);
+            for (const auto& phase : stats.phases)
+            {
+                text += std::format("\n    {:<40} {:>10.3f} ms", phase.name, milliseconds(phase.duration));
+            }
+            return text;
+        }
+
+        std::string to_text(const Report& report)
+        {
+            const auto failed = std::ranges::count_if(report.levels, [](auto&& l) { return !l.error.empty(); });
+            uint64_t bytes = 0;
+            for (const auto& level : report.levels)
+            {
+                bytes += level.file_size;
+            }
+            const double seconds = std::chrono::duration<double>(report.elapsed).count();
+            return std::format("{} levels ({} failed) in {:.3f} s on {} threads - {:.1f} levels/s, {:.1f} MB/s, peak memory {:.1f} MB",
+                report.levels.size(), failed, seconds, report.jobs,
+                seconds > 0 ? report.levels.size() / seconds : 0.0,
+                seconds > 0 ? bytes / seconds / 1e6 : 0.0,
+                report.peak_memory / 1e6);
+        }
+
+        std::string to_json(const Report& report)
+        {
+            nlohmann::ordered_json json;
+            json["elapsed_ms"] = milliseconds(report.elapsed);
+            json["jobs"] = report.jobs;
+            json["peak_memory_bytes"] = report.peak_memory;
+            json["levels"] = nlohmann::ordered_json::array();
+            for (const auto& stats : report.levels)
+            {
+                nlohmann::ordered_json entry;
+                entry["filename"] = stats.filename;
+                entry["file_size"] = stats.file_size;
+                entry["load_ms"] = milliseconds(stats.load_time);
+                if (!stats.error.empty())
+                {
+                    entry["error"] = stats.error;
+                }
+                else
+                {
+                    entry["platform"] = to_string(stats.version.platform);
+                    entry["version"] = to_string(stats.version.version);
+                    entry["raw_version"] = stats.version.raw_version;
+                    entry["remastered"] = stats.version.remastered;
+                    entry["rooms"] = stats.rooms;
+                    entry["entities"] = stats.entities;
+                    entry["triggers"] = stats.triggers;
+                    entry["textiles"] = stats.textiles;
+                    entry["sounds"] = stats.sounds;
+                    entry["phases"] = nlohmann::ordered_json::array();
+                    for (const auto& phase : stats.phases)
+                    {
+                        entry["phases"].push_back({ { "name", phase.name }, { "ms", milliseconds(phase.duration) } });
+                    }
+                }
+                json["levels"].push_back(entry);
+            }
+            return json.dump(2);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <trlevel/ILevel.h>
+#include <trview.common/IFiles.h>
+
+namespace trview
+{
+    namespace analyser
+    {
+        struct Phase
+        {
+            std::string name;
+            std::chrono::nanoseconds duration{ 0 };
+        };
+
+        struct LevelStats
+        {
+            std::string filename;
+            uint64_t file_size{ 0 };
+            /// Set when the level failed to load, in which case only the filename and file size are valid.
+            std::string error;
+            trlevel::PlatformAndVersion version;
+            uint32_t rooms{ 0 };
+            uint32_t entities{ 0 };
+            uint32_t triggers{ 0 };
+            uint32_t textiles{ 0 };
+            uint32_t sounds{ 0 };
+            std::chrono::nanoseconds load_time{ 0 };
+            /// Time between each progress message reported by the loader, in the order they were first reported.
+            std::vector<Phase> phases;
+        };
+
+        struct Options
+        {
+            trlevel::ILevel::LoadCallbacks::OpenMode open_mode{ trlevel::ILevel::LoadCallbacks::OpenMode::Full };
+            /// Number of levels to load at once. Zero uses one per hardware thread.
+            uint32_t jobs{ 0 };
+        };
+
+        struct Report
+        {
+            std::vector<LevelStats> levels;
+            std::chrono::nanoseconds elapsed{ 0 };
+            uint32_t jobs{ 0 };
+            uint64_t peak_memory{ 0 };
+        };
+
+        /// Count the triggers in the floordata of every sector in a loaded level.
+        uint32_t count_triggers(const trlevel::ILevel& level);
+        /// Find the files with level extensions in a directory and its subdirectories.
+        std::vector<std::string> find_levels(const std::string& directory);
+        /// Load a level without creating any textures or sounds and collect its stats.
+        LevelStats analyse_level(const std::string& filename, const std::shared_ptr<IFiles>& files, const Options& options);
+        /// Analyse the levels in parallel. The results are in the same order as the filenames.
+        Report analyse_levels(const std::vector<std::string>& filenames, const std::shared_ptr<IFiles>& files, const Options& options);
+
+        std::string to_text(const LevelStats& stats);
+        std::string to_text(const Report& report);
+        std::string to_json(const Report& report);
+    }
+}
@@ -0,0 +1,73 @@
+#include "Arguments.h"
+
+#include <charconv>
+
+namespace trview
+{
+    namespace analyser
+    {
+        const char* const usage = "Usage: trview.analyser [--jobs count] [--lazy] [--quiet] [--json output.json] <level or directory>...\n";
+
+        namespace
+        {
+            std::optional<uint32_t> parse_count(const std::string& value)
+            {
+                uint32_t count = 0;
+                const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), count);
+                if (error != std::errc() || end != value.data() + value.size())
+                {
+                    return std::nullopt;
+                }
+                return count;
+            }
+        }
+
+        std::optional<Arguments> parse_arguments(const std::vector<std::string>& args)
+        {
+            Arguments arguments;
+            for (std::size_t i = 0; i < args.size(); ++i)
+            {
+                const std::string& arg = args[i];
+                if (arg == "--jobs" && i + 1 < args.size())
+                {
+                    const auto jobs = parse_count(args[++i]);
+                    if (!jobs)
+                    {
+                        return std::nullopt;
+                    }
+                    arguments.options.jobs = *jobs;
+                }
+                else if (arg == "--lazy")
+                {
+                    arguments.options.open_mode = trlevel::ILevel::LoadCallbacks::OpenMode::Lazy;
+                }
+                else if (arg == "--quiet")
+                {
+                    arguments.quiet = true;
+                }
+                else if (arg == "--json" && i + 1 < args.size())
+                {
+                    arguments.json_filename = args[++i];
+                }
+                else if (arg.starts_with("--"))
+                {
+                    return std::nullopt;
+                }
+                else if (std::filesystem::is_directory(arg))
+                {
+                    std::ranges::copy(find_levels(arg), std::back_inserter(arguments.filenames));
+                }
+                else
+                {
+                    arguments.filenames.push_back(arg);
+                }
+            }
+
+            if (arguments.filenames.empty())
+            {
+                return std::nullopt;
+            }
+            return arguments;
+        }
+    }
+}
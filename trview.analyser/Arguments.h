@@ -0,0 +1,28 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Analyser.h"
+
+namespace trview
+{
+    namespace analyser
+    {
+        struct Arguments
+        {
+            Options options;
+            std::string json_filename;
+            bool quiet{ false };
+            /// The levels to load, with any directories replaced by the levels they contain.
+            std::vector<std::string> filenames;
+        };
+
+        extern const char* const usage;
+
+        /// Parse the command line arguments, not including the program name.
+        /// @returns The arguments, or nothing if they are not valid and the usage should be shown.
+        std::optional<Arguments> parse_arguments(const std::vector<std::string>& args);
+    }
+}
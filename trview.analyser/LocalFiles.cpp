@@ -0,0 +1,86 @@
+#include "LocalFiles.h"
+
+namespace trview
+{
+    namespace analyser
+    {
+        namespace
+        {
+            std::optional<std::vector<uint8_t>> read_file(const std::filesystem::path& path)
+            {
+                std::ifstream file(path, std::ios::binary | std::ios::ate);
+                if (!file)
+                {
+                    return std::nullopt;
+                }
+
+                std::vector<uint8_t> bytes(static_cast<std::size_t>(file.tellg()));
+                file.seekg(0, std::ios::beg);
+                file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+                return file ? std::optional(std::move(bytes)) : std::nullopt;
+            }
+        }
+
+        std::string LocalFiles::appdata_directory() const
+        {
+            return {};
+        }
+
+        std::string LocalFiles::fonts_directory() const
+        {
+            return {};
+        }
+
+        bool LocalFiles::create_directory(const std::string&) const
+        {
+            return false;
+        }
+
+        void LocalFiles::delete_file(const std::string&) const
+        {
+        }
+
+        std::optional<std::vector<uint8_t>> LocalFiles::load_file(const std::string& filename) const
+        {
+            return read_file(filename);
+        }
+
+        std::optional<std::vector<uint8_t>> LocalFiles::load_file(const std::wstring& filename) const
+        {
+            return read_file(filename);
+        }
+
+        void LocalFiles::save_file(const std::string&, const std::vector<uint8_t>&) const
+        {
+        }
+
+        void LocalFiles::save_file(const std::string&, const std::string&) const
+        {
+        }
+
+        std::vector<IFiles::File> LocalFiles::get_files(const std::string&, const std::string&) const
+        {
+            return {};
+        }
+
+        std::vector<IFiles::Directory> LocalFiles::get_directories(const std::string&) const
+        {
+            return {};
+        }
+
+        std::vector<IFiles::Directory> LocalFiles::get_directories(const std::string&, const std::string&) const
+        {
+            return {};
+        }
+
+        std::string LocalFiles::working_directory() const
+        {
+            return std::filesystem::current_path().string();
+        }
+
+        void LocalFiles::set_working_directory(const std::string& directory)
+        {
+            std::filesystem::current_path(directory);
+        }
+    }
+}
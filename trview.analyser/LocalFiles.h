@@ -0,0 +1,30 @@
+#pragma once
+
+#include <trview.common/IFiles.h>
+
+namespace trview
+{
+    namespace analyser
+    {
+        /// Reads files with the standard library so that levels can be loaded without the Windows file APIs.
+        /// The analyser never writes, so the functions that change files do nothing.
+        class LocalFiles final : public IFiles
+        {
+        public:
+            virtual ~LocalFiles() = default;
+            std::string appdata_directory() const override;
+            std::string fonts_directory() const override;
+            bool create_directory(const std::string& directory) const override;
+            void delete_file(const std::string& filename) const override;
+            std::optional<std::vector<uint8_t>> load_file(const std::string& filename) const override;
+            std::optional<std::vector<uint8_t>> load_file(const std::wstring& filename) const override;
+            void save_file(const std::string& filename, const std::vector<uint8_t>& bytes) const override;
+            void save_file(const std::string& filename, const std::string& text) const override;
+            std::vector<File> get_files(const std::string& folder, const std::string& pattern) const override;
+            std::vector<Directory> get_directories(const std::string& folder) const override;
+            std::vector<Directory> get_directories(const std::string& folder, const std::string& pattern) const override;
+            std::string working_directory() const override;
+            void set_working_directory(const std::string& directory) override;
+        };
+    }
+}
@@ -0,0 +1,38 @@
+#include "Analyser.h"
+#include "Arguments.h"
+#include "LocalFiles.h"
+
+#include <fstream>
+#include <iostream>
+
+/// Loads every level given, searching directories for level files, and reports stats and load timings for each.
+int main(int argc, char** argv)
+{
+    using namespace trview::analyser;
+
+    const auto arguments = parse_arguments(std::vector<std::string>(argv + 1, argv + argc));
+    if (!arguments)
+    {
+        std::cerr << usage;
+        return 1;
+    }
+
+    const auto& [options, json_filename, quiet, filenames] = *arguments;
+    const auto report = analyse_levels(filenames, std::make_shared<LocalFiles>(), options);
+    if (!quiet)
+    {
+        for (const auto& level : report.levels)
+        {
+            std::cout << to_text(level) << '\n';
+        }
+    }
+    std::cout << to_text(report) << '\n';
+
+    if (!json_filename.empty())
+    {
+        std::ofstream file(json_filename);
+        file << to_json(report);
+    }
+
+    return std::ranges::any_of(report.levels, [](auto&& l) { return !l.error.empty(); }) ? 2 : 0;
+}
@@ -0,0 +1,26 @@
+#include "Memory.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace trview
+{
+    namespace analyser
+    {
+        uint64_t peak_memory()
+        {
+#ifdef _WIN32
+            PROCESS_MEMORY_COUNTERS counters{ .cb = sizeof(PROCESS_MEMORY_COUNTERS) };
+            return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) ? counters.PeakWorkingSetSize : 0;
+#else
+            rusage usage{};
+            // Linux reports the maximum resident set size in kilobytes.
+            return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<uint64_t>(usage.ru_maxrss) * 1024 : 0;
+#endif
+        }
+    }
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace trview
+{
+    namespace analyser
+    {
+        /// The most memory that the process has used so far, in bytes.
+        uint64_t peak_memory();
+    }
+}
@@ -4,6 +4,7 @@
 #include <trview.graphics/mocks/IShaderStorage.h>
 #include <trview.app/Mocks/Geometry/ITransparencyBuffer.h>
 #include <trview.app/Mocks/Geometry/IModelStorage.h>
+#include <trview.app/Mocks/Geometry/IAnimationEngine.h>
 #include <trview.app/Mocks/Graphics/ILevelTextureStorage.h>
 #include <trview.app/Mocks/Graphics/IMeshStorage.h>
 #include <trview.app/Mocks/Graphics/ISelectionRenderer.h>
@@ -56,6 +57,7 @@ namespace
             std::shared_ptr<ILevelTextureStorage> level_texture_storage{ mock_shared<MockLevelTextureStorage>() };
             std::shared_ptr<IMeshStorage> mesh_storage{ mock_shared<MockMeshStorage>() };
             std::shared_ptr<IModelStorage> model_storage{ mock_shared<MockModelStorage>() };
+            IAnimationEngine::Source animation_engine_source{ [](auto&&...) { return mock_shared<MockAnimationEngine>(); } };
             std::unique_ptr<ITransparencyBuffer> transparency_buffer{ mock_unique<MockTransparencyBuffer>() };
             std::unique_ptr<ISelectionRenderer> selection_renderer{ mock_unique<MockSelectionRenderer>() };
             IItem::EntitySource entity_source{ [](auto&&...) { return mock_shared<MockItem>(); } };
@@ -78,7 +80,7 @@ namespace
             std::shared_ptr<Level> build()
             {
                 auto new_level = std::make_shared<Level>(device, shader_storage, level_texture_storage, std::move(transparency_buffer), std::move(selection_renderer), log, buffer_source, sound_storage, ngplus_switcher, sampler_state, level_name_lookup, messaging);
-                new_level->initialise(std::move(level), mesh_storage, model_storage, entity_source, ai_source, room_source, trigger_source, light_source, camera_sink_source, sound_source_source, flyby_source, callbacks);
+                new_level->initialise(std::move(level), mesh_storage, model_storage, animation_engine_source, entity_source, ai_source, room_source, trigger_source, light_source, camera_sink_source, sound_source_source, flyby_source, callbacks);
                 return new_level;
             }
 
@@ -88,6 +90,18 @@ namespace
                 return *this;
             }
 
+            test_module& with_animation_engine(const std::shared_ptr<IAnimationEngine>& animation_engine)
+            {
+                this->animation_engine_source = [=](auto&&...) { return animation_engine; };
+                return *this;
+            }
+
+            test_module& with_animation_engine_source(const IAnimationEngine::Source& animation_engine_source)
+            {
+                this->animation_engine_source = animation_engine_source;
+                return *this;
+            }
+
             test_module& with_entity_source(const IItem::EntitySource& entity_source)
             {
                 this->entity_source = entity_source;
@@ -888,6 +902,138 @@ TEST(Level, RoomUpdatedIfAnimationsEnabled)
     level->update(1.0f);
 }
 
+TEST(Level, AnimationEngineEvaluatesVisibleItems)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_entities()).WillRepeatedly(Return(2));
+
+    auto engine = mock_shared<MockAnimationEngine>();
+    EXPECT_CALL(*engine, add).WillOnce(Return(0u)).WillOnce(Return(1u));
+
+    std::vector<uint32_t> evaluated;
+    EXPECT_CALL(*engine, update(1.0f, _)).WillOnce([&](auto, auto instances) { evaluated = instances | std::ranges::to<std::vector>(); });
+
+    auto visible = mock_shared<MockItem>()->with_visible(true);
+    auto hidden = mock_shared<MockItem>()->with_visible(false);
+    EXPECT_CALL(*visible, set_animation(NotNull(), 0u)).Times(1);
+    EXPECT_CALL(*hidden, set_animation(NotNull(), 1u)).Times(1);
+
+    std::vector<std::shared_ptr<MockItem>> items{ visible, hidden };
+    uint32_t index = 0;
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_animation_engine(engine)
+        .with_entity_source([&](auto&&...) { return items[index++]; })
+        .build();
+
+    level->set_show_item_animation(true);
+    level->update(1.0f);
+
+    ASSERT_EQ(evaluated, std::vector<uint32_t>{ 0u });
+}
+
+TEST(Level, AnimationEngineNotUpdatedByDefault)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_entities()).WillRepeatedly(Return(1));
+
+    uint32_t created = 0;
+    auto item = mock_shared<MockItem>()->with_visible(true);
+    EXPECT_CALL(*item, set_animation).Times(0);
+
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_animation_engine_source([&]() { ++created; return mock_shared<MockAnimationEngine>(); })
+        .with_entity_source([&](auto&&...) { return item; })
+        .build();
+
+    level->update(1.0f);
+    level->set_show_item_animation(false);
+
+    ASSERT_EQ(created, 0u);
+}
+
+TEST(Level, AnimationEngineCreatedOnceWhenItemAnimationFirstShown)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_entities()).WillRepeatedly(Return(1));
+
+    auto engine = mock_shared<MockAnimationEngine>();
+    EXPECT_CALL(*engine, add).WillOnce(Return(0u));
+
+    uint32_t created = 0;
+    auto item = mock_shared<MockItem>()->with_visible(true);
+    EXPECT_CALL(*item, set_animation(NotNull(), 0u)).Times(2);
+    EXPECT_CALL(*item, set_animation(IsNull(), 0u)).Times(1);
+
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_animation_engine_source([&]() { ++created; return engine; })
+        .with_entity_source([&](auto&&...) { return item; })
+        .build();
+
+    ASSERT_EQ(created, 0u);
+    level->set_show_item_animation(true);
+    level->set_show_item_animation(false);
+    level->set_show_item_animation(true);
+
+    ASSERT_EQ(created, 1u);
+}
+
+TEST(Level, ItemAnimationWithoutAnimationEngineSource)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_entities()).WillRepeatedly(Return(1));
+
+    auto item = mock_shared<MockItem>()->with_visible(true);
+    EXPECT_CALL(*item, set_animation).Times(0);
+
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_animation_engine_source({})
+        .with_entity_source([&](auto&&...) { return item; })
+        .build();
+
+    level->set_show_item_animation(true);
+    level->update(1.0f);
+}
+
+TEST(Level, AnimationEngineNotUpdatedIfItemAnimationDisabled)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, num_entities()).WillRepeatedly(Return(1));
+
+    auto engine = mock_shared<MockAnimationEngine>();
+    EXPECT_CALL(*engine, add).WillOnce(Return(0u));
+    EXPECT_CALL(*engine, update).Times(0);
+
+    auto item = mock_shared<MockItem>()->with_visible(true);
+    EXPECT_CALL(*item, set_animation(NotNull(), 0u)).Times(1);
+    EXPECT_CALL(*item, set_animation(IsNull(), 0u)).Times(1);
+
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_animation_engine(engine)
+        .with_entity_source([&](auto&&...) { return item; })
+        .build();
+
+    level->set_show_item_animation(true);
+    level->set_show_item_animation(false);
+    level->update(1.0f);
+}
+
+TEST(Level, ItemAnimationDoesNotStopRoomAnimation)
+{
+    auto [mock_level_ptr, mock_level] = create_mock<trlevel::mocks::MockLevel>();
+    EXPECT_CALL(mock_level, get_version).WillRepeatedly(Return(LevelVersion::Tomb4));
+    EXPECT_CALL(mock_level, num_rooms()).WillRepeatedly(Return(1));
+
+    auto room = mock_shared<MockRoom>();
+    EXPECT_CALL(*room, update(1.0f)).Times(1);
+
+    auto level = register_test_module().with_level(std::move(mock_level_ptr))
+        .with_room_source([&](auto&&...) { return room; })
+        .build();
+
+    level->set_show_item_animation(false);
+    level->update(1.0f);
+}
+
 TEST(Level, SelectItemMessages)
 {
     std::optional<trview::Message> message;
@@ -6,9 +6,10 @@ using namespace trlevel;
 // Test that looking up an ID gives the correct result.
 TEST(TypeInfoLookup, LookupTR1)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":123,\"name\":\"Test Name\"}]}}";
+    static constexpr TypeNameEntry tr1[] = { { 123, "Test Name", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 } };
 
-    TypeInfoLookup lookup(json, std::nullopt);
+    TypeInfoLookup lookup(games, std::nullopt);
 
     ASSERT_EQ("Test Name", lookup.lookup({ .version = LevelVersion::Tomb1 }, 123, 0).name);
 }
@@ -16,9 +17,11 @@ TEST(TypeInfoLookup, LookupTR1)
 // Tests that if there are identical entries for different games, the correct result is returned.
 TEST(TypeInfoLookup, LookupMultipleGames)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":123,\"name\":\"Test Name TR1\"}],\"tr2\":[{\"id\":123,\"name\":\"Test Name TR2\"}]}}";
+    static constexpr TypeNameEntry tr1[] = { { 123, "Test Name TR1", "" } };
+    static constexpr TypeNameEntry tr2[] = { { 123, "Test Name TR2", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 }, { "tr2", tr2 } };
 
-    TypeInfoLookup lookup(json, std::nullopt);
+    TypeInfoLookup lookup(games, std::nullopt);
 
     ASSERT_EQ("Test Name TR1", lookup.lookup({ .version = LevelVersion::Tomb1 }, 123, 0).name);
     ASSERT_EQ("Test Name TR2", lookup.lookup({ .version = LevelVersion::Tomb2 }, 123, 0).name);
@@ -27,17 +30,16 @@ TEST(TypeInfoLookup, LookupMultipleGames)
 // Tests that if the name is missing, it still returns the number.
 TEST(TypeInfoLookup, LookupMissingItem)
 {
-    std::string json = "{}";
-
-    TypeInfoLookup lookup(json, std::nullopt);
+    TypeInfoLookup lookup({}, std::nullopt);
 
     ASSERT_EQ("123", lookup.lookup({ .version = LevelVersion::Tomb3 }, 123, 0).name);
 }
 
 TEST(TypeInfoLookup, LookupNormalMutantEggs)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":163,\"name\":\"Test Name 1\"}]}}";
-    TypeInfoLookup lookup(json, std::nullopt);
+    static constexpr TypeNameEntry tr1[] = { { 163, "Test Name 1", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 } };
+    TypeInfoLookup lookup(games, std::nullopt);
 
     auto winged = lookup.lookup({ .version = LevelVersion::Tomb1 }, 163, 0).name;
     auto shooter = lookup.lookup({ .version = LevelVersion::Tomb1 }, 163, 1 << 9).name;
@@ -56,8 +58,9 @@ TEST(TypeInfoLookup, LookupNormalMutantEggs)
 
 TEST(TypeInfoLookup, LookupBigMutantEggs)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":181,\"name\":\"Test Name 2\"}]}}";
-    TypeInfoLookup lookup(json, std::nullopt);
+    static constexpr TypeNameEntry tr1[] = { { 181, "Test Name 2", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 } };
+    TypeInfoLookup lookup(games, std::nullopt);
 
     auto winged = lookup.lookup({ .version = LevelVersion::Tomb1 }, 181, 0).name;
     auto shooter = lookup.lookup({ .version = LevelVersion::Tomb1 }, 181, 1 << 9).name;
@@ -76,8 +79,10 @@ TEST(TypeInfoLookup, LookupBigMutantEggs)
 
 TEST(TypeInfoLookup, LookupNormalMutantEggsTR2)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":163,\"name\":\"Test Name 1\"}],\"tr2\":[{\"id\":163,\"name\":\"Test Name 2\"}]}}";
-    TypeInfoLookup lookup(json, std::nullopt);
+    static constexpr TypeNameEntry tr1[] = { { 163, "Test Name 1", "" } };
+    static constexpr TypeNameEntry tr2[] = { { 163, "Test Name 2", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 }, { "tr2", tr2 } };
+    TypeInfoLookup lookup(games, std::nullopt);
 
     auto winged = lookup.lookup({ .version = LevelVersion::Tomb2 }, 163, 0).name;
 
@@ -86,20 +91,40 @@ TEST(TypeInfoLookup, LookupNormalMutantEggsTR2)
 
 TEST(TypeInfoLookup, ExtraTypesUsed)
 {
-    std::string json = "{}";
-
-    TypeInfoLookup lookup(json, "{\"games\":{\"tr3\":[{\"id\":123,\"name\":\"Test\"}]}}");
+    TypeInfoLookup lookup({}, "{\"games\":{\"tr3\":[{\"id\":123,\"name\":\"Test\"}]}}");
 
     ASSERT_EQ("Test", lookup.lookup({ .version = LevelVersion::Tomb3 }, 123, 0).name);
 }
 
 TEST(TypeInfoLookup, ExtraTypesOverride)
 {
-    std::string json = "{\"games\":{\"tr1\":[{\"id\":123,\"name\":\"Test Name 1\"},{\"id\":124,\"name\":\"Test Name 2\"}]}}";
+    static constexpr TypeNameEntry tr1[] = { { 123, "Test Name 1", "" }, { 124, "Test Name 2", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 } };
     std::string extra = "{\"games\":{\"tr1\":[{\"id\":123,\"name\":\"New Name\"}]}}";
 
-    TypeInfoLookup lookup(json, extra);
+    TypeInfoLookup lookup(games, extra);
 
     ASSERT_EQ("New Name", lookup.lookup({ .version = LevelVersion::Tomb1 }, 123, 0).name);
     ASSERT_EQ("Test Name 2", lookup.lookup({ .version = LevelVersion::Tomb1 }, 124, 0).name);
+}
+
+TEST(TypeInfoLookup, CategoriesSplit)
+{
+    static constexpr TypeNameEntry tr1[] = { { 123, "Test Name", "Entity,Pickup" }, { 124, "Test Name 2", "" } };
+    constexpr GameTypeNames games[] = { { "tr1", tr1 } };
+
+    TypeInfoLookup lookup(games, std::nullopt);
+
+    const std::unordered_set<std::string> expected{ "Entity", "Pickup" };
+    ASSERT_EQ(lookup.lookup({ .version = LevelVersion::Tomb1 }, 123, 0).categories, expected);
+    ASSERT_TRUE(lookup.lookup({ .version = LevelVersion::Tomb1 }, 124, 0).categories.empty());
+}
+
+TEST(TypeInfoLookup, EmbeddedTypeNames)
+{
+    TypeInfoLookup lookup(embedded_type_names(), std::nullopt);
+
+    const auto lara = lookup.lookup({ .version = LevelVersion::Tomb1 }, 0, 0);
+    ASSERT_EQ(lara.name, "Lara");
+    ASSERT_TRUE(lara.categories.contains("Entity"));
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include <trview.app/Geometry/Model/AnimationEngine.h>
+#include <trlevel/Mocks/ILevel.h>
+
+using namespace trview;
+using namespace trview::tests;
+using namespace trlevel;
+using namespace trlevel::mocks;
+using namespace testing;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    struct Keyframe
+    {
+        Vector3 offset;
+        std::vector<tr2_frame_rotation> rotations;
+    };
+
+    /// Add a clip to the data. Every keyframe must have one rotation per mesh.
+    void add_clip(AnimationEngine::Data& data, uint32_t frame_rate, uint32_t frame_count, uint32_t next_clip, const std::vector<Keyframe>& keyframes)
+    {
+        data.clips.push_back(
+            {
+                .first_keyframe = static_cast<uint32_t>(data.keyframe_offsets.size()),
+                .keyframe_count = static_cast<uint32_t>(keyframes.size()),
+                .frame_rate = frame_rate,
+                .frame_count = frame_count,
+                .next_clip = next_clip,
+                .next_frame = 0
+            });
+
+        for (const auto& keyframe : keyframes)
+        {
+            data.keyframe_offsets.push_back(keyframe.offset);
+            data.keyframe_rotations.push_back(static_cast<uint32_t>(data.rotations_x.size()));
+            for (const auto& rotation : keyframe.rotations)
+            {
+                data.rotations_x.push_back(rotation.x);
+                data.rotations_y.push_back(rotation.y);
+                data.rotations_z.push_back(rotation.z);
+            }
+        }
+    }
+
+    /// Two meshes where the second mesh is one unit along x from the first.
+    AnimationEngine::Data create_data()
+    {
+        AnimationEngine::Data data;
+        data.nodes = { { .parent = -1 }, { .parent = 0, .offset = Vector3(1, 0, 0) } };
+        data.skeletons = { { .first_node = 0, .mesh_count = 2, .clip = 0 } };
+        data.skeletons_by_type[5] = 0;
+        return data;
+    }
+
+    void assert_near(const Vector3& expected, const Vector3& actual)
+    {
+        ASSERT_NEAR(expected.x, actual.x, 0.0001f);
+        ASSERT_NEAR(expected.y, actual.y, 0.0001f);
+        ASSERT_NEAR(expected.z, actual.z, 0.0001f);
+    }
+}
+
+TEST(AnimationEngine, AddUnknownTypeReturnsNothing)
+{
+    auto data = create_data();
+    add_clip(data, 1, 1, 0, { { Vector3::Zero, { {}, {} } } });
+    AnimationEngine engine(data);
+
+    ASSERT_FALSE(engine.add(6).has_value());
+    ASSERT_TRUE(engine.pose(0).empty());
+}
+
+TEST(AnimationEngine, AddEvaluatesFirstKeyframe)
+{
+    auto data = create_data();
+    add_clip(data, 1, 1, 0, { { Vector3(0, 1, 0), { {}, {} } } });
+    AnimationEngine engine(data);
+
+    const auto instance = engine.add(5);
+    ASSERT_TRUE(instance.has_value());
+
+    const auto pose = engine.pose(instance.value());
+    ASSERT_EQ(pose.size(), 2);
+    assert_near(Vector3(0, 1, 0), pose[0].Translation());
+    assert_near(Vector3(1, 1, 0), pose[1].Translation());
+}
+
+TEST(AnimationEngine, ChildrenFollowParentRotation)
+{
+    auto data = create_data();
+    add_clip(data, 1, 1, 0, { { Vector3::Zero, { { .y = DirectX::XM_PIDIV2 }, {} } } });
+    AnimationEngine engine(data);
+
+    const auto pose = engine.pose(engine.add(5).value());
+    assert_near(Vector3(0, 0, -1), pose[1].Translation());
+}
+
+TEST(AnimationEngine, UpdateInterpolatesBetweenKeyframes)
+{
+    auto data = create_data();
+    add_clip(data, 2, 3, 0,
+        {
+            { Vector3::Zero, { {}, {} } },
+            { Vector3(0, 2, 0), { { .y = DirectX::XM_PIDIV2 }, {} } }
+        });
+    AnimationEngine engine(data);
+    const auto instance = engine.add(5).value();
+
+    // One tick is halfway between the two keyframes.
+    const std::vector<uint32_t> instances{ instance };
+    engine.update(1.0f / 30.0f, instances);
+
+    const auto pose = engine.pose(instance);
+    assert_near(Vector3(0, 1, 0), pose[0].Translation());
+    const auto expected = Vector3::Transform(Vector3(1, 0, 0), Matrix::CreateRotationY(DirectX::XM_PIDIV4));
+    assert_near(expected + Vector3(0, 1, 0), pose[1].Translation());
+}
+
+TEST(AnimationEngine, InterpolationTakesShortestPath)
+{
+    auto data = create_data();
+    add_clip(data, 2, 3, 0,
+        {
+            { Vector3::Zero, { { .y = 0.1f }, {} } },
+            { Vector3::Zero, { { .y = DirectX::XM_2PI - 0.1f }, {} } }
+        });
+    AnimationEngine engine(data);
+    const auto instance = engine.add(5).value();
+
+    const std::vector<uint32_t> instances{ instance };
+    engine.update(1.0f / 30.0f, instances);
+
+    // Halfway along the short path is no rotation at all, rather than half a turn.
+    assert_near(Vector3(1, 0, 0), engine.pose(instance)[1].Translation());
+}
+
+TEST(AnimationEngine, AnimationMovesToNextClip)
+{
+    auto data = create_data();
+    add_clip(data, 1, 2, 1, { { Vector3::Zero, { {}, {} } }, { Vector3::Zero, { {}, {} } } });
+    add_clip(data, 1, 1, 1, { { Vector3(0, 3, 0), { {}, {} } } });
+    AnimationEngine engine(data);
+    const auto instance = engine.add(5).value();
+
+    const std::vector<uint32_t> instances{ instance };
+    engine.update(2.0f / 30.0f, instances);
+
+    assert_near(Vector3(0, 3, 0), engine.pose(instance)[0].Translation());
+}
+
+TEST(AnimationEngine, OnlyRequestedInstancesEvaluated)
+{
+    auto data = create_data();
+    add_clip(data, 1, 2, 0, { { Vector3::Zero, { {}, {} } }, { Vector3(0, 1, 0), { {}, {} } } });
+    AnimationEngine engine(data);
+    const auto first = engine.add(5).value();
+    const auto second = engine.add(5).value();
+
+    const std::vector<uint32_t> instances{ second };
+    engine.update(1.0f / 30.0f, instances);
+
+    assert_near(Vector3::Zero, engine.pose(first)[0].Translation());
+    assert_near(Vector3(0, 1, 0), engine.pose(second)[0].Translation());
+}
+
+TEST(AnimationEngine, LongDeltaIsShortened)
+{
+    auto data = create_data();
+    add_clip(data, 10, 21, 0,
+        {
+            { Vector3::Zero, { {}, {} } },
+            { Vector3(0, 10, 0), { {}, {} } },
+            { Vector3(0, 20, 0), { {}, {} } }
+        });
+    AnimationEngine engine(data);
+    const auto instance = engine.add(5).value();
+
+    // A pause of a thousand seconds plays as a quarter of a second, which is seven and a half ticks.
+    const std::vector<uint32_t> instances{ instance };
+    engine.update(1000.0f, instances);
+
+    assert_near(Vector3(0, 7.5f, 0), engine.pose(instance)[0].Translation());
+}
+
+TEST(AnimationEngine, DuplicateInstancesEvaluatedOnce)
+{
+    auto data = create_data();
+    add_clip(data, 2, 3, 0,
+        {
+            { Vector3::Zero, { {}, {} } },
+            { Vector3(0, 2, 0), { {}, {} } }
+        });
+    AnimationEngine engine(data);
+    const auto first = engine.add(5).value();
+    const auto second = engine.add(5).value();
+
+    const std::vector<uint32_t> instances{ second, first, second, second, first };
+    engine.update(1.0f / 30.0f, instances);
+
+    assert_near(Vector3(0, 1, 0), engine.pose(first)[0].Translation());
+    assert_near(Vector3(0, 1, 0), engine.pose(second)[0].Translation());
+}
+
+TEST(AnimationEngine, LoadsAnimationsUsedByEntities)
+{
+    auto [level_ptr, level] = create_mock<MockLevel>();
+    tr_model model{ .ID = 5, .NumMeshes = 2, .MeshTree = 0, .Animation = 0 };
+    tr_animation animation{ .FrameRate = 1, .FrameSize = 10, .FrameStart = 0, .FrameEnd = 0, .NextAnimation = 0 };
+    tr2_frame frame{ .offsety = 1024, .values = { {}, {} } };
+    tr_meshtree_node node{ .Offset_X = 1024 };
+
+    ON_CALL(level, num_entities).WillByDefault(Return(1));
+    ON_CALL(level, get_entity(0)).WillByDefault(Return(tr2_entity{ .TypeID = 5 }));
+    ON_CALL(level, num_models).WillByDefault(Return(1));
+    ON_CALL(level, get_model(0)).WillByDefault(Return(model));
+    ON_CALL(level, get_model_index(5)).WillByDefault(Return(0u));
+    ON_CALL(level, animations).WillByDefault(Return(std::vector<tr_animation>{ animation }));
+    EXPECT_CALL(level, get_animation_frame(0, 0, 2)).WillOnce(Return(frame));
+    std::vector<tr_meshtree_node> nodes{ node };
+    ON_CALL(level, get_model_meshtree(0)).WillByDefault(Return(std::span<const tr_meshtree_node>(nodes)));
+
+    AnimationEngine engine(level);
+    ASSERT_FALSE(engine.add(0).has_value());
+
+    const auto pose = engine.pose(engine.add(5).value());
+    ASSERT_EQ(pose.size(), 2);
+    assert_near(Vector3(0, 1, 0), pose[0].Translation());
+    assert_near(Vector3(1, 1, 0), pose[1].Translation());
+}
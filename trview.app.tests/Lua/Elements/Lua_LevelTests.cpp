@@ -9,6 +9,7 @@
 #include <trview.tests.common/Mocks.h>
 #include <external/lua/src/lua.h>
 #include <external/lua/src/lauxlib.h>
+#include <external/lua/src/lualib.h>
 #include "../Lua.h"
 
 using namespace trview;
@@ -111,7 +112,7 @@ TEST(Lua_Level, Floordata)
 
     for (std::size_t i = 0; i < data.size(); ++i)
     {
-        lua_rawgeti(L, -1, i + 1);
+        lua_geti(L, -1, i + 1);
         ASSERT_EQ(lua_tointeger(L, -1), data[i]);
         lua_pop(L, 1);
     }
@@ -229,6 +230,62 @@ TEST(Lua_Level, Rooms)
     ASSERT_EQ(200, lua_tonumber(L, -1));
 }
 
+TEST(Lua_Level, RoomsCached)
+{
+    auto room1 = mock_shared<MockRoom>()->with_number(100);
+    auto room2 = mock_shared<MockRoom>()->with_number(200);
+    auto level = mock_shared<MockLevel>();
+    EXPECT_CALL(*level, rooms).Times(1).WillRepeatedly(Return(std::vector<std::weak_ptr<IRoom>>{ room1, room2 }));
+
+    LuaState L;
+    lua::create_level(L, level);
+    lua_setglobal(L, "l");
+
+    ASSERT_EQ(0, luaL_dostring(L, "return l.rooms == l.rooms"));
+    ASSERT_EQ(true, lua_toboolean(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return l.rooms[1] == l.rooms[1]"));
+    ASSERT_EQ(true, lua_toboolean(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return l.rooms[1] ~= l.rooms[2]"));
+    ASSERT_EQ(true, lua_toboolean(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return l.rooms[3]"));
+    ASSERT_EQ(LUA_TNIL, lua_type(L, -1));
+}
+
+TEST(Lua_Level, RoomsIterated)
+{
+    auto room1 = mock_shared<MockRoom>()->with_number(100);
+    auto room2 = mock_shared<MockRoom>()->with_number(200);
+    auto level = mock_shared<MockLevel>();
+    EXPECT_CALL(*level, rooms).WillRepeatedly(Return(std::vector<std::weak_ptr<IRoom>>{ room1, room2 }));
+
+    LuaState L;
+    luaL_openlibs(L);
+    lua::create_level(L, level);
+    lua_setglobal(L, "l");
+
+    ASSERT_EQ(0, luaL_dostring(L, "local t = 0 for i, r in ipairs(l.rooms) do t = t + i * r.number end return t"));
+    ASSERT_EQ(500, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "local t = 0 for i, r in pairs(l.rooms) do t = t + i * r.number end return t"));
+    ASSERT_EQ(500, lua_tointeger(L, -1));
+}
+
+TEST(Lua_Level, RoomsReadOnly)
+{
+    auto room1 = mock_shared<MockRoom>()->with_number(100);
+    auto level = mock_shared<MockLevel>();
+    EXPECT_CALL(*level, rooms).WillRepeatedly(Return(std::vector<std::weak_ptr<IRoom>>{ room1 }));
+
+    LuaState L;
+    luaL_openlibs(L);
+    lua::create_level(L, level);
+    lua_setglobal(L, "l");
+
+    ASSERT_NE(0, luaL_dostring(L, "l.rooms[1] = 5"));
+    ASSERT_NE(0, luaL_dostring(L, "table.insert(l.rooms, 5)"));
+    ASSERT_EQ(0, luaL_dostring(L, "return #l.rooms"));
+    ASSERT_EQ(1, lua_tointeger(L, -1));
+}
+
 TEST(Lua_Level, SelectedRoom)
 {
     auto room = mock_shared<MockRoom>()->with_number(200);
@@ -320,6 +377,23 @@ TEST(Lua_Level, Triggers)
     ASSERT_EQ(200, lua_tonumber(L, -1));
 }
 
+TEST(Lua_Level, UnknownProperty)
+{
+    auto level = mock_shared<MockLevel>();
+
+    LuaState L;
+    lua::create_level(L, level);
+    lua_setglobal(L, "l");
+
+    ASSERT_EQ(0, luaL_dostring(L, "return l.not_a_property"));
+    ASSERT_EQ(LUA_TNIL, lua_type(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return l[1]"));
+    ASSERT_EQ(LUA_TNIL, lua_type(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return l[l]"));
+    ASSERT_EQ(LUA_TNIL, lua_type(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "l.not_a_property = 1"));
+}
+
 TEST(Lua_Level, Version)
 {
     auto level = mock_shared<MockLevel>();
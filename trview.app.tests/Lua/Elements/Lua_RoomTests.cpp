@@ -6,6 +6,7 @@
 #include <trview.tests.common/Mocks.h>
 #include <external/lua/src/lua.h>
 #include <external/lua/src/lauxlib.h>
+#include <external/lua/src/lualib.h>
 #include "../Lua.h"
 
 using namespace trview;
@@ -316,6 +317,27 @@ TEST(Lua_Room, Sectors)
     ASSERT_EQ(200, lua_tointeger(L, -1));
 }
 
+TEST(Lua_Room, SectorsCached)
+{
+    auto sector1 = mock_shared<MockSector>()->with_id(100);
+    auto sector2 = mock_shared<MockSector>()->with_id(200);
+
+    auto room = mock_shared<MockRoom>();
+    EXPECT_CALL(*room, sectors).Times(1).WillRepeatedly(Return(std::vector<std::shared_ptr<ISector>>{ sector1, sector2 }));
+
+    LuaState L;
+    luaL_openlibs(L);
+    lua::create_room(L, room);
+    lua_setglobal(L, "r");
+
+    ASSERT_EQ(0, luaL_dostring(L, "return r.sectors == r.sectors"));
+    ASSERT_EQ(true, lua_toboolean(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return r.sectors[2] == r.sectors[2]"));
+    ASSERT_EQ(true, lua_toboolean(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "local t = 0 for _, s in ipairs(r.sectors) do t = t + s.number end return t"));
+    ASSERT_EQ(300, lua_tointeger(L, -1));
+}
+
 TEST(Lua_Room, Triggers)
 {
     auto trigger1 = mock_shared<MockTrigger>()->with_number(100);
@@ -0,0 +1,41 @@
+#include <trview.app/Lua/Lua.h>
+#include <trview.common/Mocks/IFiles.h>
+#include <trview.common/Mocks/Windows/IDialogs.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+
+namespace
+{
+    constexpr uint64_t step = Lua::InstructionStep;
+}
+
+TEST(Lua, InstructionsCountedInSteps)
+{
+    Lua lua({}, {}, {}, {}, mock_shared<MockDialogs>(), mock_shared<MockFiles>());
+    ASSERT_EQ(lua.instructions(), 0u);
+
+    lua.execute("local x = 0 for i = 1, 10000 do x = x + i end");
+    const auto after_loop = lua.instructions();
+    ASSERT_EQ(after_loop % step, 0u);
+    // Each iteration runs at least one instruction, and the hook won't have fired for the last partial step.
+    ASSERT_GE(after_loop, 10000u - step);
+    ASSERT_LE(after_loop, 10u * 10000u);
+
+    lua.execute("local x = 1");
+    ASSERT_LE(lua.instructions() - after_loop, step);
+}
+
+TEST(Lua, InstructionsCountedInCoroutines)
+{
+    Lua lua({}, {}, {}, {}, mock_shared<MockDialogs>(), mock_shared<MockFiles>());
+    lua.execute(
+        "local co = coroutine.create(function() local x = 0 for i = 1, 10000 do x = x + i if i % 1000 == 0 then coroutine.yield() end end end) "
+        "while coroutine.resume(co) and coroutine.status(co) ~= 'dead' do end");
+
+    // Almost all of the work is done in the coroutine, so without counting it the total would be below one step.
+    ASSERT_GE(lua.instructions(), 10000u - step);
+    ASSERT_EQ(lua.instructions() % step, 0u);
+}
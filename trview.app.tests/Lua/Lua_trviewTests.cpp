@@ -144,3 +144,77 @@ TEST(Lua_trview, SetRoute)
 
     ASSERT_EQ(0, luaL_dostring(L, "trview.route = Route.new()"));
 }
+
+TEST(Lua_trview, LoadConcurrency)
+{
+    auto application = mock_shared<MockApplication>();
+
+    LuaState L;
+    lua::trview_register(L, application.get(),
+        [](auto&&) { return mock_shared<MockRoute>(); },
+        [](auto&&) { return mock_shared<MockRandomizerRoute>(); },
+        [](auto&&...) { return mock_shared<MockWaypoint>(); },
+        [](auto&&...) { return mock_shared<MockScriptable>(); },
+        mock_shared<MockDialogs>(),
+        mock_shared<MockFiles>());
+
+    ASSERT_EQ(0, luaL_dostring(L, "trview.load_concurrency = 3"));
+    ASSERT_EQ(0, luaL_dostring(L, "return trview.load_concurrency"));
+    ASSERT_EQ(3, lua_tointeger(L, -1));
+}
+
+TEST(Lua_trview, LoadMany)
+{
+    auto level1 = mock_shared<MockLevel>();
+    ON_CALL(*level1, filename).WillByDefault(Return("a.tr2"));
+    auto level2 = mock_shared<MockLevel>();
+    ON_CALL(*level2, filename).WillByDefault(Return("b.tr2"));
+
+    auto application = mock_shared<MockApplication>();
+    EXPECT_CALL(*application, load("a.tr2", trlevel::ILevel::LoadCallbacks::OpenMode::Lazy)).WillOnce(Return(level1));
+    EXPECT_CALL(*application, load("b.tr2", trlevel::ILevel::LoadCallbacks::OpenMode::Lazy)).WillOnce(Return(level2));
+    EXPECT_CALL(*application, set_current_level).Times(0);
+
+    LuaState L;
+    lua::trview_register(L, application.get(),
+        [](auto&&) { return mock_shared<MockRoute>(); },
+        [](auto&&) { return mock_shared<MockRandomizerRoute>(); },
+        [](auto&&...) { return mock_shared<MockWaypoint>(); },
+        [](auto&&...) { return mock_shared<MockScriptable>(); },
+        mock_shared<MockDialogs>(),
+        mock_shared<MockFiles>());
+
+    ASSERT_EQ(0, luaL_dostring(L,
+        "loaded = {}\n"
+        "for filename, level in trview:load_many({ \"a.tr2\", \"b.tr2\" }, { data_only = true }) do\n"
+        "    loaded[filename] = level.filename\n"
+        "    last = level\n"
+        "end\n"
+        "return loaded[\"a.tr2\"] .. loaded[\"b.tr2\"]"));
+    ASSERT_STREQ("a.tr2b.tr2", lua_tostring(L, -1));
+
+    // Data only levels have no textures so can't be opened.
+    ASSERT_NE(0, luaL_dostring(L, "trview.level = last"));
+}
+
+TEST(Lua_trview, LoadManyReportsFailures)
+{
+    auto application = mock_shared<MockApplication>();
+    EXPECT_CALL(*application, load("a.tr2", trlevel::ILevel::LoadCallbacks::OpenMode::Full)).WillOnce(Throw(std::runtime_error("failed")));
+
+    LuaState L;
+    lua::trview_register(L, application.get(),
+        [](auto&&) { return mock_shared<MockRoute>(); },
+        [](auto&&) { return mock_shared<MockRandomizerRoute>(); },
+        [](auto&&...) { return mock_shared<MockWaypoint>(); },
+        [](auto&&...) { return mock_shared<MockScriptable>(); },
+        mock_shared<MockDialogs>(),
+        mock_shared<MockFiles>());
+
+    ASSERT_EQ(0, luaL_dostring(L,
+        "for filename, level, err in trview:load_many({ \"a.tr2\" }) do\n"
+        "    result = err\n"
+        "end\n"
+        "return result"));
+    ASSERT_STREQ("Failed to load level (a.tr2)", lua_tostring(L, -1));
+}
@@ -0,0 +1,147 @@
+#include <trview.app/Lua/Elements/Level/Lua_Level.h>
+#include <trview.app/Lua/trview/trview.h>
+#include <trview.app/Mocks/IApplication.h>
+#include <trview.app/Mocks/Elements/IItem.h>
+#include <trview.app/Mocks/Elements/ILevel.h>
+#include <trview.app/Mocks/Elements/IRoom.h>
+#include <trview.app/Mocks/Routing/IRoute.h>
+#include <trview.app/Mocks/Routing/IRandomizerRoute.h>
+#include <trview.app/Mocks/Lua/IScriptable.h>
+#include <trview.tests.common/Mocks.h>
+#include <external/lua/src/lua.h>
+#include <external/lua/src/lauxlib.h>
+#include "../Lua.h"
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace testing;
+
+namespace
+{
+    void register_trview(lua_State* L, IApplication* application)
+    {
+        lua::trview_register(L, application,
+            [](auto&&) { return mock_shared<MockRoute>(); },
+            [](auto&&) { return mock_shared<MockRandomizerRoute>(); },
+            [](auto&&...) { return mock_shared<MockWaypoint>(); },
+            [](auto&&...) { return mock_shared<MockScriptable>(); },
+            mock_shared<MockDialogs>(),
+            mock_shared<MockFiles>());
+    }
+}
+
+TEST(Lua_Query, Items)
+{
+    auto item1 = mock_shared<MockItem>()->with_number(1)->with_type_id(10);
+    auto item2 = mock_shared<MockItem>()->with_number(2)->with_type_id(20);
+    auto item3 = mock_shared<MockItem>()->with_number(3)->with_type_id(10);
+    auto level = mock_shared<MockLevel>();
+    ON_CALL(*level, items).WillByDefault(Return(std::vector<std::weak_ptr<IItem>>{ item1, item2, item3 }));
+
+    auto application = mock_shared<MockApplication>();
+    ON_CALL(*application, current_level).WillByDefault(Return(level));
+
+    LuaState L;
+    register_trview(L, application.get());
+
+    ASSERT_EQ(0, luaL_dostring(L, "return trview:query({ elements = \"items\", filters = { { key = \"Type ID\", compare = \"Equal\", value = 10 } } })"));
+    ASSERT_EQ(LUA_TTABLE, lua_type(L, -1));
+    lua_setglobal(L, "results");
+    ASSERT_EQ(0, luaL_dostring(L, "return #results"));
+    ASSERT_EQ(2, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return results[1].number"));
+    ASSERT_EQ(1, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return results[2].number"));
+    ASSERT_EQ(3, lua_tointeger(L, -1));
+}
+
+TEST(Lua_Query, Count)
+{
+    auto item1 = mock_shared<MockItem>()->with_number(1)->with_type_id(10);
+    auto item2 = mock_shared<MockItem>()->with_number(2)->with_type_id(20);
+    auto item3 = mock_shared<MockItem>()->with_number(3)->with_type_id(10);
+    auto level = mock_shared<MockLevel>();
+    ON_CALL(*level, items).WillByDefault(Return(std::vector<std::weak_ptr<IItem>>{ item1, item2, item3 }));
+
+    auto application = mock_shared<MockApplication>();
+    ON_CALL(*application, current_level).WillByDefault(Return(level));
+
+    LuaState L;
+    register_trview(L, application.get());
+
+    ASSERT_EQ(0, luaL_dostring(L, "return trview:query({ elements = \"items\", count = true, filters = { { key = \"Type ID\", compare = \"NotEqual\", value = 10 } } })"));
+    ASSERT_EQ(LUA_TNUMBER, lua_type(L, -1));
+    ASSERT_EQ(1, lua_tointeger(L, -1));
+}
+
+TEST(Lua_Query, Paged)
+{
+    std::vector<std::weak_ptr<IItem>> items;
+    std::vector<std::shared_ptr<MockItem>> item_ptrs;
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        item_ptrs.push_back(mock_shared<MockItem>()->with_number(i));
+        items.push_back(item_ptrs.back());
+    }
+    auto level = mock_shared<MockLevel>();
+    ON_CALL(*level, items).WillByDefault(Return(items));
+
+    auto application = mock_shared<MockApplication>();
+    ON_CALL(*application, current_level).WillByDefault(Return(level));
+
+    LuaState L;
+    register_trview(L, application.get());
+
+    ASSERT_EQ(0, luaL_dostring(L, "return trview:query({ elements = \"items\", offset = 4, limit = 3, filters = { { key = \"#\", compare = \"GreaterThan\", value = 1 } } })"));
+    lua_setglobal(L, "results");
+    ASSERT_EQ(0, luaL_dostring(L, "return #results"));
+    ASSERT_EQ(3, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return results[1].number"));
+    ASSERT_EQ(6, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return results[3].number"));
+    ASSERT_EQ(8, lua_tointeger(L, -1));
+}
+
+TEST(Lua_Query, LinkedElements)
+{
+    auto room1 = mock_shared<MockRoom>()->with_number(1);
+    ON_CALL(*room1, water).WillByDefault(Return(true));
+    auto room2 = mock_shared<MockRoom>()->with_number(2);
+    auto item1 = mock_shared<MockItem>()->with_number(1)->with_type_id(10)->with_room(room1);
+    auto item2 = mock_shared<MockItem>()->with_number(2)->with_type_id(10)->with_room(room2);
+    auto item3 = mock_shared<MockItem>()->with_number(3)->with_type_id(20)->with_room(room1);
+    auto level = mock_shared<MockLevel>();
+    ON_CALL(*level, items).WillByDefault(Return(std::vector<std::weak_ptr<IItem>>{ item1, item2, item3 }));
+    ON_CALL(*level, rooms).WillByDefault(Return(std::vector<std::weak_ptr<IRoom>>{ room1, room2 }));
+
+    auto application = mock_shared<MockApplication>();
+
+    LuaState L;
+    register_trview(L, application.get());
+    lua::create_level(L, level);
+    lua_setglobal(L, "l");
+
+    ASSERT_EQ(0, luaL_dostring(L,
+        "return trview:query({ level = l, elements = \"items\", filters = {"
+        "    { key = \"Type ID\", value = 10 },"
+        "    { key = \"Room\", compare = \"Matches\", children = { { key = \"Water\", value = true } } } } })"));
+    lua_setglobal(L, "results");
+    ASSERT_EQ(0, luaL_dostring(L, "return #results"));
+    ASSERT_EQ(1, lua_tointeger(L, -1));
+    ASSERT_EQ(0, luaL_dostring(L, "return results[1].number"));
+    ASSERT_EQ(1, lua_tointeger(L, -1));
+}
+
+TEST(Lua_Query, UnknownKey)
+{
+    auto level = mock_shared<MockLevel>();
+    auto application = mock_shared<MockApplication>();
+    ON_CALL(*application, current_level).WillByDefault(Return(level));
+
+    LuaState L;
+    register_trview(L, application.get());
+
+    ASSERT_NE(0, luaL_dostring(L, "return trview:query({ elements = \"items\", filters = { { key = \"Colour\", value = 1 } } })"));
+    ASSERT_NE(0, luaL_dostring(L, "return trview:query({ elements = \"cats\" })"));
+}
@@ -0,0 +1,100 @@
+#include <trview.app/Plugins/MessageBuffer.h>
+
+using namespace trview;
+
+namespace
+{
+    std::vector<std::string> texts(const std::vector<MessageBuffer::Line>& lines)
+    {
+        std::vector<std::string> result;
+        for (const auto& line : lines)
+        {
+            result.push_back(line.text);
+        }
+        return result;
+    }
+}
+
+TEST(MessageBuffer, LinesSince)
+{
+    MessageBuffer buffer;
+    buffer.add("one");
+    buffer.add("two");
+    buffer.add("three");
+
+    const auto all = buffer.lines_since(0);
+    ASSERT_EQ(texts(all), (std::vector<std::string>{ "one", "two", "three" }));
+    ASSERT_EQ(texts(buffer.lines_since(all[1].sequence)), std::vector<std::string>{ "three" });
+    ASSERT_TRUE(buffer.lines_since(all[2].sequence).empty());
+}
+
+TEST(MessageBuffer, MessagesSplitIntoLines)
+{
+    MessageBuffer buffer;
+    buffer.add("one\r\ntwo\nthree");
+    buffer.add("");
+
+    ASSERT_EQ(texts(buffer.lines_since(0)), (std::vector<std::string>{ "one", "two", "three", "" }));
+    ASSERT_EQ(buffer.size(), 4u);
+}
+
+TEST(MessageBuffer, OldestLinesDropped)
+{
+    MessageBuffer buffer(3);
+    for (int i = 0; i < 5; ++i)
+    {
+        buffer.add(std::to_string(i));
+    }
+
+    ASSERT_EQ(buffer.size(), 3u);
+    ASSERT_EQ(buffer.first_sequence(), 3u);
+    ASSERT_EQ(texts(buffer.lines_since(0)), (std::vector<std::string>{ "2", "3", "4" }));
+    ASSERT_EQ(buffer.lines_since(0).front().sequence, 3u);
+}
+
+TEST(MessageBuffer, Clear)
+{
+    MessageBuffer buffer;
+    buffer.add("one");
+    buffer.add("two");
+    buffer.clear();
+
+    ASSERT_EQ(buffer.size(), 0u);
+    ASSERT_EQ(buffer.first_sequence(), 3u);
+    ASSERT_TRUE(buffer.lines_since(0).empty());
+
+    buffer.add("three");
+    const std::vector<MessageBuffer::Line> expected{ { .sequence = 3, .text = "three" } };
+    ASSERT_EQ(buffer.lines_since(0), expected);
+}
+
+TEST(MessageBuffer, CapacityLowered)
+{
+    MessageBuffer buffer(4);
+    for (int i = 0; i < 6; ++i)
+    {
+        buffer.add(std::to_string(i));
+    }
+
+    buffer.set_capacity(2);
+    ASSERT_EQ(buffer.capacity(), 2u);
+    ASSERT_EQ(texts(buffer.lines_since(0)), (std::vector<std::string>{ "4", "5" }));
+
+    buffer.add("6");
+    ASSERT_EQ(texts(buffer.lines_since(0)), (std::vector<std::string>{ "5", "6" }));
+}
+
+TEST(MessageBuffer, CapacityRaised)
+{
+    MessageBuffer buffer(2);
+    for (int i = 0; i < 3; ++i)
+    {
+        buffer.add(std::to_string(i));
+    }
+
+    buffer.set_capacity(4);
+    buffer.add("3");
+    buffer.add("4");
+    ASSERT_EQ(texts(buffer.lines_since(0)), (std::vector<std::string>{ "1", "2", "3", "4" }));
+    ASSERT_EQ(buffer.first_sequence(), 2u);
+}
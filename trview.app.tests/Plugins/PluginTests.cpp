@@ -56,7 +56,8 @@ TEST(Plugin, PrintRegistered)
 
     lua.on_print("test");
 
-    ASSERT_EQ(plugin.messages(), "test");
+    const std::vector<MessageBuffer::Line> expected{ { .sequence = 1, .text = "test" } };
+    ASSERT_EQ(plugin.messages_since(0), expected);
 }
 
 TEST(Plugin, AddAndClearMessages)
@@ -65,9 +66,24 @@ TEST(Plugin, AddAndClearMessages)
 
     plugin.add_message("test");
     plugin.add_message("test2");
-    ASSERT_EQ(plugin.messages(), "test\ntest2");
+    const std::vector<MessageBuffer::Line> expected{ { .sequence = 1, .text = "test" }, { .sequence = 2, .text = "test2" } };
+    ASSERT_EQ(plugin.messages_since(0), expected);
     plugin.clear_messages();
-    ASSERT_EQ(plugin.messages(), "");
+    ASSERT_TRUE(plugin.messages_since(0).empty());
+    ASSERT_EQ(plugin.first_message_sequence(), 3u);
+}
+
+TEST(Plugin, MessageCapacity)
+{
+    Plugin plugin(mock_shared<MockFiles>(), mock_unique<MockLua>(), "test");
+    plugin.set_message_capacity(2);
+
+    plugin.add_message("test");
+    plugin.add_message("test2");
+    plugin.add_message("test3");
+    const std::vector<MessageBuffer::Line> expected{ { .sequence = 2, .text = "test2" }, { .sequence = 3, .text = "test3" } };
+    ASSERT_EQ(plugin.messages_since(0), expected);
+    ASSERT_EQ(plugin.first_message_sequence(), 2u);
 }
 
 TEST(Plugin, DoFile)
@@ -97,3 +113,85 @@ TEST(Plugin, SetEnabled)
     Plugin plugin(mock_shared<MockFiles>(), std::move(lua_ptr), "test");
     plugin.set_enabled(true);
 }
+
+TEST(Plugin, RenderCallsProfiled)
+{
+    auto [lua_ptr, lua] = create_mock<MockLua>();
+    uint64_t instructions = 0;
+    ON_CALL(lua, instructions).WillByDefault([&]() { return instructions; });
+    ON_CALL(lua, execute("if render_ui ~= nil then render_ui() end")).WillByDefault([&](auto&&) { instructions += 5000; });
+    ON_CALL(lua, execute("if render_toolbar ~= nil then render_toolbar() end")).WillByDefault([&](auto&&) { instructions += 2000; });
+
+    Plugin plugin(mock_shared<MockFiles>(), std::move(lua_ptr), "test");
+    plugin.render_ui();
+    plugin.render_ui();
+    plugin.render_toolbar();
+
+    const auto profile = plugin.profile();
+    ASSERT_EQ(profile.render_ui.calls, 2u);
+    ASSERT_EQ(profile.render_ui.instructions, 10000u);
+    ASSERT_EQ(profile.render_toolbar.calls, 1u);
+    ASSERT_EQ(profile.render_toolbar.instructions, 2000u);
+    ASSERT_EQ(profile.execute.calls, 0u);
+}
+
+TEST(Plugin, CallbacksProfiledAtEndOfFrame)
+{
+    auto [lua_ptr, lua] = create_mock<MockLua>();
+    uint64_t instructions = 0;
+    ON_CALL(lua, instructions).WillByDefault([&]() { return instructions; });
+    ON_CALL(lua, execute("if render_ui ~= nil then render_ui() end")).WillByDefault([&](auto&&) { instructions += 5000; });
+
+    Plugin plugin(mock_shared<MockFiles>(), std::move(lua_ptr), "test");
+    plugin.render_ui();
+    // Instructions run by something other than the plugin, such as a scriptable being clicked.
+    instructions += 3000;
+    plugin.end_frame(std::chrono::nanoseconds::zero(), false);
+
+    const auto profile = plugin.profile();
+    ASSERT_EQ(profile.callbacks.instructions, 3000u);
+    ASSERT_EQ(profile.callbacks.calls, 0u);
+    ASSERT_EQ(profile.last_frame.instructions, 8000u);
+    ASSERT_EQ(profile.last_frame.calls, 1u);
+    ASSERT_EQ(profile.frames, 1u);
+}
+
+TEST(Plugin, OverBudgetSkipsFrames)
+{
+    auto [lua_ptr, lua] = create_mock<MockLua>();
+    EXPECT_CALL(lua, execute("if render_ui ~= nil then render_ui() end"))
+        .Times(1)
+        .WillRepeatedly([](auto&&) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+
+    Plugin plugin(mock_shared<MockFiles>(), std::move(lua_ptr), "test");
+    for (int i = 0; i < 3; ++i)
+    {
+        plugin.render_ui();
+        plugin.end_frame(std::chrono::milliseconds(1), true);
+    }
+
+    const auto profile = plugin.profile();
+    ASSERT_EQ(profile.frames, 3u);
+    ASSERT_EQ(profile.frames_over_budget, 1u);
+    ASSERT_EQ(profile.frames_skipped, 2u);
+}
+
+TEST(Plugin, OverBudgetWarnsWithoutSkipping)
+{
+    auto [lua_ptr, lua] = create_mock<MockLua>();
+    EXPECT_CALL(lua, execute("if render_ui ~= nil then render_ui() end"))
+        .Times(2)
+        .WillRepeatedly([](auto&&) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+    Plugin plugin(mock_shared<MockFiles>(), std::move(lua_ptr), "test");
+    for (int i = 0; i < 2; ++i)
+    {
+        plugin.render_ui();
+        plugin.end_frame(std::chrono::milliseconds(1), false);
+    }
+
+    const auto profile = plugin.profile();
+    ASSERT_EQ(profile.frames_over_budget, 2u);
+    ASSERT_EQ(profile.frames_skipped, 0u);
+    ASSERT_GE(profile.render_ui.time, std::chrono::milliseconds(4));
+}
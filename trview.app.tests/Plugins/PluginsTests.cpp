@@ -61,3 +61,39 @@ TEST(Plugins, SettingsApplied)
 
     Plugins plugins(files, mock_shared<MockPlugin>(), source, settings);
 }
+
+TEST(Plugins, FrameEndedWithBudget)
+{
+    auto files = mock_shared<MockFiles>();
+    auto default_plugin = mock_shared<MockPlugin>();
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(*default_plugin, render_ui).Times(1);
+        EXPECT_CALL(*default_plugin, end_frame(std::chrono::nanoseconds(std::chrono::microseconds(2500)), true)).Times(1);
+    }
+
+    UserSettings settings{ .plugin_frame_budget = 2.5f, .plugin_skip_over_budget = true };
+    Plugins plugins(files, default_plugin, [](auto&&...) { return mock_shared<MockPlugin>(); }, settings);
+    plugins.render_ui();
+}
+
+TEST(Plugins, MessageCapacityApplied)
+{
+    auto files = mock_shared<MockFiles>();
+    auto default_plugin = mock_shared<MockPlugin>();
+    auto plugin = mock_shared<MockPlugin>();
+    EXPECT_CALL(*default_plugin, set_message_capacity(100)).Times(1);
+    EXPECT_CALL(*plugin, set_message_capacity(100)).Times(1);
+    EXPECT_CALL(*default_plugin, set_message_capacity(200)).Times(1);
+    EXPECT_CALL(*plugin, set_message_capacity(200)).Times(1);
+
+    UserSettings settings{ .plugin_console_lines = 100 };
+    settings.plugin_directories.push_back("dir");
+    EXPECT_CALL(*files, get_directories("dir"))
+        .WillRepeatedly(testing::Return(std::vector<IFiles::Directory>{ { "plugindir", "plugindir_friendly" } }));
+
+    Plugins plugins(files, default_plugin, [&](auto&&...) { return plugin; }, settings);
+
+    settings.plugin_console_lines = 200;
+    plugins.receive_message(trview::Message{ .type = "settings", .data = std::make_shared<MessageData<UserSettings>>(settings) });
+}
@@ -827,3 +827,65 @@ TEST(SettingsLoader, HeightLinesSaved)
     loader->save_user_settings(settings);
     EXPECT_THAT(output, HasSubstr("\"show_route_height_labels\":true"));
 }
+
+TEST(SettingsLoader, LevelCacheLoaded)
+{
+    auto loader = setup_setting("{\"level_cache\":false}");
+    auto settings = loader->load_user_settings();
+    ASSERT_EQ(settings.level_cache, false);
+
+    auto loader_true = setup_setting("{\"level_cache\":true}");
+    auto settings_true = loader_true->load_user_settings();
+    ASSERT_EQ(settings_true.level_cache, true);
+}
+
+TEST(SettingsLoader, LevelCacheSaved)
+{
+    std::string output;
+    auto loader = setup_save_setting(output);
+    UserSettings settings;
+    settings.level_cache = false;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"level_cache\":false"));
+
+    settings.level_cache = true;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"level_cache\":true"));
+}
+
+TEST(SettingsLoader, PluginFrameBudgetLoaded)
+{
+    auto loader = setup_setting("{\"plugin_frame_budget\":2.5,\"plugin_skip_over_budget\":true}");
+    auto settings = loader->load_user_settings();
+    ASSERT_EQ(settings.plugin_frame_budget, 2.5f);
+    ASSERT_EQ(settings.plugin_skip_over_budget, true);
+}
+
+TEST(SettingsLoader, PluginFrameBudgetSaved)
+{
+    std::string output;
+    auto loader = setup_save_setting(output);
+    UserSettings settings;
+    settings.plugin_frame_budget = 2.5f;
+    settings.plugin_skip_over_budget = true;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"plugin_frame_budget\":2.5"));
+    EXPECT_THAT(output, HasSubstr("\"plugin_skip_over_budget\":true"));
+}
+
+TEST(SettingsLoader, PluginConsoleLinesLoaded)
+{
+    auto loader = setup_setting("{\"plugin_console_lines\":500}");
+    auto settings = loader->load_user_settings();
+    ASSERT_EQ(settings.plugin_console_lines, 500u);
+}
+
+TEST(SettingsLoader, PluginConsoleLinesSaved)
+{
+    std::string output;
+    auto loader = setup_save_setting(output);
+    UserSettings settings;
+    settings.plugin_console_lines = 500;
+    loader->save_user_settings(settings);
+    EXPECT_THAT(output, HasSubstr("\"plugin_console_lines\":500"));
+}
@@ -0,0 +1,169 @@
+#include <trview.app/Sound/SoundMixer.h>
+#include <thread>
+
+using namespace trview;
+
+namespace
+{
+    template <typename T>
+    void append(std::vector<uint8_t>& data, const T& value)
+    {
+        const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    /// Create a 16 bit mono WAV at the mixer sample rate where every sample has the same value.
+    std::shared_ptr<const std::vector<uint8_t>> create_wav(uint32_t frames, int16_t value)
+    {
+        std::vector<uint8_t> data;
+        data.insert(data.end(), { 'R', 'I', 'F', 'F' });
+        append<uint32_t>(data, 36 + frames * 2);
+        data.insert(data.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+        append<uint32_t>(data, 16);
+        append<uint16_t>(data, 1);
+        append<uint16_t>(data, 1);
+        append<uint32_t>(data, SoundMixer::SampleRate);
+        append<uint32_t>(data, SoundMixer::SampleRate * 2);
+        append<uint16_t>(data, 2);
+        append<uint16_t>(data, 16);
+        data.insert(data.end(), { 'd', 'a', 't', 'a' });
+        append<uint32_t>(data, frames * 2);
+        for (uint32_t i = 0; i < frames; ++i)
+        {
+            append<int16_t>(data, value);
+        }
+        return std::make_shared<const std::vector<uint8_t>>(data);
+    }
+}
+
+TEST(SoundMixer, InvalidDataNotPlayed)
+{
+    SoundMixer mixer(SoundMixer::Backend::None);
+    ASSERT_FALSE(mixer.play(nullptr));
+    ASSERT_FALSE(mixer.play(std::make_shared<const std::vector<uint8_t>>()));
+    ASSERT_FALSE(mixer.play(std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3, 4 })));
+    ASSERT_EQ(mixer.active_voices(), 0);
+}
+
+TEST(SoundMixer, VoicesMixedTogether)
+{
+    SoundMixer mixer(SoundMixer::Backend::None);
+    ASSERT_TRUE(mixer.play(create_wav(1000, 8192)));
+    ASSERT_EQ(mixer.active_voices(), 1);
+
+    std::vector<float> single(64 * SoundMixer::Channels);
+    mixer.mix(single.data(), 64);
+    ASSERT_NEAR(single.back(), 0.25f, 0.01f);
+
+    ASSERT_TRUE(mixer.play(create_wav(1000, 8192)));
+    ASSERT_EQ(mixer.active_voices(), 2);
+
+    std::vector<float> both(64 * SoundMixer::Channels);
+    mixer.mix(both.data(), 64);
+    ASSERT_NEAR(both.back(), 0.5f, 0.02f);
+}
+
+TEST(SoundMixer, VoiceReleasedWhenFinished)
+{
+    SoundMixer mixer(SoundMixer::Backend::None);
+    ASSERT_TRUE(mixer.play(create_wav(100, 8192)));
+
+    std::vector<float> output(1024 * SoundMixer::Channels);
+    mixer.mix(output.data(), 1024);
+
+    ASSERT_EQ(mixer.active_voices(), 0);
+    ASSERT_EQ(output.back(), 0.0f);
+}
+
+// Freeing on the audio thread can block, so mix leaves the finished voice to be released by the next play.
+TEST(SoundMixer, FinishedVoiceReleasedByPlay)
+{
+    SoundMixer mixer(SoundMixer::Backend::None);
+    auto first = create_wav(100, 8192);
+    std::weak_ptr<const std::vector<uint8_t>> first_data = first;
+    ASSERT_TRUE(mixer.play(first));
+    first.reset();
+
+    std::vector<float> output(1024 * SoundMixer::Channels);
+    mixer.mix(output.data(), 1024);
+    ASSERT_EQ(mixer.active_voices(), 0);
+    ASSERT_FALSE(first_data.expired());
+
+    ASSERT_TRUE(mixer.play(create_wav(100, 8192)));
+    ASSERT_TRUE(first_data.expired());
+    ASSERT_EQ(mixer.active_voices(), 1);
+}
+
+TEST(SoundMixer, OldestVoiceReusedWhenFull)
+{
+    SoundMixer mixer(SoundMixer::Backend::None, 2);
+    const auto quiet = create_wav(1000, 0);
+    const auto loud = create_wav(1000, 8192);
+    ASSERT_TRUE(mixer.play(loud));
+    ASSERT_TRUE(mixer.play(quiet));
+    ASSERT_TRUE(mixer.play(quiet));
+    ASSERT_EQ(mixer.active_voices(), 2);
+
+    std::vector<float> output(64 * SoundMixer::Channels);
+    mixer.mix(output.data(), 64);
+    ASSERT_EQ(output.back(), 0.0f);
+}
+
+TEST(SoundMixer, StopReleasesVoices)
+{
+    SoundMixer mixer(SoundMixer::Backend::None);
+    ASSERT_TRUE(mixer.play(create_wav(1000, 8192)));
+    ASSERT_TRUE(mixer.play(create_wav(1000, 8192)));
+    mixer.stop();
+    ASSERT_EQ(mixer.active_voices(), 0);
+}
+
+TEST(SoundMixer, NullBackendPlaysToCompletion)
+{
+    SoundMixer mixer(SoundMixer::Backend::Null);
+    ASSERT_TRUE(mixer.has_device());
+    ASSERT_TRUE(mixer.play(create_wav(SoundMixer::SampleRate / 100, 8192)));
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (mixer.active_voices() > 0 && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQ(mixer.active_voices(), 0);
+}
+
+TEST(SoundMixer, FailedPlayKeepsPlayingVoices)
+{
+    SoundMixer mixer(SoundMixer::Backend::None, 1);
+    ASSERT_TRUE(mixer.play(create_wav(1000, 8192)));
+    ASSERT_FALSE(mixer.play(std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3, 4 })));
+    ASSERT_EQ(mixer.active_voices(), 1);
+
+    std::vector<float> output(64 * SoundMixer::Channels);
+    mixer.mix(output.data(), 64);
+    ASSERT_NEAR(output.back(), 0.25f, 0.01f);
+}
+
+TEST(SoundMixer, NullBackendPlayAndStopWhileMixing)
+{
+    SoundMixer mixer(SoundMixer::Backend::Null, 2);
+    ASSERT_TRUE(mixer.has_device());
+
+    const auto wav = create_wav(SoundMixer::SampleRate / 100, 8192);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(mixer.play(wav));
+        if (i % 10 == 0)
+        {
+            mixer.stop();
+        }
+    }
+    ASSERT_LE(mixer.active_voices(), 2u);
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (mixer.active_voices() > 0 && std::chrono::steady_clock::now() < timeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_EQ(mixer.active_voices(), 0);
+}
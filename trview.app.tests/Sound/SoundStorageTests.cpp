@@ -37,3 +37,55 @@ TEST(SoundStorage, AddAndGetSounds)
     ASSERT_EQ(sounds[0].index.sample_index, 100);
     ASSERT_EQ(sounds[0].sound.lock(), sound);
 }
+
+TEST(SoundStorage, SampleDecodedOnFirstPlay)
+{
+    ISound::DataSource data_source;
+    auto source = [&](auto&& data) { data_source = data; return mock_shared<MockSound>(); };
+    SoundStorage storage(source);
+
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, trlevel::make_sound_sample({ 1, 2, 3, 4 }));
+    ASSERT_EQ(storage.cached(), 0);
+    ASSERT_TRUE(data_source);
+
+    const auto data = data_source();
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(*data, std::vector<uint8_t>({ 1, 2, 3, 4 }));
+    ASSERT_EQ(storage.cached(), 1);
+    ASSERT_EQ(data_source(), data);
+}
+
+TEST(SoundStorage, SoundsShareSample)
+{
+    uint32_t times_called = 0;
+    auto sound = mock_shared<MockSound>();
+    auto source = [&](auto&&...) { ++times_called; return sound; };
+    SoundStorage storage(source);
+
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 100 }, {});
+    storage.add({ .sound_map = 1, .sound_details = 1, .sample_index = 100 }, {});
+
+    ASSERT_EQ(times_called, 1);
+    ASSERT_EQ(storage.sounds().size(), 2);
+    ASSERT_EQ(storage.get(100).lock(), sound);
+}
+
+TEST(SoundStorage, CacheEvictsLeastRecentlyUsed)
+{
+    auto source = [&](auto&&...) { return mock_shared<MockSound>(); };
+    SoundStorage storage(source, 2);
+
+    storage.add({ .sound_map = 0, .sound_details = 0, .sample_index = 0 }, trlevel::make_sound_sample({ 0 }));
+    storage.add({ .sound_map = 1, .sound_details = 1, .sample_index = 1 }, trlevel::make_sound_sample({ 1 }));
+    storage.add({ .sound_map = 2, .sound_details = 2, .sample_index = 2 }, trlevel::make_sound_sample({ 2 }));
+
+    const auto first = storage.data(0);
+    const auto second = storage.data(1);
+    ASSERT_EQ(storage.data(0), first);
+    storage.data(2);
+
+    ASSERT_EQ(storage.cached(), 2);
+    ASSERT_EQ(storage.data(0), first);
+    ASSERT_NE(storage.data(1), second);
+    ASSERT_EQ(*storage.data(1), std::vector<uint8_t>{ 1 });
+}
@@ -0,0 +1,27 @@
+#include <trview.app/Sound/Sound.h>
+#include <trview.app/Mocks/Sound/ISoundMixer.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using testing::Return;
+
+TEST(Sound, PlaySendsDataToMixer)
+{
+    auto mixer = mock_shared<MockSoundMixer>();
+    const auto data = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{ 1, 2, 3 });
+    EXPECT_CALL(*mixer, play(data)).Times(1).WillOnce(Return(true));
+
+    Sound sound([&]() { return data; }, mixer);
+    sound.play();
+}
+
+TEST(Sound, NoDataNotPlayed)
+{
+    auto mixer = mock_shared<MockSoundMixer>();
+    EXPECT_CALL(*mixer, play).Times(0);
+
+    Sound sound([&]() { return nullptr; }, mixer);
+    sound.play();
+}
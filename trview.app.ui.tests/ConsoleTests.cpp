@@ -39,14 +39,14 @@ void register_console_tests(ImGuiTestEngine* engine)
             auto plugins = mock_shared<MockPlugins>();
             auto plugin = mock_shared<MockPlugin>();
             ON_CALL(*plugin, name).WillByDefault(testing::Return("Default"));
-            ON_CALL(*plugin, messages).WillByDefault(testing::Return("Hello"));
+            ON_CALL(*plugin, messages_since(0)).WillByDefault(testing::Return(std::vector<MessageBuffer::Line>{ { .sequence = 1, .text = "Hello" } }));
             EXPECT_CALL(*plugin, clear_messages).Times(1);
 
             ON_CALL(*plugins, plugins).WillByDefault(testing::Return(std::vector<std::weak_ptr<IPlugin>>{ plugin }));
             context.ptr = std::make_shared<Console>(mock_shared<MockDialogs>(), plugins, mock_shared<MockFonts>());
 
             ctx->Yield();
-            IM_CHECK_STR_EQ(ItemText(ctx, ctx->ItemInfo("/Console 0/TabBar/Default/##Log").ID).c_str(), "Hello");
+            IM_CHECK_STR_EQ(RenderedText(ctx, ctx->WindowInfo("/Console 0/TabBar/Default/##Log").Window->ID).c_str(), "Hello");
 
             ctx->ItemClick("/Console 0/##MenuBar/Edit");
             ctx->ItemClick("//Menu_00/Clear");
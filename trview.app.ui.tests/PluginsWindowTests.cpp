@@ -180,4 +180,39 @@ void register_plugins_window_tests(ImGuiTestEngine* engine)
             const std::vector<std::string> expected;
             IM_CHECK_EQ(std::static_pointer_cast<MessageData<UserSettings>>(called_settings.data)->value.plugin_directories, expected);
         });
+
+    test<PluginsWindowContext>(engine, "Plugins Window", "Skip Over Budget Toggled",
+        [](ImGuiTestContext* ctx) { ctx->GetVars<PluginsWindowContext>().render(); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& context = ctx->GetVars<PluginsWindowContext>();
+            auto messaging = mock_shared<MockMessageSystem>();
+            context.plugins = mock_shared<MockPlugins>();
+            context.ptr = register_test_module().with_plugins(context.plugins).with_messaging(messaging).build();
+
+            trview::Message called_settings;
+            EXPECT_CALL(*messaging, send_message).Times(AtLeast(1)).WillRepeatedly(SaveArg<0>(&called_settings));
+
+            ctx->ItemCheck("/**/Skip Over Budget");
+
+            IM_CHECK_EQ(std::static_pointer_cast<MessageData<UserSettings>>(called_settings.data)->value.plugin_skip_over_budget, true);
+        });
+
+    test<PluginsWindowContext>(engine, "Plugins Window", "Timings Reset",
+        [](ImGuiTestContext* ctx) { ctx->GetVars<PluginsWindowContext>().render(); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto& context = ctx->GetVars<PluginsWindowContext>();
+            auto plugin = mock_shared<MockPlugin>();
+            ON_CALL(*plugin, name).WillByDefault(Return("Plugin Name"));
+            EXPECT_CALL(*plugin, reset_profile).Times(1);
+
+            context.plugins = mock_shared<MockPlugins>();
+            ON_CALL(*context.plugins, plugins).WillByDefault(Return(std::vector<std::weak_ptr<IPlugin>> { plugin }));
+            context.ptr = register_test_module().with_plugins(context.plugins).build();
+
+            ctx->ItemClick("/**/Reset Timings");
+
+            IM_CHECK_EQ(Mock::VerifyAndClearExpectations(plugin.get()), true);
+        });
 }
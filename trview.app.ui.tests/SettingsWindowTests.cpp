@@ -383,6 +383,27 @@ void register_settings_window_tests(ImGuiTestEngine* engine)
             IM_CHECK_EQ(get_settings(*received_value).randomizer_tools, true);
         });
 
+    test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Clicking Level Cache Raises Event",
+        [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
+        [](ImGuiTestContext* ctx)
+        {
+            auto messaging = mock_shared<MockMessageSystem>();
+            auto& controls = ctx->GetVars<MockWrapper<SettingsWindow>>();
+            controls.ptr = register_test_module().with_messaging(messaging).build();
+            controls.ptr->toggle_visibility();
+
+            std::optional<trview::Message> received_value;
+            EXPECT_CALL(*messaging, send_message).WillOnce(SaveArg<0>(&received_value));
+
+            ctx->SetRef("Settings");
+            ctx->ItemClick("TabBar/General");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache levels for faster reopening"), false);
+            ctx->ItemCheck("TabBar/General/Cache levels for faster reopening");
+            IM_CHECK_EQ(ctx->ItemIsChecked("TabBar/General/Cache levels for faster reopening"), true);
+            IM_CHECK_EQ(received_value.has_value(), true);
+            IM_CHECK_EQ(get_settings(*received_value).level_cache, true);
+        });
+
     test<MockWrapper<SettingsWindow>>(engine, "Settings Window", "Clicking Reset FOV Raises Event",
         [](ImGuiTestContext* ctx) { render(ctx->GetVars<MockWrapper<SettingsWindow>>()); },
         [](ImGuiTestContext* ctx)
@@ -104,6 +104,7 @@ namespace trview
 
     Application::~Application()
     {
+        lua::cancel_loads();
         SetWindowLongPtr(window(), GWLP_USERDATA, reinterpret_cast<LONG_PTR>(nullptr));
         _settings_loader->save_user_settings(_settings);
         if (_imgui_backend->is_setup())
@@ -133,7 +134,13 @@ namespace trview
 
                 try
                 {
-                    operation.level = load(filename);
+                    const auto on_progress = [this](const std::string& progress)
+                        {
+                            std::lock_guard lock{ _progress_mutex };
+                            _progress = progress;
+                        };
+                    on_progress(std::format("Loading {}", filename));
+                    operation.level = load_level(filename, trlevel::ILevel::LoadCallbacks::OpenMode::Full, on_progress);
                 }
                 catch (trlevel::LevelEncryptedException&)
                 {
@@ -401,13 +408,19 @@ namespace trview
 
         if (_load.valid())
         {
+            std::string progress;
+            {
+                std::lock_guard lock{ _progress_mutex };
+                progress = _progress;
+            }
+
             const auto viewport = ImGui::GetMainViewport();
-            const ImVec2 size = ImGui::CalcTextSize(_progress.c_str());
+            const ImVec2 size = ImGui::CalcTextSize(progress.c_str());
             ImGui::SetNextWindowPos(ImVec2(viewport->Pos.x + viewport->Size.x * 0.75f, viewport->Pos.y), 0, ImVec2(0.5f, 0.0f));
             ImGui::SetNextWindowSize(ImVec2(400, size.y));
             if (ImGui::Begin("Load Progress", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove))
             {
-                ImGui::Text(_progress.c_str());
+                ImGui::Text(progress.c_str());
                 ImGui::End();
             }
         }
@@ -592,10 +605,14 @@ namespace trview
         return _level;
     }
 
-    std::shared_ptr<ILevel> Application::load(const std::string& filename)
+    std::shared_ptr<ILevel> Application::load(const std::string& filename, trlevel::ILevel::LoadCallbacks::OpenMode open_mode)
     {
-        _progress = std::format("Loading {}", filename);
+        // Scripts can run several loads at a time on the loader threads, so only the level being opened shows its progress.
+        return load_level(filename, open_mode, {});
+    }
 
+    std::shared_ptr<ILevel> Application::load_level(const std::string& filename, trlevel::ILevel::LoadCallbacks::OpenMode open_mode, const std::function<void(const std::string&)>& on_progress)
+    {
         std::shared_ptr<trlevel::IPack> current_pack;
         if (filename.starts_with("pack://"))
         {
@@ -605,7 +622,7 @@ namespace trview
             current_pack = _level ? _level->pack().lock() : nullptr;
             if (!current_pack || current_pack->filename() != pack_filename)
             {
-                auto pack_level = _level_source(pack_filename, {}, { .on_progress_callback = [&](auto&& p) { _progress = p; } });
+                auto pack_level = _level_source(pack_filename, {}, { .on_progress_callback = on_progress });
                 if (auto pack = pack_level->pack().lock())
                 {
                     current_pack = pack;
@@ -613,7 +630,7 @@ namespace trview
             }
         }
 
-        auto level = _level_source(filename, current_pack, { .on_progress_callback = [&](auto&& p) { _progress = p; } });
+        auto level = _level_source(filename, current_pack, { .on_progress_callback = on_progress, .open_mode = open_mode, .use_cache = _settings.level_cache });
         level->set_filename(filename);
         return level;
     }
@@ -782,21 +799,21 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             lua::set_settings(_settings);
         }
-        else if (message.type == "get_settings")
+        else if (message.type == messages::types::get_settings)
         {
             if (auto requester = std::static_pointer_cast<MessageData<std::weak_ptr<IRecipient>>>(message.data)->value.lock())
             {
-                requester->receive_message({ .type = "settings", .data = std::make_shared<MessageData<UserSettings>>(_settings) });
+                requester->receive_message({ .type = messages::types::settings, .data = std::make_shared<MessageData<UserSettings>>(_settings) });
             }
         }
-        else if (message.type == "get_open_level")
+        else if (message.type == messages::types::get_open_level)
         {
             if (auto requester = std::static_pointer_cast<MessageData<std::weak_ptr<IRecipient>>>(message.data)->value.lock())
             {
-                requester->receive_message({ .type = "open_level", .data = std::make_shared<MessageData<std::weak_ptr<ILevel>>>(_level) });
+                requester->receive_message({ .type = messages::types::open_level, .data = std::make_shared<MessageData<std::weak_ptr<ILevel>>>(_level) });
             }
         }
         else if (auto diff_level = messages::read_end_diff(message))
@@ -872,11 +889,11 @@ namespace trview
                 set_route(_randomizer_route_source(std::nullopt));
             }
         }
-        else if (message.type == "get_route")
+        else if (message.type == messages::types::get_route)
         {
             if (auto requester = std::static_pointer_cast<MessageData<std::weak_ptr<IRecipient>>>(message.data)->value.lock())
             {
-                requester->receive_message({ .type = "route", .data = std::make_shared<MessageData<std::weak_ptr<IRoute>>>(_route) });
+                requester->receive_message({ .type = messages::types::route, .data = std::make_shared<MessageData<std::weak_ptr<IRoute>>>(_route) });
             }
         }
         else if (auto level = messages::read_open_level(message))
@@ -895,4 +912,27 @@ namespace trview
             open_recent_route();
         }
     }
+
+    std::optional<std::vector<MessageType>> Application::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::add_to_route,
+            messages::types::end_diff,
+            messages::types::get_open_level,
+            messages::types::get_route,
+            messages::types::get_settings,
+            messages::types::new_randomizer_route,
+            messages::types::new_route,
+            messages::types::open_level,
+            messages::types::open_level_filename,
+            messages::types::route_open,
+            messages::types::route_reload,
+            messages::types::route_save,
+            messages::types::route_save_as,
+            messages::types::route_window_opened,
+            messages::types::settings,
+            messages::types::switch_level_filename
+        };
+    }
 }
\ No newline at end of file
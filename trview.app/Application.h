@@ -1,6 +1,7 @@
 #pragma once
 
 #include <future>
+#include <mutex>
 
 #include <trview.common/Window.h>
 #include <trview.common/Timer.h>
@@ -34,7 +35,9 @@ namespace trview
         virtual ~IApplication() = 0;
         virtual int run() = 0;
         virtual std::weak_ptr<ILevel> current_level() const = 0;
-        virtual std::shared_ptr<ILevel> load(const std::string& filename) = 0;
+        /// Load a level without opening it. This is for scripts, so it can be called from any thread and doesn't report
+        /// progress. Lazy loads are for scripts that only read the level data, so they skip uploading textures.
+        virtual std::shared_ptr<ILevel> load(const std::string& filename, trlevel::ILevel::LoadCallbacks::OpenMode open_mode) = 0;
         virtual std::vector<std::string> local_levels() const = 0;
         virtual std::shared_ptr<IRoute> route() const = 0;
         virtual void set_current_level(const std::shared_ptr<ILevel>& level, ILevel::OpenMode open_mode, bool prompt_user) = 0;
@@ -80,7 +83,7 @@ namespace trview
         virtual int run() override;
         void render();
         std::weak_ptr<ILevel> current_level() const override;
-        std::shared_ptr<ILevel> load(const std::string& filename) override;
+        std::shared_ptr<ILevel> load(const std::string& filename, trlevel::ILevel::LoadCallbacks::OpenMode open_mode) override;
         std::vector<std::string> local_levels() const override;
         std::shared_ptr<IRoute> route() const override;
         void set_current_level(const std::shared_ptr<ILevel>& level, ILevel::OpenMode open_mode, bool prompt_user) override;
@@ -88,6 +91,7 @@ namespace trview
         UserSettings settings() const override;
         std::weak_ptr<IViewer> viewer() const override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         // Window setup functions.
         void setup_view_menu();
@@ -110,6 +114,7 @@ namespace trview
         void open_recent_route();
         void save_window_placement();
         void check_load();
+        std::shared_ptr<ILevel> load_level(const std::string& filename, trlevel::ILevel::LoadCallbacks::OpenMode open_mode, const std::function<void(const std::string&)>& on_progress);
         void end_diff(const std::weak_ptr<ILevel>& level);
 
         TokenStore _token_store;
@@ -159,7 +164,9 @@ namespace trview
 
         std::future<LoadOperation> _load;
         LoadMode _load_mode;
+        /// Written by the loading thread and read when rendering.
         std::string _progress;
+        std::mutex _progress_mutex;
         std::optional<std::string> _route_directory;
 
         std::shared_ptr<IMessageSystem> _messaging;
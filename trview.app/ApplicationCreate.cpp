@@ -4,6 +4,7 @@
 #include <trlevel/Decrypter.h>
 #include <trlevel/Pack.h>
 #include <trlevel/Hasher.h>
+#include <trlevel/LevelCache.h>
 #include <trview.common/Files.h>
 #include <trview.common/Logs/Log.h>
 #include <trview.common/windows/Clipboard.h>
@@ -21,6 +22,7 @@
 #include "Resources/resource.h"
 #include "Resources/DefaultShaders.h"
 #include "Resources/DefaultTextures.h"
+#include "Resources/EmbeddedTables.h"
 
 #include "Elements/TypeInfoLookup.h"
 #include "Elements/CameraSink/CameraSink.h"
@@ -39,6 +41,7 @@
 #include "Geometry/Mesh.h"
 #include "Geometry/Picking.h"
 #include "Geometry/TransparencyBuffer.h"
+#include "Geometry/Model/AnimationEngine.h"
 #include "Geometry/Model/Model.h"
 #include "Geometry/Model/ModelStorage.h"
 #include "Graphics/LevelTextureStorage.h"
@@ -55,6 +58,7 @@
 #include "Routing/Route.h"
 #include "Settings/SettingsLoader.h"
 #include "Settings/StartupOptions.h"
+#include "Sound/SoundMixer.h"
 #include "Sound/SoundStorage.h"
 #include "UI/CameraControls.h"
 #include "UI/ContextMenu.h"
@@ -178,10 +182,9 @@ namespace trview
         auto texture_storage = std::make_shared<TextureStorage>(device);
         auto shader_storage = std::make_shared<graphics::ShaderStorage>();
 
-        Resource type_list = get_resource_memory(IDR_TYPE_NAMES, L"TEXT");
         auto extra_type_info = files->load_file(files->appdata_directory() + "\\trview\\types.json");
         auto type_info_lookup = std::make_shared<TypeInfoLookup>(
-            std::string(type_list.data, type_list.data + type_list.size),
+            embedded_type_names(),
             extra_type_info.has_value() ? std::optional<std::string>(extra_type_info.value() | std::ranges::to<std::string>()) : std::nullopt);
 
         load_default_shaders(device, shader_storage);
@@ -241,7 +244,8 @@ namespace trview
         auto cube_mesh = create_cube_mesh(default_mesh_source);
         auto camera_sink_source = [=](auto&&... args) { return std::make_shared<CameraSink>(cube_mesh, texture_storage, args...); };
 
-        const auto sound_source = [=](auto&&... args) { return create_sound(args...); };
+        auto sound_mixer = std::make_shared<SoundMixer>();
+        const auto sound_source = [=](auto&&... args) { return create_sound(args..., sound_mixer); };
         const auto sound_source_source = [=](auto&&... args) { return std::make_shared<SoundSource>(cube_mesh, texture_storage, args...); };
 
         const auto flyby_node_source = [=](auto&&... args) { return std::make_shared<FlybyNode>(args...); };
@@ -255,15 +259,15 @@ namespace trview
 
         auto decrypter = std::make_shared<trlevel::Decrypter>();
         auto hasher = std::make_shared<trlevel::Hasher>();
+        auto level_cache = std::make_shared<trlevel::LevelCache>(files);
 
-        auto trlevel_pack_source = [=](auto&&... args) { return std::make_shared<trlevel::Level>(args..., files, decrypter, log, hasher); };
         const auto pack_source = [=](auto&&... args)
             { 
-                auto pack = std::make_shared<trlevel::Pack>(args..., trlevel_pack_source);
+                auto pack = std::make_shared<trlevel::Pack>(args...);
                 pack->load();
                 return pack;
             };
-        auto trlevel_source = [=](auto&&... args) { return std::make_shared<trlevel::Level>(args..., files, decrypter, log, hasher, pack_source); };
+        auto trlevel_source = [=](auto&&... args) { return std::make_shared<trlevel::Level>(args..., files, decrypter, log, hasher, level_cache, pack_source); };
 
         D3D11_SAMPLER_DESC sampler_desc;
         memset(&sampler_desc, 0, sizeof(sampler_desc));
@@ -287,26 +291,28 @@ namespace trview
                     wrap_sampler_state : clamp_sampler_state;
             };
 
-        Resource level_hashes = get_resource_memory(IDR_LEVEL_HASHES, L"TEXT");
-        auto level_name_lookup = std::make_shared<LevelNameLookup>(files, std::string(level_hashes.data, level_hashes.data + level_hashes.size));
+        auto level_name_lookup = std::make_shared<LevelNameLookup>(files, embedded_level_hashes());
 
         auto level_source = [=](auto&& filename, auto&& pack, auto&& callbacks)
             {
                 auto level = trlevel_source(filename, pack);
                 auto level_texture_storage = std::make_shared<LevelTextureStorage>(device, std::make_unique<TextureStorage>(device));
 
+                // Lazy loads are only read by scripts, so the textiles are never uploaded to the GPU.
                 int count = 0;
-                callbacks.on_textile_callback = [&](auto&& textile, auto&& width, auto&& height)
-                    {
-                        callbacks.on_progress(std::format("Loading texture {}", ++count));
-                        level_texture_storage->add_textile(textile, width, height);
-                    };
+                if (callbacks.open_mode != trlevel::ILevel::LoadCallbacks::OpenMode::Lazy)
+                {
+                    callbacks.on_textile_callback = [&](auto&& textile, auto&& width, auto&& height)
+                        {
+                            callbacks.on_progress(std::format("Loading texture {}", ++count));
+                            level_texture_storage->add_textile(textile, width, height);
+                        };
+                }
 
                 auto sound_storage = std::make_shared<SoundStorage>(sound_source);
-                callbacks.on_sound_callback = [&](auto&& sound_map, auto&& sound_details, auto&& sample_index, auto&& data)
+                callbacks.on_sound_callback = [&](auto&& sound_map, auto&& sound_details, auto&& sample_index, auto&& sample)
                     {
-                        callbacks.on_progress(std::format("Loading sound {}:{}:{}", sound_map, sound_details, sample_index));
-                        sound_storage->add({ .sound_map = sound_map, .sound_details = sound_details, .sample_index = sample_index }, data);
+                        sound_storage->add({ .sound_map = sound_map, .sound_details = sound_details, .sample_index = sample_index }, sample);
                     };
 
                 level->load(callbacks);
@@ -342,6 +348,12 @@ namespace trview
 
                 auto model_source = [=](auto&&... args) { return std::make_shared<Model>(args..., cube_mesh, texture_storage); };
                 auto model_storage = std::make_shared<ModelStorage>(mesh_storage, model_source, *level);
+                // Animations are only decoded once item animation is turned on, and never for lazy loads.
+                IAnimationEngine::Source animation_engine_source;
+                if (callbacks.open_mode != trlevel::ILevel::LoadCallbacks::OpenMode::Lazy)
+                {
+                    animation_engine_source = [=]() { return std::make_shared<AnimationEngine>(*level); };
+                }
                 auto new_level = std::make_shared<Level>(
                     device, 
                     shader_storage, 
@@ -363,6 +375,7 @@ namespace trview
                 new_level->initialise(level,
                     mesh_storage,
                     model_storage,
+                    animation_engine_source,
                     entity_source,
                     ai_source,
                     room_source,
@@ -3,39 +3,6 @@
 
 namespace trview
 {
-    namespace
-    {
-        Floordata::Command::Function extract_function(uint16_t floor, std::optional<trlevel::PlatformAndVersion> version)
-        {
-            Floordata::Command::Function function = static_cast<Floordata::Command::Function>(floor & 0x1f);
-            if (!version.has_value() || !is_tr1_may_1996(version.value()))
-            {
-                return function;
-            }
-
-            using namespace trlevel;
-            using Function = Floordata::Command::Function;
-            switch (function)
-            {
-            case Function::Portal:
-                return Function::Death;
-            case Function::Death:
-                return Function::CeilingSlant;
-                break;
-            case Function::Trigger:
-                return Function::FloorSlant;
-                break;
-            case Function::CeilingSlant:
-                return Function::Trigger;
-                break;
-            case Function::FloorSlant:
-                return Function::Portal;
-                break;
-            }
-            return function;
-        }
-    }
-
     Floordata::Command::Command(Function type, const std::vector<uint16_t>& data, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng)
         : type(type), data(data)
     {
@@ -198,108 +165,10 @@ namespace trview
     Floordata parse_floordata(const std::vector<uint16_t>& floordata, uint32_t index, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng, std::optional<trlevel::PlatformAndVersion> version)
     {
         Floordata result;
-
-        if (index == 0)
-        {
-            result.commands.push_back(Floordata::Command(Floordata::Command::Function::None, { floordata[index] }, meanings, items, trng));
-            return result;
-        }
-        
-        while (true)
-        {
-            // Parse the floordata here.
-            const uint16_t floor = floordata[index];
-            Floordata::Command::Function function = extract_function(floor, version);
-            uint16_t subfunction = (floor & 0x7F00) >> 8;
-
-            using Function = Floordata::Command::Function;
-
-            std::vector<uint16_t> data;
-            data.push_back(floor);
-
-            switch (function)
-            {
-                case Function::Trigger:
-                {
-                    std::uint16_t trigger_command = 0;
-                    std::uint16_t setup = floordata[++index];
-                    data.push_back(setup);
-
-                    auto type = (TriggerType)subfunction;
-
-                    bool continue_processing = true;
-                    if (type == TriggerType::Key || type == TriggerType::Switch)
-                    {
-                        auto reference = floordata[++index];
-                        data.push_back(reference);
-                        continue_processing = (reference & 0x8000) == 0;
-                    }
-
-                    if (continue_processing)
-                    {
-                        do
-                        {
-                            if (++index < floordata.size())
-                            {
-                                trigger_command = floordata[index];
-                                data.push_back(trigger_command);
-                                auto action = static_cast<TriggerCommandType>((trigger_command & 0x7C00) >> 10);
-                                if (action == TriggerCommandType::Camera ||
-                                    action == TriggerCommandType::Flyby ||
-                                    (trng && action == TriggerCommandType::Flipeffect))
-                                {
-                                    // Camera has another uint16_t - skip for now.
-                                    trigger_command = floordata[++index];
-                                    data.push_back(trigger_command);
-                                }
-                            }
-
-                        } while (index < floordata.size() && !(trigger_command & 0x8000));
-                    }
-
-                    break;
-                }
-                case Function::Portal:
-                case Function::FloorSlant:
-                case Function::CeilingSlant:
-                case Function::Triangulation_Floor_NWSE:
-                case Function::Triangulation_Floor_NESW:
-                case Function::Triangulation_Floor_Collision_SW:
-                case Function::Triangulation_Floor_Collision_NE:
-                case Function::Triangulation_Floor_Collision_SE:
-                case Function::Triangulation_Floor_Collision_NW:
-                case Function::Triangulation_Ceiling_NW:
-                case Function::Triangulation_Ceiling_NE:
-                case Function::Triangulation_Ceiling_Collision_SW:
-                case Function::Triangulation_Ceiling_Collision_NE:
-                case Function::Triangulation_Ceiling_Collision_NW:
-                case Function::Triangulation_Ceiling_Collision_SE:
-                {
-                    data.push_back(floordata[++index]);
-                    break;
-                }
-                case Function::MonkeySwing:
-                case Function::MinecartLeft_DeferredTrigger:
-                case Function::MinecartRight_Mapper:
-                case Function::Death:
-                case Function::ClimbableWall:
-                {
-                    break;
-                }
-            }
-
-            result.commands.push_back(Floordata::Command(function, data, meanings, items, trng));
-
-            if ((floor >> 15) || index == 0)
+        for_each_floordata_command(floordata, index, trng, version, [&](auto function, const auto& data)
             {
-                break;
-            }
-            else
-            {
-                ++index;
-            }
-        }
-
+                result.commands.push_back(Floordata::Command(function, data, meanings, items, trng));
+            });
         return result;
     }
 
@@ -2,6 +2,7 @@
 
 #include "Types.h"
 #include "IItem.h"
+#include "FloordataParser.h"
 
 namespace trview
 {
@@ -15,32 +16,7 @@ namespace trview
     {
         struct Command
         {
-            enum class Function : uint16_t
-            {
-                None,
-                Portal,
-                FloorSlant,
-                CeilingSlant,
-                Trigger,
-                Death,
-                ClimbableWall,
-                Triangulation_Floor_NWSE,
-                Triangulation_Floor_NESW,
-                Triangulation_Ceiling_NW,
-                Triangulation_Ceiling_NE,
-                Triangulation_Floor_Collision_SW,
-                Triangulation_Floor_Collision_NE,
-                Triangulation_Floor_Collision_SE,
-                Triangulation_Floor_Collision_NW,
-                Triangulation_Ceiling_Collision_SW,
-                Triangulation_Ceiling_Collision_NE,
-                Triangulation_Ceiling_Collision_NW,
-                Triangulation_Ceiling_Collision_SE,
-                MonkeySwing,
-                MinecartLeft_DeferredTrigger,
-                MinecartRight_Mapper,
-                Count
-            };
+            using Function = FloordataFunction;
 
             explicit Command(Function type, const std::vector<uint16_t>& data, FloordataMeanings meanings, const std::vector<std::weak_ptr<IItem>>& items, bool trng);
 
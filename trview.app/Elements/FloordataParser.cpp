@@ -0,0 +1,134 @@
+#include "FloordataParser.h"
+#include "Types.h"
+
+namespace trview
+{
+    namespace
+    {
+        FloordataFunction extract_function(uint16_t floor, std::optional<trlevel::PlatformAndVersion> version)
+        {
+            using Function = FloordataFunction;
+            const Function function = static_cast<Function>(floor & 0x1f);
+            if (!version.has_value() || !is_tr1_may_1996(version.value()))
+            {
+                return function;
+            }
+
+            switch (function)
+            {
+            case Function::Portal:
+                return Function::Death;
+            case Function::Death:
+                return Function::CeilingSlant;
+            case Function::Trigger:
+                return Function::FloorSlant;
+            case Function::CeilingSlant:
+                return Function::Trigger;
+            case Function::FloorSlant:
+                return Function::Portal;
+            }
+            return function;
+        }
+    }
+
+    void for_each_floordata_command(const std::vector<uint16_t>& floordata, uint32_t index, bool trng, std::optional<trlevel::PlatformAndVersion> version,
+        const std::function<void(FloordataFunction, const std::vector<uint16_t>&)>& callback)
+    {
+        if (index >= floordata.size())
+        {
+            return;
+        }
+
+        std::vector<uint16_t> data;
+        if (index == 0)
+        {
+            data.push_back(floordata[index]);
+            callback(FloordataFunction::None, data);
+            return;
+        }
+
+        const auto word = [&](uint32_t i) -> uint16_t { return i < floordata.size() ? floordata[i] : 0x8000; };
+
+        while (index < floordata.size())
+        {
+            const uint16_t floor = floordata[index];
+            const FloordataFunction function = extract_function(floor, version);
+            const uint16_t subfunction = (floor & 0x7F00) >> 8;
+
+            using Function = FloordataFunction;
+
+            data.clear();
+            data.push_back(floor);
+
+            switch (function)
+            {
+                case Function::Trigger:
+                {
+                    std::uint16_t trigger_command = 0;
+                    data.push_back(word(++index));
+
+                    auto type = (TriggerType)subfunction;
+
+                    bool continue_processing = true;
+                    if (type == TriggerType::Key || type == TriggerType::Switch)
+                    {
+                        auto reference = word(++index);
+                        data.push_back(reference);
+                        continue_processing = (reference & 0x8000) == 0;
+                    }
+
+                    if (continue_processing)
+                    {
+                        do
+                        {
+                            if (++index < floordata.size())
+                            {
+                                trigger_command = floordata[index];
+                                data.push_back(trigger_command);
+                                auto action = static_cast<TriggerCommandType>((trigger_command & 0x7C00) >> 10);
+                                if (action == TriggerCommandType::Camera ||
+                                    action == TriggerCommandType::Flyby ||
+                                    (trng && action == TriggerCommandType::Flipeffect))
+                                {
+                                    // Camera has another uint16_t - skip for now.
+                                    trigger_command = word(++index);
+                                    data.push_back(trigger_command);
+                                }
+                            }
+
+                        } while (index < floordata.size() && !(trigger_command & 0x8000));
+                    }
+
+                    break;
+                }
+                case Function::Portal:
+                case Function::FloorSlant:
+                case Function::CeilingSlant:
+                case Function::Triangulation_Floor_NWSE:
+                case Function::Triangulation_Floor_NESW:
+                case Function::Triangulation_Floor_Collision_SW:
+                case Function::Triangulation_Floor_Collision_NE:
+                case Function::Triangulation_Floor_Collision_SE:
+                case Function::Triangulation_Floor_Collision_NW:
+                case Function::Triangulation_Ceiling_NW:
+                case Function::Triangulation_Ceiling_NE:
+                case Function::Triangulation_Ceiling_Collision_SW:
+                case Function::Triangulation_Ceiling_Collision_NE:
+                case Function::Triangulation_Ceiling_Collision_NW:
+                case Function::Triangulation_Ceiling_Collision_SE:
+                {
+                    data.push_back(word(++index));
+                    break;
+                }
+            }
+
+            callback(function, data);
+
+            if ((floor >> 15) || index == 0)
+            {
+                break;
+            }
+            ++index;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <trlevel/LevelVersion.h>
+
+namespace trview
+{
+    enum class FloordataFunction : uint16_t
+    {
+        None,
+        Portal,
+        FloorSlant,
+        CeilingSlant,
+        Trigger,
+        Death,
+        ClimbableWall,
+        Triangulation_Floor_NWSE,
+        Triangulation_Floor_NESW,
+        Triangulation_Ceiling_NW,
+        Triangulation_Ceiling_NE,
+        Triangulation_Floor_Collision_SW,
+        Triangulation_Floor_Collision_NE,
+        Triangulation_Floor_Collision_SE,
+        Triangulation_Floor_Collision_NW,
+        Triangulation_Ceiling_Collision_SW,
+        Triangulation_Ceiling_Collision_NE,
+        Triangulation_Ceiling_Collision_NW,
+        Triangulation_Ceiling_Collision_SE,
+        MonkeySwing,
+        MinecartLeft_DeferredTrigger,
+        MinecartRight_Mapper,
+        Count
+    };
+
+    /// <summary>
+    /// Walk the floordata at the specified index, one command at a time. This only depends on trlevel so
+    /// that tools can read floordata without the rest of trview.app.
+    /// </summary>
+    /// <param name="floordata">The raw floor data.</param>
+    /// <param name="index">The index to start at. Index 0 gives a single None command.</param>
+    /// <param name="trng">Whether flipeffects have the extra TRNG word.</param>
+    /// <param name="version">The level version, used for the TR1 May 1996 function numbers.</param>
+    /// <param name="callback">Called with the function and the words of each command. Words past the end of the floordata are read as 0x8000 so that a truncated chain ends.</param>
+    void for_each_floordata_command(const std::vector<uint16_t>& floordata, uint32_t index, bool trng, std::optional<trlevel::PlatformAndVersion> version,
+        const std::function<void(FloordataFunction, const std::vector<uint16_t>&)>& callback);
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <unordered_set>
 #include <external/DirectXTK/Inc/SimpleMath.h>
@@ -15,6 +16,7 @@ namespace trview
     struct ITrigger;
     struct IRoom;
     struct IModelStorage;
+    struct IAnimationEngine;
 
     struct IItem : public IRenderable, public IFilterable
     {
@@ -57,6 +59,8 @@ namespace trview
         virtual bool is_ai() const = 0;
         virtual void set_remastered_extra(bool value) = 0;
         virtual bool is_remastered_extra() const = 0;
+        /// Draw the model with the pose of an animation engine instance. No engine draws the bind pose.
+        virtual void set_animation(const std::shared_ptr<const IAnimationEngine>& engine, uint32_t instance) = 0;
     };
 
     bool is_mutant_egg(const IItem& item);
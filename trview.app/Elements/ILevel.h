@@ -122,6 +122,7 @@ namespace trview
         virtual void set_show_camera_sinks(bool show) = 0;
         virtual void set_show_sound_sources(bool show) = 0;
         virtual void set_show_animation(bool show) = 0;
+        virtual void set_show_item_animation(bool show) = 0;
         virtual void set_neighbour_depth(uint32_t depth) = 0;
         virtual void set_selected_room(const std::weak_ptr<IRoom>& room) = 0;
         virtual void set_selected_item(const std::weak_ptr<IItem>& item) = 0;
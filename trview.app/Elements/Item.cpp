@@ -10,6 +10,7 @@
 #include "../Geometry/TransparencyBuffer.h"
 #include "../Geometry/Model/IModel.h"
 #include "../Geometry/Model/IModelStorage.h"
+#include "../Geometry/Model/IAnimationEngine.h"
 #include "IRoom.h"
 
 using namespace Microsoft::WRL;
@@ -113,7 +114,7 @@ namespace trview
 
         if (auto model = _model.lock())
         {
-            model->render(_world, camera.view_projection(), colour);
+            model->render(_world, pose(), camera.view_projection(), colour);
         }
 
         if (_sprite_mesh)
@@ -142,7 +143,7 @@ namespace trview
 
         if (auto model = _model.lock())
         {
-            model->render_transparency(_world, transparency, colour);
+            model->render_transparency(_world, pose(), transparency, colour);
         }
 
         if (_sprite_mesh)
@@ -179,7 +180,7 @@ namespace trview
 
         if (auto model = _model.lock())
         {
-            auto result = model->pick(_world, position, direction);
+            auto result = model->pick(_world, pose(), position, direction);
             if (result.hit)
             {
                 result.item = std::const_pointer_cast<IItem>(shared_from_this());
@@ -355,6 +356,18 @@ namespace trview
         return static_cast<int32_t>(number());
     }
 
+    void Item::set_animation(const std::shared_ptr<const IAnimationEngine>& engine, uint32_t instance)
+    {
+        _animation_engine = engine;
+        _animation_instance = instance;
+    }
+
+    std::span<const DirectX::SimpleMath::Matrix> Item::pose() const
+    {
+        // The pose is fetched each time as the engine's pose buffer moves when instances are added.
+        return _animation_engine ? _animation_engine->pose(_animation_instance) : std::span<const DirectX::SimpleMath::Matrix>{};
+    }
+
     bool is_mutant_egg(const IItem& item)
     {
         return is_mutant_egg(item.type_id());
@@ -62,16 +62,20 @@ namespace trview
         void set_remastered_extra(bool value) override;
         bool is_remastered_extra() const override;
         int32_t filterable_index() const override;
+        void set_animation(const std::shared_ptr<const IAnimationEngine>& engine, uint32_t instance) override;
     private:
         Item(const IMesh::Source& mesh_source, const IModelStorage& model_storage, const trlevel::ILevel& level, const std::weak_ptr<ILevel>& owning_level, const std::weak_ptr<IRoom>& room, uint32_t number, uint16_t type_id, const DirectX::SimpleMath::Vector3& position, int32_t angle, int32_t ocb, const TypeInfo& type, const std::vector<std::weak_ptr<ITrigger>>& triggers, uint16_t flags);
 
         void generate_bounding_box();
         void apply_ocb_adjustment(trlevel::LevelVersion version, uint32_t ocb, bool is_pickup);
         bool is_pickup() const;
+        std::span<const DirectX::SimpleMath::Matrix> pose() const;
 
         DirectX::SimpleMath::Matrix               _world;
         std::shared_ptr<IMesh>                    _sprite_mesh;
         std::weak_ptr<IModel>                     _model;
+        std::shared_ptr<const IAnimationEngine>   _animation_engine;
+        uint32_t                                  _animation_instance{ 0u };
 
         std::weak_ptr<IRoom>                      _room;
         uint32_t                                  _number;
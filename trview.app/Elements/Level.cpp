@@ -1565,6 +1565,7 @@ namespace trview
     void Level::initialise(std::shared_ptr<trlevel::ILevel> level,
         std::shared_ptr<IMeshStorage> mesh_storage,
         std::shared_ptr<IModelStorage> model_storage,
+        const IAnimationEngine::Source& animation_engine_source,
         const IItem::EntitySource& entity_source,
         const IItem::AiSource& ai_source,
         const IRoom::Source& room_source,
@@ -1582,6 +1583,7 @@ namespace trview
         _pack = level->pack().lock();
         _hash = level->hash();
         _model_storage = model_storage;
+        _animation_engine_source = animation_engine_source;
         messages::get_settings(_messaging, weak_from_this());
 
         record_models(*level);
@@ -1763,15 +1765,29 @@ namespace trview
 
     void Level::update(float delta)
     {
-        if (!_show_animation)
+        if (_show_animation)
+        {
+            for (auto& room : _rooms)
+            {
+                room->update(delta);
+            }
+        }
+
+        if (!_show_item_animation || !_animation_engine)
         {
             return;
         }
 
-        for (auto& room : _rooms)
+        _visible_instances.clear();
+        for (const auto& [item, instance] : _animated_items)
         {
-            room->update(delta);
+            if (const auto item_ptr = item.lock(); item_ptr && item_ptr->visible())
+            {
+                _visible_instances.push_back(instance);
+            }
         }
+
+        _animation_engine->update(delta, _visible_instances);
     }
 
     void Level::set_show_animation(bool show)
@@ -1779,6 +1795,46 @@ namespace trview
         _show_animation = show;
     }
 
+    void Level::set_show_item_animation(bool show)
+    {
+        _show_item_animation = show;
+        if (_show_item_animation && !_animation_engine && _animation_engine_source)
+        {
+            _animation_engine = _animation_engine_source();
+            _animation_engine_source = {};
+            generate_animations();
+        }
+
+        for (const auto& [item, instance] : _animated_items)
+        {
+            if (const auto item_ptr = item.lock())
+            {
+                item_ptr->set_animation(_show_item_animation ? _animation_engine : nullptr, instance);
+            }
+        }
+    }
+
+    void Level::generate_animations()
+    {
+        if (!_animation_engine)
+        {
+            return;
+        }
+
+        for (const auto& entity : _entities)
+        {
+            if (entity->is_ai())
+            {
+                continue;
+            }
+
+            if (const auto instance = _animation_engine->add(entity->type_id()))
+            {
+                _animated_items.push_back({ entity, instance.value() });
+            }
+        }
+    }
+
     void Level::receive_message(const Message& message)
     {
         if (auto selected_item = messages::read_select_item(message))
@@ -1814,29 +1870,29 @@ namespace trview
         {
             set_selected_camera_sink(selected_camera_sink.value());
         }
-        else if (message.type == "get_selected_item")
+        else if (message.type == messages::types::get_selected_item)
         {
-            messages::reply_to(message, "select_item", _selected_item);
+            messages::reply_to(message, messages::types::select_item, _selected_item);
         }
-        else if (message.type == "get_selected_room")
+        else if (message.type == messages::types::get_selected_room)
         {
-            messages::reply_to(message, "select_room", _selected_room);
+            messages::reply_to(message, messages::types::select_room, _selected_room);
         }
-        else if (message.type == "get_selected_light")
+        else if (message.type == messages::types::get_selected_light)
         {
-            messages::reply_to(message, "select_light", _selected_light);
+            messages::reply_to(message, messages::types::select_light, _selected_light);
         }
-        else if (message.type == "get_selected_trigger")
+        else if (message.type == messages::types::get_selected_trigger)
         {
-            messages::reply_to(message, "select_trigger", _selected_trigger);
+            messages::reply_to(message, messages::types::select_trigger, _selected_trigger);
         }
-        else if (message.type == "get_selected_camera_sink")
+        else if (message.type == messages::types::get_selected_camera_sink)
         {
-            messages::reply_to(message, "select_camera_sink", _selected_camera_sink);
+            messages::reply_to(message, messages::types::select_camera_sink, _selected_camera_sink);
         }
-        else if (message.type == "get_selected_sound_source")
+        else if (message.type == messages::types::get_selected_sound_source)
         {
-            messages::reply_to(message, "select_sound_source", _selected_sound_source);
+            messages::reply_to(message, messages::types::select_sound_source, _selected_sound_source);
         }
         else if (const auto unhide = messages::commands::read_unhide_all(message))
         {
@@ -1850,6 +1906,28 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> Level::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::get_selected_camera_sink,
+            messages::types::get_selected_item,
+            messages::types::get_selected_light,
+            messages::types::get_selected_room,
+            messages::types::get_selected_sound_source,
+            messages::types::get_selected_trigger,
+            messages::types::select_camera_sink,
+            messages::types::select_flyby_node,
+            messages::types::select_item,
+            messages::types::select_light,
+            messages::types::select_room,
+            messages::types::select_sound_source,
+            messages::types::select_trigger,
+            messages::types::settings,
+            messages::types::unhide_all
+        };
+    }
+
     std::vector<std::shared_ptr<IRoom>> Level::get_potentially_visible_rooms() const
     {
         std::vector<std::shared_ptr<IRoom>> rooms;
@@ -14,6 +14,7 @@
 #include "../Geometry/ITransparencyBuffer.h"
 #include "../Graphics/ISelectionRenderer.h"
 #include "../Graphics/IMeshStorage.h"
+#include "../Geometry/Model/IAnimationEngine.h"
 #include "Remastered/INgPlusSwitcher.h"
 
 #include <trview.graphics/IBuffer.h>
@@ -124,6 +125,7 @@ namespace trview
             std::shared_ptr<trlevel::ILevel> level,
             std::shared_ptr<IMeshStorage> mesh_storage,
             std::shared_ptr<IModelStorage> model_storage,
+            const IAnimationEngine::Source& animation_engine_source,
             const IItem::EntitySource& entity_source,
             const IItem::AiSource& ai_source,
             const IRoom::Source& room_source,
@@ -148,11 +150,14 @@ namespace trview
         std::vector<std::weak_ptr<IFlyby>> flybys() const override;
         void update(float delta) override;
         void set_show_animation(bool show) override;
+        void set_show_item_animation(bool show) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         void generate_rooms(const trlevel::ILevel& level, const IRoom::Source& room_source, const IMeshStorage& mesh_storage);
         void generate_triggers(const ITrigger::Source& trigger_source);
         void generate_entities(const trlevel::ILevel& level, const IItem::EntitySource& entity_source, const IItem::AiSource& ai_source, const IModelStorage& model_storage, const trlevel::ILevel::LoadCallbacks& callbacks);
+        void generate_animations();
         void regenerate_neighbours();
         void generate_neighbours(std::set<uint16_t>& results, uint16_t selected_room, int32_t max_depth);
         void generate_lights(const trlevel::ILevel& level, const ILight::Source& light_source);
@@ -267,6 +272,12 @@ namespace trview
         std::string _hash;
         std::shared_ptr<IModelStorage> _model_storage;
         bool _show_animation{ true };
+        bool _show_item_animation{ false };
+        /// Creates the animation engine the first time item animation is shown. Empty if the level can't animate items.
+        IAnimationEngine::Source _animation_engine_source;
+        std::shared_ptr<IAnimationEngine> _animation_engine;
+        std::vector<std::pair<std::weak_ptr<IItem>, uint32_t>> _animated_items;
+        std::vector<uint32_t> _visible_instances;
 
         std::weak_ptr<IMessageSystem> _messaging;
         std::shared_ptr<ILevelNameLookup> _level_name_lookup;
@@ -6,8 +6,6 @@
 #include <spanstream>
 #include <ranges>
 
-#include <bcrypt.h>
-
 #include <trlevel/Level_common.h>
 
 namespace trview
@@ -568,14 +566,9 @@ namespace trview
     {
     }
 
-    LevelNameLookup::LevelNameLookup(const std::shared_ptr<IFiles>& files, const std::string& level_hashes_json)
-        : _files(files)
+    LevelNameLookup::LevelNameLookup(const std::shared_ptr<IFiles>& files, std::span<const LevelHashEntry> level_hashes)
+        : _files(files), _hashes(level_hashes)
     {
-        const auto json = nlohmann::json::parse(level_hashes_json.begin(), level_hashes_json.end(), nullptr, true, true, true);
-        for (const auto& [key, value] : json.items())
-        {
-            _hashes.insert({ key, value.at("name").get<std::string>() });
-        }
     }
 
     std::optional<ILevelNameLookup::Name> LevelNameLookup::lookup(const std::weak_ptr<ILevel>& level) const
@@ -613,6 +606,12 @@ namespace trview
         return false;
     }
 
+    const LevelHashEntry* LevelNameLookup::find_hash(const std::string& hash) const
+    {
+        const auto found = std::ranges::lower_bound(_hashes, std::string_view(hash), {}, &LevelHashEntry::hash);
+        return found != _hashes.end() && found->hash == hash ? &*found : nullptr;
+    }
+
     std::optional<ILevelNameLookup::Name> LevelNameLookup::check_remastered(const std::string& filename, trlevel::PlatformAndVersion platform_and_version) const
     {
         if (!platform_and_version.remastered)
@@ -716,8 +715,7 @@ namespace trview
         }
 
         // Mode 2: Hash lookup - can hash be calculated on load and stored?
-        const auto found = _hashes.find(hash);
-        if (found != _hashes.end())
+        if (find_hash(hash))
         {
             return {};
         }
@@ -762,10 +760,9 @@ namespace trview
         }
 
         // Mode 2: Hash lookup - can hash be calculated on load and stored?
-        const auto found = _hashes.find(hash);
-        if (found != _hashes.end())
+        if (const auto found = find_hash(hash))
         {
-            return ILevelNameLookup::Name{ .name = found->second };
+            return ILevelNameLookup::Name{ .name = std::string(found->name) };
         }
 
         return std::nullopt;
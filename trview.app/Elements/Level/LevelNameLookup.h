@@ -3,13 +3,19 @@
 #include <trview.common/IFiles.h>
 #include "ILevelNameLookup.h"
 #include <trlevel/LevelVersion.h>
+#include "../../Resources/EmbeddedTables.h"
 
 namespace trview
 {
     class LevelNameLookup final : public ILevelNameLookup
     {
     public:
-        explicit LevelNameLookup(const std::shared_ptr<IFiles>& files, const std::string& level_hashes_json);
+        /// <summary>
+        /// Create a level name lookup.
+        /// </summary>
+        /// <param name="files">Files used to read the game scripts next to a level.</param>
+        /// <param name="level_hashes">Level names for known level file hashes, sorted by hash.</param>
+        explicit LevelNameLookup(const std::shared_ptr<IFiles>& files, std::span<const LevelHashEntry> level_hashes);
         virtual ~LevelNameLookup() = default;
         std::optional<Name> lookup(const std::weak_ptr<ILevel>& level) const override;
         std::optional<Name> lookup(const std::weak_ptr<trlevel::ILevel>& level) const override;
@@ -19,12 +25,13 @@ namespace trview
         std::optional<Name> check_remastered(const std::string& filename, trlevel::PlatformAndVersion platform_and_version) const;
         std::optional<Name> check_trx(const std::string& filename, trlevel::PlatformAndVersion platform_and_version) const;
         bool is_trx() const;
+        const LevelHashEntry* find_hash(const std::string& hash) const;
 
         std::vector<int32_t> get_bonus_items(const std::string& filename, trlevel::PlatformAndVersion platform_and_version, const std::string& hash) const;
         std::optional<std::vector<int32_t>> check_remastered_bonus_items(const std::string& filename, trlevel::PlatformAndVersion platform_and_version) const;
 
 
         std::shared_ptr<IFiles> _files;
-        std::unordered_map<std::string, std::string> _hashes;
+        std::span<const LevelHashEntry> _hashes;
     };
 }
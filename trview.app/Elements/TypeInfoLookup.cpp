@@ -69,45 +69,82 @@ namespace trview
     {
     }
 
-    TypeInfoLookup::TypeInfoLookup(const std::string& type_name_json, const std::optional<std::string>& extra_type_name_json)
+    TypeInfoLookup::TypeInfoLookup(std::span<const GameTypeNames> type_names, const std::optional<std::string>& extra_type_name_json)
+        : _type_names(type_names)
     {
-        auto parse_json = [&](const auto& data)
+        for (const auto& game : _type_names)
+        {
+            for (const auto& type : game.types)
             {
-                auto json = nlohmann::json::parse(data.begin(), data.end(), nullptr, true, true, true);
-                for (const auto& [key, value] : json["games"].items())
+                if (!_categories.contains(type.categories))
                 {
-                    auto& type_names = _type_names[key];
-                    for (const auto& element : value)
-                    {
-                        auto name = element.at("name").get<std::string>();
-                        type_names[element.at("id").get<uint32_t>()] = 
-                            {
-                                name,
-                                read_attribute<std::unordered_set<std::string>>(element, "categories")
-                            };
-                    }
+                    _categories.emplace(type.categories, type.categories
+                        | std::views::split(',')
+                        | std::views::transform([](auto&& category) { return std::string(std::from_range, category); })
+                        | std::ranges::to<std::unordered_set>());
                 }
-            };
+            }
+        }
+
+        if (!extra_type_name_json)
+        {
+            return;
+        }
 
-        parse_json(type_name_json);
-        parse_json(extra_type_name_json.value_or("{}"));
+        auto json = nlohmann::json::parse(extra_type_name_json->begin(), extra_type_name_json->end(), nullptr, true, true, true);
+        for (const auto& [key, value] : json["games"].items())
+        {
+            auto& type_names = _extra_type_names[key];
+            for (const auto& element : value)
+            {
+                auto name = element.at("name").get<std::string>();
+                type_names[element.at("id").get<uint32_t>()] =
+                    {
+                        name,
+                        read_attribute<std::unordered_set<std::string>>(element, "categories")
+                    };
+            }
+        }
     }
 
-    TypeInfo TypeInfoLookup::lookup(trlevel::PlatformAndVersion level_version, uint32_t type_id, int16_t flags) const
+    std::optional<TypeInfo> TypeInfoLookup::find(const std::string& game, uint32_t type_id) const
     {
-        const auto& game_types = _type_names.find(game_name(level_version));
-        if (game_types == _type_names.end())
+        if (const auto extra_types = _extra_type_names.find(game); extra_types != _extra_type_names.end())
         {
-            return { .name = std::to_string(type_id) };
+            if (const auto found_type = extra_types->second.find(type_id); found_type != extra_types->second.end())
+            {
+                return found_type->second;
+            }
+        }
+
+        const auto game_types = std::ranges::lower_bound(_type_names, std::string_view(game), {}, &GameTypeNames::game);
+        if (game_types == _type_names.end() || game_types->game != game)
+        {
+            return std::nullopt;
+        }
+
+        const auto found_type = std::ranges::lower_bound(game_types->types, type_id, {}, &TypeNameEntry::id);
+        if (found_type == game_types->types.end() || found_type->id != type_id)
+        {
+            return std::nullopt;
         }
 
-        const auto found_type = game_types->second.find(type_id);
-        if (found_type == game_types->second.end())
+        return TypeInfo
+        {
+            .name = std::string(found_type->name),
+            .categories = _categories.at(found_type->categories)
+        };
+    }
+
+    TypeInfo TypeInfoLookup::lookup(trlevel::PlatformAndVersion level_version, uint32_t type_id, int16_t flags) const
+    {
+        auto found_type = find(game_name(level_version), type_id);
+        if (!found_type)
         {
             return { .name = std::to_string(type_id) };
         }
 
-        TypeInfo result = found_type->second;
+        TypeInfo result = std::move(*found_type);
         if (level_version.version == LevelVersion::Tomb1 && is_mutant_egg(type_id))
         {
             result.name = mutant_name(flags);
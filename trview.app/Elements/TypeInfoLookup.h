@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ITypeInfoLookup.h"
+#include "../Resources/EmbeddedTables.h"
 #include <unordered_map>
 #include <unordered_set>
 
@@ -9,10 +10,20 @@ namespace trview
     class TypeInfoLookup : public ITypeInfoLookup
     {
     public:
-        explicit TypeInfoLookup(const std::string& type_name_json, const std::optional<std::string>& extra_type_name_json);
+        /// <summary>
+        /// Create a type info lookup.
+        /// </summary>
+        /// <param name="type_names">Built in type names for each game, sorted by game and then by id.</param>
+        /// <param name="extra_type_name_json">Type names from the user, which replace built in types with the same id.</param>
+        explicit TypeInfoLookup(std::span<const GameTypeNames> type_names, const std::optional<std::string>& extra_type_name_json);
         virtual ~TypeInfoLookup() = default;
         TypeInfo lookup(trlevel::PlatformAndVersion level_version, uint32_t type_id, int16_t flags) const override;
     private:
-        std::unordered_map<std::string, std::unordered_map<uint32_t, TypeInfo>> _type_names;
+        std::optional<TypeInfo> find(const std::string& game, uint32_t type_id) const;
+
+        std::span<const GameTypeNames> _type_names;
+        /// The set for each distinct category list in the built in types, so that a lookup only has to copy it.
+        std::unordered_map<std::string_view, std::unordered_set<std::string>> _categories;
+        std::unordered_map<std::string, std::unordered_map<uint32_t, TypeInfo>> _extra_type_names;
     };
 }
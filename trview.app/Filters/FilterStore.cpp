@@ -247,10 +247,18 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
         }
     }
 
+    std::optional<std::vector<MessageType>> FilterStore::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
+
     void FilterStore::remove(const std::string& type_key, const std::string& name)
     {
         const auto filters_for_key = _filters.find(type_key);
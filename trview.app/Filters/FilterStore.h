@@ -18,6 +18,7 @@ namespace trview
         void load() override;
         std::map<std::string, Filters::Filter> filters_for_key(const std::string& key) const override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void remove(const std::string& type_key, const std::string& name) override;
         void save() override;
     private:
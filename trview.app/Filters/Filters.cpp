@@ -461,6 +461,23 @@ namespace trview
         return result;
     }
 
+    std::string Filters::linked_type_key(const std::string& type_key, const std::string& key) const
+    {
+        const auto& getters = find_getter(type_key);
+        const auto found_getter = getters.getters.find(key);
+        if (found_getter != getters.getters.end())
+        {
+            return found_getter->second.type_key;
+        }
+
+        const auto found_multi_getter = getters.multi_getters.find(key);
+        if (found_multi_getter != getters.multi_getters.end())
+        {
+            return found_multi_getter->second.type_key;
+        }
+        return {};
+    }
+
     void Filters::render()
     {
         bool filter_enabled = _enabled;
@@ -693,20 +710,7 @@ namespace trview
                     _changed = true;
 
                     // Set the type - if it has changed.
-                    const auto& getters = find_getter(type_key);
-                    const auto found_getter = getters.getters.find(filter.key);
-                    if (found_getter != getters.getters.end())
-                    {
-                        filter.type_key = found_getter->second.type_key;
-                    }
-                    else
-                    {
-                        const auto found_multi_getter = getters.multi_getters.find(filter.key);
-                        if (found_multi_getter != getters.multi_getters.end())
-                        {
-                            filter.type_key = found_multi_getter->second.type_key;
-                        }
-                    }
+                    filter.type_key = linked_type_key(type_key, filter.key);
 
                     // If the current op is not valid, make it a valid one
                     const auto compare_ops = compare_ops_for_key(type_key, filter.key);
@@ -167,6 +167,10 @@ namespace trview
         bool is_match(bool value, const Filter& filter) const;
         bool is_match(std::weak_ptr<IFilterable> value, const Filter& filter) const;
         std::vector<std::string> keys(const std::string& type_key) const;
+        /// <summary>
+        /// Get the type key of the elements that a key links to, or an empty string if the key is not a link.
+        /// </summary>
+        std::string linked_type_key(const std::string& type_key, const std::string& key) const;
         bool match(const IFilterable& value) const;
         bool match(const Filter& filter, const IFilterable& value, const std::string& type_key) const;
         void render();
@@ -253,7 +253,7 @@ namespace trview
     {
     }
 
-    std::shared_ptr<IMesh> create_mesh(const trlevel::tr_mesh& mesh, const IMesh::Source& source, const ILevelTextureStorage& texture_storage, const trlevel::PlatformAndVersion& platform_and_version, bool transparent_collision)
+    std::shared_ptr<IMesh> create_mesh(const trlevel::MeshView& mesh, const IMesh::Source& source, const ILevelTextureStorage& texture_storage, const trlevel::PlatformAndVersion& platform_and_version, bool transparent_collision)
     {
         std::vector<Triangle> triangles;
 
@@ -380,7 +380,7 @@ namespace trview
     }
 
     void process_textured_rectangles(
-        const std::vector<trlevel::tr4_mesh_face4>& rectangles,
+        std::span<const trlevel::tr4_mesh_face4> rectangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -496,7 +496,7 @@ namespace trview
     }
 
     void process_textured_triangles(
-        const std::vector<trlevel::tr4_mesh_face3>& triangles,
+        std::span<const trlevel::tr4_mesh_face3> triangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -584,7 +584,7 @@ namespace trview
     }
 
     void process_coloured_rectangles(
-        const std::vector<trlevel::tr_face4>& rectangles,
+        std::span<const trlevel::tr_face4> rectangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -627,7 +627,7 @@ namespace trview
     }
 
     void process_coloured_triangles(
-        const std::vector<trlevel::tr_face3>& triangles,
+        std::span<const trlevel::tr_face3> triangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -36,7 +36,7 @@ namespace trview
     /// @param texture_storage The textures for the level.
     /// @param transparent_collision Whether to include transparent triangles in collision triangles.
     /// @returns The new mesh.
-    std::shared_ptr<IMesh> create_mesh(const trlevel::tr_mesh& mesh, const IMesh::Source& source, const ILevelTextureStorage& texture_storage, const trlevel::PlatformAndVersion& platform_and_version, bool transparent_collision = true);
+    std::shared_ptr<IMesh> create_mesh(const trlevel::MeshView& mesh, const IMesh::Source& source, const ILevelTextureStorage& texture_storage, const trlevel::PlatformAndVersion& platform_and_version, bool transparent_collision = true);
 
     /// Create a new cube mesh.
     std::shared_ptr<IMesh> create_cube_mesh(const IMesh::Source& source);
@@ -83,7 +83,7 @@ namespace trview
     /// @param collision_triangles The collection to add collision triangles to.
     /// @param transparent_collision Whether to add transparent rectangles as collision triangles.
     void process_textured_rectangles(
-        const std::vector<trlevel::tr4_mesh_face4>& rectangles,
+        std::span<const trlevel::tr4_mesh_face4> rectangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -99,7 +99,7 @@ namespace trview
     /// @param collision_triangles The collection to add collision triangles to.
     /// @param transparent_collision Whether to add transparent rectangles as collision triangles.
     void process_textured_triangles(
-        const std::vector<trlevel::tr4_mesh_face3>& triangles,
+        std::span<const trlevel::tr4_mesh_face3> triangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -113,7 +113,7 @@ namespace trview
     // output_indices: The collection to add new indices to.
     // collision_triangles: The collection to add collision triangles to.
     void process_coloured_rectangles(
-        const std::vector<trlevel::tr_face4>& rectangles,
+        std::span<const trlevel::tr_face4> rectangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
@@ -127,7 +127,7 @@ namespace trview
     // output_indices: The collection to add new indices to.
     // collision_triangles: The collection to add collision triangles to.
     void process_coloured_triangles(
-        const std::vector<trlevel::tr_face3>& triangles,
+        std::span<const trlevel::tr_face3> triangles,
         const std::vector<trlevel::trview_room_vertex>& input_vertices,
         const ILevelTextureStorage& texture_storage,
         std::vector<Triangle>& out_triangles,
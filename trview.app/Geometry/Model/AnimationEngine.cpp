@@ -0,0 +1,294 @@
+#include "AnimationEngine.h"
+
+#include <execution>
+#include <ranges>
+
+namespace trview
+{
+    namespace
+    {
+        constexpr float TicksPerSecond = 30.0f;
+        /// Longest time that is played in one update. After a stall or a breakpoint the animations carry on from
+        /// where they were rather than stepping through every frame that was missed.
+        constexpr float MaxDelta = 0.25f;
+
+        /// Blend between two sets of angles along the shortest path. Written as a flat loop over
+        /// separate arrays so that the compiler can vectorise it.
+        void interpolate_angles(const float* from, const float* to, float amount, float* out, uint32_t count)
+        {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                float difference = to[i] - from[i];
+                difference = difference > DirectX::XM_PI ? difference - DirectX::XM_2PI : difference;
+                difference = difference < -DirectX::XM_PI ? difference + DirectX::XM_2PI : difference;
+                out[i] = from[i] + difference * amount;
+            }
+        }
+
+        /// Models own the animations from their first animation up to the first animation of the next model.
+        uint32_t animation_end(const std::vector<trlevel::tr_model>& models, uint32_t start, uint32_t animation_count)
+        {
+            uint32_t end = animation_count;
+            for (const auto& model : models)
+            {
+                if (model.Animation > start && model.Animation < end)
+                {
+                    end = model.Animation;
+                }
+            }
+            return end;
+        }
+
+        /// Flatten the mesh tree stack operations into a parent index for each mesh, relative to the first mesh.
+        void load_nodes(std::vector<AnimationEngine::Node>& nodes, std::span<const trlevel::tr_meshtree_node> mesh_tree, uint32_t mesh_count)
+        {
+            nodes.push_back({ .parent = -1 });
+
+            int32_t previous = 0;
+            std::vector<int32_t> stack;
+            for (uint32_t i = 1; i < mesh_count; ++i)
+            {
+                int32_t parent = previous;
+                DirectX::SimpleMath::Vector3 offset;
+                if (i - 1 < mesh_tree.size())
+                {
+                    const auto& node = mesh_tree[i - 1];
+                    offset = node.position();
+                    if (node.Flags & 0x1)
+                    {
+                        parent = -1;
+                        if (!stack.empty())
+                        {
+                            parent = stack.back();
+                            stack.pop_back();
+                        }
+                    }
+                    if (node.Flags & 0x2)
+                    {
+                        stack.push_back(parent);
+                    }
+                }
+
+                nodes.push_back({ .parent = parent, .offset = offset });
+                previous = static_cast<int32_t>(i);
+            }
+        }
+
+        void load_clip(AnimationEngine::Data& data, const trlevel::ILevel& level, const trlevel::tr_animation& animation, uint32_t animation_index, uint32_t mesh_count)
+        {
+            AnimationEngine::Clip clip;
+            clip.first_keyframe = static_cast<uint32_t>(data.keyframe_offsets.size());
+            clip.frame_rate = std::max<uint32_t>(animation.FrameRate, 1u);
+            clip.frame_count = animation.FrameEnd >= animation.FrameStart ? animation.FrameEnd - animation.FrameStart + 1u : 1u;
+            // A partial final interval still has a keyframe at the end of the animation.
+            const uint32_t length = clip.frame_count - 1;
+            clip.keyframe_count = animation.FrameSize == 0 ? 1u : length / clip.frame_rate + 1 + (length % clip.frame_rate ? 1 : 0);
+
+            for (uint32_t k = 0; k < clip.keyframe_count; ++k)
+            {
+                const auto frame = level.get_animation_frame(animation_index, k, mesh_count);
+                data.keyframe_offsets.push_back(frame.position());
+                data.keyframe_rotations.push_back(static_cast<uint32_t>(data.rotations_x.size()));
+                for (uint32_t m = 0; m < mesh_count; ++m)
+                {
+                    const auto rotation = m < frame.values.size() ? frame.values[m] : trlevel::tr2_frame_rotation{};
+                    data.rotations_x.push_back(rotation.x);
+                    data.rotations_y.push_back(rotation.y);
+                    data.rotations_z.push_back(rotation.z);
+                }
+            }
+            data.clips.push_back(clip);
+        }
+
+        std::optional<AnimationEngine::Skeleton> load_skeleton(
+            AnimationEngine::Data& data,
+            const trlevel::ILevel& level,
+            const std::vector<trlevel::tr_model>& models,
+            const std::vector<trlevel::tr_animation>& animations,
+            uint32_t model_index)
+        {
+            const auto& model = models[model_index];
+            if (model.NumMeshes == 0 || model.NumMeshes > 0xff00 || model.Animation >= animations.size())
+            {
+                return std::nullopt;
+            }
+
+            const uint32_t start = model.Animation;
+            const uint32_t end = animation_end(models, start, static_cast<uint32_t>(animations.size()));
+            const uint32_t first_clip = static_cast<uint32_t>(data.clips.size());
+            for (uint32_t a = start; a < end; ++a)
+            {
+                load_clip(data, level, animations[a], a, model.NumMeshes);
+            }
+
+            // Link the clips now that they all exist. Animations outside of the range of this model loop instead.
+            for (uint32_t a = start; a < end; ++a)
+            {
+                auto& clip = data.clips[first_clip + a - start];
+                const auto& animation = animations[a];
+                const uint32_t next = animation.NextAnimation >= start && animation.NextAnimation < end ? animation.NextAnimation : a;
+                const auto& next_clip = data.clips[first_clip + next - start];
+                clip.next_clip = first_clip + next - start;
+                clip.next_frame = std::min<uint32_t>(
+                    animation.NextFrame >= animations[next].FrameStart ? animation.NextFrame - animations[next].FrameStart : 0u,
+                    next_clip.frame_count - 1);
+            }
+
+            AnimationEngine::Skeleton skeleton{ .first_node = static_cast<uint32_t>(data.nodes.size()), .mesh_count = model.NumMeshes, .clip = first_clip };
+            load_nodes(data.nodes, level.get_model_meshtree(model_index), model.NumMeshes);
+            return skeleton;
+        }
+    }
+
+    IAnimationEngine::~IAnimationEngine()
+    {
+    }
+
+    AnimationEngine::AnimationEngine(const trlevel::ILevel& level)
+        : AnimationEngine(load_animation_data(level))
+    {
+    }
+
+    AnimationEngine::AnimationEngine(Data data)
+        : _data(std::move(data))
+    {
+    }
+
+    std::optional<uint32_t> AnimationEngine::add(uint32_t type_id)
+    {
+        const auto found = _data.skeletons_by_type.find(type_id);
+        if (found == _data.skeletons_by_type.end())
+        {
+            return std::nullopt;
+        }
+
+        const auto& skeleton = _data.skeletons[found->second];
+        if (skeleton.clip >= _data.clips.size())
+        {
+            return std::nullopt;
+        }
+
+        const Instance instance{ .skeleton = found->second, .clip = skeleton.clip, .frame = 0.0f, .pose = static_cast<uint32_t>(_poses.size()) };
+        _poses.resize(_poses.size() + skeleton.mesh_count);
+        _instances.push_back(instance);
+        evaluate(instance);
+        return static_cast<uint32_t>(_instances.size() - 1);
+    }
+
+    void AnimationEngine::update(float delta, std::span<const uint32_t> instances)
+    {
+        const float ticks = std::clamp(delta, 0.0f, MaxDelta) * TicksPerSecond;
+        for (auto& instance : _instances)
+        {
+            advance(instance, ticks);
+        }
+
+        // Each instance has its own part of the pose buffer, so an instance listed twice would be written by two tasks at once.
+        _evaluate.assign(instances.begin(), instances.end());
+        std::ranges::sort(_evaluate);
+        _evaluate.erase(std::ranges::unique(_evaluate).begin(), _evaluate.end());
+
+        std::for_each(std::execution::par, _evaluate.begin(), _evaluate.end(), [&](uint32_t index)
+            {
+                if (index < _instances.size())
+                {
+                    evaluate(_instances[index]);
+                }
+            });
+    }
+
+    std::span<const DirectX::SimpleMath::Matrix> AnimationEngine::pose(uint32_t instance) const
+    {
+        if (instance >= _instances.size())
+        {
+            return {};
+        }
+        const auto& target = _instances[instance];
+        return std::span(_poses).subspan(target.pose, _data.skeletons[target.skeleton].mesh_count);
+    }
+
+    void AnimationEngine::advance(Instance& instance, float ticks) const
+    {
+        instance.frame += ticks;
+
+        // Next frames are clamped inside the next clip so every step moves back by at least one tick.
+        const Clip* clip = &_data.clips[instance.clip];
+        while (instance.frame >= clip->frame_count)
+        {
+            instance.frame += static_cast<float>(clip->next_frame) - clip->frame_count;
+            instance.clip = clip->next_clip;
+            clip = &_data.clips[instance.clip];
+        }
+    }
+
+    void AnimationEngine::evaluate(const Instance& instance)
+    {
+        using namespace DirectX::SimpleMath;
+
+        const auto& skeleton = _data.skeletons[instance.skeleton];
+        const auto& clip = _data.clips[instance.clip];
+
+        const float position = instance.frame / clip.frame_rate;
+        const uint32_t key0 = std::min(static_cast<uint32_t>(position), clip.keyframe_count - 1);
+        const uint32_t key1 = std::min(key0 + 1, clip.keyframe_count - 1);
+        const float amount = std::clamp(position - key0, 0.0f, 1.0f);
+
+        const uint32_t from = _data.keyframe_rotations[clip.first_keyframe + key0];
+        const uint32_t to = _data.keyframe_rotations[clip.first_keyframe + key1];
+        const uint32_t count = skeleton.mesh_count;
+
+        thread_local std::vector<float> x, y, z;
+        x.resize(count);
+        y.resize(count);
+        z.resize(count);
+        interpolate_angles(&_data.rotations_x[from], &_data.rotations_x[to], amount, x.data(), count);
+        interpolate_angles(&_data.rotations_y[from], &_data.rotations_y[to], amount, y.data(), count);
+        interpolate_angles(&_data.rotations_z[from], &_data.rotations_z[to], amount, z.data(), count);
+
+        const Vector3 offset = Vector3::Lerp(
+            _data.keyframe_offsets[clip.first_keyframe + key0],
+            _data.keyframe_offsets[clip.first_keyframe + key1],
+            amount);
+
+        // Rotations are performed in Y, X, Z order. Parents always come before their children.
+        Matrix* pose = &_poses[instance.pose];
+        for (uint32_t m = 0; m < count; ++m)
+        {
+            const auto& node = _data.nodes[skeleton.first_node + m];
+            const Matrix local = Matrix::CreateFromYawPitchRoll(y[m], x[m], z[m]) * Matrix::CreateTranslation(m == 0 ? offset : node.offset);
+            pose[m] = node.parent < 0 ? local : local * pose[node.parent];
+        }
+    }
+
+    AnimationEngine::Data load_animation_data(const trlevel::ILevel& level)
+    {
+        const auto models = std::views::iota(0u, level.num_models())
+            | std::views::transform([&](uint32_t i) { return level.get_model(i); })
+            | std::ranges::to<std::vector>();
+        const auto animations = level.animations();
+
+        // Only decode the models that entities actually use.
+        std::set<uint32_t> types;
+        for (uint32_t i = 0; i < level.num_entities(); ++i)
+        {
+            types.insert(static_cast<uint16_t>(level.get_entity(i).TypeID));
+        }
+
+        AnimationEngine::Data data;
+        for (const auto type : types)
+        {
+            const auto model_index = level.get_model_index(type);
+            if (!model_index || model_index.value() >= models.size())
+            {
+                continue;
+            }
+
+            if (const auto skeleton = load_skeleton(data, level, models, animations, model_index.value()))
+            {
+                data.skeletons_by_type[type] = static_cast<uint32_t>(data.skeletons.size());
+                data.skeletons.push_back(skeleton.value());
+            }
+        }
+        return data;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <trlevel/ILevel.h>
+
+#include "IAnimationEngine.h"
+
+namespace trview
+{
+    /// Animation engine that keeps keyframes in flat arrays and evaluates poses in parallel.
+    class AnimationEngine final : public IAnimationEngine
+    {
+    public:
+        /// An animation with its keyframes decoded.
+        struct Clip
+        {
+            uint32_t first_keyframe{ 0u };
+            uint32_t keyframe_count{ 1u };
+            /// Ticks between keyframes.
+            uint32_t frame_rate{ 1u };
+            /// Length of the animation in ticks.
+            uint32_t frame_count{ 1u };
+            uint32_t next_clip{ 0u };
+            uint32_t next_frame{ 0u };
+        };
+
+        /// A mesh in a skeleton. Parents always come before their children.
+        struct Node
+        {
+            int32_t parent{ -1 };
+            DirectX::SimpleMath::Vector3 offset;
+        };
+
+        struct Skeleton
+        {
+            uint32_t first_node{ 0u };
+            uint32_t mesh_count{ 0u };
+            uint32_t clip{ 0u };
+        };
+
+        /// Animation data flattened for evaluation. The rotations of each keyframe are stored
+        /// as separate x, y and z arrays with one entry per mesh, starting at keyframe_rotations.
+        struct Data
+        {
+            std::vector<Clip> clips;
+            std::vector<Skeleton> skeletons;
+            std::unordered_map<uint32_t, uint32_t> skeletons_by_type;
+            std::vector<Node> nodes;
+            std::vector<DirectX::SimpleMath::Vector3> keyframe_offsets;
+            std::vector<uint32_t> keyframe_rotations;
+            std::vector<float> rotations_x;
+            std::vector<float> rotations_y;
+            std::vector<float> rotations_z;
+        };
+
+        explicit AnimationEngine(const trlevel::ILevel& level);
+        explicit AnimationEngine(Data data);
+        virtual ~AnimationEngine() = default;
+        std::optional<uint32_t> add(uint32_t type_id) override;
+        void update(float delta, std::span<const uint32_t> instances) override;
+        std::span<const DirectX::SimpleMath::Matrix> pose(uint32_t instance) const override;
+    private:
+        struct Instance
+        {
+            uint32_t skeleton;
+            uint32_t clip;
+            float frame;
+            uint32_t pose;
+        };
+
+        void advance(Instance& instance, float ticks) const;
+        void evaluate(const Instance& instance);
+
+        Data _data;
+        std::vector<Instance> _instances;
+        std::vector<DirectX::SimpleMath::Matrix> _poses;
+        std::vector<uint32_t> _evaluate;
+    };
+
+    /// Decode the animations of the models used by the entities in a level.
+    AnimationEngine::Data load_animation_data(const trlevel::ILevel& level);
+}
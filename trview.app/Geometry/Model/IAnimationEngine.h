@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace trview
+{
+    /// Plays entity animations and evaluates the pose of each animated entity.
+    struct IAnimationEngine
+    {
+        using Source = std::function<std::shared_ptr<IAnimationEngine>()>;
+        virtual ~IAnimationEngine() = 0;
+        /// Start playing the first animation of the model used by an entity type.
+        /// @param type_id The entity type ID.
+        /// @returns The instance for the entity, or nothing if the type has no animation.
+        virtual std::optional<uint32_t> add(uint32_t type_id) = 0;
+        /// Advance all instances and evaluate the poses of the specified instances.
+        /// @param delta The time elapsed in seconds. Long pauses are shortened so that animations don't skip ahead.
+        /// @param instances The instances to evaluate, usually the visible entities. Duplicates are evaluated once.
+        virtual void update(float delta, std::span<const uint32_t> instances) = 0;
+        /// Get the mesh transforms of an instance, relative to the entity. The span remains valid until the next call to add.
+        virtual std::span<const DirectX::SimpleMath::Matrix> pose(uint32_t instance) const = 0;
+    };
+}
@@ -12,9 +12,10 @@ namespace trview
 
         virtual ~IModel() = 0;
         virtual DirectX::BoundingBox bounding_box() const = 0;
-        virtual PickResult pick(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
-        virtual void render(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour) = 0;
-        virtual void render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour) = 0;
+        /// The pose parameters hold one transform per mesh from the animation engine. An empty pose uses the bind pose.
+        virtual PickResult pick(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const = 0;
+        virtual void render(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour) = 0;
+        virtual void render_transparency(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour) = 0;
         virtual uint32_t type_id() const = 0;
     };
 }
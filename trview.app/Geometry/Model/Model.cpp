@@ -39,7 +39,7 @@ namespace trview
         return _bounding_box;
     }
 
-    PickResult Model::pick(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
+    PickResult Model::pick(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const
     {
         using namespace DirectX;
         using namespace DirectX::SimpleMath;
@@ -55,9 +55,16 @@ namespace trview
             auto transformed_direction = Vector3::TransformNormal(direction, transform);
             transformed_direction.Normalize();
 
-            // Try and pick against the bounding box.
+            // Try and pick against the bounding box. The stored boxes are for the bind pose.
+            BoundingOrientedBox box = _oriented_boxes[i];
+            if (is_posed(pose))
+            {
+                BoundingOrientedBox::CreateFromBoundingBox(box, _meshes[i]->bounding_box());
+                box.Transform(box, mesh_transform(i, pose));
+            }
+
             float obb_distance = 0;
-            if (_oriented_boxes[i].Intersects(transformed_position, transformed_direction, obb_distance))
+            if (box.Intersects(transformed_position, transformed_direction, obb_distance))
             {
                 // Pick against the triangles in this mesh.
                 pick_meshes.push_back(i);
@@ -73,7 +80,7 @@ namespace trview
         for (auto i : pick_meshes)
         {
             // Transform the position and the direction into mesh space.
-            const auto transform = (_world_transforms[i] * world).Invert();
+            const auto transform = (mesh_transform(i, pose) * world).Invert();
             const auto transformed_position = Vector3::Transform(position, transform);
             auto transformed_direction = Vector3::TransformNormal(direction, transform);
             transformed_direction.Normalize();
@@ -82,7 +89,7 @@ namespace trview
             if (mesh_result.hit)
             {
                 // Transform back out of model space to remove any scaling that may have been applied.
-                const auto world_hit_pos = Vector3::Transform(result.position, _world_transforms[i] * world);
+                const auto world_hit_pos = Vector3::Transform(result.position, mesh_transform(i, pose) * world);
                 const auto world_distance = (position - world_hit_pos).Length();
                 if (world_distance < result.distance)
                 {
@@ -97,11 +104,11 @@ namespace trview
         return result;
     }
 
-    void Model::render(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour)
+    void Model::render(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour)
     {
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
-            const auto wvp = _world_transforms[i] * world * view_projection;
+            const auto wvp = mesh_transform(i, pose) * world * view_projection;
             if (_null_texture.has_value())
             {
                 _meshes[i]->render(wvp, _null_texture.value(), colour);
@@ -113,13 +120,14 @@ namespace trview
         }
     }
 
-    void Model::render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour)
+    void Model::render_transparency(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour)
     {
         for (uint32_t i = 0; i < _meshes.size(); ++i)
         {
+            const auto transform = mesh_transform(i, pose) * world;
             for (const auto& triangle : _meshes[i]->transparent_triangles())
             {
-                transparency.add(triangle.transform(_world_transforms[i] * world, colour, true));
+                transparency.add(triangle.transform(transform, colour, true));
             }
         }
     }
@@ -129,6 +137,17 @@ namespace trview
         return _model.ID;
     }
 
+    bool Model::is_posed(std::span<const DirectX::SimpleMath::Matrix> pose) const
+    {
+        // Null models replace the meshes with a placeholder, so the pose no longer applies.
+        return !_is_null_model && pose.size() == _meshes.size();
+    }
+
+    const DirectX::SimpleMath::Matrix& Model::mesh_transform(uint32_t index, std::span<const DirectX::SimpleMath::Matrix> pose) const
+    {
+        return is_posed(pose) ? pose[index] : _world_transforms[index];
+    }
+
     void Model::generate_bounding_box()
     {
         using namespace DirectX;
@@ -165,6 +184,7 @@ namespace trview
     {
         if (is_null_model(_meshes))
         {
+            _is_null_model = true;
             _meshes = { null_mesh.lock() };
             _world_transforms = { DirectX::SimpleMath::Matrix::CreateScale(0.1f) * _world_transforms[0] };
             if (auto ts = texture_storage.lock())
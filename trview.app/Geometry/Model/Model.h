@@ -11,12 +11,14 @@ namespace trview
         explicit Model(const trlevel::tr_model& model, const std::vector<std::shared_ptr<IMesh>>& meshes, const std::vector<DirectX::SimpleMath::Matrix>& transforms, const std::weak_ptr<IMesh>& null_mesh, const std::weak_ptr<ITextureStorage>& texture_storage);
         virtual ~Model() = default;
         DirectX::BoundingBox bounding_box() const override;
-        PickResult pick(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
-        void render(const DirectX::SimpleMath::Matrix& world, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour) override;
-        void render_transparency(const DirectX::SimpleMath::Matrix& world, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour) override;
+        PickResult pick(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Vector3& position, const DirectX::SimpleMath::Vector3& direction) const override;
+        void render(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, const DirectX::SimpleMath::Matrix& view_projection, const DirectX::SimpleMath::Color& colour) override;
+        void render_transparency(const DirectX::SimpleMath::Matrix& world, std::span<const DirectX::SimpleMath::Matrix> pose, ITransparencyBuffer& transparency, const DirectX::SimpleMath::Color& colour) override;
         uint32_t type_id() const override;
     private:
         void generate_bounding_box();
+        bool is_posed(std::span<const DirectX::SimpleMath::Matrix> pose) const;
+        const DirectX::SimpleMath::Matrix& mesh_transform(uint32_t index, std::span<const DirectX::SimpleMath::Matrix> pose) const;
         void check_for_null_model(const std::weak_ptr<IMesh>& null_mesh, const std::weak_ptr<ITextureStorage>& texture_storage);
 
         std::vector<std::shared_ptr<IMesh>>       _meshes;
@@ -25,6 +27,7 @@ namespace trview
         std::vector<DirectX::BoundingOrientedBox> _oriented_boxes;
         trlevel::tr_model                         _model;
         std::optional<graphics::Texture>          _null_texture;
+        bool                                      _is_null_model{ false };
     };
 }
 
@@ -1,6 +1,9 @@
 #include "ModelStorage.h"
 #include "../../Graphics/IMeshStorage.h"
 
+#include <execution>
+#include <ranges>
+
 namespace trview
 {
     namespace
@@ -70,6 +73,7 @@ namespace trview
         }
 
         std::vector<DirectX::SimpleMath::Matrix> load_transforms(
+            uint32_t model_index,
             const trlevel::tr_model& model,
             const trlevel::ILevel& level)
         {
@@ -81,75 +85,68 @@ namespace trview
                     return Matrix::CreateFromYawPitchRoll(r.y, r.x, r.z);
                 };
 
-            trlevel::tr_model actual_model = model;
+            // Skins use the frames and mesh tree of Lara's model.
             if (is_skin_id(level.platform_and_version(), static_cast<int16_t>(model.ID)))
             {
-                level.get_model_by_id(0, actual_model);
+                if (const auto lara = level.get_model_index(0))
+                {
+                    model_index = lara.value();
+                }
             }
 
+            const auto frame = level.get_model_frame(model_index);
+            const auto mesh_nodes = level.get_model_meshtree(model_index);
+
             std::vector<Matrix> transforms;
-            if (actual_model.NumMeshes > 0)
+            if (frame.values.empty())
             {
-                // Load the frames.
-                auto frame = level.get_frame(trlevel::has_double_frames(level.platform_and_version()) ? actual_model.FrameOffset : actual_model.FrameOffset / 2, actual_model.NumMeshes);
-
-                // TODO: Safe frame
-                if (frame.values.empty())
-                {
-                    for (int32_t t = 0; t < actual_model.NumMeshes; ++t)
-                    {
-                        transforms.push_back(Matrix::Identity);
-                    }
-                    return transforms;
-                }
-
-                uint32_t frame_offset = 0;
+                transforms.resize(model.NumMeshes, Matrix::Identity);
+                return transforms;
+            }
 
-                auto initial_frame = frame.values[frame_offset++];
+            transforms.reserve(mesh_nodes.size() + 1);
 
-                Matrix initial_rotation = get_rotate(initial_frame);
-                Matrix initial_frame_offset = Matrix::CreateTranslation(frame.position());
+            uint32_t frame_offset = 0;
+            Matrix previous_world = get_rotate(frame.values[frame_offset++]) * Matrix::CreateTranslation(frame.position());
+            transforms.push_back(previous_world);
 
-                Matrix previous_world = initial_rotation * initial_frame_offset;
-                transforms.push_back(previous_world);
+            std::vector<Matrix> world_stack;
+            world_stack.reserve(mesh_nodes.size());
 
-                std::stack<Matrix> world_stack;
+            for (const auto& node : mesh_nodes)
+            {
+                if (frame_offset >= frame.values.size())
+                {
+                    break;
+                }
 
-                // Build the mesh tree.
-                // Request one less node than we have meshes as the first mesh is at the same position as the entity.
-                auto mesh_nodes = level.get_meshtree(actual_model.MeshTree, actual_model.NumMeshes - 1);
+                Matrix parent_world = previous_world;
 
-                for (const auto& node : mesh_nodes)
+                if (node.Flags & 0x1)
                 {
-                    Matrix parent_world = previous_world;
-
-                    if (node.Flags & 0x1)
+                    if (!world_stack.empty())
                     {
-                        if (!world_stack.empty())
-                        {
-                            parent_world = world_stack.top();
-                            world_stack.pop();
-                        }
-                        else
-                        {
-                            parent_world = Matrix::Identity;
-                        }
+                        parent_world = world_stack.back();
+                        world_stack.pop_back();
                     }
-                    if (node.Flags & 0x2)
+                    else
                     {
-                        world_stack.push(parent_world);
+                        parent_world = Matrix::Identity;
                     }
+                }
+                if (node.Flags & 0x2)
+                {
+                    world_stack.push_back(parent_world);
+                }
 
-                    // Get the rotation from the frames.
-                    // Rotations are performed in Y, X, Z order.
-                    auto rotation = frame.values[frame_offset++];
-                    Matrix rotation_matrix = get_rotate(rotation);
-                    Matrix translation_matrix = Matrix::CreateTranslation(node.position());
-                    Matrix node_transform = rotation_matrix * translation_matrix * parent_world;
+                // Get the rotation from the frames.
+                // Rotations are performed in Y, X, Z order.
+                Matrix rotation_matrix = get_rotate(frame.values[frame_offset++]);
+                Matrix translation_matrix = Matrix::CreateTranslation(node.position());
+                Matrix node_transform = rotation_matrix * translation_matrix * parent_world;
 
-                    transforms.push_back(node_transform);
-                    previous_world = node_transform;
-                }
+                transforms.push_back(node_transform);
+                previous_world = node_transform;
             }
             return transforms;
         }
@@ -169,13 +166,27 @@ namespace trview
 
     void ModelStorage::load_models(const std::shared_ptr<IMeshStorage>& mesh_storage, const IModel::Source& model_source, const trlevel::ILevel& level)
     {
-
         using namespace DirectX::SimpleMath;
 
         const auto version = level.platform_and_version();
-        for (uint32_t i = 0; i < level.num_models(); ++i)
+        const auto models = std::views::iota(0u, level.num_models())
+            | std::views::transform([&](uint32_t i) { return level.get_model(i); })
+            | std::ranges::to<std::vector>();
+
+        // Transforms only depend on the level tables so they can all be calculated up front in parallel.
+        std::vector<std::vector<Matrix>> transforms(models.size());
+        std::for_each(std::execution::par, models.begin(), models.end(), [&](const trlevel::tr_model& model)
+            {
+                const uint32_t index = static_cast<uint32_t>(&model - models.data());
+                if (model.NumMeshes > 0 && model.NumMeshes <= 0xff00)
+                {
+                    transforms[index] = load_transforms(index, model, level);
+                }
+            });
+
+        for (uint32_t i = 0; i < models.size(); ++i)
         {
-            const auto model = level.get_model(i);
+            const auto& model = models[i];
             if (model.NumMeshes > 0xff00)
             {
                 continue;
@@ -208,21 +219,19 @@ namespace trview
                 }
             }
 
-            auto transforms = load_transforms(model, level);
-            _models.push_back(model_source(model, meshes, transforms));
+            auto model_ptr = model_source(model, meshes, transforms[i]);
+            _models_by_type.emplace(static_cast<uint16_t>(model.ID), model_ptr);
+            _models.push_back(model_ptr);
         }
     }
 
     std::weak_ptr<IModel> ModelStorage::find_by_type_id(uint16_t type_id) const
     {
-        const uint16_t updated_type_id = get_skin_id(_platform_and_version, type_id);
-        for (const auto& model : _models)
+        const auto found = _models_by_type.find(get_skin_id(_platform_and_version, type_id));
+        if (found == _models_by_type.end())
         {
-            if (model->type_id() == updated_type_id)
-            {
-                return model;
-            }
+            return {};
         }
-        return {};
+        return found->second;
     }
 }
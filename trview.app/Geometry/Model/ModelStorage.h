@@ -22,6 +22,7 @@ namespace trview
             const trlevel::ILevel& level);
 
         std::vector<std::shared_ptr<IModel>> _models;
+        std::unordered_map<uint16_t, std::shared_ptr<IModel>> _models_by_type;
         trlevel::PlatformAndVersion _platform_and_version;
     };
 }
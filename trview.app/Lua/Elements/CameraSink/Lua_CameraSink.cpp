@@ -11,103 +11,122 @@ namespace trview
     {
         namespace
         {
-            int camera_sink_index(lua_State* L)
+            int camera_sink_triggered_by(lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
             {
-                auto camera_sink = lua::get_self<ICameraSink>(L);
-                const std::string key = lua_tostring(L, 2);
-                if (key == "box_index")
-                {
-                    lua_pushinteger(L, camera_sink->box_index());
-                    return 1;
-                }
-                else if (key == "flag")
-                {
-                    lua_pushinteger(L, camera_sink->flag());
-                    return 1;
-                }
-                else if (key == "inferred_rooms")
-                {
-                    return push_list_p(L, camera_sink->inferred_rooms(), create_room);
-                }
-                else if (key == "number")
-                {
-                    lua_pushinteger(L, camera_sink->number());
-                    return 1;
-                }
-                else if (key == "persistent")
-                {
-                    lua_pushboolean(L, camera_sink->persistent());
-                    return 1;
-                }
-                else if (key == "position")
-                {
-                    create_vector3(L, camera_sink->position() * trlevel::Scale);
-                    return 1;
-                }
-                else if (key == "room")
-                {
-                    return create_room(L, camera_sink->room().lock());
-                }
-                else if (key == "strength")
-                {
-                    lua_pushinteger(L, camera_sink->strength());
-                    return 1;
-                }
-                else if (key == "type")
-                {
-                    lua_pushstring(L, to_string(camera_sink->type()).c_str());
-                    return 1;
-                }
-                else if (equals_any(key, "triggered_by", "trigger_references"))
-                {
-                    return push_list_p(L, camera_sink->triggers(), create_trigger);
-                }
-                else if (key == "visible")
-                {
-                    lua_pushboolean(L, camera_sink->visible());
-                    return 1;
-                }
-                return 0;
+                return push_list_p(L, camera_sink->triggers(), create_trigger);
             }
 
-            int camera_sink_newindex(lua_State* L)
+            constexpr auto camera_sink_getters = make_properties<ICameraSink>(
+            {
+                { "box_index", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushinteger(L, camera_sink->box_index());
+                        return 1;
+                    }
+                },
+                { "flag", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushinteger(L, camera_sink->flag());
+                        return 1;
+                    }
+                },
+                { "inferred_rooms", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        return push_list_p(L, camera_sink->inferred_rooms(), create_room);
+                    }
+                },
+                { "number", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushinteger(L, camera_sink->number());
+                        return 1;
+                    }
+                },
+                { "persistent", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushboolean(L, camera_sink->persistent());
+                        return 1;
+                    }
+                },
+                { "position", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        create_vector3(L, camera_sink->position() * trlevel::Scale);
+                        return 1;
+                    }
+                },
+                { "room", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        return create_room(L, camera_sink->room().lock());
+                    }
+                },
+                { "strength", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushinteger(L, camera_sink->strength());
+                        return 1;
+                    }
+                },
+                { "type", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushstring(L, to_string(camera_sink->type()).c_str());
+                        return 1;
+                    }
+                },
+                { "triggered_by", camera_sink_triggered_by },
+                { "trigger_references", camera_sink_triggered_by },
+                { "visible", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        lua_pushboolean(L, camera_sink->visible());
+                        return 1;
+                    }
+                }
+            });
+
+            int camera_sink_index(lua_State* L)
             {
-                auto camera_sink = lua::get_self<ICameraSink>(L);
+                return camera_sink_getters.call(L);
+            }
 
-                const std::string key = lua_tostring(L, 2);
-                if (key == "type")
-                {
-                    if (auto level = camera_sink->level().lock())
+            constexpr auto camera_sink_setters = make_properties<ICameraSink>(
+            {
+                { "type", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
                     {
-                        const char* type_str = lua_tostring(L, -1);
-                        if (type_str)
+                        if (auto level = camera_sink->level().lock())
                         {
-                            std::string type = type_str;
-                            if (type == "Camera")
+                            const char* type_str = lua_tostring(L, -1);
+                            if (type_str)
                             {
-                                camera_sink->set_type(ICameraSink::Type::Camera);
-                            }
-                            else if (type == "Sink")
-                            {
-                                camera_sink->set_type(ICameraSink::Type::Sink);
+                                std::string type = type_str;
+                                if (type == "Camera")
+                                {
+                                    camera_sink->set_type(ICameraSink::Type::Camera);
+                                }
+                                else if (type == "Sink")
+                                {
+                                    camera_sink->set_type(ICameraSink::Type::Sink);
+                                }
+                                else
+                                {
+                                    return luaL_error(L, "%s is not a valid type for Camera/Sink. Valid values are \"Camera\" and \"Sink\"", type.c_str());
+                                }
                             }
                             else
                             {
-                                return luaL_error(L, "%s is not a valid type for Camera/Sink. Valid values are \"Camera\" and \"Sink\"", type.c_str());
+                                return luaL_error(L, "nil is not a valid type for Camera/Sink. Valid values are \"Camera\" and \"Sink\"");
                             }
                         }
-                        else
-                        {
-                            return luaL_error(L, "nil is not a valid type for Camera/Sink. Valid values are \"Camera\" and \"Sink\"");
-                        }
+                        return 0;
+                    }
+                },
+                { "visible", [](lua_State* L, const std::shared_ptr<ICameraSink>& camera_sink)
+                    {
+                        camera_sink->set_visible(lua_toboolean(L, -1));
+                        return 0;
                     }
                 }
-                else if (key == "visible")
-                {
-                    camera_sink->set_visible(lua_toboolean(L, -1));
-                }
+            });
 
-                return 0;
+            int camera_sink_newindex(lua_State* L)
+            {
+                return camera_sink_setters.call(L);
             }
         }
 
@@ -17,6 +17,12 @@ namespace trview
     {
         namespace
         {
+            int push_floordata(lua_State* L, uint16_t value)
+            {
+                lua_pushinteger(L, value);
+                return 1;
+            }
+
             int level_addscriptable(lua_State* L)
             {
                 auto level = lua::get_self<ILevel>(L);
@@ -33,150 +39,169 @@ namespace trview
                 return 0;
             }
 
-            int level_index(lua_State* L)
+            constexpr auto level_getters = make_properties<ILevel>(
             {
-                auto level = lua::get_self<ILevel>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "add_scriptable")
-                {
-                    lua_pushcfunction(L, level_addscriptable);
-                    return 1;
-                }
-                else if (key == "alternate_mode")
-                {
-                    lua_pushboolean(L, level->alternate_mode());
-                    return 1;
-                }
-                else if (key == "cameras_and_sinks")
-                {
-                    return push_list_p(L, level->camera_sinks(), create_camera_sink);
-                }
-                else if (key == "filename")
-                {
-                    lua_pushstring(L, level->filename().c_str());
-                    return 1;
-                }
-                else if (key == "floordata")
-                {
-                    const auto data = level->floor_data();
-                    lua_createtable(L, static_cast<int>(data.size()), 0);
-                    for (auto i = 0u; i < data.size(); ++i)
+                { "add_scriptable", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        lua_pushinteger(L, data[i]);
-                        lua_rawseti(L, -2, i + 1);
+                        lua_pushcfunction(L, level_addscriptable);
+                        return 1;
                     }
-                    return 1;
-                }
-                else if (key == "items")
-                {
-                    return push_list_p(L, 
-                        level->items() |
-                        std::views::filter([](auto&& i)
+                },
+                { "alternate_mode", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        lua_pushboolean(L, level->alternate_mode());
+                        return 1;
+                    }
+                },
+                { "cameras_and_sinks", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_camera_sink>(L, "cameras_and_sinks", [&] { return level->camera_sinks(); });
+                    }
+                },
+                { "filename", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        lua_pushstring(L, level->filename().c_str());
+                        return 1;
+                    }
+                },
+                { "floordata", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<push_floordata>(L, "floordata", [&] { return level->floor_data(); });
+                    }
+                },
+                { "items", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_item>(L, "items", [&]
                             {
-                                const auto item = i.lock();
-                                return item && item->ng_plus().value_or(false) == false;
-                            }) |
-                        std::ranges::to<std::vector>(), create_item);
-                }
-                else if (key == "items_ng")
-                {
-                    return push_list_p(L,
-                        level->items() |
-                        std::views::filter([](auto&& i)
+                                return level->items() |
+                                    std::views::filter([](auto&& i)
+                                        {
+                                            const auto item = i.lock();
+                                            return item && item->ng_plus().value_or(false) == false;
+                                        });
+                            });
+                    }
+                },
+                { "items_ng", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_item>(L, "items_ng", [&]
                             {
-                                const auto item = i.lock();
-                                return item && item->ng_plus().value_or(true) == true;
-                            }) |
-                        std::ranges::to<std::vector>(), create_item);
-                }
-                else if (key == "lights")
-                {
-                    return push_list_p(L, level->lights(), create_light);
-                }
-                else if (key == "remove_scriptable")
-                {
-                    lua_pushcfunction(L, level_removescriptable);
-                    return 1;
-                }
-                else if (key == "rooms")
-                {
-                    return push_list_p(L, level->rooms(), create_room);
-                }
-                else if (key == "selected_item")
-                {
-                    auto item = level->selected_item();
-                    if (item)
+                                return level->items() |
+                                    std::views::filter([](auto&& i)
+                                        {
+                                            const auto item = i.lock();
+                                            return item && item->ng_plus().value_or(true) == true;
+                                        });
+                            });
+                    }
+                },
+                { "lights", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        return create_item(L, level->item(item.value()).lock());
+                        return push_cached_list<create_light>(L, "lights", [&] { return level->lights(); });
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "selected_room")
-                {
-                    return create_room(L, level->selected_room().lock());
-                }
-                else if (key == "selected_trigger")
-                {
-                    auto trigger = level->selected_trigger();
-                    if (trigger)
+                },
+                { "remove_scriptable", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        return create_trigger(L, level->trigger(trigger.value()).lock());
+                        lua_pushcfunction(L, level_removescriptable);
+                        return 1;
+                    }
+                },
+                { "rooms", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_room>(L, "rooms", [&] { return level->rooms(); });
+                    }
+                },
+                { "selected_item", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        auto item = level->selected_item();
+                        if (item)
+                        {
+                            return create_item(L, level->item(item.value()).lock());
+                        }
+                        lua_pushnil(L);
+                        return 1;
+                    }
+                },
+                { "selected_room", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return create_room(L, level->selected_room().lock());
+                    }
+                },
+                { "selected_trigger", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        auto trigger = level->selected_trigger();
+                        if (trigger)
+                        {
+                            return create_trigger(L, level->trigger(trigger.value()).lock());
+                        }
+                        lua_pushnil(L);
+                        return 1;
+                    }
+                },
+                { "static_meshes", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_static_mesh>(L, "static_meshes", [&] { return level->static_meshes(); });
+                    }
+                },
+                { "triggers", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        return push_cached_list<create_trigger>(L, "triggers", [&] { return level->triggers(); });
+                    }
+                },
+                { "version", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        lua_pushinteger(L, static_cast<int>(level->version()));
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "static_meshes")
-                {
-                    return push_list_p(L, level->static_meshes(), create_static_mesh);
-                }
-                else if (key == "triggers")
-                {
-                    return push_list_p(L, level->triggers(), create_trigger);
-                }
-                else if (key == "version")
-                {
-                    lua_pushinteger(L, static_cast<int>(level->version()));
-                    return 1;
                 }
-                
-                return 0;
-            }
+            });
 
-            int level_newindex(lua_State* L)
+            int level_index(lua_State* L)
             {
-                auto level = lua::get_self<ILevel>(L);
+                return level_getters.call(L);
+            }
 
-                const std::string key = lua_tostring(L, 2);
-                if (key == "alternate_mode")
-                {
-                    luaL_checktype(L, -1, LUA_TBOOLEAN);
-                    level->set_alternate_mode(lua_toboolean(L, -1));
-                }
-                else if (key == "selected_item")
-                {
-                    if (auto item = to_item(L, -1))
+            constexpr auto level_setters = make_properties<ILevel>(
+            {
+                { "alternate_mode", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        level->set_selected_item(item);
+                        luaL_checktype(L, -1, LUA_TBOOLEAN);
+                        level->set_alternate_mode(lua_toboolean(L, -1));
+                        return 0;
                     }
-                }
-                else if (key == "selected_room")
-                {
-                    if (auto room = to_room(L, -1))
+                },
+                { "selected_item", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        level->set_selected_room(room);
+                        if (auto item = to_item(L, -1))
+                        {
+                            level->set_selected_item(item);
+                        }
+                        return 0;
                     }
-                }
-                else if (key == "selected_trigger")
-                {
-                    if (auto trigger = to_trigger(L, -1))
+                },
+                { "selected_room", [](lua_State* L, const std::shared_ptr<ILevel>& level)
+                    {
+                        if (auto room = to_room(L, -1))
+                        {
+                            level->set_selected_room(room);
+                        }
+                        return 0;
+                    }
+                },
+                { "selected_trigger", [](lua_State* L, const std::shared_ptr<ILevel>& level)
                     {
-                        level->set_selected_trigger(trigger->number());
+                        if (auto trigger = to_trigger(L, -1))
+                        {
+                            level->set_selected_trigger(trigger->number());
+                        }
+                        return 0;
                     }
                 }
+            });
 
-                return 0;
+            int level_newindex(lua_State* L)
+            {
+                return level_setters.call(L);
             }
         }
 
@@ -37,136 +37,160 @@ namespace trview
                 return 1;
             }
 
-            int room_index(lua_State* L)
+            constexpr auto room_getters = make_properties<IRoom>(
             {
-                auto room = lua::get_self<IRoom>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "alternate_mode")
-                {
-                    lua_pushstring(L, to_string(room->alternate_mode()).c_str());
-                    return 1;
-                }
-                else if (key == "alternate_group")
-                {
-                    lua_pushinteger(L, room->alternate_group());
-                    return 1;
-                }
-                else if (key == "alternate_room")
-                {
-                    if (auto level = room->level().lock())
+                { "alternate_mode", [](lua_State* L, const std::shared_ptr<IRoom>& room)
                     {
-                        return create_room(L, level->room(room->alternate_room()).lock());
+                        lua_pushstring(L, to_string(room->alternate_mode()).c_str());
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "cameras_and_sinks")
-                {
-                    return push_list_p(L, room->camera_sinks(), create_camera_sink);
-                }
-                else if (key == "flags")
-                {
-                    lua_pushinteger(L, room->flags());
-                    return 1;
-                }
-                else if (key == "has_flag")
-                {
-                    lua_pushcfunction(L, room_hasflag);
-                    return 1;
-                }
-                else if (key == "items")
-                {
-                    return push_list_p(L,
-                        room->items() |
-                        std::views::filter([](auto&& i)
+                },
+                { "alternate_group", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushinteger(L, room->alternate_group());
+                        return 1;
+                    }
+                },
+                { "alternate_room", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        if (auto level = room->level().lock())
+                        {
+                            return create_room(L, level->room(room->alternate_room()).lock());
+                        }
+                        lua_pushnil(L);
+                        return 1;
+                    }
+                },
+                { "cameras_and_sinks", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_camera_sink>(L, "cameras_and_sinks", [&] { return room->camera_sinks(); });
+                    }
+                },
+                { "flags", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushinteger(L, room->flags());
+                        return 1;
+                    }
+                },
+                { "has_flag", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushcfunction(L, room_hasflag);
+                        return 1;
+                    }
+                },
+                { "items", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_item>(L, "items", [&]
                             {
-                                const auto item = i.lock();
-                                return item && item->ng_plus().value_or(false) == false;
-                            }) |
-                        std::ranges::to<std::vector>(), create_item);
-                }
-                else if (key == "items_ng")
-                {
-                    return push_list_p(L,
-                        room->items() |
-                        std::views::filter([](auto&& i)
+                                return room->items() |
+                                    std::views::filter([](auto&& i)
+                                        {
+                                            const auto item = i.lock();
+                                            return item && item->ng_plus().value_or(false) == false;
+                                        });
+                            });
+                    }
+                },
+                { "items_ng", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_item>(L, "items_ng", [&]
                             {
-                                const auto item = i.lock();
-                                return item && item->ng_plus().value_or(true) == true;
-                            }) |
-                        std::ranges::to<std::vector>(), create_item);
-                }
-                else if (key == "level")
-                {
-                    return create_level(L, room->level().lock());
-                }
-                else if (key == "lights")
-                {
-                    return push_list_p(L, room->lights(), create_light);
-                }
-                else if (key == "number")
-                {
-                    lua_pushinteger(L, room->number());
-                    return 1;
-                }
-                else if (key == "num_x_sectors")
-                {
-                    lua_pushinteger(L, room->num_x_sectors());
-                    return 1;
-                }
-                else if (key == "num_z_sectors")
-                {
-                    lua_pushinteger(L, room->num_z_sectors());
-                    return 1;
-                }
-                else if (key == "position")
-                {
-                    const auto info = room->info();
-                    return create_vector3(L, DirectX::SimpleMath::Vector3(static_cast<float>(info.x), static_cast<float>(info.yBottom), static_cast<float>(info.z)));
-                }
-                else if (key == "sector")
-                {
-                    lua_pushcfunction(L, get_sector);
-                    return 1;
-                }
-                else if (key == "sectors")
-                {
-                    return push_list(L, room->sectors(), create_sector);
-                }
-                else if (key == "static_meshes")
-                {
-                    return push_list_p(L, room->static_meshes(), create_static_mesh);
-                }
-                else if (key == "triggers")
-                {
-                    return push_list_p(L, room->triggers(), create_trigger);
-                }
-                else if (key == "visible")
-                {
-                    lua_pushboolean(L, room->visible());
-                    return 1;
-                }
-                else if (key == "water_scheme")
-                {
-                    lua_pushnumber(L, room->water_scheme());
-                    return 1;
+                                return room->items() |
+                                    std::views::filter([](auto&& i)
+                                        {
+                                            const auto item = i.lock();
+                                            return item && item->ng_plus().value_or(true) == true;
+                                        });
+                            });
+                    }
+                },
+                { "level", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return create_level(L, room->level().lock());
+                    }
+                },
+                { "lights", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_light>(L, "lights", [&] { return room->lights(); });
+                    }
+                },
+                { "number", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushinteger(L, room->number());
+                        return 1;
+                    }
+                },
+                { "num_x_sectors", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushinteger(L, room->num_x_sectors());
+                        return 1;
+                    }
+                },
+                { "num_z_sectors", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushinteger(L, room->num_z_sectors());
+                        return 1;
+                    }
+                },
+                { "position", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        const auto info = room->info();
+                        return create_vector3(L, DirectX::SimpleMath::Vector3(static_cast<float>(info.x), static_cast<float>(info.yBottom), static_cast<float>(info.z)));
+                    }
+                },
+                { "sector", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushcfunction(L, get_sector);
+                        return 1;
+                    }
+                },
+                { "sectors", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_sector>(L, "sectors", [&] { return room->sectors(); });
+                    }
+                },
+                { "static_meshes", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_static_mesh>(L, "static_meshes", [&] { return room->static_meshes(); });
+                    }
+                },
+                { "triggers", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        return push_cached_list<create_trigger>(L, "triggers", [&] { return room->triggers(); });
+                    }
+                },
+                { "visible", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushboolean(L, room->visible());
+                        return 1;
+                    }
+                },
+                { "water_scheme", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        lua_pushnumber(L, room->water_scheme());
+                        return 1;
+                    }
                 }
+            });
 
-                return 0;
+            int room_index(lua_State* L)
+            {
+                return room_getters.call(L);
             }
 
-            int room_newindex(lua_State* L)
+            constexpr auto room_setters = make_properties<IRoom>(
             {
-                auto room = lua::get_self<IRoom>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "visible")
-                {
-                    room->set_visible(lua_toboolean(L, -1));
+                { "visible", [](lua_State* L, const std::shared_ptr<IRoom>& room)
+                    {
+                        room->set_visible(lua_toboolean(L, -1));
+                        return 0;
+                    }
                 }
+            });
 
-                return 0;
+            int room_newindex(lua_State* L)
+            {
+                return room_setters.call(L);
             }
         }
 
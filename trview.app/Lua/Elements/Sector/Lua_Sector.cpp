@@ -58,186 +58,208 @@ namespace trview
                 return 1;
             }
 
-            int sector_index(lua_State* L)
+            constexpr auto sector_getters = make_properties<ISector>(
             {
-                auto sector = lua::get_self<ISector>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "above")
-                {
-                    if (sector->room_above() != 0xff)
+                { "above", [](lua_State* L, const std::shared_ptr<ISector>& sector)
                     {
-                        if (auto room = sector->room().lock())
+                        if (sector->room_above() != 0xff)
                         {
-                            if (auto level = room->level().lock())
+                            if (auto room = sector->room().lock())
                             {
-                                return create_room(L, level->room(sector->room_above()).lock());
+                                if (auto level = room->level().lock())
+                                {
+                                    return create_room(L, level->room(sector->room_above()).lock());
+                                }
                             }
                         }
+                        lua_pushnil(L);
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "below")
-                {
-                    if (sector->room_below() != 0xff)
+                },
+                { "below", [](lua_State* L, const std::shared_ptr<ISector>& sector)
                     {
-                        if (auto room = sector->room().lock())
+                        if (sector->room_below() != 0xff)
                         {
-                            if (auto level = room->level().lock())
+                            if (auto room = sector->room().lock())
                             {
-                                return create_room(L, level->room(sector->room_below()).lock());
+                                if (auto level = room->level().lock())
+                                {
+                                    return create_room(L, level->room(sector->room_below()).lock());
+                                }
                             }
                         }
+                        lua_pushnil(L);
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "ceiling_corners")
-                {
-                    lua_newtable(L);
-                    const auto corners = to_ceiling_corner_clicks(sector, sector->ceiling_corners());
-                    lua_pushinteger(L, corners[0]);
-                    lua_rawseti(L, -2, 1);
-                    lua_pushinteger(L, corners[1]);
-                    lua_rawseti(L, -2, 2);
-                    lua_pushinteger(L, corners[2]);
-                    lua_rawseti(L, -2, 3);
-                    lua_pushinteger(L, corners[3]);
-                    lua_rawseti(L, -2, 4);
-                    return 1;
-                }
-                else if (key == "ceiling_triangulation")
-                {
-                    lua_pushstring(L, to_string(sector->ceiling_triangulation()).c_str());
-                    return 1;
-                }
-                else if (key == "corners")
-                {
-                    lua_newtable(L);
-                    const auto corners = to_corner_clicks(sector, sector->corners());
-                    lua_pushinteger(L, corners[0]);
-                    lua_rawseti(L, -2, 1);
-                    lua_pushinteger(L, corners[1]);
-                    lua_rawseti(L, -2, 2);
-                    lua_pushinteger(L, corners[2]);
-                    lua_rawseti(L, -2, 3);
-                    lua_pushinteger(L, corners[3]);
-                    lua_rawseti(L, -2, 4);
-                    return 1;
-                }
-                else if (key == "flags")
-                {
-                    lua_pushinteger(L, static_cast<int>(sector->flags()));
-                    return 1;
-                }
-                else if (key == "floordata")
-                {
-                    if (auto room = sector->room().lock())
+                },
+                { "ceiling_corners", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_newtable(L);
+                        const auto corners = to_ceiling_corner_clicks(sector, sector->ceiling_corners());
+                        lua_pushinteger(L, corners[0]);
+                        lua_rawseti(L, -2, 1);
+                        lua_pushinteger(L, corners[1]);
+                        lua_rawseti(L, -2, 2);
+                        lua_pushinteger(L, corners[2]);
+                        lua_rawseti(L, -2, 3);
+                        lua_pushinteger(L, corners[3]);
+                        lua_rawseti(L, -2, 4);
+                        return 1;
+                    }
+                },
+                { "ceiling_triangulation", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushstring(L, to_string(sector->ceiling_triangulation()).c_str());
+                        return 1;
+                    }
+                },
+                { "corners", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_newtable(L);
+                        const auto corners = to_corner_clicks(sector, sector->corners());
+                        lua_pushinteger(L, corners[0]);
+                        lua_rawseti(L, -2, 1);
+                        lua_pushinteger(L, corners[1]);
+                        lua_rawseti(L, -2, 2);
+                        lua_pushinteger(L, corners[2]);
+                        lua_rawseti(L, -2, 3);
+                        lua_pushinteger(L, corners[3]);
+                        lua_rawseti(L, -2, 4);
+                        return 1;
+                    }
+                },
+                { "flags", [](lua_State* L, const std::shared_ptr<ISector>& sector)
                     {
-                        if (auto level = room->level().lock())
+                        lua_pushinteger(L, static_cast<int>(sector->flags()));
+                        return 1;
+                    }
+                },
+                { "floordata", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        if (auto room = sector->room().lock())
                         {
-                            const auto data = level->floor_data();
-                            if (sector->floordata_index() < data.size())
+                            if (auto level = room->level().lock())
                             {
-                                lua_newtable(L);
-                                push_list(L, 
-                                    parse_floordata(level->floor_data(), sector->floordata_index(), FloordataMeanings::None, level->trng(), level->platform_and_version()).commands
-                                    | std::views::transform([](auto& f) { return f.data; })
-                                    | std::views::join,
-                                    [](auto L, auto f) { lua_pushinteger(L, f); });
-                                return 1;
+                                const auto data = level->floor_data();
+                                if (sector->floordata_index() < data.size())
+                                {
+                                    lua_newtable(L);
+                                    push_list(L, 
+                                        parse_floordata(level->floor_data(), sector->floordata_index(), FloordataMeanings::None, level->trng(), level->platform_and_version()).commands
+                                        | std::views::transform([](auto& f) { return f.data; })
+                                        | std::views::join,
+                                        [](auto L, auto f) { lua_pushinteger(L, f); });
+                                    return 1;
+                                }
                             }
                         }
+                        lua_pushnil(L);
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "has_flag")
-                {
-                    lua_pushcfunction(L, sector_hasflag);
-                    return 1;
-                }
-                else if (key == "number")
-                {
-                    lua_pushinteger(L, sector->id());
-                    return 1;
-                }
-                else if (key == "portal")
-                {
-                    if (sector->is_portal())
+                },
+                { "has_flag", [](lua_State* L, const std::shared_ptr<ISector>& sector)
                     {
-                        if (auto room = sector->room().lock())
+                        lua_pushcfunction(L, sector_hasflag);
+                        return 1;
+                    }
+                },
+                { "number", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushinteger(L, sector->id());
+                        return 1;
+                    }
+                },
+                { "portal", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        if (sector->is_portal())
                         {
-                            if (auto level = room->level().lock())
+                            if (auto room = sector->room().lock())
                             {
-                                return create_room(L, level->room(sector->portals()[0]).lock());
+                                if (auto level = room->level().lock())
+                                {
+                                    return create_room(L, level->room(sector->portals()[0]).lock());
+                                }
                             }
                         }
+                        lua_pushnil(L);
+                        return 1;
                     }
-                    lua_pushnil(L);
-                }
-                else if (key == "portals")
-                {
-                    if (sector->is_portal())
+                },
+                { "portals", [](lua_State* L, const std::shared_ptr<ISector>& sector)
                     {
-                        if (auto room = sector->room().lock())
+                        if (sector->is_portal())
                         {
-                            if (auto level = room->level().lock())
+                            if (auto room = sector->room().lock())
                             {
-                                lua_newtable(L);
-                                push_list(L,
-                                    sector->portals(),
-                                    [&](auto L, auto f) { create_room(L, level->room(f).lock()); });
-                                return 1;
+                                if (auto level = room->level().lock())
+                                {
+                                    lua_newtable(L);
+                                    push_list(L,
+                                        sector->portals(),
+                                        [&](auto L, auto f) { create_room(L, level->room(f).lock()); });
+                                    return 1;
+                                }
                             }
                         }
+                        lua_pushnil(L);
+                        return 1;
+                    }
+                },
+                { "room", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        return create_room(L, sector->room().lock());
+                    }
+                },
+                { "sector_above", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        return create_sector(L, sector_above(sector).value_or({}).sector);
+                    }
+                },
+                { "sector_below", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        return create_sector(L, sector_below(sector).value_or({}).sector);
+                    }
+                },
+                { "tilt_x", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushnumber(L, sector->tilt_x());
+                        return 1;
+                    }
+                },
+                { "tilt_z", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushnumber(L, sector->tilt_z());
+                        return 1;
+                    }
+                },
+                { "triangulation", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushstring(L, to_string(sector->triangulation()).c_str());
+                        return 1;
+                    }
+                },
+                { "trigger", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        return create_trigger(L, sector->trigger().lock());
+                    }
+                },
+                { "x", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushinteger(L, sector->x());
+                        return 1;
+                    }
+                },
+                { "z", [](lua_State* L, const std::shared_ptr<ISector>& sector)
+                    {
+                        lua_pushinteger(L, sector->z());
+                        return 1;
                     }
-                    lua_pushnil(L);
-                }
-                else if (key == "room")
-                {
-                    return create_room(L, sector->room().lock());
-                }
-                else if (key == "sector_above")
-                {
-                    return create_sector(L, sector_above(sector).value_or({}).sector);
-                }
-                else if (key == "sector_below")
-                {
-                    return create_sector(L, sector_below(sector).value_or({}).sector);
-                }
-                else if (key == "tilt_x")
-                {
-                    lua_pushnumber(L, sector->tilt_x());
-                    return 1;
-                }
-                else if (key == "tilt_z")
-                {
-                    lua_pushnumber(L, sector->tilt_z());
-                    return 1;
-                }
-                else if (key == "triangulation")
-                {
-                    lua_pushstring(L, to_string(sector->triangulation()).c_str());
-                    return 1;
-                }
-                else if (key == "trigger")
-                {
-                    return create_trigger(L, sector->trigger().lock());
-                }
-                else if (key == "x")
-                {
-                    lua_pushinteger(L, sector->x());
-                    return 1;
-                }
-                else if (key == "z")
-                {
-                    lua_pushinteger(L, sector->z());
-                    return 1;
                 }
+            });
 
-                return 0;
+            int sector_index(lua_State* L)
+            {
+                return sector_getters.call(L);
             }
 
             int sector_newindex(lua_State* L)
@@ -250,23 +272,7 @@ namespace trview
 
         int create_sector(lua_State* L, std::shared_ptr<ISector> sector)
         {
-            if (!sector)
-            {
-                lua_pushnil(L);
-                return 1;
-            }
-
-            set_self(L, sector);
-
-            lua_newtable(L);
-            lua_pushcfunction(L, sector_index);
-            lua_setfield(L, -2, "__index");
-            lua_pushcfunction(L, sector_newindex);
-            lua_setfield(L, -2, "__newindex");
-            lua_pushcfunction(L, gc<ISector>);
-            lua_setfield(L, -2, "__gc");
-            lua_setmetatable(L, -2);
-            return 1;
+            return create(L, sector, sector_index, sector_newindex);
         }
 
         void sector_register(lua_State* L)
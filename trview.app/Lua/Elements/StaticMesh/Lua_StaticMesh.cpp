@@ -10,69 +10,84 @@ namespace trview
     {
         namespace
         {
-            int static_mesh_index(lua_State* L)
+            constexpr auto static_mesh_getters = make_properties<IStaticMesh>(
             {
-                auto static_mesh = lua::get_self<IStaticMesh>(L);
-                const std::string key = lua_tostring(L, 2);
-                if (key == "breakable")
-                {
-                    lua_pushboolean(L, static_mesh->breakable());
-                    return 1;
-                }
-                else if (key == "collision")
-                {
-                    return create_bounding_box(L, static_mesh->collision());
-                }
-                else if (key == "has_collision")
-                {
-                    lua_pushboolean(L, static_mesh->has_collision());
-                    return 1;
-                }
-                else if (key == "id")
-                {
-                    lua_pushinteger(L, static_mesh->id());
-                    return 1;
-                }
-                else if (key == "position")
-                {
-                    return create_vector3(L, static_mesh->position() * trlevel::Scale);
-                }
-                else if (key == "room")
-                {
-                    return create_room(L, static_mesh->room().lock());
-                }
-                else if (key == "rotation")
-                {
-                    lua_pushnumber(L, static_mesh->rotation());
-                    return 1;
-                }
-                else if (key == "type")
-                {
-                    lua_pushstring(L, to_string(static_mesh->type()).c_str());
-                    return 1;
-                }
-                else if (key == "visible")
-                {
-                    lua_pushboolean(L, static_mesh->visible());
-                    return 1;
+                { "breakable", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushboolean(L, static_mesh->breakable());
+                        return 1;
+                    }
+                },
+                { "collision", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        return create_bounding_box(L, static_mesh->collision());
+                    }
+                },
+                { "has_collision", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushboolean(L, static_mesh->has_collision());
+                        return 1;
+                    }
+                },
+                { "id", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushinteger(L, static_mesh->id());
+                        return 1;
+                    }
+                },
+                { "position", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        return create_vector3(L, static_mesh->position() * trlevel::Scale);
+                    }
+                },
+                { "room", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        return create_room(L, static_mesh->room().lock());
+                    }
+                },
+                { "rotation", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushnumber(L, static_mesh->rotation());
+                        return 1;
+                    }
+                },
+                { "type", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushstring(L, to_string(static_mesh->type()).c_str());
+                        return 1;
+                    }
+                },
+                { "visible", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        lua_pushboolean(L, static_mesh->visible());
+                        return 1;
+                    }
+                },
+                { "visibility", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        return create_bounding_box(L, static_mesh->visibility());
+                    }
                 }
-                else if (key == "visibility")
-                {
-                    return create_bounding_box(L, static_mesh->visibility());
-                }
-                return 0;
-            }
+            });
 
-            int static_mesh_newindex(lua_State* L)
+            int static_mesh_index(lua_State* L)
             {
-                auto static_mesh = lua::get_self<IStaticMesh>(L);
-                const std::string key = lua_tostring(L, 2);
+                return static_mesh_getters.call(L);
+            }
 
-                if (key == "visible")
-                {
-                    static_mesh->set_visible(lua_toboolean(L, -1));
+            constexpr auto static_mesh_setters = make_properties<IStaticMesh>(
+            {
+                { "visible", [](lua_State* L, const std::shared_ptr<IStaticMesh>& static_mesh)
+                    {
+                        static_mesh->set_visible(lua_toboolean(L, -1));
+                        return 0;
+                    }
                 }
-                return 0;
+            });
+
+            int static_mesh_newindex(lua_State* L)
+            {
+                return static_mesh_setters.call(L);
             }
         }
 
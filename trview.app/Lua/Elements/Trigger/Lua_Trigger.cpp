@@ -34,94 +34,109 @@ namespace trview
                 lua_setfield(L, -2, "data");
             }
 
-            int trigger_index(lua_State* L)
+            constexpr auto trigger_getters = make_properties<ITrigger>(
             {
-                auto trigger = lua::get_self<ITrigger>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "colour")
-                {
-                    return create_colour(L, trigger->colour());
-                }
-                else if (key == "commands")
-                {
-                    return push_list(L, trigger->commands(), create_command);
-                }
-                else if (key == "flags")
-                {
-                    lua_pushinteger(L, trigger->flags());
-                    return 1;
-                }
-                else if (key == "number")
-                {
-                    lua_pushinteger(L, trigger->number());
-                    return 1;
-                }
-                else if (key == "only_once")
-                {
-                    lua_pushboolean(L, trigger->only_once());
-                    return 1;
-                }
-                else if (key == "position")
-                {
-                    return create_vector3(L, trigger->position() * trlevel::Scale);
-                }
-                else if (key == "room")
-                {
-                    return create_room(L, trigger->room().lock());
-                }
-                else if (key == "sector")
-                {
-                    if (auto room = trigger->room().lock())
+                { "colour", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        return create_colour(L, trigger->colour());
+                    }
+                },
+                { "commands", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        return push_list(L, trigger->commands(), create_command);
+                    }
+                },
+                { "flags", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushinteger(L, trigger->flags());
+                        return 1;
+                    }
+                },
+                { "number", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushinteger(L, trigger->number());
+                        return 1;
+                    }
+                },
+                { "only_once", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushboolean(L, trigger->only_once());
+                        return 1;
+                    }
+                },
+                { "position", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        return create_vector3(L, trigger->position() * trlevel::Scale);
+                    }
+                },
+                { "room", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        return create_room(L, trigger->room().lock());
+                    }
+                },
+                { "sector", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
                     {
-                        const auto sectors = room->sectors();
-                        if (trigger->sector_id() < sectors.size())
+                        if (auto room = trigger->room().lock())
                         {
-                            return create_sector(L, sectors[trigger->sector_id()]);
+                            const auto sectors = room->sectors();
+                            if (trigger->sector_id() < sectors.size())
+                            {
+                                return create_sector(L, sectors[trigger->sector_id()]);
+                            }
                         }
+                        lua_pushnil(L);
+                        return 1;
+                    }
+                },
+                { "timer", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushinteger(L, trigger->timer());
+                        return 1;
+                    }
+                },
+                { "type", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushstring(L, to_string(trigger->type()).c_str());
+                        return 1;
+                    }
+                },
+                { "visible", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        lua_pushboolean(L, trigger->visible());
+                        return 1;
                     }
-                    lua_pushnil(L);
-                    return 1;
-                }
-                else if (key == "timer")
-                {
-                    lua_pushinteger(L, trigger->timer());
-                    return 1;
-                }
-                else if (key == "type")
-                {
-                    lua_pushstring(L, to_string(trigger->type()).c_str());
-                    return 1;
-                }
-                else if (key == "visible")
-                {
-                    lua_pushboolean(L, trigger->visible());
-                    return 1;
                 }
+            });
 
-                return 0;
+            int trigger_index(lua_State* L)
+            {
+                return trigger_getters.call(L);
             }
 
-            int trigger_newindex(lua_State* L)
+            constexpr auto trigger_setters = make_properties<ITrigger>(
             {
-                auto trigger = lua::get_self<ITrigger>(L);
-
-                const std::string key = lua_tostring(L, 2);
-                if (key == "colour")
-                {
-                    std::optional<Colour> colour;
-                    if (lua_type(L, -1) != LUA_TNIL)
+                { "colour", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
+                    {
+                        std::optional<Colour> colour;
+                        if (lua_type(L, -1) != LUA_TNIL)
+                        {
+                            colour = to_colour(L, -1);
+                        }
+                        trigger->set_colour(colour);
+                        return 0;
+                    }
+                },
+                { "visible", [](lua_State* L, const std::shared_ptr<ITrigger>& trigger)
                     {
-                        colour = to_colour(L, -1);
+                        trigger->set_visible(lua_toboolean(L, -1));
+                        return 0;
                     }
-                    trigger->set_colour(colour);
-                }
-                else if (key == "visible")
-                {
-                    trigger->set_visible(lua_toboolean(L, -1));
                 }
+            });
 
-                return 0;
+            int trigger_newindex(lua_State* L)
+            {
+                return trigger_setters.call(L);
             }
         }
 
@@ -11,6 +11,9 @@ namespace trview
         virtual void execute(const std::string& command) = 0;
         virtual void initialise(IApplication* application) = 0;
         virtual void set_directory(const std::string& directory) = 0;
+        /// Number of Lua instructions run so far. This keeps counting when the state is recreated and is only
+        /// accurate to the instruction step of the count hook.
+        virtual uint64_t instructions() const = 0;
 
         Event<std::string> on_print;
     };
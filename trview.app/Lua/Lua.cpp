@@ -52,6 +52,13 @@ namespace trview
             return 0;
         }
 
+        /// The extra space of the state holds the counter, and threads created by the state copy both the
+        /// extra space and the hook so coroutines are counted as well.
+        void count_instructions(lua_State* L, lua_Debug*)
+        {
+            **static_cast<uint64_t**>(lua_getextraspace(L)) += Lua::InstructionStep;
+        }
+
         void nil_functions(lua_State* L, const std::string& lib, const std::vector<std::string>& names)
         {
             for (const auto& name : names)
@@ -156,6 +163,11 @@ namespace trview
         _directory = directory;
     }
 
+    uint64_t Lua::instructions() const
+    {
+        return _instructions;
+    }
+
     void Lua::create_state()
     {
         if (L)
@@ -165,6 +177,8 @@ namespace trview
         }
 
         L = luaL_newstate();
+        *static_cast<uint64_t**>(lua_getextraspace(L)) = &_instructions;
+        lua_sethook(L, count_instructions, LUA_MASKCOUNT, Lua::InstructionStep);
         trview_luaL_openlibs(L);
         nil_functions(L, LUA_OSLIBNAME, { "execute", "exit", "remove", "rename", "setlocale" });
     }
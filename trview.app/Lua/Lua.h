@@ -2,7 +2,10 @@
 
 #include <external/lua/src/lua.h>
 #include <external/lua/src/lauxlib.h>
+#include <array>
+#include <bit>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 #include <trview.common/Event.h>
@@ -23,6 +26,9 @@ namespace trview
     class Lua final : public ILua
     {
     public:
+        /// The count hook runs every this many instructions, which keeps the cost of counting low.
+        static constexpr int InstructionStep = 1000;
+
         explicit Lua(
             const IRoute::Source& route_source,
             const IRandomizerRoute::Source& randomizer_route_source,
@@ -33,6 +39,7 @@ namespace trview
         void execute(const std::string& command) override;
         void initialise(IApplication* application) override;
         void set_directory(const std::string& directory) override;
+        uint64_t instructions() const override;
     private:
         void create_state();
 
@@ -44,6 +51,7 @@ namespace trview
         std::shared_ptr<IDialogs> _dialogs;
         std::shared_ptr<IFiles> _files;
         std::string _directory;
+        uint64_t _instructions{ 0 };
     };
 
     namespace lua
@@ -56,6 +64,63 @@ namespace trview
         template <typename Func>
         int push_list(lua_State* L, std::ranges::input_range auto&& range, Func&& func);
 
+        /// <summary>
+        /// Push a read only table for a collection that doesn't change for the lifetime of the element at index 1.
+        /// Elements are only created when they are read and the table is kept with the element, so reading the same
+        /// collection again returns the same table.
+        /// </summary>
+        /// <typeparam name="Create">Function that pushes an element</typeparam>
+        /// <param name="L">Lua state</param>
+        /// <param name="key">Name of the collection</param>
+        /// <param name="source">Function that returns the collection. Only called the first time.</param>
+        /// <returns>Stack change.</returns>
+        template <auto Create, typename Source>
+        int push_cached_list(lua_State* L, const char* key, Source&& source);
+
+        template <typename T>
+        using PropertyHandler = int (*)(lua_State* L, const std::shared_ptr<T>& self);
+
+        template <typename T>
+        struct Property
+        {
+            std::string_view name;
+            PropertyHandler<T> handler{ nullptr };
+        };
+
+        /// <summary>
+        /// Table of handlers for the properties of an element, used to implement __index and __newindex.
+        /// The names are placed with a perfect hash when the table is built at compile time, so finding
+        /// the handler for a key is one hash and one string compare.
+        /// </summary>
+        /// <typeparam name="T">Element type</typeparam>
+        /// <typeparam name="N">Number of properties</typeparam>
+        template <typename T, std::size_t N>
+        class Properties final
+        {
+        public:
+            static_assert(N > 0 && N < 255);
+
+            consteval explicit Properties(const Property<T>(&properties)[N]);
+            /// <summary>
+            /// Call the handler for the key at index 2 with the element at index 1.
+            /// </summary>
+            /// <returns>Stack change. Keys without a handler push nothing.</returns>
+            int call(lua_State* L) const;
+            constexpr const Property<T>* find(std::string_view name) const;
+        private:
+            static constexpr std::size_t Slots = std::bit_ceil(N * 4);
+            /// The slot is taken from the top bits of the hash, as the bottom bits of FNV-1a are poorly mixed.
+            static constexpr uint32_t Shift = 32 - std::countr_zero(Slots);
+
+            std::array<Property<T>, N> _properties{};
+            /// Index of the property in each slot plus one, or zero for an empty slot.
+            std::array<uint8_t, Slots> _slots{};
+            uint32_t _seed{ 0 };
+        };
+
+        template <typename T, std::size_t N>
+        consteval Properties<T, N> make_properties(const Property<T>(&properties)[N]);
+
         template <typename T>
         struct EnumValue
         {
@@ -69,6 +134,10 @@ namespace trview
         template <typename T>
         void create_enum(lua_State* L, const std::string& name, const std::vector<EnumValue<T>>& values);
 
+        /// <summary>
+        /// Push the userdata for an element. Elements that already have a userdata get the same one back and all
+        /// userdata with the same index function share a metatable.
+        /// </summary>
         template <typename T>
         int create(lua_State* L, const std::shared_ptr<T>& self, lua_CFunction index, lua_CFunction new_index);
 
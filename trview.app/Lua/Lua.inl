@@ -4,6 +4,156 @@ namespace trview
 {
     namespace lua
     {
+        namespace detail
+        {
+            /// Registry key for the table of element userdata, keyed by element address. Values are weak so
+            /// that an element's userdata can still be collected once scripts stop using it.
+            inline const char element_cache_key{};
+
+            template <typename T>
+            int destroy(lua_State* L)
+            {
+                static_cast<T*>(lua_touserdata(L, 1))->~T();
+                return 0;
+            }
+
+            template <auto Create, typename T>
+            int push_element(lua_State* L, const T& element)
+            {
+                if constexpr (requires { element.lock(); })
+                {
+                    return Create(L, element.lock());
+                }
+                else
+                {
+                    return Create(L, element);
+                }
+            }
+
+            template <auto Create, typename T>
+            int list_index(lua_State* L)
+            {
+                const auto& elements = *static_cast<std::vector<T>*>(lua_touserdata(L, lua_upvalueindex(1)));
+                int is_integer = 0;
+                const auto index = lua_tointegerx(L, 2, &is_integer);
+                if (!is_integer || index < 1 || index > static_cast<lua_Integer>(elements.size()))
+                {
+                    lua_pushnil(L);
+                    return 1;
+                }
+                return push_element<Create>(L, elements[index - 1]);
+            }
+
+            template <typename T>
+            int list_len(lua_State* L)
+            {
+                lua_pushinteger(L, static_cast<lua_Integer>(static_cast<std::vector<T>*>(lua_touserdata(L, lua_upvalueindex(1)))->size()));
+                return 1;
+            }
+
+            inline int list_next(lua_State* L)
+            {
+                const auto index = lua_isnil(L, 2) ? 1 : lua_tointeger(L, 2) + 1;
+                if (index > luaL_len(L, 1))
+                {
+                    lua_pushnil(L);
+                    return 1;
+                }
+                lua_pushinteger(L, index);
+                lua_geti(L, 1, index);
+                return 2;
+            }
+
+            inline int list_pairs(lua_State* L)
+            {
+                lua_pushcfunction(L, list_next);
+                lua_pushvalue(L, 1);
+                lua_pushnil(L);
+                return 3;
+            }
+
+            inline int list_newindex(lua_State* L)
+            {
+                return luaL_error(L, "Collection is read only");
+            }
+
+            constexpr uint32_t property_hash(std::string_view name, uint32_t seed)
+            {
+                uint32_t hash = 2166136261u ^ seed;
+                for (const char c : name)
+                {
+                    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+                }
+                return hash;
+            }
+        }
+
+        template <typename T, std::size_t N>
+        consteval Properties<T, N>::Properties(const Property<T>(&properties)[N])
+        {
+            std::copy(std::begin(properties), std::end(properties), _properties.begin());
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                for (std::size_t j = i + 1; j < N; ++j)
+                {
+                    if (_properties[i].name == _properties[j].name)
+                    {
+                        throw std::exception("Property names must be unique");
+                    }
+                }
+            }
+
+            // With four slots per name a seed that separates every name is usually found within a few tries.
+            for (bool placed = false; !placed; ++_seed)
+            {
+                _slots.fill(0);
+                placed = true;
+                for (std::size_t i = 0; i < N && placed; ++i)
+                {
+                    auto& slot = _slots[detail::property_hash(_properties[i].name, _seed) >> Shift];
+                    placed = slot == 0;
+                    slot = static_cast<uint8_t>(i + 1);
+                }
+            }
+            --_seed;
+        }
+
+        template <typename T, std::size_t N>
+        constexpr const Property<T>* Properties<T, N>::find(std::string_view name) const
+        {
+            const auto slot = _slots[detail::property_hash(name, _seed) >> Shift];
+            if (slot == 0 || _properties[slot - 1].name != name)
+            {
+                return nullptr;
+            }
+            return &_properties[slot - 1];
+        }
+
+        template <typename T, std::size_t N>
+        int Properties<T, N>::call(lua_State* L) const
+        {
+            luaL_checktype(L, 1, LUA_TUSERDATA);
+            if (lua_type(L, 2) != LUA_TSTRING)
+            {
+                return 0;
+            }
+
+            std::size_t length = 0;
+            const char* key = lua_tolstring(L, 2, &length);
+            const auto property = find({ key, length });
+            if (!property)
+            {
+                return 0;
+            }
+            return property->handler(L, *static_cast<std::shared_ptr<T>*>(lua_touserdata(L, 1)));
+        }
+
+        template <typename T, std::size_t N>
+        consteval Properties<T, N> make_properties(const Property<T>(&properties)[N])
+        {
+            return Properties<T, N>(properties);
+        }
+
         template <typename Func>
         int push_list_p(lua_State* L, std::ranges::input_range auto&& range, Func&& func)
         {
@@ -34,6 +184,55 @@ namespace trview
             return 1;
         }
 
+        template <auto Create, typename Source>
+        int push_cached_list(lua_State* L, const char* key, Source&& source)
+        {
+            if (lua_getiuservalue(L, 1, 1) != LUA_TTABLE)
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushvalue(L, -1);
+                lua_setiuservalue(L, 1, 1);
+            }
+
+            if (lua_getfield(L, -1, key) == LUA_TTABLE)
+            {
+                lua_remove(L, -2);
+                return 1;
+            }
+            lua_pop(L, 1);
+
+            // The elements are held by a userdata that the metamethods have as an upvalue, which leaves the table
+            // itself empty - so every read goes through __index and every write through __newindex.
+            using Elements = std::vector<std::ranges::range_value_t<std::invoke_result_t<Source>>>;
+            auto elements = static_cast<Elements*>(lua_newuserdatauv(L, sizeof(Elements), 0));
+            new (elements) Elements(source() | std::ranges::to<std::vector>());
+            lua_newtable(L);
+            lua_pushcfunction(L, detail::destroy<Elements>);
+            lua_setfield(L, -2, "__gc");
+            lua_setmetatable(L, -2);
+
+            lua_newtable(L);
+            lua_newtable(L);
+            lua_pushvalue(L, -3);
+            lua_pushcclosure(L, detail::list_index<Create, typename Elements::value_type>, 1);
+            lua_setfield(L, -2, "__index");
+            lua_pushvalue(L, -3);
+            lua_pushcclosure(L, detail::list_len<typename Elements::value_type>, 1);
+            lua_setfield(L, -2, "__len");
+            lua_pushcfunction(L, detail::list_pairs);
+            lua_setfield(L, -2, "__pairs");
+            lua_pushcfunction(L, detail::list_newindex);
+            lua_setfield(L, -2, "__newindex");
+            lua_setmetatable(L, -2);
+            lua_remove(L, -2);
+
+            lua_pushvalue(L, -1);
+            lua_setfield(L, -3, key);
+            lua_remove(L, -2);
+            return 1;
+        }
+
         template <typename T>
         void set_enum_value(lua_State* L, const EnumValue<T>& value)
         {
@@ -61,16 +260,54 @@ namespace trview
                 return 1;
             }
 
-            set_self(L, self);
+            if (lua_rawgetp(L, LUA_REGISTRYINDEX, &detail::element_cache_key) != LUA_TTABLE)
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_newtable(L);
+                lua_pushstring(L, "v");
+                lua_setfield(L, -2, "__mode");
+                lua_setmetatable(L, -2);
+                lua_pushvalue(L, -1);
+                lua_rawsetp(L, LUA_REGISTRYINDEX, &detail::element_cache_key);
+            }
 
-            lua_newtable(L);
             lua_pushcfunction(L, index);
-            lua_setfield(L, -2, "__index");
-            lua_pushcfunction(L, new_index);
-            lua_setfield(L, -2, "__newindex");
-            lua_pushcfunction(L, gc<T>);
-            lua_setfield(L, -2, "__gc");
+            if (lua_rawget(L, LUA_REGISTRYINDEX) != LUA_TTABLE)
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushcfunction(L, index);
+                lua_setfield(L, -2, "__index");
+                lua_pushcfunction(L, new_index);
+                lua_setfield(L, -2, "__newindex");
+                lua_pushcfunction(L, gc<T>);
+                lua_setfield(L, -2, "__gc");
+                lua_pushcfunction(L, index);
+                lua_pushvalue(L, -2);
+                lua_rawset(L, LUA_REGISTRYINDEX);
+            }
+
+            // Different types of element can have the same address, so only reuse the userdata if it is for the same type.
+            if (lua_rawgetp(L, -2, self.get()) == LUA_TUSERDATA && lua_getmetatable(L, -1))
+            {
+                const bool same_type = lua_rawequal(L, -1, -3);
+                lua_pop(L, 1);
+                if (same_type)
+                {
+                    lua_replace(L, -3);
+                    lua_pop(L, 1);
+                    return 1;
+                }
+            }
+            lua_pop(L, 1);
+
+            set_self(L, self);
+            lua_insert(L, -2);
             lua_setmetatable(L, -2);
+            lua_pushvalue(L, -1);
+            lua_rawsetp(L, -3, self.get());
+            lua_remove(L, -2);
             return 1;
         }
 
@@ -92,7 +329,7 @@ namespace trview
         void set_self(lua_State* L, const std::shared_ptr<T>& self)
         {
             using Ptr = std::shared_ptr<T>;
-            auto userdata = static_cast<Ptr*>(lua_newuserdata(L, sizeof(Ptr)));
+            auto userdata = static_cast<Ptr*>(lua_newuserdatauv(L, sizeof(Ptr), 1));
             new (userdata) Ptr(self);
         }
 
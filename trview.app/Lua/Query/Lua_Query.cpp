@@ -0,0 +1,317 @@
+#include "Lua_Query.h"
+#include "../Lua.h"
+#include "../Elements/Item/Lua_Item.h"
+#include "../Elements/Light/Lua_Light.h"
+#include "../Elements/Room/Lua_Room.h"
+#include "../Elements/Sector/Lua_Sector.h"
+#include "../Elements/StaticMesh/Lua_StaticMesh.h"
+#include "../Elements/Trigger/Lua_Trigger.h"
+#include "../../Elements/ElementFilters.h"
+#include "../../Elements/IRoom.h"
+#include "../../Filters/Filters.h"
+
+#include <trview.common/Strings.h>
+
+namespace trview
+{
+    namespace lua
+    {
+        namespace
+        {
+            struct Page
+            {
+                lua_Integer offset{ 0 };
+                std::optional<lua_Integer> limit;
+                bool count{ false };
+            };
+
+            constexpr std::pair<std::string_view, CompareOp> compare_ops[] =
+            {
+                { "equal", CompareOp::Equal },
+                { "notequal", CompareOp::NotEqual },
+                { "greaterthan", CompareOp::GreaterThan },
+                { "greaterthanorequal", CompareOp::GreaterThanOrEqual },
+                { "lessthan", CompareOp::LessThan },
+                { "lessthanorequal", CompareOp::LessThanOrEqual },
+                { "between", CompareOp::Between },
+                { "betweeninclusive", CompareOp::BetweenInclusive },
+                { "exists", CompareOp::Exists },
+                { "notexists", CompareOp::NotExists },
+                { "startswith", CompareOp::StartsWith },
+                { "endswith", CompareOp::EndsWith },
+                { "matches", CompareOp::Matches }
+            };
+
+            CompareOp to_compare_op(lua_State* L, const std::string& name)
+            {
+                const auto found = std::ranges::find(compare_ops, to_lowercase(name), &std::pair<std::string_view, CompareOp>::first);
+                if (found != std::ranges::end(compare_ops))
+                {
+                    return found->second;
+                }
+                luaL_error(L, "Unknown filter compare '%s'", name.c_str());
+                return CompareOp::Equal;
+            }
+
+            Op to_op(lua_State* L, const std::string& name)
+            {
+                const auto value = to_lowercase(name);
+                if (value == "and")
+                {
+                    return Op::And;
+                }
+                else if (value == "or")
+                {
+                    return Op::Or;
+                }
+                luaL_error(L, "Unknown filter op '%s'", name.c_str());
+                return Op::And;
+            }
+
+            /// Filters compare against strings, so numbers and booleans are converted the same way the filter window would enter them.
+            std::string to_filter_value(lua_State* L, int index)
+            {
+                switch (lua_type(L, index))
+                {
+                case LUA_TNIL:
+                    return {};
+                case LUA_TBOOLEAN:
+                    return lua_toboolean(L, index) ? "true" : "false";
+                case LUA_TNUMBER:
+                case LUA_TSTRING:
+                    return lua_tostring(L, index);
+                }
+                luaL_error(L, "Filter values must be strings, numbers or booleans");
+                return {};
+            }
+
+            Filters::Filter to_filter(lua_State* L, int index, const Filters& filters, const std::string& type_key)
+            {
+                index = lua_absindex(L, index);
+                luaL_checktype(L, index, LUA_TTABLE);
+
+                Filters::Filter filter;
+                if (LUA_TSTRING == lua_getfield(L, index, "key"))
+                {
+                    filter.key = lua_tostring(L, -1);
+                }
+                lua_pop(L, 1);
+
+                if (LUA_TSTRING == lua_getfield(L, index, "compare"))
+                {
+                    filter.compare = to_compare_op(L, lua_tostring(L, -1));
+                }
+                lua_pop(L, 1);
+
+                lua_getfield(L, index, "value");
+                filter.value = to_filter_value(L, -1);
+                lua_pop(L, 1);
+
+                lua_getfield(L, index, "value2");
+                filter.value2 = to_filter_value(L, -1);
+                lua_pop(L, 1);
+
+                if (LUA_TSTRING == lua_getfield(L, index, "op"))
+                {
+                    filter.op = to_op(L, lua_tostring(L, -1));
+                }
+                lua_pop(L, 1);
+
+                lua_getfield(L, index, "invert");
+                filter.invert = lua_toboolean(L, -1);
+                lua_pop(L, 1);
+
+                if (!filter.key.empty() && !std::ranges::contains(filters.keys(type_key), filter.key))
+                {
+                    luaL_error(L, "Unknown filter key '%s' for %s", filter.key.c_str(), type_key.c_str());
+                }
+
+                // The filter window fills in the type of a linked element when the key is picked, so do the same here.
+                if (LUA_TSTRING == lua_getfield(L, index, "type_key"))
+                {
+                    filter.type_key = lua_tostring(L, -1);
+                }
+                else if (!filter.key.empty())
+                {
+                    filter.type_key = filters.linked_type_key(type_key, filter.key);
+                }
+                lua_pop(L, 1);
+
+                if (LUA_TTABLE == lua_getfield(L, index, "children"))
+                {
+                    const auto child_type_key = filter.type_key.empty() ? type_key : filter.type_key;
+                    const lua_Integer count = luaL_len(L, -1);
+                    for (lua_Integer i = 1; i <= count; ++i)
+                    {
+                        lua_geti(L, -1, i);
+                        filter.children.push_back(to_filter(L, -1, filters, child_type_key));
+                        lua_pop(L, 1);
+                    }
+                }
+                lua_pop(L, 1);
+                return filter;
+            }
+
+            Page to_page(lua_State* L, int index)
+            {
+                Page page;
+                if (LUA_TNUMBER == lua_getfield(L, index, "offset"))
+                {
+                    page.offset = std::max<lua_Integer>(0, lua_tointeger(L, -1));
+                }
+                lua_pop(L, 1);
+
+                if (LUA_TNUMBER == lua_getfield(L, index, "limit"))
+                {
+                    page.limit = std::max<lua_Integer>(0, lua_tointeger(L, -1));
+                }
+                lua_pop(L, 1);
+
+                lua_getfield(L, index, "count");
+                page.count = lua_toboolean(L, -1);
+                lua_pop(L, 1);
+                return page;
+            }
+
+            /// Elements are only created for the matches that are returned, so a count or a page of a large level
+            /// doesn't allocate anything for the elements that are skipped.
+            template <typename T, typename Create>
+            int push_matches(lua_State* L, const Filters& filters, const std::vector<std::weak_ptr<T>>& elements, const Page& page, Create&& create)
+            {
+                if (page.count)
+                {
+                    lua_Integer count = 0;
+                    for (const auto& element : elements)
+                    {
+                        const auto element_ptr = element.lock();
+                        count += element_ptr && filters.match(*element_ptr);
+                    }
+                    lua_pushinteger(L, count);
+                    return 1;
+                }
+
+                lua_newtable(L);
+                lua_Integer skipped = 0;
+                lua_Integer found = 0;
+                for (const auto& element : elements)
+                {
+                    if (page.limit && found == *page.limit)
+                    {
+                        break;
+                    }
+
+                    const auto element_ptr = element.lock();
+                    if (!element_ptr || !filters.match(*element_ptr))
+                    {
+                        continue;
+                    }
+
+                    if (skipped < page.offset)
+                    {
+                        ++skipped;
+                        continue;
+                    }
+
+                    create(L, element_ptr);
+                    lua_seti(L, -2, ++found);
+                }
+                return 1;
+            }
+
+            std::vector<std::weak_ptr<ISector>> all_sectors(const ILevel& level)
+            {
+                std::vector<std::weak_ptr<ISector>> sectors;
+                for (const auto& room : level.rooms())
+                {
+                    if (const auto room_ptr = room.lock())
+                    {
+                        sectors.append_range(room_ptr->sectors());
+                    }
+                }
+                return sectors;
+            }
+        }
+
+        int query(lua_State* L, const std::shared_ptr<ILevel>& level, int index)
+        {
+            index = lua_absindex(L, index);
+            luaL_checktype(L, index, LUA_TTABLE);
+
+            if (!level)
+            {
+                return luaL_error(L, "No level to query");
+            }
+
+            if (LUA_TSTRING != lua_getfield(L, index, "elements"))
+            {
+                return luaL_error(L, "Query must have an elements name");
+            }
+            const std::string elements = lua_tostring(L, -1);
+            lua_pop(L, 1);
+
+            const std::unordered_map<std::string, std::string> type_keys
+            {
+                { "items", "Item" },
+                { "lights", "Light" },
+                { "rooms", "Room" },
+                { "sectors", "Sector" },
+                { "static_meshes", "StaticMesh" },
+                { "triggers", "Trigger" }
+            };
+
+            const auto type_key = type_keys.find(elements);
+            if (type_key == type_keys.end())
+            {
+                return luaL_error(L, "Unknown query elements '%s'", elements.c_str());
+            }
+
+            try
+            {
+                Filters filters;
+                add_all_filters(filters, level);
+                filters.set_type_key(type_key->second);
+
+                std::vector<Filters::Filter> conditions;
+                if (LUA_TTABLE == lua_getfield(L, index, "filters"))
+                {
+                    const lua_Integer count = luaL_len(L, -1);
+                    for (lua_Integer i = 1; i <= count; ++i)
+                    {
+                        lua_geti(L, -1, i);
+                        conditions.push_back(to_filter(L, -1, filters, type_key->second));
+                        lua_pop(L, 1);
+                    }
+                }
+                lua_pop(L, 1);
+                filters.set_filters(conditions);
+
+                const Page page = to_page(L, index);
+                if (elements == "items")
+                {
+                    return push_matches(L, filters, level->items(), page, create_item);
+                }
+                else if (elements == "lights")
+                {
+                    return push_matches(L, filters, level->lights(), page, create_light);
+                }
+                else if (elements == "rooms")
+                {
+                    return push_matches(L, filters, level->rooms(), page, create_room);
+                }
+                else if (elements == "sectors")
+                {
+                    return push_matches(L, filters, all_sectors(*level), page, create_sector);
+                }
+                else if (elements == "static_meshes")
+                {
+                    return push_matches(L, filters, level->static_meshes(), page, create_static_mesh);
+                }
+                return push_matches(L, filters, level->triggers(), page, create_trigger);
+            }
+            catch (const std::exception& e)
+            {
+                return luaL_error(L, "Query failed (%s)", e.what());
+            }
+        }
+    }
+}
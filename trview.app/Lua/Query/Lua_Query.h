@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../../Elements/ILevel.h"
+
+struct lua_State;
+
+namespace trview
+{
+    namespace lua
+    {
+        /// Find the elements of a level that match the query table at the index. Pushes a table of the matching
+        /// elements, or the number of matches if the query asks for a count.
+        int query(lua_State* L, const std::shared_ptr<ILevel>& level, int index);
+    }
+}
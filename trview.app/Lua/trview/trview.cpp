@@ -6,6 +6,7 @@
 #include "../Camera/Lua_Camera.h"
 #include "../Elements/Room/Lua_Room.h"
 #include "../Elements/Sector/Lua_Sector.h"
+#include "../Query/Lua_Query.h"
 #include "../Route/Lua_Route.h"
 #include "../Route/Lua_Waypoint.h"
 #include "../Colour.h"
@@ -13,6 +14,8 @@
 #include "../Scriptable/IScriptable.h"
 #include "Lua/Lua.h"
 
+#include <trview.common/WorkerPool.h>
+
 #include <future>
 
 namespace trview
@@ -21,23 +24,109 @@ namespace trview
     {
         namespace
         {
+            using OpenMode = trlevel::ILevel::LoadCallbacks::OpenMode;
+
+            /// Loads started by scripts share these threads, so a script that loads every level doesn't start a thread for each one.
+            WorkerPool& load_pool()
+            {
+                static WorkerPool pool(std::thread::hardware_concurrency());
+                return pool;
+            }
+
             struct LoadRequest
             {
+                std::string filename;
                 std::future<std::shared_ptr<ILevel>> level;
             };
             std::mutex request_mutex;
             std::vector<std::unique_ptr<LoadRequest>> active_requests;
 
+            /// Data only levels have no textures so they can't be opened in the viewer.
+            std::mutex data_only_mutex;
+            std::vector<std::weak_ptr<ILevel>> data_only_levels;
+
+            /// A set of levels being loaded by load_many. Levels are handed out in the order they finish loading.
+            struct BatchLoad
+            {
+                static constexpr const char* Name = "trview.BatchLoad";
+                std::vector<LoadRequest> pending;
+            };
+
+            LoadRequest start_load(IApplication* application, const std::string& filename, bool data_only)
+            {
+                return
+                {
+                    .filename = filename,
+                    .level = load_pool().submit([=]()
+                        {
+                            auto level = application->load(filename, data_only ? OpenMode::Lazy : OpenMode::Full);
+                            if (data_only)
+                            {
+                                std::lock_guard lock{ data_only_mutex };
+                                std::erase_if(data_only_levels, [](auto&& l) { return l.expired(); });
+                                data_only_levels.push_back(level);
+                            }
+                            return level;
+                        })
+                };
+            }
+
+            bool is_data_only(const std::shared_ptr<ILevel>& level)
+            {
+                std::lock_guard lock{ data_only_mutex };
+                return std::ranges::any_of(data_only_levels, [&](auto&& l) { return l.lock() == level; });
+            }
+
+            bool is_ready(const LoadRequest& request)
+            {
+                return request.level.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            }
+
+            /// Get the level from a finished request. Sets the error if the level failed to load.
+            std::shared_ptr<ILevel> take_level(LoadRequest& request, std::string& error)
+            {
+                try
+                {
+                    return request.level.get();
+                }
+                catch (trlevel::LevelEncryptedException&)
+                {
+                    error = std::format("Level is encrypted and cannot be loaded ({})", request.filename);
+                }
+                catch (std::exception&)
+                {
+                    error = std::format("Failed to load level ({})", request.filename);
+                }
+                return nullptr;
+            }
+
+            bool data_only_option(lua_State* L, int index)
+            {
+                if (!lua_istable(L, index))
+                {
+                    return false;
+                }
+                lua_getfield(L, index, "data_only");
+                const bool data_only = lua_toboolean(L, -1);
+                lua_pop(L, 1);
+                return data_only;
+            }
+
             int trview_yield_load(lua_State* L, int, lua_KContext context)
             {
                 LoadRequest* request = reinterpret_cast<LoadRequest*>(context);
-                if (request->level._Is_ready())
+                if (is_ready(*request))
                 {
-                    auto level = request->level.get();
+                    std::string error;
+                    auto level = take_level(*request, error);
                     {
                         std::lock_guard lock{ request_mutex };
                         std::erase_if(active_requests, [=](const auto& r) { return r.get() == request; });
                     }
+                    if (!level)
+                    {
+                        return luaL_error(L, "%s", error.c_str());
+                    }
                     return create_level(L, level);
                 }
                 return lua_yieldk(L, 0, context, trview_yield_load);
@@ -46,30 +135,110 @@ namespace trview
             int trview_load(lua_State* L)
             {
                 auto application = lua::get_self_raw<IApplication>(L);
+                const std::string filename = luaL_checkstring(L, 2);
+
+                auto request = std::make_unique<LoadRequest>(start_load(application, filename, data_only_option(L, 3)));
+                auto p = request.get();
+                {
+                    std::lock_guard lock{ request_mutex };
+                    active_requests.push_back(std::move(request));
+                }
+                return lua_yieldk(L, 0, reinterpret_cast<lua_KContext>(p), trview_yield_load);
+            }
 
-                luaL_checktype(L, -1, LUA_TSTRING);
-                const char* filename = lua_tostring(L, -1);
+            int load_many_next(lua_State* L, int, lua_KContext)
+            {
+                auto batch = static_cast<BatchLoad*>(luaL_checkudata(L, lua_upvalueindex(1), BatchLoad::Name));
+                if (batch->pending.empty())
+                {
+                    return 0;
+                }
 
-                try
+                auto ready = std::ranges::find_if(batch->pending, is_ready);
+                if (ready == batch->pending.end())
                 {
-                    auto request = std::make_unique<LoadRequest>();
-                    std::string file = filename;
-                    request->level = std::async(std::launch::async, [=]() { return application->load(file); });
-                    auto p = request.get();
+                    if (lua_isyieldable(L))
                     {
-                        std::lock_guard lock{ request_mutex };
-                        active_requests.push_back(std::move(request));
+                        return lua_yieldk(L, 0, 0, load_many_next);
                     }
-                    return lua_yieldk(L, 0, reinterpret_cast<lua_KContext>(p), trview_yield_load);
+                    // Outside of a coroutine there is nothing else to do but wait.
+                    ready = batch->pending.begin();
+                    ready->level.wait();
                 }
-                catch (trlevel::LevelEncryptedException&)
+
+                auto request = std::move(*ready);
+                batch->pending.erase(ready);
+
+                lua_pushstring(L, request.filename.c_str());
+                std::string error;
+                if (auto level = take_level(request, error))
                 {
-                    return luaL_error(L, "Level is encrypted and cannot be loaded (%s)", "");
+                    create_level(L, level);
+                    return 2;
                 }
-                catch (std::exception&)
+                lua_pushnil(L);
+                lua_pushstring(L, error.c_str());
+                return 3;
+            }
+
+            int load_many_iterator(lua_State* L)
+            {
+                return load_many_next(L, LUA_OK, 0);
+            }
+
+            int batch_load_gc(lua_State* L)
+            {
+                auto batch = static_cast<BatchLoad*>(luaL_checkudata(L, 1, BatchLoad::Name));
+                batch->~BatchLoad();
+                return 0;
+            }
+
+            int trview_load_many(lua_State* L)
+            {
+                auto application = lua::get_self_raw<IApplication>(L);
+                luaL_checktype(L, 2, LUA_TTABLE);
+                const bool data_only = data_only_option(L, 3);
+
+                auto batch = new (lua_newuserdatauv(L, sizeof(BatchLoad), 0)) BatchLoad();
+                if (luaL_newmetatable(L, BatchLoad::Name))
+                {
+                    lua_pushcfunction(L, batch_load_gc);
+                    lua_setfield(L, -2, "__gc");
+                }
+                lua_setmetatable(L, -2);
+
+                const lua_Integer count = luaL_len(L, 2);
+                batch->pending.reserve(static_cast<std::size_t>(count));
+                for (lua_Integer i = 1; i <= count; ++i)
+                {
+                    lua_geti(L, 2, i);
+                    if (const char* filename = lua_tostring(L, -1))
+                    {
+                        batch->pending.push_back(start_load(application, filename, data_only));
+                    }
+                    lua_pop(L, 1);
+                }
+
+                lua_pushcclosure(L, load_many_iterator, 1);
+                return 1;
+            }
+
+            int trview_query(lua_State* L)
+            {
+                auto application = lua::get_self_raw<IApplication>(L);
+                luaL_checktype(L, 2, LUA_TTABLE);
+
+                std::shared_ptr<ILevel> level;
+                if (LUA_TUSERDATA == lua_getfield(L, 2, "level"))
+                {
+                    level = to_level(L, -1);
+                }
+                else
                 {
-                    return luaL_error(L, "Failed to load level (%s)", "");
+                    level = application->current_level().lock();
                 }
+                lua_pop(L, 1);
+                return query(L, level, 2);
             }
 
             int trview_index(lua_State* L)
@@ -93,10 +262,25 @@ namespace trview
                     lua_pushcfunction(L, trview_load);
                     return 1;
                 }
+                else if (key == "load_concurrency")
+                {
+                    lua_pushinteger(L, load_pool().limit());
+                    return 1;
+                }
+                else if (key == "load_many")
+                {
+                    lua_pushcfunction(L, trview_load_many);
+                    return 1;
+                }
                 else if (key == "local_levels")
                 {
                     return push_list(L, application->local_levels(), push_string);
                 }
+                else if (key == "query")
+                {
+                    lua_pushcfunction(L, trview_query);
+                    return 1;
+                }
                 else if (key == "recent_files")
                 {
                     return push_list(L, application->settings().recent_files, push_string);
@@ -117,6 +301,11 @@ namespace trview
                 {
                     if (auto level = to_level(L, -1))
                     {
+                        if (is_data_only(level))
+                        {
+                            return luaL_error(L, "Level was loaded with data_only and cannot be opened");
+                        }
+
                         try
                         {
                             application->set_current_level(level, ILevel::OpenMode::Full, true);
@@ -131,6 +320,10 @@ namespace trview
                         }
                     }
                 }
+                else if (key == "load_concurrency")
+                {
+                    load_pool().set_limit(static_cast<uint32_t>(std::max<lua_Integer>(1, luaL_checkinteger(L, -1))));
+                }
                 else if (key == "route")
                 {
                     application->set_route(to_route(L, -1));
@@ -173,5 +366,10 @@ namespace trview
             waypoint_set_settings(settings);
             route_set_settings(settings);
         }
+
+        void cancel_loads()
+        {
+            load_pool().cancel();
+        }
     }
 }
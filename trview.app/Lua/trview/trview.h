@@ -27,5 +27,8 @@ namespace trview
             const std::shared_ptr<IDialogs>& dialogs,
             const std::shared_ptr<IFiles>& files);
         void set_settings(const UserSettings& settings);
+        /// Drop the script loads that haven't started and wait for the ones that are running, so that none of them
+        /// use the application once it has gone.
+        void cancel_loads();
     }
 }
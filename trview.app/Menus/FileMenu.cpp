@@ -280,4 +280,12 @@ namespace trview
             set_recent_files(settings->recent_files);
         }
     }
+
+    std::optional<std::vector<MessageType>> FileMenu::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
 }
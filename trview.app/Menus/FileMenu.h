@@ -32,6 +32,7 @@ namespace trview
         void set_sorting_mode(LevelSortingMode mode);
         void switch_to(const std::string& filename) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         void choose_file();
         void next_directory_file();
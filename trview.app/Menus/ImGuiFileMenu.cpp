@@ -122,4 +122,12 @@ namespace trview
             set_recent_files(settings->recent_diff_files);
         }
     }
+
+    std::optional<std::vector<MessageType>> ImGuiFileMenu::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
 }
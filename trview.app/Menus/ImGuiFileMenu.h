@@ -25,6 +25,7 @@ namespace trview
         void set_sorting_mode(LevelSortingMode mode);
         void switch_to(const std::string& filename) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         static const inline std::string default_file_pattern{ "\\*.TR2*,\\*.TR4*,\\*.TRC*,\\*.PHD,\\*.PSX,\\*.OBJ,\\*.TOM,\\*.SAT" };
         void sort_level_switcher();
@@ -7,26 +7,36 @@ namespace trview
     {
         namespace
         {
-            void get_message(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to, const std::string& name)
+            void get_message(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to, MessageType type)
             {
                 if (auto ms = messaging.lock())
                 {
-                    ms->send_message(Message{ .type = name, .data = std::make_shared<MessageData<std::weak_ptr<IRecipient>>>(reply_to) });
+                    ms->send_message(Message{ .type = type, .data = std::make_shared<MessageData<std::weak_ptr<IRecipient>>>(reply_to) });
                 }
             }
 
             template <typename T>
-            std::optional<T> read_message(const Message& message, const std::string& type)
+            const T* read_message_data(const Message& message, MessageType type)
             {
                 if (message.type != type)
                 {
-                    return std::nullopt;
+                    return nullptr;
                 }
-                return std::static_pointer_cast<MessageData<T>>(message.data)->value;
+                return &std::static_pointer_cast<MessageData<T>>(message.data)->value;
             }
 
             template <typename T>
-            void send_message(const std::weak_ptr<IMessageSystem>& messaging, const T& value, const std::string& type)
+            std::optional<T> read_message(const Message& message, MessageType type)
+            {
+                if (const auto value = read_message_data<T>(message, type))
+                {
+                    return *value;
+                }
+                return std::nullopt;
+            }
+
+            template <typename T>
+            void send_message(const std::weak_ptr<IMessageSystem>& messaging, const T& value, MessageType type)
             {
                 if (auto ms = messaging.lock())
                 {
@@ -39,353 +49,353 @@ namespace trview
         {
             std::optional<bool> read_route_open(const Message& message)
             {
-                return read_message<bool>(message, "route_open");
+                return read_message<bool>(message, types::route_open);
             }
 
             void send_route_open(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "route_open");
+                send_message(messaging, true, types::route_open);
             }
 
             std::optional<bool> read_route_reload(const Message& message)
             {
-                return read_message<bool>(message, "route_reload");
+                return read_message<bool>(message, types::route_reload);
             }
 
             void send_route_reload(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "route_reload");
+                send_message(messaging, true, types::route_reload);
             }
 
             std::optional<bool> read_route_save(const Message& message)
             {
-                return read_message<bool>(message, "route_save");
+                return read_message<bool>(message, types::route_save);
             }
 
             void send_route_save(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "route_save");
+                send_message(messaging, true, types::route_save);
             }
 
             std::optional<bool> read_route_save_as(const Message& message)
             {
-                return read_message<bool>(message, "route_save_as");
+                return read_message<bool>(message, types::route_save_as);
             }
 
             void send_route_save_as(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "route_save_as");
+                send_message(messaging, true, types::route_save_as);
             }
 
             std::optional<bool> read_new_route(const Message& message)
             {
-                return read_message<bool>(message, "new_route");
+                return read_message<bool>(message, types::new_route);
             }
 
             void send_new_route(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "new_route");
+                send_message(messaging, true, types::new_route);
             }
 
             std::optional<bool> read_new_randomizer_route(const Message& message)
             {
-                return read_message<bool>(message, "new_randomizer_route");
+                return read_message<bool>(message, types::new_randomizer_route);
             }
 
             void send_new_randomizer_route(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "new_randomizer_route");
+                send_message(messaging, true, types::new_randomizer_route);
             }
 
             std::optional<bool> read_unhide_all(const Message& message)
             {
-                return read_message<bool>(message, "unhide_all");
+                return read_message<bool>(message, types::unhide_all);
             }
 
             void send_unhide_all(const std::weak_ptr<IMessageSystem>& messaging)
             {
-                send_message(messaging, true, "unhide_all");
+                send_message(messaging, true, types::unhide_all);
             }
         }
 
         void get_settings(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_settings");
+            get_message(messaging, reply_to, types::get_settings);
         }
 
-        std::optional<UserSettings> read_settings(const Message& message)
+        const UserSettings* read_settings(const Message& message)
         {
-            return read_message<UserSettings>(message, "settings");
+            return read_message_data<UserSettings>(message, types::settings);
         }
 
         void send_settings(const std::weak_ptr<IMessageSystem>& messaging, const UserSettings& settings)
         {
-            send_message(messaging, settings, "settings");
+            send_message(messaging, settings, types::settings);
         }
 
         std::optional<RouteMessage> read_add_to_route(const Message& message)
         {
-            return read_message<RouteMessage>(message, "add_to_route");
+            return read_message<RouteMessage>(message, types::add_to_route);
         }
 
         void send_add_to_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IItem>& item)
         {
-            send_message(messaging, RouteMessage{ .element = item }, "add_to_route");
+            send_message(messaging, RouteMessage{ .element = item }, types::add_to_route);
         }
 
         void send_add_to_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ITrigger>& trigger)
         {
-            send_message(messaging, RouteMessage{ .element = trigger }, "add_to_route");
+            send_message(messaging, RouteMessage{ .element = trigger }, types::add_to_route);
         }
 
         void send_add_to_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ILight>& light)
         {
-            send_message(messaging, RouteMessage{ .element = light }, "add_to_route");
+            send_message(messaging, RouteMessage{ .element = light }, types::add_to_route);
         }
 
         void send_add_to_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ICameraSink>& camera_sink)
         {
-            send_message(messaging, RouteMessage{ .element = camera_sink }, "add_to_route");
+            send_message(messaging, RouteMessage{ .element = camera_sink }, types::add_to_route);
         }
 
         std::optional<bool> read_ng_plus(const Message& message)
         {
-            return read_message<bool>(message, "ng_plus");
+            return read_message<bool>(message, types::ng_plus);
         }
 
         void send_ng_plus(const std::weak_ptr<IMessageSystem>& messaging, bool value)
         {
-            send_message(messaging, value, "ng_plus");
+            send_message(messaging, value, types::ng_plus);
         }
 
         void get_open_level(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_open_level");
+            get_message(messaging, reply_to, types::get_open_level);
         }
 
         std::optional<std::weak_ptr<ILevel>> read_open_level(const Message& message)
         {
-            return read_message<std::weak_ptr<ILevel>>(message, "open_level");
+            return read_message<std::weak_ptr<ILevel>>(message, types::open_level);
         }
 
         void send_open_level(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ILevel>& level)
         {
-            send_message(messaging, level, "open_level");
+            send_message(messaging, level, types::open_level);
         }
 
         std::optional<std::string> read_open_level_filename(const Message& message)
         {
-            return read_message<std::string>(message, "open_level_filename");
+            return read_message<std::string>(message, types::open_level_filename);
         }
 
         void send_open_level_filename(const std::weak_ptr<IMessageSystem>& messaging, const std::string& path)
         {
-            send_message(messaging, path, "open_level_filename");
+            send_message(messaging, path, types::open_level_filename);
         }
 
         std::optional<std::string> read_switch_level_filename(const Message& message)
         {
-            return read_message<std::string>(message, "switch_level_filename");
+            return read_message<std::string>(message, types::switch_level_filename);
         }
 
         void send_switch_level_filename(const std::weak_ptr<IMessageSystem>& messaging, const std::string& path)
         {
-            send_message(messaging, path, "switch_level_filename");
+            send_message(messaging, path, types::switch_level_filename);
         }
 
         std::optional<std::weak_ptr<ILevel>> read_end_diff(const Message& message)
         {
-            return read_message<std::weak_ptr<ILevel>>(message, "end_diff");
+            return read_message<std::weak_ptr<ILevel>>(message, types::end_diff);
         }
 
         void send_end_diff(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ILevel>& level)
         {
-            send_message(messaging, level, "end_diff");
+            send_message(messaging, level, types::end_diff);
         }
 
         std::optional<std::weak_ptr<ISector>> read_hover_sector(const Message& message)
         {
-            return read_message<std::weak_ptr<ISector>>(message, "hover_sector");
+            return read_message<std::weak_ptr<ISector>>(message, types::hover_sector);
         }
 
         void send_hover_sector(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ISector>& sector)
         {
-            send_message(messaging, sector, "hover_sector");
+            send_message(messaging, sector, types::hover_sector);
         }
 
         void get_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_route");
+            get_message(messaging, reply_to, types::get_route);
         }
 
         std::optional<std::weak_ptr<IRoute>> read_route(const Message& message)
         {
-            return read_message<std::weak_ptr<IRoute>>(message, "route");
+            return read_message<std::weak_ptr<IRoute>>(message, types::route);
         }
 
         void send_route(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRoute>& route)
         {
-            send_message(messaging, route, "route");
+            send_message(messaging, route, types::route);
         }
 
         std::optional<bool> read_route_window_opened(const Message& message)
         {
-            return read_message<bool>(message, "route_window_opened");
+            return read_message<bool>(message, types::route_window_opened);
         }
 
         void send_route_window_opened(const std::weak_ptr<IMessageSystem>& messaging)
         {
-            send_message(messaging, true, "route_window_opened");
+            send_message(messaging, true, types::route_window_opened);
         }
 
         void get_selected_camera_sink(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_camera_sink");
+            get_message(messaging, reply_to, types::get_selected_camera_sink);
         }
 
         std::optional<std::weak_ptr<ICameraSink>> read_select_camera_sink(const Message& message)
         {
-            return read_message<std::weak_ptr<ICameraSink>>(message, "select_camera_sink");
+            return read_message<std::weak_ptr<ICameraSink>>(message, types::select_camera_sink);
         }
 
         void send_select_camera_sink(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ICameraSink>& camera_sink)
         {
-            send_message(messaging, camera_sink, "select_camera_sink");
+            send_message(messaging, camera_sink, types::select_camera_sink);
         }
 
         void get_selected_item(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_item");
+            get_message(messaging, reply_to, types::get_selected_item);
         }
 
         std::optional<std::weak_ptr<IItem>> read_select_item(const Message& message)
         {
-            return read_message<std::weak_ptr<IItem>>(message, "select_item");
+            return read_message<std::weak_ptr<IItem>>(message, types::select_item);
         }
 
         void send_select_item(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IItem>& item)
         {
-            send_message(messaging, item, "select_item");
+            send_message(messaging, item, types::select_item);
         }
 
         void get_selected_flyby_node(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_flyby_node");
+            get_message(messaging, reply_to, types::get_selected_flyby_node);
         }
 
         std::optional<std::weak_ptr<IFlybyNode>> read_select_flyby_node(const Message& message)
         {
-            return read_message<std::weak_ptr<IFlybyNode>>(message, "select_flyby_node");
+            return read_message<std::weak_ptr<IFlybyNode>>(message, types::select_flyby_node);
         }
 
         void send_select_flyby_node(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IFlybyNode>& flyby_node)
         {
-            send_message(messaging, flyby_node, "select_flyby_node");
+            send_message(messaging, flyby_node, types::select_flyby_node);
         }
 
         void get_selected_light(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_light");
+            get_message(messaging, reply_to, types::get_selected_light);
         }
 
         std::optional<std::weak_ptr<ILight>> read_select_light(const Message& message)
         {
-            return read_message<std::weak_ptr<ILight>>(message, "select_light");
+            return read_message<std::weak_ptr<ILight>>(message, types::select_light);
         }
 
         void send_select_light(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ILight>& light)
         {
-            send_message(messaging, light, "select_light");
+            send_message(messaging, light, types::select_light);
         }
 
         void get_selected_room(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_room");
+            get_message(messaging, reply_to, types::get_selected_room);
         }
 
         std::optional<std::weak_ptr<IRoom>> read_select_room(const Message& message)
         {
-            return read_message<std::weak_ptr<IRoom>>(message, "select_room");
+            return read_message<std::weak_ptr<IRoom>>(message, types::select_room);
         }
 
         void send_select_room(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRoom>& room)
         {
-            send_message(messaging, room, "select_room");
+            send_message(messaging, room, types::select_room);
         }
 
         void get_selected_sector(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_sector");
+            get_message(messaging, reply_to, types::get_selected_sector);
         }
 
         std::optional<std::weak_ptr<ISector>> read_select_sector(const Message& message)
         {
-            return read_message<std::weak_ptr<ISector>>(message, "select_sector");
+            return read_message<std::weak_ptr<ISector>>(message, types::select_sector);
         }
 
         void send_select_sector(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ISector>& sector)
         {
-            send_message(messaging, sector, "select_sector");
+            send_message(messaging, sector, types::select_sector);
         }
 
         void get_selected_sound_source(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_sound_source");
+            get_message(messaging, reply_to, types::get_selected_sound_source);
         }
 
         std::optional<std::weak_ptr<ISoundSource>> read_select_sound_source(const Message& message)
         {
-            return read_message<std::weak_ptr<ISoundSource>>(message, "select_sound_source");
+            return read_message<std::weak_ptr<ISoundSource>>(message, types::select_sound_source);
         }
 
         void send_select_sound_source(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ISoundSource>& sound_source)
         {
-            send_message(messaging, sound_source, "select_sound_source");
+            send_message(messaging, sound_source, types::select_sound_source);
         }
 
         void get_selected_static_mesh(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_static_mesh");
+            get_message(messaging, reply_to, types::get_selected_static_mesh);
         }
 
         std::optional<std::weak_ptr<IStaticMesh>> read_select_static_mesh(const Message& message)
         {
-            return read_message<std::weak_ptr<IStaticMesh>>(message, "select_static_mesh");
+            return read_message<std::weak_ptr<IStaticMesh>>(message, types::select_static_mesh);
         }
 
         void send_select_static_mesh(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IStaticMesh>& static_mesh)
         {
-            send_message(messaging, static_mesh, "select_static_mesh");
+            send_message(messaging, static_mesh, types::select_static_mesh);
         }
 
         void get_selected_trigger(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_trigger");
+            get_message(messaging, reply_to, types::get_selected_trigger);
         }
 
         std::optional<std::weak_ptr<ITrigger>> read_select_trigger(const Message& message)
         {
-            return read_message<std::weak_ptr<ITrigger>>(message, "select_trigger");
+            return read_message<std::weak_ptr<ITrigger>>(message, types::select_trigger);
         }
 
         void send_select_trigger(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<ITrigger>& trigger)
         {
-            send_message(messaging, trigger, "select_trigger");
+            send_message(messaging, trigger, types::select_trigger);
         }
 
         void get_selected_waypoint(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to)
         {
-            get_message(messaging, reply_to, "get_selected_waypoint");
+            get_message(messaging, reply_to, types::get_selected_waypoint);
         }
 
         std::optional<std::weak_ptr<IWaypoint>> read_select_waypoint(const Message& message)
         {
-            return read_message<std::weak_ptr<IWaypoint>>(message, "select_waypoint");
+            return read_message<std::weak_ptr<IWaypoint>>(message, types::select_waypoint);
         }
 
         void send_select_waypoint(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IWaypoint>& waypoint)
         {
-            send_message(messaging, waypoint, "select_waypoint");
+            send_message(messaging, waypoint, types::select_waypoint);
         }
     }
 }
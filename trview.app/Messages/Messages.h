@@ -3,6 +3,7 @@
 #include <optional>
 #include <memory>
 #include <variant>
+#include <trview.common/Messages/Message.h>
 
 namespace trview
 {
@@ -20,11 +21,56 @@ namespace trview
     struct IStaticMesh;
     struct ITrigger;
     struct IWaypoint;
-    struct Message;
     struct UserSettings;
 
     namespace messages
     {
+        namespace types
+        {
+            inline constexpr MessageType add_to_route{ "add_to_route" };
+            inline constexpr MessageType end_diff{ "end_diff" };
+            inline constexpr MessageType get_open_level{ "get_open_level" };
+            inline constexpr MessageType get_route{ "get_route" };
+            inline constexpr MessageType get_selected_camera_sink{ "get_selected_camera_sink" };
+            inline constexpr MessageType get_selected_flyby_node{ "get_selected_flyby_node" };
+            inline constexpr MessageType get_selected_item{ "get_selected_item" };
+            inline constexpr MessageType get_selected_light{ "get_selected_light" };
+            inline constexpr MessageType get_selected_room{ "get_selected_room" };
+            inline constexpr MessageType get_selected_sector{ "get_selected_sector" };
+            inline constexpr MessageType get_selected_sound_source{ "get_selected_sound_source" };
+            inline constexpr MessageType get_selected_static_mesh{ "get_selected_static_mesh" };
+            inline constexpr MessageType get_selected_trigger{ "get_selected_trigger" };
+            inline constexpr MessageType get_selected_waypoint{ "get_selected_waypoint" };
+            inline constexpr MessageType get_settings{ "get_settings" };
+            inline constexpr MessageType hover_sector{ "hover_sector" };
+            inline constexpr MessageType item_filters{ "item_filters" };
+            inline constexpr MessageType new_randomizer_route{ "new_randomizer_route" };
+            inline constexpr MessageType new_route{ "new_route" };
+            inline constexpr MessageType ng_plus{ "ng_plus" };
+            inline constexpr MessageType open_level{ "open_level" };
+            inline constexpr MessageType open_level_filename{ "open_level_filename" };
+            inline constexpr MessageType room_filters{ "room_filters" };
+            inline constexpr MessageType route{ "route" };
+            inline constexpr MessageType route_open{ "route_open" };
+            inline constexpr MessageType route_reload{ "route_reload" };
+            inline constexpr MessageType route_save{ "route_save" };
+            inline constexpr MessageType route_save_as{ "route_save_as" };
+            inline constexpr MessageType route_window_opened{ "route_window_opened" };
+            inline constexpr MessageType select_camera_sink{ "select_camera_sink" };
+            inline constexpr MessageType select_flyby_node{ "select_flyby_node" };
+            inline constexpr MessageType select_item{ "select_item" };
+            inline constexpr MessageType select_light{ "select_light" };
+            inline constexpr MessageType select_room{ "select_room" };
+            inline constexpr MessageType select_sector{ "select_sector" };
+            inline constexpr MessageType select_sound_source{ "select_sound_source" };
+            inline constexpr MessageType select_static_mesh{ "select_static_mesh" };
+            inline constexpr MessageType select_trigger{ "select_trigger" };
+            inline constexpr MessageType select_waypoint{ "select_waypoint" };
+            inline constexpr MessageType settings{ "settings" };
+            inline constexpr MessageType switch_level_filename{ "switch_level_filename" };
+            inline constexpr MessageType unhide_all{ "unhide_all" };
+        }
+
         struct RouteMessage
         {
             // TODO: Interfaces
@@ -56,7 +102,8 @@ namespace trview
         }
 
         void get_settings(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IRecipient>& reply_to);
-        std::optional<UserSettings> read_settings(const Message& message);
+        /// The settings are shared by every recipient of the message, so they are only valid while the message is.
+        const UserSettings* read_settings(const Message& message);
         void send_settings(const std::weak_ptr<IMessageSystem>& messaging, const UserSettings& settings);
 
         std::optional<RouteMessage> read_add_to_route(const Message& message);
@@ -132,7 +179,7 @@ namespace trview
         void send_select_waypoint(const std::weak_ptr<IMessageSystem>& messaging, const std::weak_ptr<IWaypoint>& trigger);
 
         template <typename T>
-        void reply_to(const Message& message, const std::string& type, T&& data);
+        void reply_to(const Message& message, MessageType type, T&& data);
     }
 }
 
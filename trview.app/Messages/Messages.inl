@@ -7,7 +7,7 @@ namespace trview
     namespace messages
     {
         template <typename T>
-        void reply_to(const Message& message, const std::string& type, T&& data)
+        void reply_to(const Message& message, MessageType type, T&& data)
         {
             if (auto requester = std::static_pointer_cast<MessageData<std::weak_ptr<IRecipient>>>(message.data)->value.lock())
             {
@@ -39,6 +39,7 @@ namespace trview
             MOCK_METHOD(bool, is_remastered_extra, (), (const, override));
             MOCK_METHOD(void, set_remastered_extra, (bool), (override));
             MOCK_METHOD(int32_t, filterable_index, (), (const, override));
+            MOCK_METHOD(void, set_animation, (const std::shared_ptr<const IAnimationEngine>&, uint32_t), (override));
 
             bool _visible_state;
 
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../../Geometry/Model/IAnimationEngine.h"
+
+namespace trview
+{
+    namespace mocks
+    {
+        struct MockAnimationEngine : public IAnimationEngine
+        {
+            MockAnimationEngine();
+            virtual ~MockAnimationEngine();
+            MOCK_METHOD(std::optional<uint32_t>, add, (uint32_t), (override));
+            MOCK_METHOD(void, update, (float, std::span<const uint32_t>), (override));
+            MOCK_METHOD(std::span<const DirectX::SimpleMath::Matrix>, pose, (uint32_t), (const, override));
+        };
+    }
+}
\ No newline at end of file
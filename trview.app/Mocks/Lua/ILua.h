@@ -14,6 +14,7 @@ namespace trview
             MOCK_METHOD(void, execute, (const std::string&), (override));
             MOCK_METHOD(void, initialise, (IApplication*), (override));
             MOCK_METHOD(void, set_directory, (const std::string&), (override));
+            MOCK_METHOD(uint64_t, instructions, (), (const, override));
         };
     }
 }
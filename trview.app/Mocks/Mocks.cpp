@@ -17,6 +17,7 @@
 #include "Elements/ILevelNameLookup.h"
 #include "Filters/IFilterStore.h"
 #include "Filters/IFilterable.h"
+#include "Geometry/IAnimationEngine.h"
 #include "Geometry/IMesh.h"
 #include "Geometry/IPicking.h"
 #include "Geometry/ITransparencyBuffer.h"
@@ -35,6 +36,7 @@
 #include "Settings/ISettingsLoader.h"
 #include "Settings/IStartupOptions.h"
 #include "Sound/ISound.h"
+#include "Sound/ISoundMixer.h"
 #include "Sound/ISoundStorage.h"
 #include "Tools/ICompass.h"
 #include "Tools/IMeasure.h"
@@ -198,6 +200,9 @@ namespace trview
         MockSound::MockSound() {};
         MockSound::~MockSound() {};
 
+        MockSoundMixer::MockSoundMixer() {};
+        MockSoundMixer::~MockSoundMixer() {};
+
         MockNgPlusSwitcher::MockNgPlusSwitcher() {};
         MockNgPlusSwitcher::~MockNgPlusSwitcher() {};
 
@@ -207,6 +212,9 @@ namespace trview
         MockModelStorage::MockModelStorage() {};
         MockModelStorage::~MockModelStorage() {};
 
+        MockAnimationEngine::MockAnimationEngine() {};
+        MockAnimationEngine::~MockAnimationEngine() {};
+
         MockFlyby::MockFlyby() {};
         MockFlyby::~MockFlyby() {};
 
@@ -17,7 +17,9 @@ namespace trview
             MOCK_METHOD(bool, enabled, (), (const, override));
             MOCK_METHOD(void, initialise, (IApplication*), (override));
             MOCK_METHOD(std::string, path, (), (const, override));
-            MOCK_METHOD(std::string, messages, (), (const, override));
+            MOCK_METHOD(std::vector<MessageBuffer::Line>, messages_since, (uint64_t), (const, override));
+            MOCK_METHOD(uint64_t, first_message_sequence, (), (const, override));
+            MOCK_METHOD(void, set_message_capacity, (std::size_t), (override));
             MOCK_METHOD(void, execute, (const std::string&), (override));
             MOCK_METHOD(void, add_message, (const std::string&), (override));
             MOCK_METHOD(void, do_file, (const std::string&), (override));
@@ -26,6 +28,9 @@ namespace trview
             MOCK_METHOD(void, render_toolbar, (), (override));
             MOCK_METHOD(void, render_ui, (), (override));
             MOCK_METHOD(void, set_enabled, (bool), (override));
+            MOCK_METHOD(Profile, profile, (), (const, override));
+            MOCK_METHOD(void, reset_profile, (), (override));
+            MOCK_METHOD(void, end_frame, (std::chrono::nanoseconds, bool), (override));
         };
     }
 }
\ No newline at end of file
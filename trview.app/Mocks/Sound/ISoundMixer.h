@@ -0,0 +1,17 @@
+#pragma once
+
+#include "../../Sound/ISoundMixer.h"
+
+namespace trview
+{
+    namespace mocks
+    {
+        struct MockSoundMixer : public ISoundMixer
+        {
+            MockSoundMixer();
+            virtual ~MockSoundMixer();
+            MOCK_METHOD(bool, play, (const std::shared_ptr<const std::vector<uint8_t>>&), (override));
+            MOCK_METHOD(void, stop, (), (override));
+        };
+    }
+}
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <trview.common/Event.h>
+#include "MessageBuffer.h"
 
 namespace trview
 {
@@ -11,6 +13,33 @@ namespace trview
     {
         using Source = std::function<std::shared_ptr<IPlugin>(const std::string& directory)>;
 
+        /// Time spent and Lua instructions run by a plugin.
+        struct Timing
+        {
+            std::chrono::nanoseconds time{ 0 };
+            uint64_t instructions{ 0 };
+            uint32_t calls{ 0 };
+
+            Timing& operator+=(const Timing& other);
+        };
+
+        /// Accounting for the plugin since it was loaded or the profile was reset.
+        struct Profile
+        {
+            Timing render_ui;
+            Timing render_toolbar;
+            /// Console commands and files run from the console.
+            Timing execute;
+            /// set_enabled and Lua callbacks run outside of the other calls, such as scriptable clicks. Callbacks
+            /// are not timed, only their instructions are counted.
+            Timing callbacks;
+            /// Everything run in the last complete frame.
+            Timing last_frame;
+            uint32_t frames{ 0 };
+            uint32_t frames_over_budget{ 0 };
+            uint32_t frames_skipped{ 0 };
+        };
+
         virtual ~IPlugin() = 0;
         virtual bool built_in() const = 0;
         virtual std::string name() const = 0;
@@ -19,7 +48,12 @@ namespace trview
         virtual bool enabled() const = 0;
         virtual void initialise(IApplication* application) = 0;
         virtual std::string path() const = 0;
-        virtual std::string messages() const = 0;
+        /// Console lines with a sequence number after the one given.
+        virtual std::vector<MessageBuffer::Line> messages_since(uint64_t sequence) const = 0;
+        /// Sequence number of the oldest console line still kept. Lines before this have been dropped or cleared.
+        virtual uint64_t first_message_sequence() const = 0;
+        /// Change the most console lines kept.
+        virtual void set_message_capacity(std::size_t capacity) = 0;
         virtual void execute(const std::string& command) = 0;
         virtual void add_message(const std::string& message) = 0;
         virtual void do_file(const std::string& path) = 0;
@@ -28,6 +62,14 @@ namespace trview
         virtual void render_toolbar() = 0;
         virtual void render_ui() = 0;
         virtual void set_enabled(bool value) = 0;
+        virtual Profile profile() const = 0;
+        virtual void reset_profile() = 0;
+        /// <summary>
+        /// Finish the accounting for the current frame and start the next one.
+        /// </summary>
+        /// <param name="budget">Most time the plugin should take in a frame, or zero for no budget.</param>
+        /// <param name="skip">Whether a plugin that went over the budget should skip its UI callbacks for enough frames to bring its average back under the budget.</param>
+        virtual void end_frame(std::chrono::nanoseconds budget, bool skip) = 0;
 
         Event<std::string> on_message;
     };
@@ -0,0 +1,103 @@
+#include "MessageBuffer.h"
+
+namespace trview
+{
+    MessageBuffer::MessageBuffer(std::size_t capacity)
+        : _capacity(std::max<std::size_t>(1, capacity))
+    {
+    }
+
+    void MessageBuffer::add(std::string_view message)
+    {
+        std::size_t start = 0;
+        std::size_t end = message.find('\n');
+        while (end != std::string_view::npos)
+        {
+            store(message.substr(start, end - start));
+            start = end + 1;
+            end = message.find('\n', start);
+        }
+        store(message.substr(start));
+    }
+
+    void MessageBuffer::clear()
+    {
+        _lines.clear();
+        _first_sequence = _next_sequence;
+    }
+
+    std::size_t MessageBuffer::capacity() const
+    {
+        return _capacity;
+    }
+
+    void MessageBuffer::set_capacity(std::size_t capacity)
+    {
+        capacity = std::max<std::size_t>(1, capacity);
+        if (capacity == _capacity)
+        {
+            return;
+        }
+
+        // Lines move to different slots with a different capacity, so lay out the ones being kept again.
+        const auto kept = lines_since(_next_sequence - 1 - std::min(size(), capacity));
+        _capacity = capacity;
+        _lines.clear();
+        _first_sequence = _next_sequence - kept.size();
+        for (const auto& line : kept)
+        {
+            slot(line.sequence) = line.text;
+        }
+    }
+
+    std::size_t MessageBuffer::size() const
+    {
+        return static_cast<std::size_t>(_next_sequence - _first_sequence);
+    }
+
+    uint64_t MessageBuffer::first_sequence() const
+    {
+        return _first_sequence;
+    }
+
+    std::vector<MessageBuffer::Line> MessageBuffer::lines_since(uint64_t sequence) const
+    {
+        std::vector<Line> lines;
+        const uint64_t start = std::max(sequence + 1, _first_sequence);
+        if (start >= _next_sequence)
+        {
+            return lines;
+        }
+
+        lines.reserve(static_cast<std::size_t>(_next_sequence - start));
+        for (uint64_t s = start; s < _next_sequence; ++s)
+        {
+            lines.push_back({ .sequence = s, .text = _lines[(s - 1) % _capacity] });
+        }
+        return lines;
+    }
+
+    void MessageBuffer::store(std::string_view text)
+    {
+        if (text.ends_with('\r'))
+        {
+            text.remove_suffix(1);
+        }
+
+        slot(_next_sequence++) = text;
+        if (size() > _capacity)
+        {
+            _first_sequence = _next_sequence - _capacity;
+        }
+    }
+
+    std::string& MessageBuffer::slot(uint64_t sequence)
+    {
+        const auto index = static_cast<std::size_t>((sequence - 1) % _capacity);
+        if (index >= _lines.size())
+        {
+            _lines.resize(index + 1);
+        }
+        return _lines[index];
+    }
+}
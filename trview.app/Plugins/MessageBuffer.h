@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace trview
+{
+    /// Keeps the most recent lines written to a plugin console in a fixed size ring. Each line has a sequence number
+    /// so readers can ask for only the lines added since they last looked.
+    class MessageBuffer final
+    {
+    public:
+        struct Line
+        {
+            uint64_t sequence{ 0 };
+            std::string text;
+
+            bool operator==(const Line& other) const = default;
+        };
+
+        static constexpr std::size_t DefaultCapacity = 10000;
+
+        explicit MessageBuffer(std::size_t capacity = DefaultCapacity);
+        /// Add a message. A message with more than one line takes a slot for each line.
+        void add(std::string_view message);
+        void clear();
+        std::size_t capacity() const;
+        /// Change the most lines kept. The newest lines are kept when the capacity goes down.
+        void set_capacity(std::size_t capacity);
+        std::size_t size() const;
+        /// Sequence number of the oldest line still kept. Lines before this have been dropped or cleared.
+        uint64_t first_sequence() const;
+        /// Lines with a sequence number after the one given.
+        std::vector<Line> lines_since(uint64_t sequence) const;
+    private:
+        void store(std::string_view text);
+        std::string& slot(uint64_t sequence);
+
+        /// Line for each sequence number is at (sequence - 1) % capacity. Grows to the capacity as lines are added.
+        std::vector<std::string> _lines;
+        std::size_t _capacity;
+        uint64_t _first_sequence{ 1 };
+        uint64_t _next_sequence{ 1 };
+    };
+}
@@ -4,10 +4,24 @@
 
 namespace trview
 {
+    namespace
+    {
+        /// A plugin that goes a long way over the budget once, such as when a level is loaded, shouldn't stop for too long.
+        constexpr uint32_t max_frames_to_skip = 60;
+    }
+
     IPlugin::~IPlugin()
     {
     }
 
+    IPlugin::Timing& IPlugin::Timing::operator+=(const Timing& other)
+    {
+        time += other.time;
+        instructions += other.instructions;
+        calls += other.calls;
+        return *this;
+    }
+
     Plugin::Plugin(std::unique_ptr<ILua> lua, const std::string& name, const std::string& author, const std::string& description)
         : _lua(std::move(lua)), _name(name), _author(author), _description(description), _built_in(true)
     {
@@ -65,31 +79,39 @@ namespace trview
         _lua->initialise(application);
         set_package_path();
         load_script();
+        // Loading the script isn't part of the cost of any frame, and a reloaded plugin starts again.
+        reset_profile();
+    }
+
+    std::vector<MessageBuffer::Line> Plugin::messages_since(uint64_t sequence) const
+    {
+        return _messages.lines_since(sequence);
+    }
+
+    uint64_t Plugin::first_message_sequence() const
+    {
+        return _messages.first_sequence();
     }
 
-    std::string Plugin::messages() const
+    void Plugin::set_message_capacity(std::size_t capacity)
     {
-        return _messages;
+        _messages.set_capacity(capacity);
     }
 
     void Plugin::execute(const std::string& command)
     {
-        _lua->execute(command);
+        measure(_profile.execute, [&]() { _lua->execute(command); });
     }
 
     void Plugin::add_message(const std::string& message)
     {
-        if (!_messages.empty())
-        {
-            _messages += '\n';
-        }
-        _messages += message;
+        _messages.add(message);
         on_message(message);
     }
 
     void Plugin::do_file(const std::string& path)
     {
-        _lua->do_file(path);
+        measure(_profile.execute, [&]() { _lua->do_file(path); });
     }
 
     void Plugin::clear_messages()
@@ -143,22 +165,22 @@ namespace trview
 
     void Plugin::render_toolbar()
     {
-        if (!_enabled)
+        if (!_enabled || _frames_to_skip)
         {
             return;
         }
 
-        _lua->execute("if render_toolbar ~= nil then render_toolbar() end");
+        measure(_profile.render_toolbar, [&]() { _lua->execute("if render_toolbar ~= nil then render_toolbar() end"); });
     }
 
     void Plugin::render_ui()
     {
-        if (!_enabled)
+        if (!_enabled || _frames_to_skip)
         {
             return;
         }
 
-        _lua->execute("if render_ui ~= nil then render_ui() end");
+        measure(_profile.render_ui, [&]() { _lua->execute("if render_ui ~= nil then render_ui() end"); });
     }
 
     void Plugin::set_package_path()
@@ -181,6 +203,70 @@ namespace trview
             load_script();
         }
 
-        _lua->execute(std::format("if set_enabled ~= nil then set_enabled({}) end", value));
+        measure(_profile.callbacks, [&]() { _lua->execute(std::format("if set_enabled ~= nil then set_enabled({}) end", value)); });
+    }
+
+    IPlugin::Profile Plugin::profile() const
+    {
+        return _profile;
+    }
+
+    void Plugin::reset_profile()
+    {
+        account_callbacks();
+        _profile = {};
+        _frame = {};
+        _frames_to_skip = 0;
+    }
+
+    void Plugin::end_frame(std::chrono::nanoseconds budget, bool skip)
+    {
+        account_callbacks();
+        _profile.last_frame = _frame;
+        ++_profile.frames;
+
+        if (_frames_to_skip)
+        {
+            --_frames_to_skip;
+            ++_profile.frames_skipped;
+        }
+        else if (budget > std::chrono::nanoseconds::zero() && _frame.time > budget)
+        {
+            ++_profile.frames_over_budget;
+            if (skip)
+            {
+                // Skipping one frame for each whole budget over keeps the average under the budget - a plugin that takes
+                // three times the budget runs every third frame.
+                _frames_to_skip = std::min(max_frames_to_skip, static_cast<uint32_t>((_frame.time - std::chrono::nanoseconds(1)) / budget));
+            }
+        }
+
+        _frame = {};
+    }
+
+    void Plugin::account_callbacks()
+    {
+        // Instructions run since the last measured call came from Lua callbacks that the plugin didn't call itself.
+        const Timing callbacks{ .instructions = _lua->instructions() - _accounted_instructions };
+        _accounted_instructions += callbacks.instructions;
+        _profile.callbacks += callbacks;
+        _frame += callbacks;
+    }
+
+    template <typename Func>
+    void Plugin::measure(Timing& timing, Func&& func)
+    {
+        account_callbacks();
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const Timing call
+        {
+            .time = std::chrono::steady_clock::now() - start,
+            .instructions = _lua->instructions() - _accounted_instructions,
+            .calls = 1
+        };
+        _accounted_instructions += call.instructions;
+        timing += call;
+        _frame += call;
     }
 }
@@ -22,7 +22,9 @@ namespace trview
         bool enabled() const override;
         void initialise(IApplication* application) override;
         std::string path() const override;
-        std::string messages() const override;
+        std::vector<MessageBuffer::Line> messages_since(uint64_t sequence) const override;
+        uint64_t first_message_sequence() const override;
+        void set_message_capacity(std::size_t capacity) override;
         void execute(const std::string& command) override;
         void add_message(const std::string& message) override;
         void do_file(const std::string& path) override;
@@ -31,7 +33,13 @@ namespace trview
         void render_toolbar() override;
         void render_ui() override;
         void set_enabled(bool value) override;
+        Profile profile() const override;
+        void reset_profile() override;
+        void end_frame(std::chrono::nanoseconds budget, bool skip) override;
     private:
+        void account_callbacks();
+        template <typename Func>
+        void measure(Timing& timing, Func&& func);
         void load();
         void load_script();
         void register_print();
@@ -44,11 +52,16 @@ namespace trview
         std::string _author{ "Unknown" };
         std::string _description;
         std::string _script;
-        std::string _messages;
+        MessageBuffer _messages;
         TokenStore _token_store;
         IApplication* _application;
         bool _enabled{ true };
         bool _built_in{ false };
         bool _script_loaded{ false };
+        Profile _profile;
+        Timing _frame;
+        /// Instruction count of the Lua state that has already been added to the profile.
+        uint64_t _accounted_instructions{ 0 };
+        uint32_t _frames_to_skip{ 0 };
     };
 }
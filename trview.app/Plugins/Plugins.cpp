@@ -15,6 +15,7 @@ namespace trview
         : _files(files), _settings(settings), _plugin_source(plugin_source)
     {
         _plugins.push_back(default_plugin);
+        default_plugin->set_message_capacity(_settings.plugin_console_lines);
         reload();
     }
 
@@ -36,7 +37,12 @@ namespace trview
 
     void Plugins::render_ui()
     {
-        std::ranges::for_each(_plugins, [](auto&& p) { p->render_ui(); });
+        const auto budget = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<float, std::milli>(_settings.plugin_frame_budget));
+        for (const auto& plugin : _plugins)
+        {
+            plugin->render_ui();
+            plugin->end_frame(budget, _settings.plugin_skip_over_budget);
+        }
     }
 
     void Plugins::reload()
@@ -51,6 +57,7 @@ namespace trview
             {
                 auto new_plugin = _plugin_source(plugin.path);
                 _plugins.push_back(new_plugin);
+                new_plugin->set_message_capacity(_settings.plugin_console_lines);
 
                 const auto plugin_setting = _settings.plugins.find(plugin.path);
                 new_plugin->set_enabled(plugin_setting != _settings.plugins.end() ? plugin_setting->second.enabled : true);
@@ -64,7 +71,19 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            if (settings->plugin_console_lines != _settings.plugin_console_lines)
+            {
+                std::ranges::for_each(_plugins, [&](auto&& p) { p->set_message_capacity(settings->plugin_console_lines); });
+            }
+            _settings = *settings;
         }
     }
+
+    std::optional<std::vector<MessageType>> Plugins::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
 }
@@ -21,6 +21,7 @@ namespace trview
         void render_ui() override;
         void reload() override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         std::vector<std::shared_ptr<IPlugin>> _plugins;
         std::shared_ptr<IFiles> _files;
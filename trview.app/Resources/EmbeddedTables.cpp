@@ -0,0 +1,35 @@
+#include "EmbeddedTables.h"
+#include "Generated/type_names.inl"
+#include "Generated/level_hashes.inl"
+
+namespace trview
+{
+    namespace
+    {
+        // The lookups binary search these tables, so check that the generator sorted them.
+        consteval bool types_sorted()
+        {
+            for (const auto& game : generated::type_names)
+            {
+                if (!std::ranges::is_sorted(game.types, std::ranges::less{}, &TypeNameEntry::id))
+                {
+                    return false;
+                }
+            }
+            return std::ranges::is_sorted(generated::type_names, std::ranges::less{}, &GameTypeNames::game);
+        }
+
+        static_assert(types_sorted());
+        static_assert(std::ranges::is_sorted(generated::level_hashes, std::ranges::less{}, &LevelHashEntry::hash));
+    }
+
+    std::span<const GameTypeNames> embedded_type_names()
+    {
+        return generated::type_names;
+    }
+
+    std::span<const LevelHashEntry> embedded_level_hashes()
+    {
+        return generated::level_hashes;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace trview
+{
+    /// Type name built into trview. Categories are separated by commas.
+    struct TypeNameEntry
+    {
+        uint32_t id;
+        std::string_view name;
+        std::string_view categories;
+    };
+
+    /// Built in type names for one game, sorted by id.
+    struct GameTypeNames
+    {
+        std::string_view game;
+        std::span<const TypeNameEntry> types;
+    };
+
+    /// Level name built into trview for the hash of a level file.
+    struct LevelHashEntry
+    {
+        std::string_view hash;
+        std::string_view name;
+    };
+
+    /// Type names for each game from Files\type_names.txt, sorted by game. Generated by GenerateTables.ps1 when trview.app is built.
+    std::span<const GameTypeNames> embedded_type_names();
+    /// Level names from Files\level_hashes.json, sorted by hash. Generated by GenerateTables.ps1 when trview.app is built.
+    std::span<const LevelHashEntry> embedded_level_hashes();
+}
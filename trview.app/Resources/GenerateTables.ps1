@@ -0,0 +1,99 @@
+# Turns the type name and level hash files into constexpr tables so that they don't have to be parsed at startup.
+# Run as a pre-build step of trview.app. The tables are only written when they change so that they don't cause a rebuild.
+
+$ErrorActionPreference = 'Stop'
+
+$files = Join-Path $PSScriptRoot 'Files'
+$generated = Join-Path $PSScriptRoot 'Generated'
+New-Item -ItemType Directory -Force -Path $generated | Out-Null
+
+# Strings are written byte by byte so that non-ASCII names keep their UTF-8 encoding whatever the compiler's source
+# character set is. Octal escapes are used as they can't run on into the next character like hex escapes can.
+function Format-Literal([string]$value)
+{
+    $builder = New-Object System.Text.StringBuilder
+    [void]$builder.Append('"')
+    foreach ($byte in [System.Text.Encoding]::UTF8.GetBytes($value))
+    {
+        if ($byte -ge 0x20 -and $byte -lt 0x7F -and $byte -ne 0x22 -and $byte -ne 0x5C)
+        {
+            [void]$builder.Append([char]$byte)
+        }
+        else
+        {
+            [void]$builder.Append('\' + [Convert]::ToString($byte, 8).PadLeft(3, '0'))
+        }
+    }
+    [void]$builder.Append('"')
+    return $builder.ToString()
+}
+
+function Write-IfChanged([string]$path, [string]$content)
+{
+    if ((Test-Path $path) -and ([System.IO.File]::ReadAllText($path) -eq $content))
+    {
+        return
+    }
+    [System.IO.File]::WriteAllText($path, $content, (New-Object System.Text.UTF8Encoding $false))
+}
+
+# The tables are searched with ordinal string comparisons, so they have to be sorted the same way.
+function Get-OrdinalSorted([string[]]$values)
+{
+    $list = New-Object 'System.Collections.Generic.List[string]'
+    $list.AddRange($values)
+    $list.Sort([System.StringComparer]::Ordinal)
+    return $list.ToArray()
+}
+
+$type_names = Get-Content -Raw -Encoding UTF8 (Join-Path $files 'type_names.txt') | ConvertFrom-Json
+$games = @(Get-OrdinalSorted @($type_names.games.PSObject.Properties | ForEach-Object { $_.Name }))
+
+$output = New-Object System.Text.StringBuilder
+[void]$output.AppendLine('// Generated from Files\type_names.txt by GenerateTables.ps1 - do not edit.')
+[void]$output.AppendLine('namespace trview::generated')
+[void]$output.AppendLine('{')
+for ($i = 0; $i -lt $games.Count; ++$i)
+{
+    # Later entries with the same id replace earlier ones, as they did when the file was parsed at startup.
+    $types = New-Object 'System.Collections.Generic.SortedDictionary[uint32, object]'
+    foreach ($type in $type_names.games.($games[$i]))
+    {
+        $types[[uint32]$type.id] = $type
+    }
+
+    [void]$output.AppendLine("    constexpr TypeNameEntry types_$i[] =")
+    [void]$output.AppendLine('    {')
+    foreach ($type in $types.Values)
+    {
+        $categories = if ($type.categories) { @($type.categories) -join ',' } else { '' }
+        [void]$output.AppendLine("        { $($type.id), $(Format-Literal $type.name), $(Format-Literal $categories) },")
+    }
+    [void]$output.AppendLine('    };')
+    [void]$output.AppendLine()
+}
+[void]$output.AppendLine('    constexpr GameTypeNames type_names[] =')
+[void]$output.AppendLine('    {')
+for ($i = 0; $i -lt $games.Count; ++$i)
+{
+    [void]$output.AppendLine("        { $(Format-Literal $games[$i]), types_$i },")
+}
+[void]$output.AppendLine('    };')
+[void]$output.AppendLine('}')
+Write-IfChanged (Join-Path $generated 'type_names.inl') $output.ToString()
+
+$level_hashes = Get-Content -Raw -Encoding UTF8 (Join-Path $files 'level_hashes.json') | ConvertFrom-Json
+
+$output = New-Object System.Text.StringBuilder
+[void]$output.AppendLine('// Generated from Files\level_hashes.json by GenerateTables.ps1 - do not edit.')
+[void]$output.AppendLine('namespace trview::generated')
+[void]$output.AppendLine('{')
+[void]$output.AppendLine('    constexpr LevelHashEntry level_hashes[] =')
+[void]$output.AppendLine('    {')
+foreach ($hash in (Get-OrdinalSorted @($level_hashes.PSObject.Properties | ForEach-Object { $_.Name })))
+{
+    [void]$output.AppendLine("        { $(Format-Literal $hash), $(Format-Literal $level_hashes.$hash.name) },")
+}
+[void]$output.AppendLine('    };')
+[void]$output.AppendLine('}')
+Write-IfChanged (Join-Path $generated 'level_hashes.inl') $output.ToString()
@@ -17,7 +17,6 @@
 #define IDR_LEVEL_PIXEL_SHADER          144
 #define IDR_UI_VERTEX_SHADER            145
 #define IDR_UI_PIXEL_SHADER             146
-#define IDR_TYPE_NAMES                  149
 #define IDR_ACTIONS                     150
 #define ID_FILE_OPEN                    32771
 #define ID_FILE_OPENRECENT              32772
@@ -53,7 +52,6 @@
 #define IDR_NGPLUS                      33030
 #define ID_WINDOWS_DIFF                 33031
 #define ID_WINDOWS_PACK                 33032
-#define IDR_LEVEL_HASHES                33033
 
 // Next default values for new objects
 // 
@@ -136,6 +136,10 @@ namespace trview
             read_attribute(json, settings.version, "version");
             read_attribute(json, settings.filter_directory, "filter_directory");
             read_attribute(json, settings.show_route_height_labels, "show_route_height_labels");
+            read_attribute(json, settings.level_cache, "level_cache");
+            read_attribute(json, settings.plugin_frame_budget, "plugin_frame_budget");
+            read_attribute(json, settings.plugin_skip_over_budget, "plugin_skip_over_budget");
+            read_attribute(json, settings.plugin_console_lines, "plugin_console_lines");
 
             settings.recent_files.resize(std::min<std::size_t>(settings.recent_files.size(), settings.max_recent_files));
         }
@@ -223,6 +227,10 @@ namespace trview
             json["version"] = trview::version();
             json["filter_directory"] = settings.filter_directory;
             json["show_route_height_labels"] = settings.show_route_height_labels;
+            json["level_cache"] = settings.level_cache;
+            json["plugin_frame_budget"] = settings.plugin_frame_budget;
+            json["plugin_skip_over_budget"] = settings.plugin_skip_over_budget;
+            json["plugin_console_lines"] = settings.plugin_console_lines;
             _files->save_file(file_path, json.dump());
         }
         catch (...)
@@ -65,6 +65,10 @@ namespace trview
             statics_window_columns == other.statics_window_columns &&
             sounds_window_columns == other.sounds_window_columns &&
             lights_window_columns == other.lights_window_columns &&
-            triggers_window_columns == other.triggers_window_columns;
+            triggers_window_columns == other.triggers_window_columns &&
+            level_cache == other.level_cache &&
+            plugin_frame_budget == other.plugin_frame_budget &&
+            plugin_skip_over_budget == other.plugin_skip_over_budget &&
+            plugin_console_lines == other.plugin_console_lines;
     }
 }
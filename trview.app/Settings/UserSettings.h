@@ -92,6 +92,12 @@ namespace trview
         std::string version;
         std::string filter_directory;
         bool show_route_height_labels{ true };
+        bool level_cache{ false };
+        /// Most time each plugin can take in a frame in milliseconds, or zero for no budget.
+        float plugin_frame_budget{ 0.0f };
+        bool plugin_skip_over_budget{ false };
+        /// Most lines kept in the console for each plugin.
+        uint32_t plugin_console_lines{ 10000 };
 
         bool operator==(const UserSettings& other) const;
     };
@@ -2,12 +2,16 @@
 
 namespace trview
 {
+    struct ISoundMixer;
+
     struct ISound
     {
-        using Source = std::function<std::shared_ptr<ISound>(const std::vector<uint8_t>&)>;
+        /// Provides the playable data for a sound when it is first played.
+        using DataSource = std::function<std::shared_ptr<const std::vector<uint8_t>>()>;
+        using Source = std::function<std::shared_ptr<ISound>(const DataSource&)>;
         virtual ~ISound() = 0;
         virtual void play() = 0;
     };
 
-    std::shared_ptr<ISound> create_sound(const std::vector<uint8_t>& data);
+    std::shared_ptr<ISound> create_sound(const ISound::DataSource& data_source, const std::weak_ptr<ISoundMixer>& mixer);
 }
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace trview
+{
+    /// Mixes playing sounds into a single audio output.
+    struct ISoundMixer
+    {
+        virtual ~ISoundMixer() = 0;
+        /// Start playing the sound data on a free voice.
+        /// @param data The WAV data to play. This is kept alive until the voice has finished.
+        /// @returns Whether the sound could be played.
+        virtual bool play(const std::shared_ptr<const std::vector<uint8_t>>& data) = 0;
+        /// Stop all playing voices.
+        virtual void stop() = 0;
+    };
+}
@@ -4,6 +4,8 @@
 #include <vector>
 #include <memory>
 
+#include <trlevel/SoundSample.h>
+
 namespace trview
 {
     struct ISound;
@@ -25,7 +27,7 @@ namespace trview
         };
 
         virtual ~ISoundStorage() = 0;
-        virtual void add(Index index, const std::vector<uint8_t>& data) = 0;
+        virtual void add(Index index, const trlevel::SoundSample& sample) = 0;
         virtual std::weak_ptr<ISound> get(uint16_t index) const = 0;
         virtual std::vector<Entry> sounds() const = 0;
     };
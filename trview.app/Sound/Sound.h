@@ -1,18 +1,18 @@
 #pragma once
 
 #include "ISound.h"
+#include "ISoundMixer.h"
 
 namespace trview
 {
     class Sound final : public ISound
     {
     public:
-        explicit Sound(const std::vector<uint8_t>& data);
-        virtual ~Sound();
+        explicit Sound(const DataSource& data_source, const std::weak_ptr<ISoundMixer>& mixer);
+        virtual ~Sound() = default;
         void play() override;
     private:
-        bool initialise();
-        struct Impl;
-        std::unique_ptr<Impl> _impl;
+        DataSource _data_source;
+        std::weak_ptr<ISoundMixer> _mixer;
     };
 }
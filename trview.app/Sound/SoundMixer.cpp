@@ -0,0 +1,202 @@
+#include "SoundMixer.h"
+
+#define MINIAUDIO_IMPLEMENTATION
+#include <external/miniaudio/miniaudio.h>
+
+namespace trview
+{
+    namespace
+    {
+        void data_callback(ma_device* device, void* output, const void*, ma_uint32 frame_count)
+        {
+            static_cast<SoundMixer*>(device->pUserData)->mix(static_cast<float*>(output), frame_count);
+        }
+    }
+
+    ISoundMixer::~ISoundMixer()
+    {
+    }
+
+    struct SoundMixer::Impl
+    {
+        struct DecoderDeleter
+        {
+            void operator()(ma_decoder* decoder) const
+            {
+                ma_decoder_uninit(decoder);
+                delete decoder;
+            }
+        };
+
+        /// Decoders are kept on the heap as the decoding backends point back to them.
+        using Decoder = std::unique_ptr<ma_decoder, DecoderDeleter>;
+
+        struct Voice
+        {
+            std::shared_ptr<const std::vector<uint8_t>> data;
+            Decoder decoder;
+            uint64_t started{ 0 };
+            /// Set by mix when the voice reaches the end. The voice is released by play or stop, as freeing the
+            /// decoder or the last reference to the data can't be done on the audio thread.
+            bool finished{ false };
+        };
+
+        std::vector<Voice> voices;
+        uint64_t play_count{ 0 };
+        bool has_context{ false };
+        bool has_device{ false };
+        bool device_started{ false };
+        ma_context context;
+        ma_device device;
+    };
+
+    SoundMixer::SoundMixer(Backend backend, uint32_t voices)
+        : _impl(std::make_unique<Impl>())
+    {
+        _impl->voices = std::vector<Impl::Voice>(std::max(voices, 1u));
+        if (backend == Backend::None)
+        {
+            return;
+        }
+
+        const ma_backend null_backend[] = { ma_backend_null };
+        const bool use_null = backend == Backend::Null;
+        if (MA_SUCCESS != ma_context_init(use_null ? null_backend : nullptr, use_null ? 1 : 0, nullptr, &_impl->context))
+        {
+            return;
+        }
+        _impl->has_context = true;
+
+        ma_device_config config = ma_device_config_init(ma_device_type_playback);
+        config.playback.format = ma_format_f32;
+        config.playback.channels = Channels;
+        config.sampleRate = SampleRate;
+        config.dataCallback = data_callback;
+        config.pUserData = this;
+        _impl->has_device = MA_SUCCESS == ma_device_init(&_impl->context, &config, &_impl->device);
+    }
+
+    SoundMixer::~SoundMixer()
+    {
+        if (_impl->has_device)
+        {
+            ma_device_uninit(&_impl->device);
+        }
+
+        if (_impl->has_context)
+        {
+            ma_context_uninit(&_impl->context);
+        }
+    }
+
+    bool SoundMixer::play(const std::shared_ptr<const std::vector<uint8_t>>& data)
+    {
+        if (!data || data->empty())
+        {
+            return false;
+        }
+
+        // Open the decoder before taking a voice so that data that can't be played doesn't stop a sound that is playing.
+        auto decoder = std::make_unique<ma_decoder>();
+        const ma_decoder_config config = ma_decoder_config_init(ma_format_f32, Channels, SampleRate);
+        if (MA_SUCCESS != ma_decoder_init_memory(data->data(), data->size(), &config, decoder.get()))
+        {
+            return false;
+        }
+
+        // Voices that are replaced or have finished are freed after the lock is released so that mix isn't kept waiting.
+        std::vector<Impl::Voice> released;
+        released.reserve(_impl->voices.size());
+        std::lock_guard lock{ _mutex };
+        for (auto& voice : _impl->voices)
+        {
+            if (voice.finished)
+            {
+                released.push_back(std::exchange(voice, {}));
+            }
+        }
+
+        // Take a free voice, or the one that has been playing the longest if all are in use.
+        auto voice = std::ranges::find_if(_impl->voices, [](auto&& v) { return v.data == nullptr; });
+        if (voice == _impl->voices.end())
+        {
+            voice = std::ranges::min_element(_impl->voices, {}, &Impl::Voice::started);
+        }
+        released.push_back(std::exchange(*voice, { data, Impl::Decoder(decoder.release()), ++_impl->play_count }));
+
+        // The device is only started on first play so that nothing is opened until it is needed.
+        if (_impl->has_device && !_impl->device_started)
+        {
+            _impl->device_started = MA_SUCCESS == ma_device_start(&_impl->device);
+        }
+        return true;
+    }
+
+    void SoundMixer::stop()
+    {
+        std::vector<Impl::Voice> stopped(_impl->voices.size());
+        std::lock_guard lock{ _mutex };
+        std::ranges::swap_ranges(_impl->voices, stopped);
+    }
+
+    void SoundMixer::mix(float* output, uint32_t frame_count)
+    {
+        std::fill(output, output + frame_count * Channels, 0.0f);
+
+        std::array<float, 1024 * Channels> buffer;
+        constexpr ma_uint64 buffer_frames = buffer.size() / Channels;
+
+        // This runs on the audio thread, so rather than wait for play or stop to finish it leaves this period silent.
+        std::unique_lock lock{ _mutex, std::try_to_lock };
+        if (!lock.owns_lock())
+        {
+            return;
+        }
+
+        for (auto& voice : _impl->voices)
+        {
+            if (!voice.data || voice.finished)
+            {
+                continue;
+            }
+
+            float* destination = output;
+            ma_uint64 remaining = frame_count;
+            while (remaining > 0)
+            {
+                const ma_uint64 requested = std::min(remaining, buffer_frames);
+                ma_uint64 read = 0;
+                const ma_result result = ma_decoder_read_pcm_frames(voice.decoder.get(), buffer.data(), requested, &read);
+                for (ma_uint64 i = 0; i < read * Channels; ++i)
+                {
+                    destination[i] += buffer[i];
+                }
+
+                if (result != MA_SUCCESS || read < requested)
+                {
+                    voice.finished = true;
+                    break;
+                }
+
+                remaining -= read;
+                destination += read * Channels;
+            }
+        }
+
+        for (uint32_t i = 0; i < frame_count * Channels; ++i)
+        {
+            output[i] = std::clamp(output[i], -1.0f, 1.0f);
+        }
+    }
+
+    uint32_t SoundMixer::active_voices() const
+    {
+        std::lock_guard lock{ _mutex };
+        return static_cast<uint32_t>(std::ranges::count_if(_impl->voices, [](auto&& v) { return v.data != nullptr && !v.finished; }));
+    }
+
+    bool SoundMixer::has_device() const
+    {
+        return _impl->has_device;
+    }
+}
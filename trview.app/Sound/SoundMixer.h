@@ -0,0 +1,45 @@
+#pragma once
+
+#include <mutex>
+
+#include "ISoundMixer.h"
+
+namespace trview
+{
+    /// Plays sounds through a single audio device with a fixed pool of voices.
+    class SoundMixer final : public ISoundMixer
+    {
+    public:
+        enum class Backend
+        {
+            /// Use the default audio device for the platform.
+            Default,
+            /// Use the miniaudio null backend - the device runs but produces no output.
+            Null,
+            /// Do not open a device. Output is only produced by calling mix.
+            None
+        };
+
+        static constexpr uint32_t Channels = 2;
+        static constexpr uint32_t SampleRate = 44100;
+        static constexpr uint32_t DefaultVoices = 16;
+
+        explicit SoundMixer(Backend backend = Backend::Default, uint32_t voices = DefaultVoices);
+        virtual ~SoundMixer();
+        bool play(const std::shared_ptr<const std::vector<uint8_t>>& data) override;
+        void stop() override;
+        /// Mix the active voices into the output buffer. Voices that finish are only marked as finished, nothing is
+        /// freed here - they are released by the next call to play or stop.
+        /// @param output Interleaved 32 bit float output with room for frame_count * Channels samples.
+        /// @param frame_count The number of frames to produce.
+        void mix(float* output, uint32_t frame_count);
+        /// Get the number of voices that are currently playing.
+        uint32_t active_voices() const;
+        /// Get whether an audio device is open.
+        bool has_device() const;
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> _impl;
+        mutable std::mutex _mutex;
+    };
+}
@@ -7,25 +7,63 @@ namespace trview
     {
     }
 
-    SoundStorage::SoundStorage(const ISound::Source& sound_source)
-        : _sound_source(sound_source)
+    SoundStorage::SoundStorage(const ISound::Source& sound_source, std::size_t cache_capacity)
+        : _sound_source(sound_source), _cache_capacity(std::max<std::size_t>(cache_capacity, 1))
     {
     }
 
-    void SoundStorage::add(Index index, const std::vector<uint8_t>& data)
+    void SoundStorage::add(Index index, const trlevel::SoundSample& sample)
     {
-        const auto sound = _sound_source(data);
+        // Samples can be shared between sound details, so only create one sound per sample.
+        auto& sound = _sample_sounds[index.sample_index];
+        if (!sound)
+        {
+            _samples[index.sample_index] = sample;
+            sound = _sound_source([this, sample_index = index.sample_index]() { return data(sample_index); });
+        }
         _sounds.push_back({ .index = index, .sound = sound });
     }
 
     std::weak_ptr<ISound> SoundStorage::get(uint16_t index) const
     {
-        const auto found = std::ranges::find_if(_sounds, [=](auto& s) { return s.index.sample_index == index; });
-        return found == _sounds.end() ? nullptr : found->sound;
+        const auto found = _sample_sounds.find(index);
+        return found == _sample_sounds.end() ? nullptr : found->second;
     }
 
     std::vector<ISoundStorage::Entry> SoundStorage::sounds() const
     {
         return _sounds | std::views::transform([](auto&& e) -> Entry { return { .index = e.index, .sound = e.sound }; }) | std::ranges::to<std::vector>();
     }
+
+    std::shared_ptr<const std::vector<uint8_t>> SoundStorage::data(uint16_t sample_index) const
+    {
+        std::lock_guard lock{ _cache_mutex };
+        if (const auto cached = _cache_lookup.find(sample_index); cached != _cache_lookup.end())
+        {
+            _cache.splice(_cache.begin(), _cache, cached->second);
+            return cached->second->second;
+        }
+
+        const auto sample = _samples.find(sample_index);
+        if (sample == _samples.end())
+        {
+            return nullptr;
+        }
+
+        auto decoded = std::make_shared<const std::vector<uint8_t>>(sample->second.decode());
+        _cache.emplace_front(sample_index, decoded);
+        _cache_lookup[sample_index] = _cache.begin();
+        if (_cache.size() > _cache_capacity)
+        {
+            _cache_lookup.erase(_cache.back().first);
+            _cache.pop_back();
+        }
+        return decoded;
+    }
+
+    std::size_t SoundStorage::cached() const
+    {
+        std::lock_guard lock{ _cache_mutex };
+        return _cache.size();
+    }
 }
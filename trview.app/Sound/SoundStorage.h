@@ -1,6 +1,8 @@
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -12,11 +14,18 @@ namespace trview
     class SoundStorage final : public ISoundStorage
     {
     public:
-        explicit SoundStorage(const ISound::Source& sound_source);
+        /// The default number of decoded samples that are kept in memory.
+        static constexpr std::size_t DefaultCacheCapacity = 32;
+
+        explicit SoundStorage(const ISound::Source& sound_source, std::size_t cache_capacity = DefaultCacheCapacity);
         virtual ~SoundStorage() = default;
-        void add(Index index, const std::vector<uint8_t>& data) override;
+        void add(Index index, const trlevel::SoundSample& sample) override;
         std::weak_ptr<ISound> get(uint16_t index) const override;
         std::vector<Entry> sounds() const override;
+        /// Get the decoded data for a sample, decoding it if it is not in the cache.
+        std::shared_ptr<const std::vector<uint8_t>> data(uint16_t sample_index) const;
+        /// Get the number of decoded samples currently held in the cache.
+        std::size_t cached() const;
     private:
         struct OwningEntry
         {
@@ -24,7 +33,15 @@ namespace trview
             std::shared_ptr<ISound> sound;
         };
 
+        using CacheEntry = std::pair<uint16_t, std::shared_ptr<const std::vector<uint8_t>>>;
+
         ISound::Source _sound_source;
         std::vector<OwningEntry> _sounds;
+        std::unordered_map<uint16_t, std::shared_ptr<ISound>> _sample_sounds;
+        std::unordered_map<uint16_t, trlevel::SoundSample> _samples;
+        std::size_t _cache_capacity;
+        mutable std::mutex _cache_mutex;
+        mutable std::list<CacheEntry> _cache;
+        mutable std::unordered_map<uint16_t, std::list<CacheEntry>::iterator> _cache_lookup;
     };
 }
@@ -423,7 +423,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
         }
         else if (auto selected_room = messages::read_select_room(message))
         {
@@ -434,6 +434,15 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> MapRenderer::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::select_room,
+            messages::types::settings
+        };
+    }
+
     void MapRenderer::initialise()
     {
         messages::get_selected_room(_messaging, weak_from_this());
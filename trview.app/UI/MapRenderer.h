@@ -60,6 +60,7 @@ namespace trview
         Size size() const override;
         void reposition() override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void set_selection(const std::vector<std::shared_ptr<ISector>>& sectors) override;
         void initialise();
     private:
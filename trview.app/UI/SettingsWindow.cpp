@@ -55,6 +55,7 @@ namespace trview
                     checkbox(Names::camera_sink_startup, _settings.camera_sink_startup);
                     checkbox(Names::statics_startup, _settings.statics_startup);
                     checkbox(Names::randomizer_tools, _settings.randomizer_tools);
+                    checkbox(Names::level_cache, _settings.level_cache);
                     if (ImGui::InputInt(Names::max_recent_files.c_str(), &_settings.max_recent_files))
                     {
                         _settings.max_recent_files = std::max(0, _settings.max_recent_files);
@@ -294,7 +295,15 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
         }
     }
+
+    std::optional<std::vector<MessageType>> SettingsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
 }
@@ -48,6 +48,7 @@ namespace trview
             static inline const std::string statics_startup = "Open Statics Window at startup";
             static inline const std::string linear_filtering = "Linear Filtering";
             static inline const std::string show_height_labels = "Show Height Labels by Default";
+            static inline const std::string level_cache = "Cache levels for faster reopening";
         };
 
         explicit SettingsWindow(const std::shared_ptr<IDialogs>& dialogs,
@@ -59,6 +60,7 @@ namespace trview
         virtual void render() override;
         virtual void toggle_visibility() override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         void show_texture_filtering_window();
 
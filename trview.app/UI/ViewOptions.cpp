@@ -4,6 +4,7 @@
 #include "../Windows/IWindows.h"
 #include "../Windows/IWindow.h"
 #include <trview.common/Messages/Message.h>
+#include "../Messages/Messages.h"
 
 namespace trview
 {
@@ -27,7 +28,7 @@ namespace trview
                             if (const auto new_window = windows_ptr->create("Rooms").lock())
                             {
                                 new_window->receive_message(
-                                    Message{ .type = "room_filters", .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(filters) });
+                                    Message{ .type = messages::types::room_filters, .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(filters) });
                             }
                         }
 
@@ -38,7 +39,7 @@ namespace trview
                                 if (ImGui::MenuItem(actual_window->title().c_str()))
                                 {
                                     actual_window->receive_message(
-                                        Message{ .type = "room_filters", .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(filters) });
+                                        Message{ .type = messages::types::room_filters, .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(filters) });
                                 }
                             }
                         }
@@ -71,6 +72,7 @@ namespace trview
         _toggles[IViewer::Options::camera_sinks] = false;
         _toggles[IViewer::Options::lighting] = true;
         _toggles[IViewer::Options::animation] = true;
+        _toggles[IViewer::Options::item_animation] = false;
         _toggles[IViewer::Options::notes] = true;
         _toggles[IViewer::Options::sound_sources] = false;
         _toggles[IViewer::Options::ng_plus] = false;
@@ -127,6 +129,7 @@ namespace trview
                 ImGui::BeginDisabled(!_ng_plus_enabled); 
                 add_toggle(IViewer::Options::ng_plus);
                 ImGui::EndDisabled();
+                add_toggle(IViewer::Options::item_animation);
                 ImGui::TableNextRow();
                 if (!_use_alternate_groups)
                 {
@@ -508,7 +508,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             _camera_position->set_display_degrees(_settings.camera_display_degrees);
             _camera_position->set_visible(_settings.camera_position_window);
             for (const auto& toggle : _settings.toggles)
@@ -521,4 +521,13 @@ namespace trview
             set_selected_room(selected_room.value().lock());
         }
     }
+
+    std::optional<std::vector<MessageType>> ViewerUI::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::select_room,
+            messages::types::settings
+        };
+    }
 }
@@ -73,6 +73,7 @@ namespace trview
         void reset_layout() override;
         void set_tile_filter_enabled(bool value) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
     private:
         void generate_tool_window();
         void render_route_notes();
@@ -1081,7 +1081,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->camera_sink_window_columns);
@@ -1114,6 +1114,18 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> CameraSinkWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::select_camera_sink,
+            messages::types::select_flyby_node,
+            messages::types::select_room,
+            messages::types::settings
+        };
+    }
+
     void CameraSinkWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
@@ -45,6 +45,7 @@ namespace trview
         void update(float delta) override;
         void set_platform_and_version(const trlevel::PlatformAndVersion& version);
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
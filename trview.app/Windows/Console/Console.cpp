@@ -16,20 +16,6 @@ namespace trview
     Console::Console(const std::shared_ptr<IDialogs>& dialogs, const std::weak_ptr<IPlugins>& plugins, const std::shared_ptr<IFonts>& fonts)
         : _dialogs(dialogs), _plugins(plugins), _fonts(fonts)
     {
-        if (auto plugins_ptr = _plugins.lock())
-        {
-            for (const auto& plugin : plugins_ptr->plugins())
-            {
-                if (auto plugin_ptr = plugin.lock())
-                {
-                    auto raw = plugin_ptr.get();
-                    _token_store += plugin_ptr->on_message += [raw, this](const std::string&)
-                    {
-                        _need_scroll.insert(raw);
-                    };
-                }
-            }
-        }
     }
 
     void Console::update(float)
@@ -111,6 +97,11 @@ namespace trview
 
                 if (ImGui::BeginMenu("Edit"))
                 {
+                    if (ImGui::MenuItem("Copy"))
+                    {
+                        copy_messages();
+                    }
+
                     if (ImGui::MenuItem("Clear"))
                     {
                         if (auto plugin = _selected_plugin.lock())
@@ -125,6 +116,8 @@ namespace trview
 
             if (ImGui::BeginTabBar("TabBar"))
             {
+                // Plugins that have been reloaded are new plugins, so the views for the old ones can go.
+                std::erase_if(_views, [](auto&& view) { return view.first.expired(); });
                 if (auto plugins = _plugins.lock())
                 {
                     for (const auto& plugin : plugins->plugins())
@@ -169,16 +162,26 @@ namespace trview
         {
             _selected_plugin = plugin;
 
-            auto text = plugin->messages();
-            ImGui::InputTextMultiline(Names::log.c_str(), &text, ImVec2(-1, -25), ImGuiInputTextFlags_ReadOnly);
-            if (ImGui::BeginChild(Names::log.c_str()))
+            auto& view = update_view(plugin);
+            if (ImGui::BeginChild(Names::log.c_str(), ImVec2(-1, -25), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
             {
-                if (need_scroll(plugin))
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(view.lines.size()));
+                while (clipper.Step())
+                {
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+                    {
+                        ImGui::TextUnformatted(view.lines[i].text.c_str());
+                    }
+                }
+
+                if (view.scroll)
                 {
                     ImGui::SetScrollHereY(1.0f);
+                    view.scroll = false;
                 }
-                ImGui::EndChild();
             }
+            ImGui::EndChild();
             if (ImGui::IsWindowAppearing() || _need_focus)
             {
                 ImGui::SetKeyboardFocusHere();
@@ -235,15 +238,39 @@ namespace trview
         }
     }
 
-    bool Console::need_scroll(const std::shared_ptr<IPlugin>& plugin)
+    Console::View& Console::update_view(const std::shared_ptr<IPlugin>& plugin)
     {
-        auto iter = std::ranges::find(_need_scroll, plugin.get());
-        if (iter == _need_scroll.end())
+        auto& view = _views[plugin];
+
+        // Drop anything that the plugin has dropped, either because it was full or it was cleared.
+        const uint64_t first = plugin->first_message_sequence();
+        while (!view.lines.empty() && view.lines.front().sequence < first)
         {
-            return false;
+            view.lines.pop_front();
         }
-        _need_scroll.erase(*iter);
-        return true;
+
+        for (auto& line : plugin->messages_since(view.sequence))
+        {
+            view.sequence = line.sequence;
+            view.lines.push_back(std::move(line));
+            view.scroll = true;
+        }
+        return view;
+    }
+
+    void Console::copy_messages()
+    {
+        const auto view = _views.find(_selected_plugin);
+        if (view == _views.end())
+        {
+            return;
+        }
+
+        const auto text = view->second.lines
+            | std::views::transform(&MessageBuffer::Line::text)
+            | std::views::join_with('\n')
+            | std::ranges::to<std::string>();
+        ImGui::SetClipboardText(text.c_str());
     }
 
     std::string Console::type() const
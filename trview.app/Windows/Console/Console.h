@@ -1,6 +1,7 @@
 #pragma once
 
-#include <unordered_set>
+#include <deque>
+#include <map>
 
 #include "../IWindow.h"
 #include "../../Plugins/IPlugins.h"
@@ -8,7 +9,6 @@
 
 #include <trview.common/Event.h>
 #include <trview.common/Windows/IDialogs.h>
-#include <trview.common/TokenStore.h>
 
 namespace trview
 {
@@ -31,13 +31,21 @@ namespace trview
         void receive_message(const Message&) override {};
         std::string title() const override;
     private:
+        /// Lines read from a plugin so far, so each frame only reads the lines that are new.
+        struct View
+        {
+            uint64_t sequence{ 0 };
+            std::deque<MessageBuffer::Line> lines;
+            bool scroll{ false };
+        };
+
         static int callback(ImGuiInputTextCallbackData* data);
         bool render_console();
         void add_command(const std::string& command);
         void render_plugin_logs(const std::shared_ptr<IPlugin>& plugin);
-        bool need_scroll(const std::shared_ptr<IPlugin>& plugin);
+        View& update_view(const std::shared_ptr<IPlugin>& plugin);
+        void copy_messages();
 
-        TokenStore _token_store;
         std::string _buffer;
         std::shared_ptr<IDialogs> _dialogs;
         bool _need_focus{ false };
@@ -49,7 +57,7 @@ namespace trview
         int32_t _command_history_index{ 0 };
         std::weak_ptr<IPlugins> _plugins;
         std::weak_ptr<IPlugin> _selected_plugin;
-        std::unordered_set<IPlugin*> _need_scroll;
+        std::map<std::weak_ptr<IPlugin>, View, std::owner_less<>> _views;
         std::optional<std::string> _initial_directory;
     };
 }
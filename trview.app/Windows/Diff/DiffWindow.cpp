@@ -916,7 +916,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
         }
         else if (auto level = messages::read_open_level(message))
         {
@@ -924,6 +924,15 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> DiffWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::settings
+        };
+    }
+
     void DiffWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
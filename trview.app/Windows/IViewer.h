@@ -31,6 +31,7 @@ namespace trview
             inline static const std::string camera_sinks = "Camera/Sink";
             inline static const std::string lighting = "Lighting";
             inline static const std::string animation = "Animation";
+            inline static const std::string item_animation = "Item Animation";
             inline static const std::string notes = "Notes";
             inline static const std::string sound_sources = "Sounds";
             inline static const std::string ng_plus = "NG+";
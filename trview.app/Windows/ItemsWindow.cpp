@@ -511,7 +511,7 @@ namespace trview
         }
         else if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->items_window_columns);
@@ -534,12 +534,25 @@ namespace trview
         {
             set_ng_plus(ng_plus.value());
         }
-        else if (message.type == "item_filters")
+        else if (message.type == messages::types::item_filters)
         {
             set_filters(std::static_pointer_cast<MessageData<std::vector<Filters::Filter>>>(message.data)->value);
         }
     }
 
+    std::optional<std::vector<MessageType>> ItemsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::item_filters,
+            messages::types::ng_plus,
+            messages::types::open_level,
+            messages::types::select_item,
+            messages::types::select_room,
+            messages::types::settings
+        };
+    }
+
     void ItemsWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
@@ -48,6 +48,7 @@ namespace trview
         void set_ng_plus(bool value);
         std::string name() const;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
@@ -372,7 +372,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->lights_window_columns);
@@ -399,6 +399,17 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> LightsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::select_light,
+            messages::types::select_room,
+            messages::types::settings
+        };
+    }
+
     void LightsWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
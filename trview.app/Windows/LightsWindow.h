@@ -39,6 +39,7 @@ namespace trview
         void set_number(int32_t number) override;
         void set_current_room(const std::weak_ptr<IRoom>& room);
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
@@ -45,24 +45,36 @@ namespace trview
             {
                 if (ImGui::BeginTabItem(Names::all_topic.c_str()))
                 {
+                    update_view(_all, _log->messages_since(_all.sequence));
                     if (ImGui::Button(Names::save.c_str()))
                     {
-                        save_to_file(_log->messages(), 0);
+                        save_to_file(_all.messages, 0);
+                    }
+                    ImGui::SameLine();
+                    if (ImGui::Button(Names::export_trace.c_str()))
+                    {
+                        export_trace();
                     }
 
                     if (ImGui::BeginChild("allmessages", ImVec2(), false, ImGuiWindowFlags_HorizontalScrollbar))
                     {
-                        for (const auto& message : _log->messages())
+                        ImGuiListClipper clipper;
+                        clipper.Begin(static_cast<int>(_all.messages.size()));
+                        while (clipper.Step())
                         {
-                            std::string activities;
-                            for (const auto& activity : message.activity)
+                            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
                             {
-                                activities += "[" + activity + "]";
-                            }
+                                const auto& message = _all.messages[i];
+                                std::string activities;
+                                for (const auto& activity : message.activity)
+                                {
+                                    activities += "[" + activity + "]";
+                                }
 
-                            ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
-                            ImGui::Text("[%s] [%s] %s - %s", message.topic.c_str(), message.timestamp.c_str(), activities.c_str(), message.text.c_str());
-                            ImGui::PopStyleColor();
+                                ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
+                                ImGui::Text("[%s] [%s] %s - %s", message.topic.c_str(), message.timestamp.c_str(), activities.c_str(), message.text.c_str());
+                                ImGui::PopStyleColor();
+                            }
                         }
                     }
                     ImGui::EndChild();
@@ -79,25 +91,34 @@ namespace trview
                             {
                                 if (ImGui::BeginTabItem(activity.c_str()))
                                 {
+                                    const std::string id = topic + "-" + activity;
+                                    auto& view = _views[id];
+                                    update_view(view, _log->messages_since(view.sequence, topic, activity));
                                     if (ImGui::Button("Save"))
                                     {
-                                        save_to_file(_log->messages(topic, activity), 1);
+                                        save_to_file(view.messages, 1);
                                     }
 
                                     ImGui::Separator();
-                                    if (ImGui::BeginChild((topic + "-" + activity).c_str(), ImVec2(), false, ImGuiWindowFlags_HorizontalScrollbar))
+                                    if (ImGui::BeginChild(id.c_str(), ImVec2(), false, ImGuiWindowFlags_HorizontalScrollbar))
                                     {
-                                        for (const auto& message : _log->messages(topic, activity))
+                                        ImGuiListClipper clipper;
+                                        clipper.Begin(static_cast<int>(view.messages.size()));
+                                        while (clipper.Step())
                                         {
-                                            std::string activities;
-                                            for (auto iter = message.activity.begin() + 1; iter != message.activity.end(); ++iter)
+                                            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
                                             {
-                                                activities += "[" + *iter + "]";
+                                                const auto& message = view.messages[i];
+                                                std::string activities;
+                                                for (auto iter = message.activity.begin() + 1; iter != message.activity.end(); ++iter)
+                                                {
+                                                    activities += "[" + *iter + "]";
+                                                }
+
+                                                ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
+                                                ImGui::Text("[%s] %s - %s", message.timestamp.c_str(), activities.c_str(), message.text.c_str());
+                                                ImGui::PopStyleColor();
                                             }
-
-                                            ImGui::PushStyleColor(ImGuiCol_Text, get_colour(message));
-                                            ImGui::Text("[%s] %s - %s", message.timestamp.c_str(), activities.c_str(), message.text.c_str());
-                                            ImGui::PopStyleColor();
                                         }
                                     }
                                     ImGui::EndChild();
@@ -123,7 +144,23 @@ namespace trview
         _id = std::format("Log {}", number);
     }
 
-    void LogWindow::save_to_file(const std::vector<LogMessage>& messages, int level_offset)
+    void LogWindow::update_view(View& view, std::vector<LogMessage>&& added)
+    {
+        // Drop anything that the log has dropped, either because it was full or it was cleared.
+        const uint64_t first = _log->first_sequence();
+        while (!view.messages.empty() && view.messages.front().sequence < first)
+        {
+            view.messages.pop_front();
+        }
+
+        for (auto& message : added)
+        {
+            view.sequence = message.sequence;
+            view.messages.push_back(std::move(message));
+        }
+    }
+
+    void LogWindow::save_to_file(const std::deque<LogMessage>& messages, int level_offset)
     {
         auto result = _dialogs->save_file(L"Save log", { { L"Log File", { L"*.txt" } } }, 1);
         if (!result.has_value())
@@ -145,6 +182,16 @@ namespace trview
         _files->save_file(result.value().filename, stream.str());
     }
 
+    void LogWindow::export_trace()
+    {
+        auto result = _dialogs->save_file(L"Export trace", { { L"Chrome Trace", { L"*.json" } } }, 1);
+        if (!result.has_value())
+        {
+            return;
+        }
+        _files->save_file(result.value().filename, _log->trace_json());
+    }
+
     std::string LogWindow::type() const
     {
         return "Log";
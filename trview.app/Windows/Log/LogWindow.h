@@ -4,6 +4,7 @@
 #include <trview.common/IFiles.h>
 #include <trview.common/Windows/IDialogs.h>
 #include "../IWindow.h"
+#include <deque>
 
 namespace trview
 {
@@ -15,6 +16,7 @@ namespace trview
             const static inline std::string topics_tabs{ "topics" };
             const static inline std::string all_topic{ "All" };
             const static inline std::string save{ "Save" };
+            const static inline std::string export_trace{ "Export Trace" };
         };
 
         explicit LogWindow(const std::shared_ptr<ILog>& log, const std::shared_ptr<IDialogs>& dialogs, const std::shared_ptr<IFiles>& files);
@@ -26,12 +28,23 @@ namespace trview
         void receive_message(const Message&) override;
         std::string title() const override;
     private:
+        /// Copy of the messages shown in a tab, so that each frame only has to fetch the new messages.
+        struct View
+        {
+            uint64_t sequence{ 0 };
+            std::deque<LogMessage> messages;
+        };
+
         bool render_log_window();
-        void save_to_file(const std::vector<LogMessage>& messages, int level_offset);
+        void update_view(View& view, std::vector<LogMessage>&& added);
+        void save_to_file(const std::deque<LogMessage>& messages, int level_offset);
+        void export_trace();
 
         std::shared_ptr<ILog> _log;
         std::shared_ptr<IDialogs> _dialogs;
         std::shared_ptr<IFiles> _files;
         std::string _id{ "Log 0" };
+        View _all;
+        std::map<std::string, View> _views;
     };
 }
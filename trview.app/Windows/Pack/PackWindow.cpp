@@ -68,7 +68,7 @@ namespace trview
                                     { { L"TR4 levels", { L"*.tr4" } }, { L"TR5 levels", { L"*.trc" }}, { L"All files", { L"*.*" }} },
                                     part.version.has_value() ? (part.version.value().version == trlevel::LevelVersion::Tomb4 ? 1 : 2) : 3))
                                 {
-                                    _files->save_file(file->filename, part.data);
+                                    _files->save_file(file->filename, std::vector<uint8_t>(part.data.begin(), part.data.end()));
                                 }
                             }
                             ImGui::EndPopup();
@@ -111,6 +111,14 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> PackWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level
+        };
+    }
+
     std::string PackWindow::type() const
     {
         return "Pack";
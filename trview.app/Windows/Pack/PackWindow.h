@@ -17,6 +17,7 @@ namespace trview
         void set_pack(const std::weak_ptr<trlevel::IPack>& pack);
         void initialise();
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         std::string type() const override;
         std::string title() const override;
     private:
@@ -3,6 +3,48 @@
 
 namespace trview
 {
+    namespace
+    {
+        float to_milliseconds(std::chrono::nanoseconds time)
+        {
+            return std::chrono::duration<float, std::milli>(time).count();
+        }
+
+        void render_timing_tooltip(const IPlugin::Profile& profile)
+        {
+            ImGui::BeginTooltip();
+            if (ImGui::BeginTable("Timings", 4, ImGuiTableFlags_SizingFixedFit))
+            {
+                ImGui::TableSetupColumn("Call");
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableSetupColumn("Total (ms)");
+                ImGui::TableSetupColumn("Instructions");
+                ImGui::TableHeadersRow();
+
+                const auto render_row = [](const std::string& name, const IPlugin::Timing& timing)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text(name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", timing.calls);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.3f", to_milliseconds(timing.time));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", timing.instructions);
+                };
+
+                render_row("UI", profile.render_ui);
+                render_row("Toolbar", profile.render_toolbar);
+                render_row("Execute", profile.execute);
+                render_row("Callbacks", profile.callbacks);
+                ImGui::EndTable();
+            }
+            ImGui::Text("%u frames, %u over budget, %u skipped", profile.frames, profile.frames_over_budget, profile.frames_skipped);
+            ImGui::EndTooltip();
+        }
+    }
+
     PluginsWindow::PluginsWindow(const std::weak_ptr<IPlugins>& plugins, const std::shared_ptr<IShell>& shell, const std::shared_ptr<IDialogs>& dialogs,
         const std::weak_ptr<IMessageSystem>& messaging)
         : _plugins(plugins), _shell(shell), _dialogs(dialogs), _messaging(messaging)
@@ -71,8 +113,10 @@ namespace trview
                     ImGui::EndTable();
                 }
 
+                render_budget(*plugins);
+
                 ImGui::Text("Plugins");
-                if (ImGui::BeginTable(Names::plugins_list.c_str(), 6, ImGuiTableFlags_SizingStretchProp))
+                if (ImGui::BeginTable(Names::plugins_list.c_str(), 8, ImGuiTableFlags_SizingStretchProp))
                 {
                     ImGui::TableSetupColumn("Enabled");
                     ImGui::TableSetupColumn("Location");
@@ -80,6 +124,8 @@ namespace trview
                     ImGui::TableSetupColumn("Name");
                     ImGui::TableSetupColumn("Author");
                     ImGui::TableSetupColumn("Description");
+                    ImGui::TableSetupColumn("Frame (ms)");
+                    ImGui::TableSetupColumn("Instructions");
                     ImGui::TableSetupScrollFreeze(0, 1);
                     ImGui::TableHeadersRow();
 
@@ -114,6 +160,19 @@ namespace trview
                             ImGui::Text(plugin->author().c_str());
                             ImGui::TableNextColumn();
                             ImGui::Text(plugin->description().c_str());
+
+                            const auto profile = plugin->profile();
+                            const bool over_budget = _settings->plugin_frame_budget > 0 && to_milliseconds(profile.last_frame.time) > _settings->plugin_frame_budget;
+                            ImGui::TableNextColumn();
+                            ImGui::PushStyleColor(ImGuiCol_Text, over_budget ? ImVec4(1, 0, 0, 1) : ImVec4(1, 1, 1, 1));
+                            ImGui::Text("%.3f", to_milliseconds(profile.last_frame.time));
+                            ImGui::PopStyleColor();
+                            if (ImGui::IsItemHovered())
+                            {
+                                render_timing_tooltip(profile);
+                            }
+                            ImGui::TableNextColumn();
+                            ImGui::Text("%llu", profile.last_frame.instructions);
                         }
                     }
 
@@ -126,6 +185,37 @@ namespace trview
         return stay_open;
     }
 
+    void PluginsWindow::render_budget(IPlugins& plugins)
+    {
+        ImGui::SetNextItemWidth(100);
+        float budget = _settings->plugin_frame_budget;
+        if (ImGui::InputFloat(Names::frame_budget.c_str(), &budget, 0.0f, 0.0f, "%.2f"))
+        {
+            _settings->plugin_frame_budget = std::max(0.0f, budget);
+            messages::send_settings(_messaging, *_settings);
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Most time each plugin should take in a frame. Zero for no budget.");
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox(Names::skip_over_budget.c_str(), &_settings->plugin_skip_over_budget))
+        {
+            messages::send_settings(_messaging, *_settings);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button(Names::reset_profiles.c_str()))
+        {
+            for (const auto& p : plugins.plugins())
+            {
+                if (auto plugin = p.lock())
+                {
+                    plugin->reset_profile();
+                }
+            }
+        }
+    }
+
     void PluginsWindow::set_number(int32_t number)
     {
         _id = std::format("Plugins {}", number);
@@ -139,10 +229,18 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
         }
     }
 
+    std::optional<std::vector<MessageType>> PluginsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::settings
+        };
+    }
+
     std::string PluginsWindow::type() const
     {
         return "Plugins";
@@ -15,6 +15,9 @@ namespace trview
         struct Names
         {
             static inline const std::string plugins_list = "Plugins";
+            static inline const std::string frame_budget = "Frame Budget (ms)";
+            static inline const std::string skip_over_budget = "Skip Over Budget";
+            static inline const std::string reset_profiles = "Reset Timings";
         };
 
         explicit PluginsWindow(const std::weak_ptr<IPlugins>& plugins, const std::shared_ptr<IShell>& shell, const std::shared_ptr<IDialogs>& dialogs, const std::weak_ptr<IMessageSystem>& messaging);
@@ -23,10 +26,12 @@ namespace trview
         void set_number(int32_t number) override;
         void update(float dt) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         std::string type() const override;
         std::string title() const override;
     private:
         bool render_plugins_window();
+        void render_budget(IPlugins& plugins);
 
         std::string _id{ "Plugins 0" };
         std::weak_ptr<IPlugins> _plugins;
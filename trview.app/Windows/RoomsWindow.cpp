@@ -1427,7 +1427,7 @@ namespace trview
         }
         else if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->rooms_window_columns);
@@ -1473,12 +1473,29 @@ namespace trview
         {
             set_ng_plus(ng_plus.value());
         }
-        else if (message.type == "room_filters")
+        else if (message.type == messages::types::room_filters)
         {
             set_filters(std::static_pointer_cast<MessageData<std::vector<Filters::Filter>>>(message.data)->value);
         }
     }
 
+    std::optional<std::vector<MessageType>> RoomsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::ng_plus,
+            messages::types::open_level,
+            messages::types::room_filters,
+            messages::types::select_camera_sink,
+            messages::types::select_item,
+            messages::types::select_light,
+            messages::types::select_room,
+            messages::types::select_sector,
+            messages::types::select_trigger,
+            messages::types::settings
+        };
+    }
+
     void RoomsWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
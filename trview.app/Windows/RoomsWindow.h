@@ -55,6 +55,7 @@ namespace trview
         void set_filters(std::vector<Filters::Filter> filters);
         void set_selected_sector(const std::weak_ptr<ISector>& sector);
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
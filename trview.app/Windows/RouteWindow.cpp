@@ -703,6 +703,17 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> RouteWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::route,
+            messages::types::select_waypoint,
+            messages::types::settings
+        };
+    }
+
     void RouteWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
@@ -48,6 +48,7 @@ namespace trview
         void focus();
         void update(float delta);
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         std::string type() const override;
         std::string title() const override;
     private:
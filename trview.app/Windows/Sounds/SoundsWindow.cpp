@@ -59,10 +59,7 @@ namespace trview
                 if (_settings)
                 {
                     _settings->sounds_window_columns = _filters.columns();
-                    if (auto ms = _messaging.lock())
-                    {
-                        ms->send_message(Message{ .type = "settings", .data = std::make_shared<MessageData<UserSettings>>(*_settings) });
-                    }
+                    messages::send_settings(_messaging, *_settings);
                 }
             };
     }
@@ -357,7 +354,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->sounds_window_columns);
@@ -381,6 +378,16 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> SoundsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::select_sound_source,
+            messages::types::settings
+        };
+    }
+
     void SoundsWindow::initialise()
     {
         messages::get_selected_sound_source(_messaging, weak_from_this());
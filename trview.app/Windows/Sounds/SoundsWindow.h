@@ -42,6 +42,7 @@ namespace trview
         void set_sound_storage(const std::weak_ptr<ISoundStorage>& sound_storage);
         void set_sound_sources(const std::vector<std::weak_ptr<ISoundSource>>& sound_sources);
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
@@ -268,7 +268,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->statics_window_columns);
@@ -293,6 +293,17 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> StaticsWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::select_room,
+            messages::types::select_static_mesh,
+            messages::types::settings
+        };
+    }
+
     void StaticsWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
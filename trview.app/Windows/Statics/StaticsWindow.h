@@ -39,6 +39,7 @@ namespace trview
         void set_statics(const std::vector<std::weak_ptr<IStaticMesh>>& statics);
         void update(float dt) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         std::string type() const override;
         std::string title() const override;
     private:
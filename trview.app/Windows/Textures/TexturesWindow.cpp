@@ -75,6 +75,14 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> TexturesWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level
+        };
+    }
+
     void TexturesWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
@@ -22,6 +22,7 @@ namespace trview
         void update(float delta) override;
         void set_number(int32_t number) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void set_texture_storage(const std::shared_ptr<ILevelTextureStorage>& texture_storage);
         std::string type() const override;
         std::string title() const override;
@@ -685,7 +685,7 @@ namespace trview
     {
         if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             if (!_columns_set)
             {
                 _filters.set_columns(_settings->triggers_window_columns);
@@ -712,6 +712,17 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> TriggersWindow::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::open_level,
+            messages::types::select_room,
+            messages::types::select_trigger,
+            messages::types::settings
+        };
+    }
+
     void TriggersWindow::initialise()
     {
         messages::get_open_level(_messaging, weak_from_this());
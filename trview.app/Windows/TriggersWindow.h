@@ -47,6 +47,7 @@ namespace trview
         std::weak_ptr<ITrigger> selected_trigger() const;
         virtual void update(float delta) override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
         std::string type() const override;
         std::string title() const override;
@@ -91,6 +91,7 @@ namespace trview
         toggles[Options::camera_sinks] = [this](bool value) { set_show_camera_sinks(value); };
         toggles[Options::lighting] = [this](bool value) { set_show_lighting(value); };
         toggles[Options::animation] = [this](bool value) { set_show_animation(value); };
+        toggles[Options::item_animation] = [this](bool value) { set_show_item_animation(value); };
         toggles[Options::notes] = [](bool) {};
         toggles[Options::sound_sources] = [this](bool value) { set_show_sound_sources(value); };
         toggles[Options::ng_plus] = [this](bool value) { set_ng_plus(value); };
@@ -404,7 +405,7 @@ namespace trview
                             const auto sector_x = static_cast<int>(_context_pick.position.x - (info.x / trlevel::Scale_X));
                             const auto sector_z = static_cast<int>(_context_pick.position.z - (info.z / trlevel::Scale_Z));
                             window->receive_message(
-                                Message{ .type = "item_filters", .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(
+                                Message{ .type = messages::types::item_filters, .data = std::make_shared<MessageData<std::vector<Filters::Filter>>>(
                                 std::vector<Filters::Filter>
                                 {
                                     {.key = "Room #", .compare = CompareOp::Equal, .value = std::to_string(room->number()), .op = Op::And },
@@ -763,6 +764,7 @@ namespace trview
         new_level->set_show_sound_sources(_ui->toggle(Options::sound_sources));
         new_level->set_ng_plus(_ui->toggle(Options::ng_plus));
         new_level->set_show_animation(_ui->toggle(Options::animation));
+        new_level->set_show_item_animation(_ui->toggle(Options::item_animation));
 
         // Set up the views.
         auto rooms = new_level->rooms();
@@ -1670,6 +1672,15 @@ namespace trview
         set_toggle(Options::animation, show);
     }
 
+    void Viewer::set_show_item_animation(bool show)
+    {
+        if (auto level = _level.lock())
+        {
+            level->set_show_item_animation(show);
+        }
+        set_toggle(Options::item_animation, show);
+    }
+
     void Viewer::receive_message(const Message& message)
     {
         if (auto selected_room = messages::read_select_room(message))
@@ -1686,7 +1697,7 @@ namespace trview
         }
         else if (auto settings = messages::read_settings(message))
         {
-            _settings = settings.value();
+            _settings = *settings;
             apply_camera_settings();
         }
         else if (auto selected_trigger = messages::read_select_trigger(message))
@@ -1734,6 +1745,26 @@ namespace trview
         }
     }
 
+    std::optional<std::vector<MessageType>> Viewer::message_types() const
+    {
+        return std::vector<MessageType>
+        {
+            messages::types::hover_sector,
+            messages::types::route,
+            messages::types::select_camera_sink,
+            messages::types::select_flyby_node,
+            messages::types::select_item,
+            messages::types::select_light,
+            messages::types::select_room,
+            messages::types::select_sector,
+            messages::types::select_sound_source,
+            messages::types::select_static_mesh,
+            messages::types::select_trigger,
+            messages::types::select_waypoint,
+            messages::types::settings
+        };
+    }
+
     void Viewer::initialise()
     {
         messages::get_selected_room(_messaging, weak_from_this());
@@ -92,6 +92,7 @@ namespace trview
         void select_flyby_node(const std::weak_ptr<IFlybyNode>& flyby_node) override;
         std::weak_ptr<ILevel> level() const override;
         void receive_message(const Message& message) override;
+        std::optional<std::vector<MessageType>> message_types() const override;
         void initialise();
     private:
         void initialise_input();
@@ -135,6 +136,7 @@ namespace trview
         void set_show_sound_sources(bool show);
         void set_ng_plus(bool show);
         void set_show_animation(bool show);
+        void set_show_item_animation(bool show);
         template <typename T>
         std::shared_ptr<T> get_entity_and_sync_level(const std::weak_ptr<T>& entity);
         void toggle_borderless();
@@ -0,0 +1,178 @@
+#include "Benchmark.h"
+
+#include <external/nlohmann/json.hpp>
+#include <format>
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        namespace
+        {
+            std::vector<std::pair<std::string, Function>>& registry()
+            {
+                static std::vector<std::pair<std::string, Function>> benchmarks;
+                return benchmarks;
+            }
+
+            const void* volatile sink = nullptr;
+
+            double per_second(uint64_t per_iteration, uint64_t iterations, std::chrono::nanoseconds elapsed)
+            {
+                const double seconds = std::chrono::duration<double>(elapsed).count();
+                return seconds > 0 ? static_cast<double>(per_iteration * iterations) / seconds : 0.0;
+            }
+        }
+
+        State::State(std::chrono::nanoseconds min_time)
+            : _min_time(min_time)
+        {
+        }
+
+        void State::run(const std::function<void()>& function)
+        {
+            // Warm up once, then keep doubling the batch size until a batch takes long enough to time.
+            function();
+
+            uint64_t batch = 1;
+            while (true)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                for (uint64_t i = 0; i < batch; ++i)
+                {
+                    function();
+                }
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                if (elapsed >= _min_time || batch >= (1ull << 40))
+                {
+                    _elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+                    _iterations = batch;
+                    return;
+                }
+                batch *= 2;
+            }
+        }
+
+        void State::set_items_per_iteration(uint64_t items)
+        {
+            _items_per_iteration = items;
+        }
+
+        void State::set_bytes_per_iteration(uint64_t bytes)
+        {
+            _bytes_per_iteration = bytes;
+        }
+
+        void State::set_counter(const std::string& name, double value)
+        {
+            _counters.push_back({ name, value });
+        }
+
+        uint64_t State::iterations() const
+        {
+            return _iterations;
+        }
+
+        std::chrono::nanoseconds State::elapsed() const
+        {
+            return _elapsed;
+        }
+
+        uint64_t State::items_per_iteration() const
+        {
+            return _items_per_iteration;
+        }
+
+        uint64_t State::bytes_per_iteration() const
+        {
+            return _bytes_per_iteration;
+        }
+
+        const std::vector<std::pair<std::string, double>>& State::counters() const
+        {
+            return _counters;
+        }
+
+        Registration::Registration(const std::string& name, const Function& function)
+        {
+            registry().push_back({ name, function });
+        }
+
+        std::vector<Result> run(const std::string& filter, std::chrono::nanoseconds min_time)
+        {
+            auto benchmarks = registry();
+            std::ranges::sort(benchmarks, {}, &std::pair<std::string, Function>::first);
+
+            std::vector<Result> results;
+            for (const auto& [name, function] : benchmarks)
+            {
+                if (!filter.empty() && name.find(filter) == name.npos)
+                {
+                    continue;
+                }
+
+                State state{ min_time };
+                function(state);
+                if (state.iterations() == 0)
+                {
+                    continue;
+                }
+
+                results.push_back(
+                    {
+                        .name = name,
+                        .iterations = state.iterations(),
+                        .nanoseconds_per_iteration = static_cast<double>(state.elapsed().count()) / state.iterations(),
+                        .items_per_second = per_second(state.items_per_iteration(), state.iterations(), state.elapsed()),
+                        .bytes_per_second = per_second(state.bytes_per_iteration(), state.iterations(), state.elapsed()),
+                        .counters = state.counters()
+                    });
+            }
+            return results;
+        }
+
+        std::string to_json(const std::vector<Result>& results)
+        {
+            nlohmann::ordered_json json;
+            json["benchmarks"] = nlohmann::ordered_json::array();
+            for (const auto& result : results)
+            {
+                nlohmann::ordered_json entry;
+                entry["name"] = result.name;
+                entry["iterations"] = result.iterations;
+                entry["ns_per_iteration"] = result.nanoseconds_per_iteration;
+                entry["items_per_second"] = result.items_per_second;
+                entry["bytes_per_second"] = result.bytes_per_second;
+                for (const auto& [name, value] : result.counters)
+                {
+                    entry["counters"][name] = value;
+                }
+                json["benchmarks"].push_back(entry);
+            }
+            return json.dump(2);
+        }
+
+        std::string to_text(const Result& result)
+        {
+            std::string text = std::format("{:<48} {:>14.1f} ns {:>12} iterations", result.name, result.nanoseconds_per_iteration, result.iterations);
+            if (result.items_per_second > 0)
+            {
+                text += std::format(" {:>14.0f} items/s", result.items_per_second);
+            }
+            if (result.bytes_per_second > 0)
+            {
+                text += std::format(" {:>10.3f} GB/s", result.bytes_per_second / 1e9);
+            }
+            for (const auto& [name, value] : result.counters)
+            {
+                text += std::format(" {}={}", name, value);
+            }
+            return text;
+        }
+
+        void do_not_optimise(const void* value)
+        {
+            sink = value;
+        }
+    }
+}
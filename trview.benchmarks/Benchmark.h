@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace trview
+{
+    namespace benchmarks
+    {
+        /// Passed to each benchmark to time the code under test.
+        class State final
+        {
+        public:
+            explicit State(std::chrono::nanoseconds min_time);
+            /// Run the function repeatedly until the minimum time has elapsed. Setup done
+            /// before calling this is not included in the timing.
+            void run(const std::function<void()>& function);
+            /// Set the number of items (samples, faces, rooms...) processed by one iteration.
+            void set_items_per_iteration(uint64_t items);
+            /// Set the number of bytes processed by one iteration.
+            void set_bytes_per_iteration(uint64_t bytes);
+            /// Add a named value to the result, such as the size of the input.
+            void set_counter(const std::string& name, double value);
+
+            uint64_t iterations() const;
+            std::chrono::nanoseconds elapsed() const;
+            uint64_t items_per_iteration() const;
+            uint64_t bytes_per_iteration() const;
+            const std::vector<std::pair<std::string, double>>& counters() const;
+        private:
+            std::chrono::nanoseconds _min_time;
+            std::chrono::nanoseconds _elapsed{ 0 };
+            uint64_t _iterations{ 0 };
+            uint64_t _items_per_iteration{ 0 };
+            uint64_t _bytes_per_iteration{ 0 };
+            std::vector<std::pair<std::string, double>> _counters;
+        };
+
+        struct Result
+        {
+            std::string name;
+            uint64_t iterations;
+            double nanoseconds_per_iteration;
+            double items_per_second;
+            double bytes_per_second;
+            std::vector<std::pair<std::string, double>> counters;
+        };
+
+        using Function = std::function<void(State&)>;
+
+        /// Adds a benchmark to the list of benchmarks to run. Use TRVIEW_BENCHMARK instead of using this directly.
+        struct Registration final
+        {
+            Registration(const std::string& name, const Function& function);
+        };
+
+        /// Run all benchmarks whose name contains the filter.
+        std::vector<Result> run(const std::string& filter, std::chrono::nanoseconds min_time);
+        std::string to_json(const std::vector<Result>& results);
+        std::string to_text(const Result& result);
+
+        /// Prevent the compiler from removing a computation whose result is otherwise unused.
+        void do_not_optimise(const void* value);
+
+        template <typename T>
+        void do_not_optimise(const T& value)
+        {
+            do_not_optimise(static_cast<const void*>(&value));
+        }
+    }
+}
+
+#define TRVIEW_BENCHMARK(name) \
+    static void name(trview::benchmarks::State& state); \
+    static const trview::benchmarks::Registration name##_registration(#name, name); \
+    static void name(trview::benchmarks::State& state)
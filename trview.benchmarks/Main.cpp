@@ -0,0 +1,47 @@
+#include "Benchmark.h"
+
+#include <fstream>
+#include <iostream>
+
+/// Usage: trview.benchmarks [--filter text] [--min-time milliseconds] [--json output.json]
+int main(int argc, char** argv)
+{
+    std::string filter;
+    std::string json_filename;
+    std::chrono::milliseconds min_time{ 500 };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--min-time" && i + 1 < argc)
+        {
+            min_time = std::chrono::milliseconds(std::stoi(argv[++i]));
+        }
+        else if (arg == "--json" && i + 1 < argc)
+        {
+            json_filename = argv[++i];
+        }
+        else
+        {
+            std::cerr << "Usage: trview.benchmarks [--filter text] [--min-time milliseconds] [--json output.json]\n";
+            return 1;
+        }
+    }
+
+    const auto results = trview::benchmarks::run(filter, min_time);
+    for (const auto& result : results)
+    {
+        std::cout << trview::benchmarks::to_text(result) << '\n';
+    }
+
+    if (!json_filename.empty())
+    {
+        std::ofstream file(json_filename);
+        file << trview::benchmarks::to_json(results);
+    }
+    return 0;
+}
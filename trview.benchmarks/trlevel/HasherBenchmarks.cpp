@@ -0,0 +1,36 @@
+#include <trlevel/Hasher.h>
+
+using namespace trlevel;
+
+namespace
+{
+    /// Roughly the size of a large TR4 level.
+    constexpr std::size_t level_size = 16 * 1024 * 1024;
+
+    std::vector<uint8_t> create_level_bytes()
+    {
+        std::mt19937 random(1);
+        std::vector<uint8_t> data(level_size);
+        std::ranges::generate(data, [&]() { return static_cast<uint8_t>(random()); });
+        return data;
+    }
+
+    void hash_benchmark(trview::benchmarks::State& state, Hasher::Implementation implementation)
+    {
+        const auto data = create_level_bytes();
+        const Hasher hasher(implementation);
+        state.set_bytes_per_iteration(data.size());
+        state.set_counter("accelerated", hasher.implementation() != Hasher::Implementation::Software ? 1.0 : 0.0);
+        state.run([&]() { trview::benchmarks::do_not_optimise(hasher.digest(data)); });
+    }
+}
+
+TRVIEW_BENCHMARK(HashSoftware)
+{
+    hash_benchmark(state, Hasher::Implementation::Software);
+}
+
+TRVIEW_BENCHMARK(HashBest)
+{
+    hash_benchmark(state, best_hasher_implementation());
+}
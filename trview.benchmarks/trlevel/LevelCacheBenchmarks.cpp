@@ -0,0 +1,123 @@
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trlevel/Level.h>
+#include <trview.common/Logs/Log.h>
+#include <trview.common/Resources.h>
+#include "../resource.h"
+
+using namespace trlevel;
+
+namespace
+{
+    const std::string level_filename = "lake.trc";
+
+    /// Serves the embedded level and nothing else.
+    class LevelFiles final : public trview::IFiles
+    {
+    public:
+        explicit LevelFiles(const std::vector<uint8_t>& level) : _level(level) {}
+        std::string appdata_directory() const override { return {}; }
+        std::string fonts_directory() const override { return {}; }
+        bool create_directory(const std::string&) const override { return true; }
+        void delete_file(const std::string&) const override {}
+        std::optional<std::vector<uint8_t>> load_file(const std::string& filename) const override
+        {
+            return filename == level_filename ? std::optional(_level) : std::nullopt;
+        }
+        std::optional<std::vector<uint8_t>> load_file(const std::wstring&) const override { return std::nullopt; }
+        void save_file(const std::string&, const std::vector<uint8_t>&) const override {}
+        void save_file(const std::string&, const std::string&) const override {}
+        std::vector<File> get_files(const std::string&, const std::string&) const override { return {}; }
+        std::vector<Directory> get_directories(const std::string&) const override { return {}; }
+        std::vector<Directory> get_directories(const std::string&, const std::string&) const override { return {}; }
+        std::string working_directory() const override { return {}; }
+        void set_working_directory(const std::string&) override {}
+    private:
+        std::vector<uint8_t> _level;
+    };
+
+    /// Keeps cache entries in memory so that the warm open measures reading the entry rather than the disk.
+    class MemoryLevelCache final : public ILevelCache
+    {
+    public:
+        std::unique_ptr<Entry> open(const std::string& hash) const override
+        {
+            const auto found = _entries.find(hash);
+            return found == _entries.end() ? nullptr : std::make_unique<MemoryEntry>(found->second);
+        }
+
+        void save(const std::string& hash, const std::vector<uint8_t>& data) override
+        {
+            _entries[hash] = data;
+        }
+
+        void remove(const std::string& hash) override
+        {
+            _entries.erase(hash);
+        }
+    private:
+        struct MemoryEntry final : public Entry
+        {
+            explicit MemoryEntry(const std::vector<uint8_t>& bytes) : bytes(bytes) {}
+            std::span<const uint8_t> data() const override { return bytes; }
+            const std::vector<uint8_t>& bytes;
+        };
+
+        std::unordered_map<std::string, std::vector<uint8_t>> _entries;
+    };
+
+    std::vector<uint8_t> load_level_bytes()
+    {
+        const auto resource = trview::get_resource_memory(IDR_ORIGINAL_LAKE, L"FILE");
+        return std::vector<uint8_t>(resource.data, resource.data + resource.size);
+    }
+
+    void open_level(const std::shared_ptr<trview::IFiles>& files, const std::shared_ptr<ILevelCache>& cache, bool use_cache,
+        ILevel::LoadCallbacks::OpenMode open_mode = ILevel::LoadCallbacks::OpenMode::Full)
+    {
+        auto level = std::make_shared<Level>(level_filename, nullptr, files, std::make_shared<Decrypter>(),
+            std::make_shared<trview::Log>(), std::make_shared<Hasher>(), cache);
+        ILevel::LoadCallbacks callbacks{ .on_sound_callback = [](auto&&...) {}, .open_mode = open_mode, .use_cache = use_cache };
+        // Lazy loads are read by scripts, which don't take the textiles, as in the application.
+        if (open_mode != ILevel::LoadCallbacks::OpenMode::Lazy)
+        {
+            callbacks.on_textile_callback = [](auto&&...) {};
+        }
+        level->load(callbacks);
+        trview::benchmarks::do_not_optimise(level->num_rooms());
+    }
+}
+
+TRVIEW_BENCHMARK(LevelOpenCold)
+{
+    const auto bytes = load_level_bytes();
+    const auto files = std::make_shared<LevelFiles>(bytes);
+    state.set_bytes_per_iteration(bytes.size());
+    state.run([&]() { open_level(files, nullptr, false); });
+}
+
+TRVIEW_BENCHMARK(LevelOpenWarm)
+{
+    const auto bytes = load_level_bytes();
+    const auto files = std::make_shared<LevelFiles>(bytes);
+    const auto cache = std::make_shared<MemoryLevelCache>();
+    open_level(files, cache, true);
+    state.set_bytes_per_iteration(bytes.size());
+    state.run([&]() { open_level(files, cache, true); });
+}
+
+TRVIEW_BENCHMARK(LevelOpenLazy)
+{
+    const auto bytes = load_level_bytes();
+    const auto files = std::make_shared<LevelFiles>(bytes);
+    state.set_bytes_per_iteration(bytes.size());
+    state.run([&]() { open_level(files, nullptr, false, ILevel::LoadCallbacks::OpenMode::Lazy); });
+}
+
+TRVIEW_BENCHMARK(LevelOpenPreview)
+{
+    const auto bytes = load_level_bytes();
+    const auto files = std::make_shared<LevelFiles>(bytes);
+    state.set_bytes_per_iteration(bytes.size());
+    state.run([&]() { open_level(files, nullptr, false, ILevel::LoadCallbacks::OpenMode::Preview); });
+}
@@ -0,0 +1,147 @@
+#include <trlevel/LevelProbe.h>
+#include <trlevel/Level_common.h>
+#include <trlevel/Level_psx.h>
+
+using namespace trlevel;
+
+namespace
+{
+    /// The number of parts in a PSX level pack.
+    constexpr std::size_t part_count = 50;
+    constexpr std::size_t part_size = 512 * 1024;
+
+    /// Parts that don't match any signature, so every signature is checked before falling back to the first bytes.
+    std::vector<std::vector<uint8_t>> create_parts()
+    {
+        std::mt19937 random(1);
+        std::vector<std::vector<uint8_t>> parts(part_count);
+        for (auto& part : parts)
+        {
+            part.resize(part_size);
+            std::ranges::generate(part, [&]() { return static_cast<uint8_t>(random()); });
+            // Keep the counts at the start small so that the sound skips stay inside the part.
+            part[1] = part[2] = part[3] = 0;
+        }
+        return parts;
+    }
+
+    // The stream based chain that probe_level_version replaced, kept here as the baseline for the benchmark.
+    std::optional<PlatformAndVersion> check_raw_version(std::basic_ispanstream<uint8_t>& file, std::streamoff offset, uint32_t version, PlatformAndVersion result)
+    {
+        file.seekg(offset);
+        return read<uint32_t>(file) == version ? std::optional(result) : std::nullopt;
+    }
+
+    std::optional<PlatformAndVersion> check_sounds_then_version(std::basic_ispanstream<uint8_t>& file, std::size_t sample_size, std::size_t extra, uint32_t version, PlatformAndVersion result)
+    {
+        skip(file, read<uint32_t>(file) * sample_size);
+        skip(file, read<uint32_t>(file));
+        skip(file, extra);
+        return read<uint32_t>(file) == version ? std::optional(result) : std::nullopt;
+    }
+
+    std::optional<PlatformAndVersion> check_for_tr4_psx(std::basic_ispanstream<uint8_t>& file)
+    {
+        for (const auto offset : { 0x7000, 0x7800, 0x6000 })
+        {
+            file.seekg(offset);
+            const int32_t potential_version = peek<int32_t>(file);
+            if (is_supported_tr4_psx_version(potential_version))
+            {
+                return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb4, .raw_version = potential_version };
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<PlatformAndVersion> check_for_tr5_psx(std::basic_ispanstream<uint8_t>& file)
+    {
+        file.seekg(313344);
+        const int32_t potential_version = read<int32_t>(file);
+        if (is_supported_tr5_psx_version(potential_version))
+        {
+            return PlatformAndVersion{ .platform = Platform::PSX, .version = LevelVersion::Tomb5, .raw_version = potential_version };
+        }
+        return std::nullopt;
+    }
+
+    std::optional<PlatformAndVersion> check_for_tr1_saturn(std::basic_ispanstream<uint8_t>& file)
+    {
+        std::array<uint8_t, 8> data;
+        file.read(&data[0], 8);
+        if (std::ranges::equal(data, std::string_view("ROOMFILE")))
+        {
+            skip(file, 4);
+            const int32_t version = std::byteswap(read<int32_t>(file));
+            return PlatformAndVersion{ .platform = Platform::Saturn, .version = LevelVersion::Tomb1, .raw_version = version };
+        }
+        return std::nullopt;
+    }
+
+    PlatformAndVersion detect_level_version(std::span<const uint8_t> data)
+    {
+        const std::vector<std::function<std::optional<PlatformAndVersion>(std::basic_ispanstream<uint8_t>&)>> checks
+        {
+            [](auto& file) { return check_sounds_then_version(file, sizeof(uint32_t), 0, 45, { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 45 }); },
+            [](auto& file) { return check_sounds_then_version(file, 1, 0, 44, { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 44 }); },
+            [](auto& file) { return check_sounds_then_version(file, 1, sizeof(tr_textile4) * 18 + sizeof(tr_clut) * 2048, 42, { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 42 }); },
+            [](auto& file) { return check_sounds_then_version(file, 1, sizeof(tr_textile4) * 14 + sizeof(tr_clut) * 1024, 38, { .platform = Platform::PSX, .version = LevelVersion::Tomb2, .raw_version = 38 }); },
+            [](auto& file) { return check_raw_version(file, sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024, 27, { .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 27 }); },
+            [](auto& file) { return check_raw_version(file, sizeof(tr_textile4) * 15 + sizeof(tr_clut) * 1024, 32, { .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32, .extra = { "handydemo" } }); },
+            [](auto& file) { return check_raw_version(file, sizeof(tr_textile4) * 21 + sizeof(tr_clut) * 1024, 11, { .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 11 }); },
+            [](auto& file) { return check_raw_version(file, sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024, 32, { .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 }); },
+            [](auto& file) { return check_sounds_then_version(file, 1, sizeof(tr_textile4) * 13 + sizeof(tr_clut) * 1024, 32, { .platform = Platform::PSX, .version = LevelVersion::Tomb1, .raw_version = 32 }); },
+            check_for_tr4_psx,
+            check_for_tr5_psx,
+            check_for_tr1_saturn
+        };
+
+        std::basic_ispanstream<uint8_t> file(std::span<uint8_t>(const_cast<uint8_t*>(data.data()), data.size()));
+        file.exceptions(std::ios::failbit);
+        for (const auto& check : checks)
+        {
+            file.clear();
+            file.seekg(0, std::ios::beg);
+            try
+            {
+                if (const auto version = check(file))
+                {
+                    return version.value();
+                }
+            }
+            catch (...)
+            {
+            }
+        }
+
+        file.clear();
+        file.seekg(0, std::ios::beg);
+        return convert_level_version(read<uint32_t>(file));
+    }
+}
+
+TRVIEW_BENCHMARK(ProbeLevelVersion)
+{
+    const auto parts = create_parts();
+    state.set_items_per_iteration(parts.size());
+    state.run([&]()
+        {
+            for (const auto& part : parts)
+            {
+                trview::benchmarks::do_not_optimise(probe_level_version(part).raw_version);
+            }
+        });
+}
+
+TRVIEW_BENCHMARK(DetectLevelVersionChain)
+{
+    const auto parts = create_parts();
+    state.set_items_per_iteration(parts.size());
+    state.run([&]()
+        {
+            for (const auto& part : parts)
+            {
+                trview::benchmarks::do_not_optimise(detect_level_version(part).raw_version);
+            }
+        });
+}
@@ -0,0 +1,82 @@
+#include <spanstream>
+
+#include <trlevel/Level_common.h>
+#include <trlevel/LevelWriter.h>
+
+using namespace trlevel;
+
+namespace
+{
+    constexpr uint32_t sector_count = 256 * 1024;
+    constexpr uint32_t textile_count = 16;
+
+    template <typename T>
+    std::vector<T> random_textiles(uint32_t count)
+    {
+        std::mt19937 random(1);
+        std::vector<T> textiles(count);
+        for (auto& textile : textiles)
+        {
+            std::ranges::generate(textile.Tile, [&]() { return static_cast<std::ranges::range_value_t<decltype(textile.Tile)>>(random()); });
+        }
+        return textiles;
+    }
+}
+
+TRVIEW_BENCHMARK(ReadVector)
+{
+    std::mt19937 random(1);
+    std::vector<uint8_t> bytes(sector_count * sizeof(tr_room_sector));
+    std::ranges::generate(bytes, [&]() { return static_cast<uint8_t>(random()); });
+
+    state.set_items_per_iteration(sector_count);
+    state.set_bytes_per_iteration(bytes.size());
+    state.run([&]()
+        {
+            std::basic_ispanstream<uint8_t> file{ std::span(bytes) };
+            trview::benchmarks::do_not_optimise(read_vector<tr_room_sector>(file, sector_count));
+        });
+}
+
+TRVIEW_BENCHMARK(ReadCompressed)
+{
+    // A TR4 level starts with the version and three textile counts, followed by the compressed 32-bit textiles.
+    auto level = write_level(generate_level({ .textiles = textile_count }), LevelVersion::Tomb4);
+    constexpr std::size_t textiles_offset = sizeof(uint32_t) + 3 * sizeof(uint16_t);
+
+    state.set_items_per_iteration(textile_count);
+    state.set_bytes_per_iteration(textile_count * sizeof(tr_textile32));
+    state.run([&]()
+        {
+            std::basic_ispanstream<uint8_t> file{ std::span(level).subspan(textiles_offset) };
+            trview::benchmarks::do_not_optimise(read_compressed(file));
+        });
+}
+
+TRVIEW_BENCHMARK(ConvertTextile16)
+{
+    const auto textiles = random_textiles<tr_textile16>(textile_count);
+    state.set_items_per_iteration(textile_count);
+    state.set_bytes_per_iteration(textile_count * sizeof(tr_textile16));
+    state.run([&]()
+        {
+            for (const auto& textile : textiles)
+            {
+                trview::benchmarks::do_not_optimise(convert_textile(textile));
+            }
+        });
+}
+
+TRVIEW_BENCHMARK(ConvertTextile32)
+{
+    const auto textiles = random_textiles<tr_textile32>(textile_count);
+    state.set_items_per_iteration(textile_count);
+    state.set_bytes_per_iteration(textile_count * sizeof(tr_textile32));
+    state.run([&]()
+        {
+            for (const auto& textile : textiles)
+            {
+                trview::benchmarks::do_not_optimise(convert_textile(textile));
+            }
+        });
+}
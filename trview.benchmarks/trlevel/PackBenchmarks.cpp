@@ -0,0 +1,40 @@
+#include <trlevel/Pack.h>
+
+using namespace trlevel;
+
+namespace
+{
+    constexpr uint32_t part_count = 50;
+    constexpr uint32_t part_size = 512 * 1024;
+    constexpr uint32_t headers_size = 1024;
+
+    /// A pack of TR4 PC parts, the layout of a PSX disc pack with the headers at the start.
+    std::shared_ptr<const std::vector<uint8_t>> create_pack()
+    {
+        std::mt19937 random(1);
+        std::vector<uint8_t> data(headers_size + part_count * part_size);
+        std::ranges::generate(data, [&]() { return static_cast<uint8_t>(random()); });
+        std::fill(data.begin(), data.begin() + headers_size, static_cast<uint8_t>(0));
+        for (uint32_t i = 0; i < part_count; ++i)
+        {
+            const uint32_t header[2]{ headers_size + i * part_size, part_size };
+            std::memcpy(&data[8 + i * sizeof(header)], header, sizeof(header));
+            const uint32_t version = 0x00345254;
+            std::memcpy(&data[header[0]], &version, sizeof(version));
+        }
+        return std::make_shared<const std::vector<uint8_t>>(std::move(data));
+    }
+}
+
+TRVIEW_BENCHMARK(PackLoad)
+{
+    const auto data = create_pack();
+    state.set_items_per_iteration(part_count);
+    state.set_bytes_per_iteration(data->size());
+    state.run([&]()
+        {
+            auto pack = std::make_shared<Pack>(data);
+            pack->load();
+            trview::benchmarks::do_not_optimise(pack->parts().size());
+        });
+}
@@ -0,0 +1,32 @@
+#include <trlevel/SoundSample.h>
+
+using namespace trlevel;
+
+namespace
+{
+    /// Create a sample of random VAG blocks with valid filter and shift values.
+    SoundSample create_vag_sample(std::mt19937& random, std::size_t blocks)
+    {
+        std::vector<uint8_t> data(16 + blocks * 16 + 48);
+        std::ranges::generate(data, [&]() { return static_cast<uint8_t>(random()); });
+        for (std::size_t block = 16; block + 1 < data.size(); block += 16)
+        {
+            data[block] = static_cast<uint8_t>(((random() % 5) << 4) | (random() % 13));
+            data[block + 1] = 0;
+        }
+        const std::size_t size = data.size();
+        return { .source = std::make_shared<const std::vector<uint8_t>>(std::move(data)), .size = size, .format = SoundSample::Format::Vag, .sample_frequency = 11025 };
+    }
+
+    constexpr std::size_t blocks_per_sample = 2048;
+    constexpr std::size_t samples_per_block = 28;
+}
+
+TRVIEW_BENCHMARK(VagDecodeSingle)
+{
+    std::mt19937 random(1);
+    const auto sample = create_vag_sample(random, blocks_per_sample);
+    state.set_items_per_iteration(blocks_per_sample * samples_per_block);
+    state.set_bytes_per_iteration(sample.size);
+    state.run([&]() { trview::benchmarks::do_not_optimise(sample.decode()); });
+}
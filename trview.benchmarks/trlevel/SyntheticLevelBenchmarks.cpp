@@ -0,0 +1,90 @@
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trlevel/Level.h>
+#include <trlevel/LevelWriter.h>
+#include <trview.common/Logs/Log.h>
+
+using namespace trlevel;
+
+namespace
+{
+    /// Serves one generated level under each name that it is written as.
+    class SyntheticFiles final : public trview::IFiles
+    {
+    public:
+        SyntheticFiles(const std::string& filename, const std::vector<uint8_t>& level) : _filename(filename), _level(level) {}
+        std::string appdata_directory() const override { return {}; }
+        std::string fonts_directory() const override { return {}; }
+        bool create_directory(const std::string&) const override { return true; }
+        void delete_file(const std::string&) const override {}
+        std::optional<std::vector<uint8_t>> load_file(const std::string& filename) const override
+        {
+            return filename == _filename ? std::optional(_level) : std::nullopt;
+        }
+        std::optional<std::vector<uint8_t>> load_file(const std::wstring&) const override { return std::nullopt; }
+        void save_file(const std::string&, const std::vector<uint8_t>&) const override {}
+        void save_file(const std::string&, const std::string&) const override {}
+        std::vector<File> get_files(const std::string&, const std::string&) const override { return {}; }
+        std::vector<Directory> get_directories(const std::string&) const override { return {}; }
+        std::vector<Directory> get_directories(const std::string&, const std::string&) const override { return {}; }
+        std::string working_directory() const override { return {}; }
+        void set_working_directory(const std::string&) override {}
+    private:
+        std::string _filename;
+        std::vector<uint8_t> _level;
+    };
+
+    /// Far larger than any shipped level, so that the loader's per-element costs dominate.
+    constexpr SyntheticLevelCounts large_level
+    {
+        .rooms = 2000,
+        .sectors = 16,
+        .meshes = 4000,
+        .mesh_faces = 24,
+        .entities = 10000,
+        .triggers = 20000,
+        .textiles = 32
+    };
+
+    void benchmark_open(trview::benchmarks::State& state, LevelVersion version, const std::string& filename)
+    {
+        const auto bytes = write_level(generate_level(large_level), version);
+        const auto files = std::make_shared<SyntheticFiles>(filename, bytes);
+        state.set_bytes_per_iteration(bytes.size());
+        state.set_items_per_iteration(large_level.rooms);
+        state.run([&]()
+            {
+                auto level = std::make_shared<Level>(filename, nullptr, files, std::make_shared<Decrypter>(),
+                    std::make_shared<trview::Log>(), std::make_shared<Hasher>(), nullptr);
+                level->load({ .on_textile_callback = [](auto&&...) {}, .on_sound_callback = [](auto&&...) {} });
+                trview::benchmarks::do_not_optimise(level->num_rooms());
+            });
+    }
+}
+
+TRVIEW_BENCHMARK(SyntheticLevelOpenTomb1)
+{
+    benchmark_open(state, LevelVersion::Tomb1, "synthetic.phd");
+}
+
+TRVIEW_BENCHMARK(SyntheticLevelOpenTomb3)
+{
+    benchmark_open(state, LevelVersion::Tomb3, "synthetic.tr2");
+}
+
+TRVIEW_BENCHMARK(SyntheticLevelOpenTomb4)
+{
+    benchmark_open(state, LevelVersion::Tomb4, "synthetic.tr4");
+}
+
+TRVIEW_BENCHMARK(SyntheticLevelOpenTomb5)
+{
+    benchmark_open(state, LevelVersion::Tomb5, "synthetic.trc");
+}
+
+TRVIEW_BENCHMARK(SyntheticLevelWrite)
+{
+    const auto content = generate_level(large_level);
+    state.set_items_per_iteration(large_level.rooms);
+    state.run([&]() { trview::benchmarks::do_not_optimise(write_level(content, LevelVersion::Tomb4).size()); });
+}
@@ -0,0 +1,76 @@
+#include <optional>
+#include <span>
+#include <unordered_map>
+
+#include <SimpleMath.h>
+#include <trview.app/Geometry/Model/AnimationEngine.h>
+
+using namespace trview;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    /// Roughly the shape of Lara: fifteen meshes and a long looping animation.
+    constexpr uint32_t mesh_count = 15;
+    constexpr uint32_t keyframe_count = 40;
+    constexpr uint32_t frame_rate = 2;
+
+    AnimationEngine::Data create_data()
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> angle(0.0f, DirectX::XM_2PI);
+
+        AnimationEngine::Data data;
+        data.skeletons = { { .first_node = 0, .mesh_count = mesh_count, .clip = 0 } };
+        data.skeletons_by_type[0] = 0;
+        data.nodes.push_back({ .parent = -1 });
+        for (uint32_t m = 1; m < mesh_count; ++m)
+        {
+            // Three limbs branching from the root.
+            const int32_t parent = m % 5 == 1 ? 0 : static_cast<int32_t>(m - 1);
+            data.nodes.push_back({ .parent = parent, .offset = Vector3(0.0f, 0.1f, 0.05f) });
+        }
+
+        data.clips = { { .first_keyframe = 0, .keyframe_count = keyframe_count, .frame_rate = frame_rate, .frame_count = (keyframe_count - 1) * frame_rate + 1, .next_clip = 0 } };
+        for (uint32_t k = 0; k < keyframe_count; ++k)
+        {
+            data.keyframe_offsets.push_back(Vector3(0.0f, angle(random) * 0.01f, 0.0f));
+            data.keyframe_rotations.push_back(static_cast<uint32_t>(data.rotations_x.size()));
+            for (uint32_t m = 0; m < mesh_count; ++m)
+            {
+                data.rotations_x.push_back(angle(random));
+                data.rotations_y.push_back(angle(random));
+                data.rotations_z.push_back(angle(random));
+            }
+        }
+        return data;
+    }
+
+    void animation_benchmark(trview::benchmarks::State& state, uint32_t entity_count)
+    {
+        AnimationEngine engine(create_data());
+        std::vector<uint32_t> instances;
+        for (uint32_t i = 0; i < entity_count; ++i)
+        {
+            instances.push_back(engine.add(0).value());
+        }
+
+        state.set_items_per_iteration(entity_count);
+        state.set_counter("meshes", entity_count * mesh_count);
+        state.run([&]()
+            {
+                engine.update(1.0f / 60.0f, instances);
+                trview::benchmarks::do_not_optimise(engine.pose(instances.back()).front());
+            });
+    }
+}
+
+TRVIEW_BENCHMARK(AnimateEntities10)
+{
+    animation_benchmark(state, 10);
+}
+
+TRVIEW_BENCHMARK(AnimateEntities500)
+{
+    animation_benchmark(state, 500);
+}
@@ -0,0 +1,86 @@
+#include <trview.app/Filters/Filters.h>
+
+using namespace trview;
+
+namespace
+{
+    /// Roughly the shape of an entity as the items window sees it.
+    struct Object : public IFilterable
+    {
+        int32_t number = 0;
+        std::string type;
+        float x = 0;
+        std::vector<float> triggers;
+
+        int32_t filterable_index() const override
+        {
+            return number;
+        }
+    };
+
+    constexpr uint32_t object_count = 10000;
+    const std::vector<std::string> types{ "Lara", "Door", "Switch", "Key", "Wolf", "Bear", "Block", "Trapdoor" };
+
+    std::vector<Object> create_objects()
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> position(0.0f, 100000.0f);
+
+        std::vector<Object> objects;
+        for (uint32_t i = 0; i < object_count; ++i)
+        {
+            Object object;
+            object.number = static_cast<int32_t>(i);
+            object.type = types[random() % types.size()];
+            object.x = position(random);
+            const uint32_t trigger_count = random() % 4;
+            for (uint32_t t = 0; t < trigger_count; ++t)
+            {
+                object.triggers.push_back(static_cast<float>(random() % 1000));
+            }
+            objects.push_back(object);
+        }
+        return objects;
+    }
+
+    Filters::Filter make_filter(const std::string& key, CompareOp compare, const std::string& value, Op op)
+    {
+        Filters::Filter filter;
+        filter.key = key;
+        filter.compare = compare;
+        filter.value = value;
+        filter.op = op;
+        return filter;
+    }
+}
+
+TRVIEW_BENCHMARK(FiltersMatch)
+{
+    const auto objects = create_objects();
+
+    Filters filters;
+    filters.add_getters(Filters::GettersBuilder()
+        .with_getter<Object, std::string>("Type", [](auto&& o) { return o.type; })
+        .with_getter<Object, float>("X", [](auto&& o) { return o.x; })
+        .with_multi_getter<Object, float>("Triggers", [](auto&& o) { return o.triggers; })
+        .build());
+    // Doors or switches in the first half of the level that have a trigger.
+    filters.set_filters(
+        {
+            make_filter("Type", CompareOp::Equal, "Door", Op::Or),
+            make_filter("Type", CompareOp::StartsWith, "Sw", Op::And),
+            make_filter("X", CompareOp::LessThan, "50000", Op::And),
+            make_filter("Triggers", CompareOp::Exists, "", Op::And)
+        });
+
+    state.set_items_per_iteration(object_count);
+    state.run([&]()
+        {
+            uint32_t matches = 0;
+            for (const auto& object : objects)
+            {
+                matches += filters.match(object);
+            }
+            trview::benchmarks::do_not_optimise(matches);
+        });
+}
@@ -0,0 +1,110 @@
+#include <trview.app/Elements/Level.h>
+#include <trlevel/Mocks/ILevel.h>
+#include <trview.app/Mocks/Elements/ICameraSink.h>
+#include <trview.app/Mocks/Elements/IFlyby.h>
+#include <trview.app/Mocks/Elements/IItem.h>
+#include <trview.app/Mocks/Elements/ILevelNameLookup.h>
+#include <trview.app/Mocks/Elements/ILight.h>
+#include <trview.app/Mocks/Elements/INgPlusSwitcher.h>
+#include <trview.app/Mocks/Elements/IRoom.h>
+#include <trview.app/Mocks/Elements/ISector.h>
+#include <trview.app/Mocks/Elements/ISoundSource.h>
+#include <trview.app/Mocks/Elements/ITrigger.h>
+#include <trview.app/Mocks/Geometry/IAnimationEngine.h>
+#include <trview.app/Mocks/Geometry/IModelStorage.h>
+#include <trview.app/Mocks/Geometry/ITransparencyBuffer.h>
+#include <trview.app/Mocks/Graphics/ILevelTextureStorage.h>
+#include <trview.app/Mocks/Graphics/IMeshStorage.h>
+#include <trview.app/Mocks/Graphics/ISelectionRenderer.h>
+#include <trview.app/Mocks/Sound/ISoundStorage.h>
+#include <trview.common/Mocks/Logs/ILog.h>
+#include <trview.common/Mocks/Messages/IMessageSystem.h>
+#include <trview.graphics/mocks/IBuffer.h>
+#include <trview.graphics/mocks/IDevice.h>
+#include <trview.graphics/mocks/ISamplerState.h>
+#include <trview.graphics/mocks/IShaderStorage.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::graphics::mocks;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace testing;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    /// A row of rooms where each room shares its last column of sectors with the first column of the next room,
+    /// so that every room has two neighbours and some triangles to deduplicate.
+    constexpr uint32_t room_count = 64;
+    constexpr uint16_t sectors_per_side = 16;
+
+    std::vector<std::shared_ptr<MockRoom>> create_rooms()
+    {
+        std::vector<std::shared_ptr<MockRoom>> rooms;
+        for (uint32_t r = 0; r < room_count; ++r)
+        {
+            std::vector<std::shared_ptr<ISector>> sectors;
+            for (uint16_t x = 0; x < sectors_per_side; ++x)
+            {
+                for (uint16_t z = 0; z < sectors_per_side; ++z)
+                {
+                    const Vector3 corner(x, 0, z);
+                    auto sector = mock_shared<MockSector>();
+                    ON_CALL(*sector, triangles).WillByDefault(Return(std::vector<ISector::Triangle>
+                        {
+                            { corner, corner + Vector3(1, 0, 0), corner + Vector3(0, 0, 1), SectorFlag::None, r },
+                            { corner + Vector3(1, 0, 0), corner + Vector3(1, 0, 1), corner + Vector3(0, 0, 1), SectorFlag::None, r }
+                        }));
+                    sectors.push_back(sector);
+                }
+            }
+
+            std::set<uint16_t> neighbours;
+            if (r > 0)
+            {
+                neighbours.insert(static_cast<uint16_t>(r - 1));
+            }
+            if (r + 1 < room_count)
+            {
+                neighbours.insert(static_cast<uint16_t>(r + 1));
+            }
+
+            auto room = mock_shared<MockRoom>()->with_number(r)->with_room_info({ .x = static_cast<int32_t>(r * (sectors_per_side - 1) * trlevel::Scale_X) });
+            ON_CALL(*room, sectors).WillByDefault(Return(sectors));
+            ON_CALL(*room, neighbours).WillByDefault(Return(neighbours));
+            rooms.push_back(room);
+        }
+        return rooms;
+    }
+}
+
+/// Initialising a level is dominated by Level::deduplicate_triangles, which compares every sector triangle in a room
+/// with every sector triangle in each of its neighbours.
+TRVIEW_BENCHMARK(LevelDeduplicateTriangles)
+{
+    const auto rooms = create_rooms();
+    state.set_items_per_iteration(room_count);
+    state.set_counter("triangles", static_cast<double>(room_count * sectors_per_side * sectors_per_side * 2));
+    state.run([&]()
+        {
+            auto level = mock_unique<trlevel::mocks::MockLevel>();
+            ON_CALL(*level, num_rooms).WillByDefault(Return(room_count));
+
+            auto new_level = std::make_shared<Level>(mock_shared<MockDevice>(), mock_shared<MockShaderStorage>(), mock_shared<MockLevelTextureStorage>(),
+                mock_unique<MockTransparencyBuffer>(), mock_unique<MockSelectionRenderer>(), mock_shared<MockLog>(),
+                [](auto&&...) { return mock_unique<MockBuffer>(); }, mock_shared<MockSoundStorage>(), mock_shared<MockNgPlusSwitcher>(),
+                mock_shared<MockSamplerState>(), mock_shared<MockLevelNameLookup>(), mock_shared<MockMessageSystem>());
+            new_level->initialise(std::move(level), mock_shared<MockMeshStorage>(), mock_shared<MockModelStorage>(), [](auto&&...) { return mock_shared<MockAnimationEngine>(); },
+                [](auto&&...) { return mock_shared<MockItem>(); },
+                [](auto&&...) { return mock_shared<MockItem>(); },
+                [&](auto&&, auto&&, auto&&, auto&&, uint32_t index, auto&&...) { return rooms[index]; },
+                [](auto&&...) { return mock_shared<MockTrigger>(); },
+                [](auto&&...) { return mock_shared<MockLight>(); },
+                [](auto&&...) { return mock_shared<MockCameraSink>(); },
+                [](auto&&...) { return mock_shared<MockSoundSource>(); },
+                [](auto&&...) { return mock_shared<MockFlyby>(); },
+                {});
+            trview::benchmarks::do_not_optimise(new_level->number_of_rooms());
+        });
+}
@@ -0,0 +1,123 @@
+#include <trview.app/Lua/Elements/Level/Lua_Level.h>
+#include <trview.app/Lua/Elements/Sector/Lua_Sector.h>
+#include <trview.app/Mocks/Elements/ILevel.h>
+#include <trview.app/Mocks/Elements/IRoom.h>
+#include <trview.app/Mocks/Elements/ISector.h>
+#include <trview.tests.common/Mocks.h>
+#include <external/lua/src/lua.h>
+#include <external/lua/src/lauxlib.h>
+#include <external/lua/src/lualib.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace testing;
+
+namespace
+{
+    constexpr uint32_t room_count = 64;
+    constexpr uint32_t sectors_per_room = 256;
+
+    struct Scene
+    {
+        std::shared_ptr<MockLevel> level;
+        std::vector<std::shared_ptr<MockRoom>> rooms;
+    };
+
+    Scene create_scene()
+    {
+        Scene scene{ .level = mock_shared<MockLevel>() };
+        std::vector<std::weak_ptr<IRoom>> rooms;
+        for (uint32_t r = 0; r < room_count; ++r)
+        {
+            std::vector<std::shared_ptr<ISector>> sectors;
+            for (uint32_t s = 0; s < sectors_per_room; ++s)
+            {
+                sectors.push_back(mock_shared<MockSector>()->with_id(s));
+            }
+
+            auto room = mock_shared<MockRoom>()->with_number(r);
+            ON_CALL(*room, sectors).WillByDefault(Return(sectors));
+            scene.rooms.push_back(room);
+            rooms.push_back(room);
+        }
+        ON_CALL(*scene.level, rooms).WillByDefault(Return(rooms));
+        return scene;
+    }
+
+    void run_script(lua_State* L, const char* script)
+    {
+        if (luaL_dostring(L, script) != 0)
+        {
+            throw std::exception(lua_tostring(L, -1));
+        }
+        trview::benchmarks::do_not_optimise(lua_tointeger(L, -1));
+        lua_settop(L, 0);
+    }
+}
+
+TRVIEW_BENCHMARK(LuaIterateSectors)
+{
+    const auto scene = create_scene();
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+    lua::create_level(L, scene.level);
+    lua_setglobal(L, "level");
+
+    state.set_items_per_iteration(room_count * sectors_per_room);
+    state.run([&]()
+        {
+            run_script(L,
+                "local total = 0 "
+                "for _, room in ipairs(level.rooms) do "
+                "  for _, sector in ipairs(room.sectors) do total = total + sector.number end "
+                "end "
+                "return total");
+        });
+    lua_close(L);
+}
+
+TRVIEW_BENCHMARK(LuaIndexSectors)
+{
+    const auto scene = create_scene();
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+    lua::create_level(L, scene.level);
+    lua_setglobal(L, "level");
+
+    // Reading the collection again for each element is common in scripts and used to rebuild it every time.
+    state.set_items_per_iteration(room_count * sectors_per_room);
+    state.run([&]()
+        {
+            run_script(L,
+                "local total = 0 "
+                "for r = 1, #level.rooms do "
+                "  for s = 1, #level.rooms[r].sectors do total = total + level.rooms[r].sectors[s].number end "
+                "end "
+                "return total");
+        });
+    lua_close(L);
+}
+
+TRVIEW_BENCHMARK(LuaPropertyReads)
+{
+    constexpr uint32_t reads = 100000;
+    auto sector = mock_shared<MockSector>()->with_id(1);
+    lua_State* L = luaL_newstate();
+    luaL_openlibs(L);
+    lua::create_sector(L, sector);
+    lua_setglobal(L, "sector");
+
+    // Reading has_flag doesn't call the sector, so it is only the cost of finding the property.
+    state.set_items_per_iteration(reads * 4);
+    state.run([&]()
+        {
+            run_script(L,
+                "local total = 0 "
+                "for i = 1, 100000 do "
+                "  if sector.has_flag then total = total + sector.number + sector.x + sector.z end "
+                "end "
+                "return total");
+        });
+    lua_close(L);
+}
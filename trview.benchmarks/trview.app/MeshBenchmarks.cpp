@@ -0,0 +1,56 @@
+#include <trview.app/Geometry/Mesh.h>
+#include <trview.app/Mocks/Graphics/ITextureStorage.h>
+#include <trview.graphics/mocks/IDevice.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::graphics::mocks;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    /// A flat grid of quads, about the number of collision triangles in a large room.
+    constexpr uint32_t grid_size = 64;
+    constexpr uint32_t ray_count = 256;
+
+    std::vector<Triangle> create_grid()
+    {
+        std::vector<Triangle> triangles;
+        for (uint32_t x = 0; x < grid_size; ++x)
+        {
+            for (uint32_t z = 0; z < grid_size; ++z)
+            {
+                const Vector3 corner(static_cast<float>(x), 0, static_cast<float>(z));
+                triangles.push_back({ .vertices = { corner, corner + Vector3(1, 0, 0), corner + Vector3(0, 0, 1) } });
+                triangles.push_back({ .vertices = { corner + Vector3(1, 0, 0), corner + Vector3(1, 0, 1), corner + Vector3(0, 0, 1) } });
+            }
+        }
+        return triangles;
+    }
+}
+
+TRVIEW_BENCHMARK(MeshPick)
+{
+    const auto triangles = create_grid();
+    Mesh mesh(mock_shared<MockDevice>(), triangles, mock_shared<MockTextureStorage>());
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> position(0.0f, static_cast<float>(grid_size));
+    std::vector<Vector3> origins;
+    for (uint32_t r = 0; r < ray_count; ++r)
+    {
+        origins.push_back(Vector3(position(random), 1.0f, position(random)));
+    }
+
+    state.set_items_per_iteration(ray_count);
+    state.set_counter("triangles", static_cast<double>(triangles.size()));
+    state.run([&]()
+        {
+            for (const auto& origin : origins)
+            {
+                trview::benchmarks::do_not_optimise(mesh.pick(origin, Vector3(0, -1, 0)));
+            }
+        });
+}
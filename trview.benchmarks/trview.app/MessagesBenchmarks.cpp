@@ -0,0 +1,118 @@
+#include <trview.app/Messages/Messages.h>
+#include <trview.app/Settings/UserSettings.h>
+#include <trview.common/Messages/MessageSystem.h>
+#include <format>
+
+using namespace trview;
+
+namespace
+{
+    /// Stands in for a window that keeps its own copy of the settings, like most of the real recipients.
+    struct SettingsRecipient final : public IRecipient
+    {
+        void receive_message(const Message& message) override
+        {
+            if (auto new_settings = messages::read_settings(message))
+            {
+                settings = *new_settings;
+            }
+            else if (auto room = messages::read_select_room(message))
+            {
+                selected = room.value();
+            }
+        }
+
+        std::optional<std::vector<MessageType>> message_types() const override
+        {
+            return std::vector<MessageType>{ messages::types::select_room, messages::types::settings };
+        }
+
+        UserSettings settings;
+        std::weak_ptr<IRoom> selected;
+    };
+
+    /// Stands in for a recipient that only cares about one kind of selection.
+    struct SelectionRecipient final : public IRecipient
+    {
+        void receive_message(const Message& message) override
+        {
+            if (auto item = messages::read_select_item(message))
+            {
+                selected = item.value();
+            }
+        }
+
+        std::optional<std::vector<MessageType>> message_types() const override
+        {
+            return std::vector<MessageType>{ messages::types::select_item };
+        }
+
+        std::weak_ptr<IItem> selected;
+    };
+
+    /// About as many recipients as the application has with a few windows open.
+    constexpr uint32_t settings_recipients = 20;
+    constexpr uint32_t selection_recipients = 10;
+    constexpr uint32_t storm_size = 100;
+
+    std::vector<std::shared_ptr<IRecipient>> add_recipients(MessageSystem& messaging)
+    {
+        std::vector<std::shared_ptr<IRecipient>> recipients;
+        for (uint32_t i = 0; i < settings_recipients; ++i)
+        {
+            recipients.push_back(std::make_shared<SettingsRecipient>());
+        }
+        for (uint32_t i = 0; i < selection_recipients; ++i)
+        {
+            recipients.push_back(std::make_shared<SelectionRecipient>());
+        }
+        for (const auto& recipient : recipients)
+        {
+            messaging.add_recipient(recipient);
+        }
+        return recipients;
+    }
+
+    UserSettings create_settings()
+    {
+        UserSettings settings;
+        for (int i = 0; i < 10; ++i)
+        {
+            settings.add_recent_file(std::format("C:\\Levels\\level{}.tr2", i));
+        }
+        return settings;
+    }
+}
+
+TRVIEW_BENCHMARK(MessagesSettingsStorm)
+{
+    auto messaging = std::make_shared<MessageSystem>();
+    const auto recipients = add_recipients(*messaging);
+
+    auto settings = create_settings();
+    state.set_items_per_iteration(storm_size);
+    state.run([&]()
+        {
+            // Something like dragging a slider in the settings window.
+            for (uint32_t i = 0; i < storm_size; ++i)
+            {
+                settings.camera_sensitivity = static_cast<float>(i);
+                messages::send_settings(messaging, settings);
+            }
+        });
+}
+
+TRVIEW_BENCHMARK(MessagesSelectionStorm)
+{
+    auto messaging = std::make_shared<MessageSystem>();
+    const auto recipients = add_recipients(*messaging);
+
+    state.set_items_per_iteration(storm_size);
+    state.run([&]()
+        {
+            for (uint32_t i = 0; i < storm_size; ++i)
+            {
+                messages::send_select_item(messaging, std::weak_ptr<IItem>{});
+            }
+        });
+}
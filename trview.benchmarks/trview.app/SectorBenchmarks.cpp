@@ -0,0 +1,91 @@
+#include <trlevel/Decrypter.h>
+#include <trlevel/Hasher.h>
+#include <trlevel/Level.h>
+#include <trlevel/LevelWriter.h>
+#include <trview.app/Elements/Floordata.h>
+#include <trview.app/Elements/Sector.h>
+#include <trview.app/Mocks/Elements/IRoom.h>
+#include <trview.common/Mocks/IFiles.h>
+#include <trview.common/Mocks/Logs/ILog.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace testing;
+
+namespace
+{
+    /// Every sector has a floor and a third of them have a trigger, which is denser than most shipped levels.
+    constexpr trlevel::SyntheticLevelCounts counts
+    {
+        .rooms = 64,
+        .sectors = 16,
+        .entities = 256,
+        .triggers = 64 * 16 * 16 / 3
+    };
+
+    std::shared_ptr<trlevel::Level> load_level()
+    {
+        const std::string filename = "synthetic.tr4";
+        auto files = mock_shared<MockFiles>();
+        ON_CALL(*files, load_file(An<const std::string&>())).WillByDefault(Return(std::nullopt));
+        ON_CALL(*files, load_file(filename)).WillByDefault(Return(trlevel::write_level(trlevel::generate_level(counts), trlevel::LevelVersion::Tomb4)));
+
+        auto level = std::make_shared<trlevel::Level>(filename, nullptr, files, std::make_shared<trlevel::Decrypter>(), mock_shared<MockLog>(), std::make_shared<trlevel::Hasher>(), nullptr);
+        level->load({ .on_textile_callback = [](auto&&...) {}, .on_sound_callback = [](auto&&...) {} });
+        return level;
+    }
+}
+
+TRVIEW_BENCHMARK(ParseFloordata)
+{
+    const auto level = load_level();
+    const auto floor_data = level->get_floor_data_all();
+    const auto version = level->platform_and_version();
+
+    std::vector<uint32_t> indices;
+    for (uint32_t r = 0; r < level->num_rooms(); ++r)
+    {
+        for (const auto& sector : level->get_room(r).sector_list)
+        {
+            indices.push_back(sector.floordata_index);
+        }
+    }
+
+    state.set_items_per_iteration(indices.size());
+    state.set_counter("floordata", static_cast<double>(floor_data.size()));
+    state.run([&]()
+        {
+            for (const auto index : indices)
+            {
+                trview::benchmarks::do_not_optimise(parse_floordata(floor_data, index, FloordataMeanings::None, false, version));
+            }
+        });
+}
+
+TRVIEW_BENCHMARK(SectorConstruction)
+{
+    const auto level = load_level();
+    std::vector<trlevel::tr3_room> rooms;
+    std::vector<std::shared_ptr<MockRoom>> room_ptrs;
+    for (uint32_t r = 0; r < level->num_rooms(); ++r)
+    {
+        rooms.push_back(level->get_room(r));
+        room_ptrs.push_back(mock_shared<MockRoom>()->with_number(r));
+    }
+
+    state.set_items_per_iteration(rooms.size() * counts.sectors * counts.sectors);
+    state.run([&]()
+        {
+            uint32_t number = 0;
+            for (std::size_t r = 0; r < rooms.size(); ++r)
+            {
+                for (std::size_t s = 0; s < rooms[r].sector_list.size(); ++s)
+                {
+                    Sector sector(*level, rooms[r], rooms[r].sector_list[s], static_cast<int>(s), room_ptrs[r], number++);
+                    trview::benchmarks::do_not_optimise(sector.flags());
+                }
+            }
+        });
+}
@@ -0,0 +1,59 @@
+#include <trview.app/Geometry/TransparencyBuffer.h>
+#include <trview.app/Mocks/Graphics/ITextureStorage.h>
+#include <trview.graphics/mocks/IDevice.h>
+#include <trview.tests.common/Mocks.h>
+
+using namespace trview;
+using namespace trview::graphics::mocks;
+using namespace trview::mocks;
+using namespace trview::tests;
+using namespace DirectX::SimpleMath;
+
+namespace
+{
+    constexpr uint32_t triangle_count = 20000;
+    constexpr uint32_t texture_count = 16;
+
+    std::vector<Triangle> create_triangles()
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::uniform_int_distribution<uint32_t> texture(0, texture_count - 1);
+
+        std::vector<Triangle> triangles;
+        for (uint32_t t = 0; t < triangle_count; ++t)
+        {
+            const Vector3 corner(position(random), position(random), position(random));
+            triangles.push_back(
+                {
+                    .frames = { { .texture = texture(random) } },
+                    .transparency_mode = t % 4 ? Triangle::TransparencyMode::Normal : Triangle::TransparencyMode::Additive,
+                    .vertices = { corner, corner + Vector3(1, 0, 0), corner + Vector3(0, 0, 1) }
+                });
+        }
+        return triangles;
+    }
+}
+
+/// The work done for every frame: collect the transparent triangles and sort them from the camera.
+TRVIEW_BENCHMARK(TransparencyBufferSort)
+{
+    const auto triangles = create_triangles();
+    auto texture_storage = mock_shared<MockTextureStorage>();
+    TransparencyBuffer buffer(mock_shared<MockDevice>(), texture_storage);
+
+    // Move the camera each time so that the triangles are never already in order.
+    const std::array<Vector3, 4> eyes{ Vector3(-60, 0, 0), Vector3(60, 0, 0), Vector3(0, 0, -60), Vector3(0, 0, 60) };
+    std::size_t eye = 0;
+
+    state.set_items_per_iteration(triangle_count);
+    state.run([&]()
+        {
+            buffer.reset();
+            for (const auto& triangle : triangles)
+            {
+                buffer.add(triangle);
+            }
+            buffer.sort(eyes[eye++ % eyes.size()]);
+        });
+}
@@ -0,0 +1,73 @@
+#include <trview.app/Elements/TypeInfoLookup.h>
+
+using namespace trview;
+using namespace trlevel;
+
+namespace
+{
+    struct Game
+    {
+        std::string_view name;
+        LevelVersion version;
+    };
+
+    constexpr Game games[] =
+    {
+        { "tr1", LevelVersion::Tomb1 },
+        { "tr2", LevelVersion::Tomb2 },
+        { "tr3", LevelVersion::Tomb3 },
+        { "tr4", LevelVersion::Tomb4 },
+        { "tr5", LevelVersion::Tomb5 }
+    };
+
+    uint64_t type_count(std::span<const GameTypeNames> type_names)
+    {
+        uint64_t count = 0;
+        for (const auto& game : type_names)
+        {
+            count += game.types.size();
+        }
+        return count;
+    }
+}
+
+TRVIEW_BENCHMARK(TypeInfoLookupCreate)
+{
+    const auto type_names = embedded_type_names();
+    state.set_items_per_iteration(type_count(type_names));
+    state.set_counter("games", static_cast<double>(type_names.size()));
+    state.run([&]()
+        {
+            TypeInfoLookup lookup(type_names, std::nullopt);
+            trview::benchmarks::do_not_optimise(lookup);
+        });
+}
+
+TRVIEW_BENCHMARK(TypeInfoLookupLookup)
+{
+    const auto type_names = embedded_type_names();
+    const TypeInfoLookup lookup(type_names, std::nullopt);
+
+    // Every type of the retail games, which is what a level load asks for an item at a time.
+    std::vector<std::pair<PlatformAndVersion, uint32_t>> requests;
+    for (const auto& game : games)
+    {
+        const auto game_types = std::ranges::find(type_names, game.name, &GameTypeNames::game);
+        if (game_types != type_names.end())
+        {
+            for (const auto& type : game_types->types)
+            {
+                requests.push_back({ { .version = game.version }, type.id });
+            }
+        }
+    }
+
+    state.set_items_per_iteration(requests.size());
+    state.run([&]()
+        {
+            for (const auto& [version, id] : requests)
+            {
+                trview::benchmarks::do_not_optimise(lookup.lookup(version, id, 0));
+            }
+        });
+}
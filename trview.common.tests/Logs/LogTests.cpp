@@ -52,4 +52,130 @@ TEST(Log, Clear)
     ASSERT_EQ(log.messages().size(), 1u);
     log.clear();
     ASSERT_EQ(log.messages().size(), 0u);
-}
\ No newline at end of file
+}
+
+TEST(Log, TraceEventsInMessages)
+{
+    Log log;
+    log.log(LogMessage::Status::Information, "topic", "activity", "first");
+    const int64_t value = 5;
+    log.trace(log.trace_scope("topic", { "activity", "child" }), "Traced {}", 0, { &value, 1 });
+    log.log(LogMessage::Status::Information, "topic", "activity", "last");
+
+    auto messages = log.messages("topic", "activity");
+    ASSERT_EQ(messages.size(), 3u);
+    ASSERT_EQ(messages[0].text, "first");
+    ASSERT_EQ(messages[1].text, "[0] Traced 5");
+    ASSERT_EQ(messages[1].status, LogMessage::Status::Information);
+    std::vector<std::string> expected_activity{ "activity", "child" };
+    ASSERT_EQ(messages[1].activity, expected_activity);
+    ASSERT_EQ(messages[2].text, "last");
+}
+
+TEST(Log, TraceOnlyTopicsListed)
+{
+    Log log;
+    const int64_t value = 5;
+    log.trace(log.trace_scope("topic", { "activity" }), "Traced {}", 0, { &value, 1 });
+    std::vector<std::string> expected_topics{ "topic" };
+    ASSERT_EQ(log.topics(), expected_topics);
+    std::vector<std::string> expected_activities{ "activity" };
+    ASSERT_EQ(log.activities("topic"), expected_activities);
+}
+
+TEST(Log, ClearRemovesTraceEvents)
+{
+    Log log;
+    const int64_t value = 5;
+    log.trace(log.trace_scope("topic", { "activity" }), "Traced {}", 0, { &value, 1 });
+    ASSERT_EQ(log.messages().size(), 1u);
+    log.clear();
+    ASSERT_EQ(log.messages().size(), 0u);
+}
+
+TEST(Log, MessagesSince)
+{
+    Log log;
+    log.log(LogMessage::Status::Information, "topic", "activity", "first");
+    auto messages = log.messages_since(0);
+    ASSERT_EQ(messages.size(), 1u);
+    const auto sequence = messages[0].sequence;
+
+    log.log(LogMessage::Status::Information, "topic", "activity", "second");
+    log.log(LogMessage::Status::Information, "topic", "activity 2", "third");
+    messages = log.messages_since(sequence);
+    ASSERT_EQ(messages.size(), 2u);
+    ASSERT_EQ(messages[0].text, "second");
+    ASSERT_EQ(messages[1].text, "third");
+    ASSERT_GT(messages[0].sequence, sequence);
+    ASSERT_GT(messages[1].sequence, messages[0].sequence);
+
+    messages = log.messages_since(sequence, "topic", "activity");
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].text, "second");
+    ASSERT_TRUE(log.messages_since(messages[0].sequence, "topic", "activity").empty());
+}
+
+TEST(Log, OldestMessagesDropped)
+{
+    Log log(16);
+    for (int i = 0; i < 100; ++i)
+    {
+        log.log(LogMessage::Status::Information, "topic", i < 50 ? "old" : "new", std::to_string(i));
+    }
+
+    auto messages = log.messages();
+    ASSERT_LE(messages.size(), 16u);
+    ASSERT_GE(messages.size(), 14u);
+    ASSERT_EQ(messages.back().text, "99");
+    ASSERT_EQ(messages.front().sequence, log.first_sequence());
+    for (std::size_t i = 1; i < messages.size(); ++i)
+    {
+        ASSERT_EQ(messages[i].sequence, messages[i - 1].sequence + 1);
+    }
+
+    std::vector<std::string> expected_activities{ "new" };
+    ASSERT_EQ(log.activities("topic"), expected_activities);
+    ASSERT_TRUE(log.messages("topic", "old").empty());
+    ASSERT_EQ(log.messages("topic", "new").size(), messages.size());
+}
+
+TEST(Log, UnreadMessagesBounded)
+{
+    Log log(16);
+    for (int i = 0; i < 1000; ++i)
+    {
+        log.log(LogMessage::Status::Information, "topic", "activity", std::to_string(i));
+    }
+
+    // The store is full and less than a segment is waiting to be moved into it.
+    ASSERT_LT(log.retained(), 32u);
+    ASSERT_EQ(log.messages().back().text, "999");
+    ASSERT_LE(log.retained(), 16u);
+}
+
+TEST(Log, TopicRemovedWhenAllMessagesDropped)
+{
+    Log log(16);
+    log.log(LogMessage::Status::Information, "old", "activity", "text");
+    for (int i = 0; i < 32; ++i)
+    {
+        log.log(LogMessage::Status::Information, "new", "activity", "text");
+    }
+    std::vector<std::string> expected_topics{ "new" };
+    ASSERT_EQ(log.topics(), expected_topics);
+}
+
+TEST(Log, ClearMovesFirstSequence)
+{
+    Log log;
+    log.log(LogMessage::Status::Information, "topic", "activity", "text");
+    const auto sequence = log.messages()[0].sequence;
+    log.clear();
+    ASSERT_GT(log.first_sequence(), sequence);
+    log.log(LogMessage::Status::Information, "topic", "activity", "text 2");
+    auto messages = log.messages_since(sequence);
+    ASSERT_EQ(messages.size(), 1u);
+    ASSERT_EQ(messages[0].text, "text 2");
+    ASSERT_GT(messages[0].sequence, sequence);
+}
@@ -0,0 +1,151 @@
+#include <trview.common/Logs/Trace.h>
+#include <external/nlohmann/json.hpp>
+#include <set>
+#include <thread>
+
+using namespace trview;
+
+namespace
+{
+    void record(Trace& trace, uint32_t scope, const char* format, uint64_t offset, std::initializer_list<int64_t> values)
+    {
+        trace.record(scope, format, offset, std::span<const int64_t>(values.begin(), values.size()));
+    }
+}
+
+TEST(Trace, ScopesAreReused)
+{
+    Trace trace;
+    const auto first = trace.scope("topic", { "activity" });
+    const auto second = trace.scope("topic", { "activity", "child" });
+    ASSERT_NE(first, second);
+    ASSERT_EQ(trace.scope("topic", { "activity" }), first);
+
+    const auto scopes = trace.scopes();
+    ASSERT_EQ(scopes.size(), 2u);
+    ASSERT_EQ(scopes[second].topic, "topic");
+    std::vector<std::string> expected{ "activity", "child" };
+    ASSERT_EQ(scopes[second].activity, expected);
+}
+
+TEST(Trace, EventsRecorded)
+{
+    Trace trace;
+    const auto scope = trace.scope("topic", { "activity" });
+    record(trace, scope, "Reading {} rooms", 10, { 5 });
+    record(trace, scope, "Read {} of {}", 20, { 1, 2 });
+
+    const auto events = trace.events();
+    ASSERT_EQ(events.size(), 2u);
+    ASSERT_EQ(events[0].scope, scope);
+    ASSERT_EQ(events[0].offset, 10u);
+    ASSERT_EQ(format_trace_event(events[0]), "Reading 5 rooms");
+    ASSERT_EQ(events[1].offset, 20u);
+    ASSERT_EQ(format_trace_event(events[1]), "Read 1 of 2");
+    ASSERT_EQ(trace.recorded(), 2u);
+}
+
+TEST(Trace, FormatWithoutValues)
+{
+    TraceEvent event;
+    event.format = "Reading rooms";
+    ASSERT_EQ(format_trace_event(event), "Reading rooms");
+}
+
+TEST(Trace, OldestEventsDropped)
+{
+    Trace trace(4);
+    const auto scope = trace.scope("topic", { "activity" });
+    for (int64_t i = 0; i < 10; ++i)
+    {
+        record(trace, scope, "Event {}", i, { i });
+    }
+
+    const auto events = trace.events();
+    ASSERT_LE(events.size(), 4u);
+    ASSERT_FALSE(events.empty());
+    ASSERT_EQ(events.back().offset, 9u);
+    for (std::size_t i = 1; i < events.size(); ++i)
+    {
+        ASSERT_EQ(events[i].offset, events[i - 1].offset + 1);
+    }
+    ASSERT_EQ(trace.recorded(), 10u);
+}
+
+TEST(Trace, TakeReturnsNewEvents)
+{
+    Trace trace;
+    const auto scope = trace.scope("topic", { "activity" });
+    record(trace, scope, "Event {}", 0, { 1 });
+    ASSERT_EQ(trace.take().size(), 1u);
+    ASSERT_TRUE(trace.take().empty());
+
+    record(trace, scope, "Event {}", 0, { 2 });
+    const auto taken = trace.take();
+    ASSERT_EQ(taken.size(), 1u);
+    ASSERT_EQ(format_trace_event(taken[0]), "Event 2");
+    ASSERT_EQ(trace.events().size(), 2u);
+}
+
+TEST(Trace, Clear)
+{
+    Trace trace;
+    const auto scope = trace.scope("topic", { "activity" });
+    record(trace, scope, "Event {}", 0, { 1 });
+    trace.clear();
+    ASSERT_TRUE(trace.events().empty());
+    ASSERT_EQ(trace.scopes().size(), 1u);
+
+    record(trace, scope, "Event {}", 0, { 2 });
+    const auto events = trace.events();
+    ASSERT_EQ(events.size(), 1u);
+    ASSERT_EQ(format_trace_event(events[0]), "Event 2");
+}
+
+TEST(Trace, EventsFromThreadsMerged)
+{
+    Trace trace;
+    const auto scope = trace.scope("topic", { "activity" });
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&]()
+            {
+                for (int64_t i = 0; i < 100; ++i)
+                {
+                    record(trace, scope, "Event {}", i, { i });
+                }
+            });
+    }
+    threads.clear();
+
+    const auto events = trace.events();
+    ASSERT_EQ(events.size(), 400u);
+    ASSERT_TRUE(std::ranges::is_sorted(events, {}, &TraceEvent::time));
+    std::set<uint32_t> thread_numbers;
+    for (const auto& event : events)
+    {
+        thread_numbers.insert(event.thread);
+    }
+    ASSERT_EQ(thread_numbers.size(), 4u);
+}
+
+TEST(Trace, ChromeJson)
+{
+    Trace trace;
+    const auto scope = trace.scope("Level", { "Load", "Rooms" });
+    record(trace, scope, "Reading {} rooms", 100, { 5 });
+    record(trace, scope, "Read room {}", 200, { 0 });
+
+    const auto json = nlohmann::json::parse(trace.to_chrome_json());
+    const auto& events = json["traceEvents"];
+    ASSERT_EQ(events.size(), 2u);
+    ASSERT_EQ(events[0]["name"], "Reading 5 rooms");
+    ASSERT_EQ(events[0]["cat"], "Level");
+    ASSERT_EQ(events[0]["ph"], "X");
+    ASSERT_EQ(events[0]["args"]["activity"], "Load/Rooms");
+    ASSERT_EQ(events[0]["args"]["offset"], 100);
+    ASSERT_EQ(events[1]["name"], "Read room 0");
+    ASSERT_EQ(events[1]["dur"], 0.0);
+    ASSERT_GE(events[0]["dur"].get<double>(), 0.0);
+}
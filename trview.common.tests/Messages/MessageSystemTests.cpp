@@ -0,0 +1,136 @@
+#include <trview.common/Messages/MessageSystem.h>
+#include <functional>
+
+using namespace trview;
+
+namespace
+{
+    struct Recipient final : public IRecipient
+    {
+        explicit Recipient(std::optional<std::vector<MessageType>> types = std::nullopt)
+            : types(types)
+        {
+        }
+
+        void receive_message(const Message& message) override
+        {
+            received.push_back(message.type);
+            if (on_message)
+            {
+                on_message(message);
+            }
+        }
+
+        std::optional<std::vector<MessageType>> message_types() const override
+        {
+            return types;
+        }
+
+        std::optional<std::vector<MessageType>> types;
+        std::vector<MessageType> received;
+        std::function<void(const Message&)> on_message;
+    };
+}
+
+TEST(MessageType, LiteralMatchesName)
+{
+    constexpr MessageType literal{ "settings" };
+    const std::string name = "settings";
+    ASSERT_EQ(literal, MessageType(name));
+    ASSERT_NE(literal, MessageType("select_item"));
+    static_assert(MessageType("settings").id() == MessageType(std::string_view("settings")).id());
+}
+
+TEST(MessageSystem, SubscribedTypesOnly)
+{
+    MessageSystem messaging;
+    auto recipient = std::make_shared<Recipient>(std::vector<MessageType>{ "settings" });
+    messaging.add_recipient(recipient);
+
+    messaging.send_message({ .type = "select_item" });
+    messaging.send_message({ .type = "settings" });
+
+    std::vector<MessageType> expected{ "settings" };
+    ASSERT_EQ(recipient->received, expected);
+}
+
+TEST(MessageSystem, NoTypesGetsEverything)
+{
+    MessageSystem messaging;
+    auto recipient = std::make_shared<Recipient>();
+    messaging.add_recipient(recipient);
+
+    messaging.send_message({ .type = "select_item" });
+    messaging.send_message({ .type = "settings" });
+
+    std::vector<MessageType> expected{ "select_item", "settings" };
+    ASSERT_EQ(recipient->received, expected);
+}
+
+TEST(MessageSystem, EmptyTypesGetsNothing)
+{
+    MessageSystem messaging;
+    auto recipient = std::make_shared<Recipient>(std::vector<MessageType>{});
+    messaging.add_recipient(recipient);
+    messaging.send_message({ .type = "settings" });
+    ASSERT_TRUE(recipient->received.empty());
+}
+
+TEST(MessageSystem, SentInOrderAdded)
+{
+    MessageSystem messaging;
+    std::vector<int> order;
+    std::vector<std::shared_ptr<Recipient>> recipients
+    {
+        std::make_shared<Recipient>(std::vector<MessageType>{ "settings" }),
+        std::make_shared<Recipient>(),
+        std::make_shared<Recipient>(std::vector<MessageType>{ "select_item", "settings" }),
+        std::make_shared<Recipient>()
+    };
+    for (int i = 0; i < static_cast<int>(recipients.size()); ++i)
+    {
+        recipients[i]->on_message = [&order, i](auto&&) { order.push_back(i); };
+        messaging.add_recipient(recipients[i]);
+    }
+
+    messaging.send_message({ .type = "settings" });
+    std::vector<int> expected{ 0, 1, 2, 3 };
+    ASSERT_EQ(order, expected);
+
+    order.clear();
+    messaging.send_message({ .type = "select_item" });
+    expected = { 1, 2, 3 };
+    ASSERT_EQ(order, expected);
+}
+
+TEST(MessageSystem, ExpiredRecipientsSkipped)
+{
+    MessageSystem messaging;
+    auto recipient = std::make_shared<Recipient>(std::vector<MessageType>{ "settings" });
+    auto other = std::make_shared<Recipient>(std::vector<MessageType>{ "settings" });
+    messaging.add_recipient(recipient);
+    messaging.add_recipient(other);
+    recipient.reset();
+
+    messaging.send_message({ .type = "settings" });
+    ASSERT_EQ(other->received.size(), 1u);
+}
+
+TEST(MessageSystem, RecipientAddedWhileSending)
+{
+    MessageSystem messaging;
+    auto added = std::make_shared<Recipient>(std::vector<MessageType>{ "settings" });
+    auto recipient = std::make_shared<Recipient>(std::vector<MessageType>{ "settings" });
+    recipient->on_message = [&](auto&&)
+        {
+            messaging.add_recipient(added);
+        };
+    messaging.add_recipient(recipient);
+
+    messaging.send_message({ .type = "settings" });
+    ASSERT_TRUE(added->received.empty());
+
+    recipient->on_message = nullptr;
+    messaging.send_message({ .type = "settings" });
+    ASSERT_EQ(added->received.size(), 1u);
+}
@@ -0,0 +1,116 @@
+#include <trview.common/WorkerPool.h>
+#include <atomic>
+#include <latch>
+
+using namespace trview;
+
+TEST(WorkerPool, ReturnsResults)
+{
+    WorkerPool pool(4);
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 20; ++i)
+    {
+        results.push_back(pool.submit([=]() { return i * 2; }));
+    }
+
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_EQ(results[i].get(), i * 2);
+    }
+}
+
+TEST(WorkerPool, ExceptionsAreReturned)
+{
+    WorkerPool pool(1);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("failed"); });
+    ASSERT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(WorkerPool, LimitsConcurrentJobs)
+{
+    WorkerPool pool(2);
+    std::atomic<int> running{ 0 };
+    std::atomic<int> most_running{ 0 };
+
+    std::vector<std::future<void>> results;
+    for (int i = 0; i < 16; ++i)
+    {
+        results.push_back(pool.submit([&]()
+            {
+                const int now = ++running;
+                int most = most_running;
+                while (now > most && !most_running.compare_exchange_weak(most, now))
+                {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                --running;
+            }));
+    }
+
+    for (auto& result : results)
+    {
+        result.get();
+    }
+
+    ASSERT_LE(most_running.load(), 2);
+    ASSERT_LE(pool.threads(), 2u);
+}
+
+TEST(WorkerPool, OnlyStartsThreadsForWork)
+{
+    WorkerPool pool(8);
+    ASSERT_EQ(pool.threads(), 0u);
+    pool.submit([]() {}).get();
+    ASSERT_EQ(pool.threads(), 1u);
+}
+
+TEST(WorkerPool, RaisingLimitRunsWaitingJobs)
+{
+    WorkerPool pool(1);
+    std::latch both_started(2);
+    auto first = pool.submit([&]() { both_started.arrive_and_wait(); });
+    auto second = pool.submit([&]() { both_started.arrive_and_wait(); });
+
+    // With a limit of one the jobs would wait for each other forever.
+    pool.set_limit(2);
+    ASSERT_EQ(first.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    ASSERT_EQ(second.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    ASSERT_EQ(pool.limit(), 2u);
+}
+
+TEST(WorkerPool, CancelDropsWaitingJobsAndWaitsForRunningJobs)
+{
+    WorkerPool pool(1);
+    std::promise<void> started;
+    std::atomic<bool> finished{ false };
+    auto running = pool.submit([&]()
+        {
+            started.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finished = true;
+        });
+    auto waiting = pool.submit([]() {});
+    started.get_future().wait();
+
+    pool.cancel();
+    ASSERT_TRUE(finished);
+    ASSERT_EQ(running.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    ASSERT_THROW(waiting.get(), std::future_error);
+
+    ASSERT_EQ(pool.submit([]() { return 1; }).get(), 1);
+}
+
+TEST(WorkerPool, DestroyingLeavesNoFuturesWaiting)
+{
+    std::future<void> waiting;
+    {
+        WorkerPool pool(1);
+        std::promise<void> release;
+        auto blocker = pool.submit([release = release.get_future()]() mutable { release.wait(); });
+        waiting = pool.submit([]() {});
+        release.set_value();
+        blocker.get();
+    }
+    ASSERT_TRUE(waiting.valid());
+    ASSERT_EQ(waiting.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+}
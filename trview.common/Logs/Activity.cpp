@@ -45,4 +45,16 @@ namespace trview
             _log->log(status, _topic, _names, text);
         }
     }
+
+    void Activity::trace(const char* format, uint64_t offset, std::span<const int64_t> values) const
+    {
+        if (_log)
+        {
+            if (!_trace_scope)
+            {
+                _trace_scope = _log->trace_scope(_topic, _names);
+            }
+            _log->trace(_trace_scope.value(), format, offset, values);
+        }
+    }
 }
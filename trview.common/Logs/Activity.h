@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+#include <span>
 #include "ILog.h"
 
 namespace trview
@@ -27,9 +29,18 @@ namespace trview
         ~Activity();
         void log(const std::string& text) const;
         void log(LogMessage::Status status, const std::string& text) const;
+        /// <summary>
+        /// Record a trace event for this activity. This is much cheaper than log as the text is only formatted
+        /// when the log is read.
+        /// </summary>
+        /// <param name="format">String literal with a {} for each value.</param>
+        /// <param name="offset">Position in the file being read.</param>
+        /// <param name="values">Up to three values to format into the text.</param>
+        void trace(const char* format, uint64_t offset, std::span<const int64_t> values) const;
     private:
         mutable std::shared_ptr<ILog> _log;
         std::string _topic;
         std::vector<std::string> _names;
+        mutable std::optional<uint32_t> _trace_scope;
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include "LogMessage.h"
 
 namespace trview
@@ -11,8 +12,20 @@ namespace trview
         virtual void log(LogMessage::Status status, const std::string& topic, const std::vector<std::string>& activity, const std::string& text) = 0;
         virtual std::vector<LogMessage> messages() const = 0;
         virtual std::vector<LogMessage> messages(const std::string& topic, const std::string& activity) const = 0;
+        /// Messages with a sequence number after the one given.
+        virtual std::vector<LogMessage> messages_since(uint64_t sequence) const = 0;
+        /// Messages for the topic and activity with a sequence number after the one given.
+        virtual std::vector<LogMessage> messages_since(uint64_t sequence, const std::string& topic, const std::string& activity) const = 0;
+        /// Sequence number of the oldest message still in the log. Messages before this have been dropped or cleared.
+        virtual uint64_t first_sequence() const = 0;
         virtual std::vector<std::string> topics() const = 0;
         virtual std::vector<std::string> activities(const std::string& topic) const = 0;
         virtual void clear() = 0;
+        /// Get the id to record trace events against for a topic and activity.
+        virtual uint32_t trace_scope(const std::string& topic, const std::vector<std::string>& activity) = 0;
+        /// Record a trace event. Nothing is formatted until the messages are read, so the format must be a string literal.
+        virtual void trace(uint32_t scope, const char* format, uint64_t offset, std::span<const int64_t> values) = 0;
+        /// Export the trace events in the Chrome trace event format.
+        virtual std::string trace_json() const = 0;
     };
 }
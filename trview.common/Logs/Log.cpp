@@ -1,13 +1,23 @@
 #include "Log.h"
-#include <set>
 #include <format>
 
 namespace trview
 {
+    namespace
+    {
+        constexpr std::size_t max_segment_size = 1024;
+    }
+
     ILog::~ILog()
     {
     }
 
+    Log::Log(std::size_t capacity)
+        : _segment_size(std::clamp<std::size_t>(capacity / 8, 1, max_segment_size)),
+        _max_segments(std::max<std::size_t>(1, capacity / _segment_size))
+    {
+    }
+
     void Log::log(LogMessage::Status status, const std::string& topic, const std::string& activity, const std::string& text)
     {
         log(status, topic, std::vector<std::string>{ activity }, text);
@@ -15,62 +25,212 @@ namespace trview
 
     void Log::log(LogMessage::Status status, const std::string& topic, const std::vector<std::string>& activity, const std::string& text)
     {
-        SYSTEMTIME time;
-        GetLocalTime(&time);
+        const auto now = std::chrono::steady_clock::now();
         std::lock_guard lock{ _mutex };
-        _messages.push_back({
-            status,
-            std::format("{:02d}-{:02d}-{} {:02d}:{:02d}:{:02d}", time.wDay, time.wMonth, time.wYear, time.wHour, time.wMinute, time.wSecond),
-            topic, activity, text });
+        _pending.push_back({ now, { status, {}, topic, activity, text } });
+        if (_pending.size() >= _segment_size)
+        {
+            update();
+        }
     }
 
     std::vector<LogMessage> Log::messages() const
     {
-        std::lock_guard lock{ _mutex };
-        return _messages;
+        return messages_since(0);
     }
 
     std::vector<LogMessage> Log::messages(const std::string& topic, const std::string& activity) const
     {
+        return messages_since(0, topic, activity);
+    }
+
+    std::vector<LogMessage> Log::messages_since(uint64_t sequence) const
+    {
+        std::lock_guard lock{ _mutex };
+        update();
         std::vector<LogMessage> messages;
+        const uint64_t first = std::max(sequence + 1, _first_sequence);
+        if (first < _next_sequence)
         {
-            std::lock_guard lock{ _mutex };
-            std::copy_if(_messages.begin(), _messages.end(), std::back_inserter(messages),
-                [&](const auto& m) { return m.topic == topic &&
-                !m.activity.empty() &&
-                m.activity[0] == activity; });
+            messages.reserve(_next_sequence - first);
+            for (uint64_t i = first; i < _next_sequence; ++i)
+            {
+                messages.push_back(at(i));
+            }
         }
         return messages;
     }
 
+    std::vector<LogMessage> Log::messages_since(uint64_t sequence, const std::string& topic, const std::string& activity) const
+    {
+        std::lock_guard lock{ _mutex };
+        update();
+        std::vector<LogMessage> messages;
+        const auto found_topic = _topics.find(topic);
+        if (found_topic == _topics.end())
+        {
+            return messages;
+        }
+
+        const auto found_activity = found_topic->second.activities.find(activity);
+        if (found_activity == found_topic->second.activities.end())
+        {
+            return messages;
+        }
+
+        const auto& sequences = found_activity->second;
+        for (auto iter = std::ranges::upper_bound(sequences, sequence); iter != sequences.end(); ++iter)
+        {
+            messages.push_back(at(*iter));
+        }
+        return messages;
+    }
+
+    uint64_t Log::first_sequence() const
+    {
+        std::lock_guard lock{ _mutex };
+        update();
+        return _first_sequence;
+    }
+
     std::vector<std::string> Log::topics() const
     {
-        std::set<std::string> all_topics;
         std::lock_guard lock{ _mutex };
-        for (const auto& message : _messages)
+        update();
+        std::vector<std::string> all_topics;
+        all_topics.reserve(_topics.size());
+        for (const auto& [topic, _] : _topics)
         {
-            all_topics.insert(message.topic);
+            all_topics.push_back(topic);
         }
-        return { all_topics.begin(), all_topics.end() };
+        return all_topics;
     }
 
     std::vector<std::string> Log::activities(const std::string& topic) const
     {
-        std::set<std::string> all_activities;
         std::lock_guard lock{ _mutex };
-        for (const auto& message : _messages)
+        update();
+        std::vector<std::string> all_activities;
+        const auto found = _topics.find(topic);
+        if (found != _topics.end())
         {
-            if (message.topic == topic && !message.activity.empty())
+            for (const auto& [activity, _] : found->second.activities)
             {
-                all_activities.insert(message.activity[0]);
+                all_activities.push_back(activity);
             }
         }
-        return { all_activities.begin(), all_activities.end() };
+        return all_activities;
     }
 
     void Log::clear()
     {
         std::lock_guard lock{ _mutex };
-        _messages.clear();
+        _pending.clear();
+        _trace.clear();
+        _segments.clear();
+        _topics.clear();
+        _first_sequence = _next_sequence;
+    }
+
+    uint32_t Log::trace_scope(const std::string& topic, const std::vector<std::string>& activity)
+    {
+        return _trace.scope(topic, activity);
+    }
+
+    void Log::trace(uint32_t scope, const char* format, uint64_t offset, std::span<const int64_t> values)
+    {
+        _trace.record(scope, format, offset, values);
+    }
+
+    std::string Log::trace_json() const
+    {
+        return _trace.to_chrome_json();
+    }
+
+    std::size_t Log::retained() const
+    {
+        std::lock_guard lock{ _mutex };
+        return static_cast<std::size_t>(_next_sequence - _first_sequence) + _pending.size();
+    }
+
+    void Log::update() const
+    {
+        // Scopes are fetched after the events so that every event's scope is included.
+        const auto events = _trace.take();
+        if (_pending.empty() && events.empty())
+        {
+            return;
+        }
+
+        const auto scopes = _trace.scopes();
+        const auto middle = _pending.size();
+        for (const auto& event : events)
+        {
+            const auto& scope = scopes[event.scope];
+            _pending.push_back({ event.time, { LogMessage::Status::Information, {}, scope.topic, scope.activity, std::format("[{}] {}", event.offset, format_trace_event(event)) } });
+        }
+        std::ranges::inplace_merge(_pending, _pending.begin() + middle, {}, &Pending::time);
+
+        const auto zone = std::chrono::current_zone();
+        for (auto& entry : _pending)
+        {
+            const auto time = std::chrono::floor<std::chrono::seconds>(_start_system + std::chrono::duration_cast<std::chrono::system_clock::duration>(entry.time - _start));
+            entry.message.timestamp = std::format("{:%d-%m-%Y %H:%M:%S}", zone->to_local(time));
+            append(std::move(entry.message));
+        }
+        _pending.clear();
+    }
+
+    void Log::append(LogMessage&& message) const
+    {
+        if (_segments.empty() || _segments.back().size() == _segment_size)
+        {
+            if (_segments.size() == _max_segments)
+            {
+                drop_oldest_segment();
+            }
+            _segments.emplace_back().reserve(_segment_size);
+        }
+
+        message.sequence = _next_sequence++;
+        auto& topic = _topics[message.topic];
+        ++topic.count;
+        if (!message.activity.empty())
+        {
+            topic.activities[message.activity[0]].push_back(message.sequence);
+        }
+        _segments.back().push_back(std::move(message));
+    }
+
+    void Log::drop_oldest_segment() const
+    {
+        // Messages are indexed in the order they were added, so the ones being dropped are at the front of each index.
+        for (const auto& message : _segments.front())
+        {
+            auto topic = _topics.find(message.topic);
+            if (!message.activity.empty())
+            {
+                auto activity = topic->second.activities.find(message.activity[0]);
+                activity->second.pop_front();
+                if (activity->second.empty())
+                {
+                    topic->second.activities.erase(activity);
+                }
+            }
+
+            if (--topic->second.count == 0)
+            {
+                _topics.erase(topic);
+            }
+        }
+
+        _first_sequence += _segments.front().size();
+        _segments.pop_front();
+    }
+
+    const LogMessage& Log::at(uint64_t sequence) const
+    {
+        const std::size_t index = static_cast<std::size_t>(sequence - _first_sequence);
+        return _segments[index / _segment_size][index % _segment_size];
     }
 }
@@ -2,23 +2,71 @@
 
 #include "ILog.h"
 #include "LogMessage.h"
+#include "Trace.h"
+#include <chrono>
+#include <deque>
+#include <map>
 #include <mutex>
 
 namespace trview
 {
+    /// Keeps the most recent messages in fixed size segments. When the store is full the oldest segment is dropped,
+    /// so the log holds between capacity - segment size and capacity messages. New messages wait to be timestamped
+    /// until the log is read or a segment's worth have been logged, whichever comes first.
     class Log final : public ILog
     {
     public:
+        static constexpr std::size_t DefaultCapacity = 65536;
+
+        explicit Log(std::size_t capacity = DefaultCapacity);
         virtual ~Log() = default;
         virtual void log(LogMessage::Status status, const std::string& topic, const std::string& activity, const std::string& text) override;
         virtual void log(LogMessage::Status status, const std::string& topic, const std::vector<std::string>& activity, const std::string& text) override;
         virtual std::vector<LogMessage> messages() const override;
         virtual std::vector<LogMessage> messages(const std::string& topic, const std::string& activity) const override;
+        virtual std::vector<LogMessage> messages_since(uint64_t sequence) const override;
+        virtual std::vector<LogMessage> messages_since(uint64_t sequence, const std::string& topic, const std::string& activity) const override;
+        virtual uint64_t first_sequence() const override;
         virtual std::vector<std::string> topics() const override;
         virtual std::vector<std::string> activities(const std::string& topic) const override;
         virtual void clear() override;
+        virtual uint32_t trace_scope(const std::string& topic, const std::vector<std::string>& activity) override;
+        virtual void trace(uint32_t scope, const char* format, uint64_t offset, std::span<const int64_t> values) override;
+        virtual std::string trace_json() const override;
+        /// The number of messages held, including those waiting to be moved into the store.
+        std::size_t retained() const;
     private:
-        std::vector<LogMessage> _messages;
+        struct Pending
+        {
+            std::chrono::steady_clock::time_point time;
+            LogMessage message;
+        };
+
+        struct Topic
+        {
+            std::size_t count{ 0 };
+            /// Sequence numbers of the messages for each activity, oldest first.
+            std::map<std::string, std::deque<uint64_t>> activities;
+        };
+
+        /// Move the messages logged and trace events recorded since the last update into the store, in time order.
+        /// This is where the timestamps are filled in.
+        void update() const;
+        void append(LogMessage&& message) const;
+        void drop_oldest_segment() const;
+        const LogMessage& at(uint64_t sequence) const;
+
+        const std::size_t _segment_size;
+        const std::size_t _max_segments;
+        mutable std::vector<Pending> _pending;
+        mutable Trace _trace;
+        const std::chrono::steady_clock::time_point _start{ std::chrono::steady_clock::now() };
+        const std::chrono::system_clock::time_point _start_system{ std::chrono::system_clock::now() };
+        mutable std::deque<std::vector<LogMessage>> _segments;
+        /// Sequence number of the first message in the first segment.
+        mutable uint64_t _first_sequence{ 1 };
+        mutable uint64_t _next_sequence{ 1 };
+        mutable std::map<std::string, Topic> _topics;
         mutable std::mutex _mutex;
     };
 }
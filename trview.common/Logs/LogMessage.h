@@ -16,5 +16,7 @@ namespace trview
         std::string topic;
         std::vector<std::string> activity;
         std::string text;
+        /// Increases by one for each message added to the log.
+        uint64_t sequence{ 0 };
     };
 }
@@ -0,0 +1,237 @@
+#include "Trace.h"
+#include <atomic>
+#include <format>
+#include <thread>
+#include <external/nlohmann/json.hpp>
+
+namespace trview
+{
+    namespace
+    {
+        std::atomic<uint64_t> next_trace_id{ 1 };
+
+        double microseconds(std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+    }
+
+    struct Trace::Buffer
+    {
+        Buffer(std::thread::id owner, uint32_t number, std::size_t capacity)
+            : owner(owner), number(number), events(capacity)
+        {
+        }
+
+        const std::thread::id owner;
+        const uint32_t number;
+        std::vector<TraceEvent> events;
+        /// Number of events ever recorded. Only the owning thread writes to the buffer.
+        std::atomic<uint64_t> written{ 0 };
+        /// Events recorded before this were cleared.
+        std::atomic<uint64_t> cleared{ 0 };
+        /// Events recorded before this have been taken. Only changed with the trace mutex held.
+        uint64_t taken{ 0 };
+    };
+
+    Trace::Trace(std::size_t capacity)
+        : _id(next_trace_id++), _capacity(std::max<std::size_t>(capacity, 2)), _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    Trace::~Trace()
+    {
+    }
+
+    Trace::Buffer& Trace::buffer()
+    {
+        // Most threads only ever write to one trace, so remember the last buffer used to avoid the lock.
+        static thread_local std::pair<uint64_t, Buffer*> last{ 0, nullptr };
+        if (last.first == _id)
+        {
+            return *last.second;
+        }
+
+        std::lock_guard lock{ _mutex };
+        const auto owner = std::this_thread::get_id();
+        auto existing = std::ranges::find(_buffers, owner, [](auto&& b) { return b->owner; });
+        if (existing == _buffers.end())
+        {
+            _buffers.push_back(std::make_unique<Buffer>(owner, static_cast<uint32_t>(_buffers.size() + 1), _capacity));
+            existing = std::prev(_buffers.end());
+        }
+        last = { _id, existing->get() };
+        return **existing;
+    }
+
+    uint32_t Trace::scope(const std::string& topic, const std::vector<std::string>& activity)
+    {
+        Scope scope{ topic, activity };
+        std::lock_guard lock{ _mutex };
+        const auto existing = _scope_ids.find(scope);
+        if (existing != _scope_ids.end())
+        {
+            return existing->second;
+        }
+
+        const uint32_t id = static_cast<uint32_t>(_scopes.size());
+        _scopes.push_back(scope);
+        _scope_ids[std::move(scope)] = id;
+        return id;
+    }
+
+    std::vector<Trace::Scope> Trace::scopes() const
+    {
+        std::lock_guard lock{ _mutex };
+        return _scopes;
+    }
+
+    void Trace::record(uint32_t scope, const char* format, uint64_t offset, std::span<const int64_t> values)
+    {
+        auto& target = buffer();
+        const uint64_t index = target.written.load(std::memory_order_relaxed);
+        auto& event = target.events[index % _capacity];
+        event.format = format;
+        event.scope = scope;
+        event.thread = target.number;
+        event.offset = offset;
+        event.time = std::chrono::steady_clock::now();
+        event.value_count = static_cast<uint32_t>(std::min(values.size(), TraceEvent::MaxValues));
+        std::copy_n(values.begin(), event.value_count, event.values.begin());
+        target.written.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<TraceEvent> Trace::events() const
+    {
+        std::vector<TraceEvent> results;
+        std::lock_guard lock{ _mutex };
+        for (const auto& buffer : _buffers)
+        {
+            copy_events(*buffer, buffer->cleared.load(std::memory_order_acquire), results);
+        }
+        std::ranges::stable_sort(results, {}, &TraceEvent::time);
+        return results;
+    }
+
+    std::vector<TraceEvent> Trace::take()
+    {
+        std::vector<TraceEvent> results;
+        std::lock_guard lock{ _mutex };
+        for (auto& buffer : _buffers)
+        {
+            buffer->taken = copy_events(*buffer, std::max(buffer->taken, buffer->cleared.load(std::memory_order_acquire)), results);
+        }
+        std::ranges::stable_sort(results, {}, &TraceEvent::time);
+        return results;
+    }
+
+    uint64_t Trace::copy_events(const Buffer& buffer, uint64_t from, std::vector<TraceEvent>& results) const
+    {
+        const uint64_t written = buffer.written.load(std::memory_order_acquire);
+        const uint64_t first = std::max(written > _capacity ? written - _capacity : 0, from);
+        std::vector<TraceEvent> copied;
+        for (uint64_t i = first; i < written; ++i)
+        {
+            copied.push_back(buffer.events[i % _capacity]);
+        }
+
+        // The owning thread may have carried on writing during the copy, in which case the oldest events
+        // copied could have been overwritten - including the slot that it is writing to now. The fence keeps
+        // the copy above from being reordered after the second read of the count.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t written_after = buffer.written.load(std::memory_order_relaxed);
+        const uint64_t valid_from = written_after + 1 > _capacity ? written_after + 1 - _capacity : 0;
+        const auto skip = std::min<uint64_t>(valid_from > first ? valid_from - first : 0, copied.size());
+        results.insert(results.end(), copied.begin() + skip, copied.end());
+        return written;
+    }
+
+    uint64_t Trace::recorded() const
+    {
+        uint64_t total = 0;
+        std::lock_guard lock{ _mutex };
+        for (const auto& buffer : _buffers)
+        {
+            total += buffer->written.load(std::memory_order_acquire);
+        }
+        return total;
+    }
+
+    void Trace::clear()
+    {
+        std::lock_guard lock{ _mutex };
+        for (auto& buffer : _buffers)
+        {
+            buffer->cleared.store(buffer->written.load(std::memory_order_acquire), std::memory_order_release);
+        }
+    }
+
+    std::string Trace::to_chrome_json() const
+    {
+        const auto all_events = events();
+        const auto all_scopes = scopes();
+
+        std::map<uint32_t, std::vector<const TraceEvent*>> by_thread;
+        for (const auto& event : all_events)
+        {
+            by_thread[event.thread].push_back(&event);
+        }
+
+        nlohmann::ordered_json trace_events = nlohmann::ordered_json::array();
+        for (const auto& [thread, thread_events] : by_thread)
+        {
+            for (std::size_t i = 0; i < thread_events.size(); ++i)
+            {
+                const auto& event = *thread_events[i];
+                const auto& event_scope = event.scope < all_scopes.size() ? all_scopes[event.scope] : Scope{};
+                std::string activity;
+                for (const auto& name : event_scope.activity)
+                {
+                    activity += (activity.empty() ? "" : "/") + name;
+                }
+
+                nlohmann::ordered_json entry;
+                entry["name"] = format_trace_event(event);
+                entry["cat"] = event_scope.topic;
+                entry["ph"] = "X";
+                entry["ts"] = microseconds(event.time - _start);
+                entry["dur"] = i + 1 < thread_events.size() ? microseconds(thread_events[i + 1]->time - event.time) : 0.0;
+                entry["pid"] = 1;
+                entry["tid"] = thread;
+                entry["args"] = { { "activity", activity }, { "offset", event.offset } };
+                trace_events.push_back(entry);
+            }
+        }
+
+        nlohmann::ordered_json json;
+        json["traceEvents"] = trace_events;
+        json["displayTimeUnit"] = "ms";
+        return json.dump();
+    }
+
+    std::string format_trace_event(const TraceEvent& event)
+    {
+        if (!event.format)
+        {
+            return {};
+        }
+
+        auto values = event.values;
+        try
+        {
+            switch (event.value_count)
+            {
+            case 1:
+                return std::vformat(event.format, std::make_format_args(values[0]));
+            case 2:
+                return std::vformat(event.format, std::make_format_args(values[0], values[1]));
+            case 3:
+                return std::vformat(event.format, std::make_format_args(values[0], values[1], values[2]));
+            }
+        }
+        catch (const std::format_error&)
+        {
+        }
+        return event.format;
+    }
+}
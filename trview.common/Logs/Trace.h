@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace trview
+{
+    /// Fixed size record of something that happened during a load. The text is only made when the event is read.
+    struct TraceEvent
+    {
+        static constexpr std::size_t MaxValues = 3;
+
+        /// Format string with a {} for each value. This is not copied so it must be a string literal.
+        const char* format{ nullptr };
+        uint32_t scope{ 0 };
+        uint32_t thread{ 0 };
+        /// Position in the file being read when the event was recorded.
+        uint64_t offset{ 0 };
+        std::chrono::steady_clock::time_point time;
+        std::array<int64_t, MaxValues> values{};
+        uint32_t value_count{ 0 };
+    };
+
+    /// Records trace events into a ring buffer for each thread that writes to it. Recording an event doesn't
+    /// allocate, format or take a lock, so it can be done for every section of a level. When a thread records
+    /// more events than its buffer holds the oldest are dropped.
+    class Trace final
+    {
+    public:
+        struct Scope
+        {
+            std::string topic;
+            std::vector<std::string> activity;
+
+            auto operator<=>(const Scope&) const = default;
+        };
+
+        static constexpr std::size_t DefaultCapacity = 16384;
+
+        explicit Trace(std::size_t capacity = DefaultCapacity);
+        Trace(const Trace&) = delete;
+        Trace& operator=(const Trace&) = delete;
+        ~Trace();
+        /// Get the id to record events against for a topic and activity. The same id is returned for the same topic and activity.
+        uint32_t scope(const std::string& topic, const std::vector<std::string>& activity);
+        /// All scopes, indexed by id.
+        std::vector<Scope> scopes() const;
+        void record(uint32_t scope, const char* format, uint64_t offset, std::span<const int64_t> values);
+        /// All events that are still held, from all threads, oldest first.
+        std::vector<TraceEvent> events() const;
+        /// Events recorded since the last call to take, from all threads, oldest first.
+        std::vector<TraceEvent> take();
+        /// Total number of events recorded by all threads, including any that have since been dropped or cleared.
+        uint64_t recorded() const;
+        /// Drop all recorded events. Scopes are kept.
+        void clear();
+        /// Convert the events to the Chrome trace event format, to be viewed in chrome://tracing or Perfetto.
+        /// Each event lasts until the next event on the same thread.
+        std::string to_chrome_json() const;
+    private:
+        struct Buffer;
+        Buffer& buffer();
+        /// Copy the events from the buffer that were recorded after from and are still held. Returns the number written.
+        uint64_t copy_events(const Buffer& buffer, uint64_t from, std::vector<TraceEvent>& results) const;
+
+        const uint64_t _id;
+        const std::size_t _capacity;
+        const std::chrono::steady_clock::time_point _start;
+        mutable std::mutex _mutex;
+        std::vector<std::unique_ptr<Buffer>> _buffers;
+        std::vector<Scope> _scopes;
+        std::map<Scope, uint32_t> _scope_ids;
+    };
+
+    /// Fill in the values in the event's format string.
+    std::string format_trace_event(const TraceEvent& event);
+}
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+#include "Message.h"
+
 namespace trview
 {
-    struct Message;
-
     struct IRecipient
     {
         virtual ~IRecipient() = 0;
         virtual void receive_message(const Message& message) = 0;
+        /// The types of message that the recipient handles. Messages of other types are not sent to it.
+        /// If this is nullopt the recipient is sent every message.
+        virtual std::optional<std::vector<MessageType>> message_types() const;
     };
 }
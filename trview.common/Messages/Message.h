@@ -1,15 +1,57 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace trview
 {
+    /// Identifies a type of message by a hash of its name. When the name is a string literal the hash is worked out
+    /// when compiling, so comparing two types is an integer comparison.
+    class MessageType final
+    {
+    public:
+        constexpr MessageType() = default;
+
+        template <std::size_t N>
+        consteval MessageType(const char(&name)[N])
+            : _id(hash(std::string_view(name, N - 1)))
+        {
+        }
+
+        constexpr explicit MessageType(std::string_view name)
+            : _id(hash(name))
+        {
+        }
+
+        constexpr uint32_t id() const
+        {
+            return _id;
+        }
+
+        constexpr bool operator==(const MessageType&) const = default;
+    private:
+        /// FNV-1a.
+        static constexpr uint32_t hash(std::string_view name)
+        {
+            uint32_t result = 2166136261u;
+            for (const char c : name)
+            {
+                result = (result ^ static_cast<uint8_t>(c)) * 16777619u;
+            }
+            return result;
+        }
+
+        uint32_t _id{ 0 };
+    };
+
     struct IMessageData
     {
         virtual ~IMessageData() = 0;
     };
 
+    /// Message payload. The same data is shared by every recipient of a message so it can't be changed.
     template <typename T>
     struct MessageData : public IMessageData
     {
@@ -20,12 +62,12 @@ namespace trview
         {
         }
 
-        T value;
+        const T value;
     };
 
     struct Message
     {
-        std::string type;
+        MessageType type;
         std::shared_ptr<IMessageData> data;
     };
 }
@@ -15,19 +15,75 @@ namespace trview
     {
     }
 
+    std::optional<std::vector<MessageType>> IRecipient::message_types() const
+    {
+        return std::nullopt;
+    }
+
     void MessageSystem::send_message(const Message& message)
     {
-        for (const auto& recipient : _recipients)
+        const auto found = _subscribers.find(message.type.id());
+        const std::vector<Subscriber>* subscribers = found == _subscribers.end() ? nullptr : &found->second;
+
+        // Recipients can send messages or add recipients while handling a message, so go by index and
+        // only send this message to the recipients that were there when it was sent.
+        ++_sending;
+        const std::size_t typed_count = subscribers ? subscribers->size() : 0;
+        const std::size_t all_count = _all.size();
+        std::size_t typed = 0;
+        std::size_t all = 0;
+        while (typed < typed_count || all < all_count)
         {
+            const bool use_typed = all == all_count || (typed < typed_count && (*subscribers)[typed].order < _all[all].order);
+            const auto recipient = use_typed ? (*subscribers)[typed++].recipient : _all[all++].recipient;
             if (auto recipient_ptr = recipient.lock())
             {
                 recipient_ptr->receive_message(message);
             }
         }
+        --_sending;
     }
 
     void MessageSystem::add_recipient(const std::weak_ptr<IRecipient>& recipient)
     {
-        _recipients.push_back(recipient);
+        const auto recipient_ptr = recipient.lock();
+        if (!recipient_ptr)
+        {
+            return;
+        }
+
+        remove_expired();
+
+        const Subscriber subscriber{ _next_order++, recipient };
+        const auto types = recipient_ptr->message_types();
+        if (!types)
+        {
+            _all.push_back(subscriber);
+            return;
+        }
+
+        for (const auto& type : types.value())
+        {
+            auto& subscribers = _subscribers[type.id()];
+            if (subscribers.empty() || subscribers.back().order != subscriber.order)
+            {
+                subscribers.push_back(subscriber);
+            }
+        }
+    }
+
+    void MessageSystem::remove_expired()
+    {
+        if (_sending)
+        {
+            return;
+        }
+
+        const auto expired = [](const Subscriber& s) { return s.recipient.expired(); };
+        std::erase_if(_all, expired);
+        for (auto& [_, subscribers] : _subscribers)
+        {
+            std::erase_if(subscribers, expired);
+        }
     }
 }
@@ -4,11 +4,13 @@
 
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 namespace trview
 {
     struct IRecipient;
 
+    /// Sends each message to the recipients that handle its type, in the order that they were added.
     class MessageSystem final : public IMessageSystem
     {
     public:
@@ -16,6 +18,19 @@ namespace trview
         void send_message(const Message& message) override;
         void add_recipient(const std::weak_ptr<IRecipient>& recipient) override;
     private:
-        std::vector<std::weak_ptr<IRecipient>> _recipients;
+        struct Subscriber
+        {
+            uint64_t order;
+            std::weak_ptr<IRecipient> recipient;
+        };
+
+        void remove_expired();
+
+        uint64_t _next_order{ 0 };
+        /// How many messages are being sent. Recipients aren't removed while sending as that would move the others.
+        uint32_t _sending{ 0 };
+        /// Recipients that are sent every message.
+        std::vector<Subscriber> _all;
+        std::unordered_map<uint32_t, std::vector<Subscriber>> _subscribers;
     };
 }
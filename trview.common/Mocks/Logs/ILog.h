@@ -14,9 +14,15 @@ namespace trview
             MOCK_METHOD(void, log, (LogMessage::Status, const std::string&, const std::vector<std::string>&, const std::string&), (override));
             MOCK_METHOD(std::vector<LogMessage>, messages, (), (const, override));
             MOCK_METHOD(std::vector<LogMessage>, messages, (const std::string&, const std::string&), (const, override));
+            MOCK_METHOD(std::vector<LogMessage>, messages_since, (uint64_t), (const, override));
+            MOCK_METHOD(std::vector<LogMessage>, messages_since, (uint64_t, const std::string&, const std::string&), (const, override));
+            MOCK_METHOD(uint64_t, first_sequence, (), (const, override));
             MOCK_METHOD(std::vector<std::string>, topics, (), (const, override));
             MOCK_METHOD(std::vector<std::string>, activities, (const std::string&), (const, override));
             MOCK_METHOD(void, clear, (), (override));
+            MOCK_METHOD(uint32_t, trace_scope, (const std::string&, const std::vector<std::string>&), (override));
+            MOCK_METHOD(void, trace, (uint32_t, const char*, uint64_t, std::span<const int64_t>), (override));
+            MOCK_METHOD(std::string, trace_json, (), (const, override));
         };
     }
 }
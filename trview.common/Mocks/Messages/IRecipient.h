@@ -11,6 +11,7 @@ namespace trview
             MockRecipient();
             virtual ~MockRecipient();
             MOCK_METHOD(void, receive_message, (const Message&), (override));
+            MOCK_METHOD(std::optional<std::vector<MessageType>>, message_types, (), (const, override));
         };
     }
 }
@@ -5,6 +5,7 @@
 
 namespace trview
 {
+#ifdef _WIN32
     std::string to_utf8(const std::wstring& value)
     {
         std::vector<char> output(WideCharToMultiByte(CP_UTF8, 0, value.c_str(), -1, nullptr, 0, nullptr, nullptr), 0);
@@ -24,6 +25,18 @@ namespace trview
         }
         return &output[0];
     }
+#else
+    std::string to_utf8(const std::wstring& value)
+    {
+        const auto result = std::filesystem::path(value).u8string();
+        return { result.begin(), result.end() };
+    }
+
+    std::wstring to_utf16(const std::string& value)
+    {
+        return std::filesystem::path(std::u8string(value.begin(), value.end())).wstring();
+    }
+#endif
 
     std::string format_binary(uint16_t value)
     {
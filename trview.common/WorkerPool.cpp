@@ -0,0 +1,99 @@
+#include "WorkerPool.h"
+
+namespace trview
+{
+    WorkerPool::WorkerPool(uint32_t limit)
+        : _limit(std::max(1u, limit))
+    {
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        std::deque<std::move_only_function<void()>> dropped;
+        {
+            std::lock_guard lock{ _mutex };
+            _stopping = true;
+            dropped.swap(_jobs);
+        }
+        _condition.notify_all();
+        _threads.clear();
+    }
+
+    uint32_t WorkerPool::limit() const
+    {
+        std::lock_guard lock{ _mutex };
+        return _limit;
+    }
+
+    void WorkerPool::set_limit(uint32_t limit)
+    {
+        {
+            std::lock_guard lock{ _mutex };
+            _limit = std::max(1u, limit);
+            start_threads();
+        }
+        _condition.notify_all();
+    }
+
+    std::size_t WorkerPool::threads() const
+    {
+        std::lock_guard lock{ _mutex };
+        return _threads.size();
+    }
+
+    void WorkerPool::cancel()
+    {
+        std::deque<std::move_only_function<void()>> dropped;
+        std::unique_lock lock{ _mutex };
+        dropped.swap(_jobs);
+        _idle.wait(lock, [this]() { return _active == 0; });
+    }
+
+    void WorkerPool::add(std::move_only_function<void()> job)
+    {
+        {
+            std::lock_guard lock{ _mutex };
+            _jobs.push_back(std::move(job));
+            start_threads();
+        }
+        _condition.notify_one();
+    }
+
+    void WorkerPool::start_threads()
+    {
+        // Only start as many threads as there is work for - idle threads already started will pick up jobs first.
+        const std::size_t wanted = std::min<std::size_t>(_limit, _active + _jobs.size());
+        while (_threads.size() < wanted)
+        {
+            _threads.emplace_back([this]() { work(); });
+        }
+    }
+
+    void WorkerPool::work()
+    {
+        std::unique_lock lock{ _mutex };
+        while (true)
+        {
+            _condition.wait(lock, [this]() { return _stopping || (!_jobs.empty() && _active < _limit); });
+            if (_stopping)
+            {
+                return;
+            }
+
+            auto job = std::move(_jobs.front());
+            _jobs.pop_front();
+            ++_active;
+            lock.unlock();
+            job();
+            job = nullptr;
+            lock.lock();
+            --_active;
+            // The limit may have been lowered while this job was running, in which case another thread could be waiting for this one.
+            _condition.notify_one();
+            if (_active == 0)
+            {
+                _idle.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace trview
+{
+    /// Runs jobs on a limited number of threads. Threads are started when there are jobs waiting for them,
+    /// up to the limit, and are kept for later jobs. Jobs run in the order they were submitted.
+    class WorkerPool final
+    {
+    public:
+        explicit WorkerPool(uint32_t limit);
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+        /// Waits for the running jobs to finish. Jobs that haven't started are dropped, so their futures report a broken promise.
+        ~WorkerPool();
+        /// The most jobs that will run at the same time.
+        uint32_t limit() const;
+        /// Change the most jobs that will run at the same time. Jobs that are already running are not affected.
+        void set_limit(uint32_t limit);
+        /// Number of threads that have been started.
+        std::size_t threads() const;
+        /// Drops the jobs that haven't started and waits for the running jobs to finish. The pool can be used again afterwards.
+        void cancel();
+        template <typename Func>
+        std::future<std::invoke_result_t<Func>> submit(Func&& func);
+    private:
+        void add(std::move_only_function<void()> job);
+        void start_threads();
+        void work();
+
+        mutable std::mutex _mutex;
+        std::condition_variable _condition;
+        std::condition_variable _idle;
+        std::deque<std::move_only_function<void()>> _jobs;
+        std::vector<std::jthread> _threads;
+        uint32_t _limit;
+        uint32_t _active{ 0 };
+        bool _stopping{ false };
+    };
+
+    template <typename Func>
+    std::future<std::invoke_result_t<Func>> WorkerPool::submit(Func&& func)
+    {
+        std::packaged_task<std::invoke_result_t<Func>()> task(std::forward<Func>(func));
+        auto future = task.get_future();
+        add([task = std::move(task)]() mutable { task(); });
+        return future;
+    }
+}
@@ -10,7 +10,7 @@ namespace trview
         {
             for (const auto& message : messages)
             {
-                if (message.type == type)
+                if (message.type == MessageType(type))
                 {
                     return message;
                 }
@@ -22,7 +22,7 @@ namespace trview
         {
             for (const auto& message : messages)
             {
-                if (message.type == type)
+                if (message.type == MessageType(type))
                 {
                     return message;
                 }
@@ -35,7 +35,7 @@ namespace trview
             std::optional<trview::Message> result;
             for (const auto& message : messages)
             {
-                if (message.type == type)
+                if (message.type == MessageType(type))
                 {
                     result = message;
                 }
@@ -47,7 +47,7 @@ namespace trview
         {
             for (const auto& message : messages | std::views::reverse)
             {
-                if (message.type == type)
+                if (message.type == MessageType(type))
                 {
                     return message;
                 }